@@ -48,7 +48,9 @@
 #include <librepcb/core/project/erc/ercmsglist.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectloader.h>
+#include <librepcb/core/project/projectmemoryreport.h>
 #include <librepcb/core/project/schematic/schematicpainter.h>
+#include <librepcb/core/utils/timingrecorder.h>
 
 #include <QtCore>
 
@@ -95,6 +97,12 @@ int CommandLineInterface::execute() noexcept {
   parser.addOption(versionOption);
   QCommandLineOption verboseOption({"v", "verbose"}, tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption traceOption(
+      "trace",
+      tr("Record the duration of all performed operations and write them "
+         "as Chrome trace JSON to the given file."),
+      tr("file"));
+  parser.addOption(traceOption);
   parser.addPositionalArgument("command",
                                tr("The command to execute (see list below)."));
   positionalArgNames.append("command");
@@ -178,6 +186,10 @@ int CommandLineInterface::execute() noexcept {
       tr("Fail if the project files are not strictly canonical, i.e. "
          "there would be changes when saving the project. Note that "
          "this option is not available for *.lppz files."));
+  QCommandLineOption memoryReportOption(
+      "memory-report",
+      tr("Print the approximate memory usage of the opened project, split "
+         "into its subsystems."));
 
   // Define options for "open-library"
   QCommandLineOption libAllOption(
@@ -233,6 +245,7 @@ int CommandLineInterface::execute() noexcept {
     parser.addOption(removeOtherBoardsOption);
     parser.addOption(saveOption);
     parser.addOption(prjStrictOption);
+    parser.addOption(memoryReportOption);
   } else if (command == "open-library") {
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
@@ -270,6 +283,11 @@ int CommandLineInterface::execute() noexcept {
     Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::All);
   }
 
+  // --trace
+  if (parser.isSet(traceOption)) {
+    TimingRecorder::instance().start();
+  }
+
   // --help (also shown if no arguments supplied)
   if (parser.isSet(helpOption) || (args.count() <= 1)) {
     print(helpText);
@@ -322,7 +340,8 @@ int CommandLineInterface::execute() noexcept {
         parser.values(boardIndexOption),  // board indices
         parser.isSet(removeOtherBoardsOption),  // remove other boards
         parser.isSet(saveOption),  // save project
-        parser.isSet(prjStrictOption)  // strict mode
+        parser.isSet(prjStrictOption),  // strict mode
+        parser.isSet(memoryReportOption)  // print memory report
     );
   } else if (command == "open-library") {
     cmdSuccess = openLibrary(positionalArgs.value(1),  // library directory
@@ -333,6 +352,18 @@ int CommandLineInterface::execute() noexcept {
   } else {
     printErr("Internal failure.");  // No tr() because this cannot occur.
   }
+  if (parser.isSet(traceOption)) {
+    TimingRecorder::instance().stop();
+    const QString traceFile = parser.value(traceOption);
+    const FilePath fp(QFileInfo(traceFile).absoluteFilePath());
+    print(tr("Write trace to '%1'...").arg(prettyPath(fp, traceFile)));
+    try {
+      TimingRecorder::instance().writeChromeTrace(fp);  // can throw
+    } catch (const Exception& e) {
+      printErr(tr("ERROR: %1").arg(e.getMsg()));
+      cmdSuccess = false;
+    }
+  }
   if (cmdSuccess) {
     print(tr("SUCCESS"));
     return 0;
@@ -354,7 +385,7 @@ bool CommandLineInterface::openProject(
     const QStringList& exportPnpTopFiles,
     const QStringList& exportPnpBottomFiles, const QStringList& boardNames,
     const QStringList& boardIndices, bool removeOtherBoards, bool save,
-    bool strict) const noexcept {
+    bool strict, bool memoryReport) const noexcept {
   try {
     bool success = true;
     QMap<FilePath, int> writtenFilesCounter;
@@ -685,6 +716,15 @@ bool CommandLineInterface::openProject(
       }
     }
 
+    // Print memory report
+    if (memoryReport) {
+      print(tr("Memory usage (approximate):"));
+      const ProjectMemoryReport report(*project);
+      foreach (const QString& line, report.toString().split("\n")) {
+        print("  " % line);
+      }
+    }
+
     // Save project
     if (save) {
       print(tr("Save project..."));
@@ -67,7 +67,7 @@ private:  // Methods
                    const QStringList& exportPnpBottomFiles,
                    const QStringList& boardNames,
                    const QStringList& boardIndices, bool removeOtherBoards,
-                   bool save, bool strict) const noexcept;
+                   bool save, bool strict, bool memoryReport) const noexcept;
   bool openLibrary(const QString& libDir, bool all, bool save,
                    bool strict) const noexcept;
   void processLibraryElement(const QString& libDir, TransactionalFileSystem& fs,
@@ -24,6 +24,7 @@
 #include <librepcb/core/debug.h>
 #include <librepcb/core/exceptions.h>
 #include <librepcb/core/network/networkaccessmanager.h>
+#include <librepcb/core/utils/timingrecorder.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacesettings.h>
 #include <librepcb/editor/dialogs/directorylockhandlerdialog.h>
@@ -68,6 +69,13 @@ int main(int argc, char* argv[]) {
   // (organization + name).
   Debug::instance();
 
+  // Record the duration of operations (e.g. opening projects) if requested by
+  // environment variable. The trace is written when the application exits.
+  const QString traceFile = qgetenv("LIBREPCB_TRACE_FILE");
+  if (!traceFile.isEmpty()) {
+    TimingRecorder::instance().start();
+  }
+
   // Configure the application settings format and location used by QSettings
   configureApplicationSettings();
 
@@ -91,6 +99,18 @@ int main(int argc, char* argv[]) {
   // Stop network access manager thread
   networkAccessManager.reset();
 
+  // Write recorded trace, if enabled.
+  if (!traceFile.isEmpty()) {
+    TimingRecorder::instance().stop();
+    try {
+      const FilePath fp(QFileInfo(traceFile).absoluteFilePath());
+      qInfo() << "Write trace to" << fp.toNative();
+      TimingRecorder::instance().writeChromeTrace(fp);  // can throw
+    } catch (const Exception& e) {
+      qCritical() << "Failed to write trace:" << e.getMsg();
+    }
+  }
+
   qDebug().nospace() << "Exit application with code " << retval << ".";
   return retval;
 }
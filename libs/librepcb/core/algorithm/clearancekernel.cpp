@@ -0,0 +1,261 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "clearancekernel.h"
+
+#include <QtCore>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ClearanceKernel::ClearanceKernel() noexcept {
+}
+
+ClearanceKernel::~ClearanceKernel() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+int ClearanceKernel::addCircle(int group, const Point& center,
+                               const UnsignedLength& diameter) noexcept {
+  return addObject(group, {center}, diameter->toNm() / qreal(2));
+}
+
+int ClearanceKernel::addCapsule(int group, const Point& p1, const Point& p2,
+                                const UnsignedLength& width) noexcept {
+  return addObject(group, {p1, p2}, width->toNm() / qreal(2));
+}
+
+int ClearanceKernel::addConvexPolygon(int group,
+                                      const QVector<Point>& vertices,
+                                      const UnsignedLength& width) noexcept {
+  Q_ASSERT(!vertices.isEmpty());
+  return addObject(group, vertices, width->toNm() / qreal(2));
+}
+
+Length ClearanceKernel::calcDistance(int object1, int object2) const noexcept {
+  const qreal distance = calcHullDistance(object1, object2) -
+      mRadii.at(object1) - mRadii.at(object2);
+  return Length(std::max(qRound64(distance), qint64(0)));
+}
+
+QVector<ClearanceKernel::Violation> ClearanceKernel::findViolations(
+    const UnsignedLength& clearance) const noexcept {
+  const qreal c = clearance->toNm();
+  const int count = getCount();
+
+  // Sort objects by the left edge of their bounding boxes and copy the
+  // bounding boxes into contiguous arrays in that order, so the sweep below
+  // only touches sequential memory.
+  QVector<int> order(count);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [this](int a, int b) { return mMinX.at(a) < mMinX.at(b); });
+  QVector<qreal> minX(count), maxX(count), minY(count), maxY(count);
+  QVector<int> groups(count);
+  for (int i = 0; i < count; ++i) {
+    const int object = order.at(i);
+    minX[i] = mMinX.at(object);
+    maxX[i] = mMaxX.at(object);
+    minY[i] = mMinY.at(object);
+    maxY[i] = mMaxY.at(object);
+    groups[i] = mGroups.at(object);
+  }
+
+  // Sweep and prune. Since the distance is compared with a tolerance of
+  // half a nanometer, touching objects with exactly the required clearance
+  // are not reported due to floating point inaccuracy.
+  QVector<Violation> violations;
+  for (int i = 0; i < count; ++i) {
+    const qreal xLimit = maxX.at(i) + c;
+    const qreal yMin = minY.at(i) - c;
+    const qreal yMax = maxY.at(i) + c;
+    const int group = groups.at(i);
+    for (int k = i + 1; (k < count) && (minX.at(k) < xLimit); ++k) {
+      if ((groups.at(k) == group) || (minY.at(k) >= yMax) ||
+          (maxY.at(k) <= yMin)) {
+        continue;
+      }
+      const int o1 = std::min(order.at(i), order.at(k));
+      const int o2 = std::max(order.at(i), order.at(k));
+      const qreal distance =
+          calcHullDistance(o1, o2) - mRadii.at(o1) - mRadii.at(o2);
+      if (distance + qreal(0.5) < c) {
+        violations.append(Violation{o1, o2});
+      }
+    }
+  }
+  std::sort(violations.begin(), violations.end(),
+            [](const Violation& a, const Violation& b) {
+              return (a.object1 != b.object1) ? (a.object1 < b.object1)
+                                              : (a.object2 < b.object2);
+            });
+  return violations;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+int ClearanceKernel::addObject(int group, const QVector<Point>& points,
+                               qreal radius) noexcept {
+  const int index = getCount();
+  mGroups.append(group);
+  mRadii.append(radius);
+  mFirstVertex.append(mX.count());
+  mVertexCount.append(points.count());
+  qreal minX = std::numeric_limits<qreal>::max();
+  qreal minY = std::numeric_limits<qreal>::max();
+  qreal maxX = std::numeric_limits<qreal>::lowest();
+  qreal maxY = std::numeric_limits<qreal>::lowest();
+  for (const Point& p : points) {
+    const qreal x = p.getX().toNm();
+    const qreal y = p.getY().toNm();
+    mX.append(x);
+    mY.append(y);
+    minX = std::min(minX, x);
+    minY = std::min(minY, y);
+    maxX = std::max(maxX, x);
+    maxY = std::max(maxY, y);
+  }
+  mMinX.append(minX - radius);
+  mMinY.append(minY - radius);
+  mMaxX.append(maxX + radius);
+  mMaxY.append(maxY + radius);
+  return index;
+}
+
+qreal ClearanceKernel::calcHullDistance(int object1, int object2) const
+    noexcept {
+  const int first1 = mFirstVertex.at(object1);
+  const int first2 = mFirstVertex.at(object2);
+  const int count1 = mVertexCount.at(object1);
+  const int count2 = mVertexCount.at(object2);
+
+  // If one polygon is completely inside the other one, no edges intersect.
+  if ((count1 >= 3) && containsPoint(object1, mX.at(first2), mY.at(first2))) {
+    return 0;
+  }
+  if ((count2 >= 3) && containsPoint(object2, mX.at(first1), mY.at(first1))) {
+    return 0;
+  }
+
+  // Otherwise it's the minimum distance between all edges. A single vertex
+  // is handled as a zero-length edge, and polygons are implicitly closed.
+  const int edges1 = (count1 >= 3) ? count1 : 1;
+  const int edges2 = (count2 >= 3) ? count2 : 1;
+  qreal distance = std::numeric_limits<qreal>::max();
+  for (int i = 0; i < edges1; ++i) {
+    const int a = first1 + i;
+    const int b = first1 + ((i + 1) % count1);
+    for (int k = 0; k < edges2; ++k) {
+      const int c = first2 + k;
+      const int d = first2 + ((k + 1) % count2);
+      distance = std::min(
+          distance,
+          calcSegmentDistance(mX.at(a), mY.at(a), mX.at(b), mY.at(b),
+                              mX.at(c), mY.at(c), mX.at(d), mY.at(d)));
+      if (distance <= 0) {
+        return 0;
+      }
+    }
+  }
+  return distance;
+}
+
+bool ClearanceKernel::containsPoint(int object, qreal x, qreal y) const
+    noexcept {
+  // The point is inside a convex polygon if it is on the same side of all
+  // edges, independent of the polygon orientation.
+  const int first = mFirstVertex.at(object);
+  const int count = mVertexCount.at(object);
+  bool hasPositive = false;
+  bool hasNegative = false;
+  for (int i = 0; i < count; ++i) {
+    const int a = first + i;
+    const int b = first + ((i + 1) % count);
+    const qreal cross = (mX.at(b) - mX.at(a)) * (y - mY.at(a)) -
+        (mY.at(b) - mY.at(a)) * (x - mX.at(a));
+    hasPositive = hasPositive || (cross > 0);
+    hasNegative = hasNegative || (cross < 0);
+  }
+  return !(hasPositive && hasNegative);
+}
+
+qreal ClearanceKernel::calcSegmentDistance(qreal ax, qreal ay, qreal bx,
+                                           qreal by, qreal cx, qreal cy,
+                                           qreal dx, qreal dy) noexcept {
+  // Proper intersection of the segments AB and CD?
+  const qreal d1 = (dx - cx) * (ay - cy) - (dy - cy) * (ax - cx);
+  const qreal d2 = (dx - cx) * (by - cy) - (dy - cy) * (bx - cx);
+  const qreal d3 = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+  const qreal d4 = (bx - ax) * (dy - ay) - (by - ay) * (dx - ax);
+  if ((((d1 > 0) && (d2 < 0)) || ((d1 < 0) && (d2 > 0))) &&
+      (((d3 > 0) && (d4 < 0)) || ((d3 < 0) && (d4 > 0)))) {
+    return 0;
+  }
+
+  // Otherwise (including touching and collinear segments) the minimum
+  // distance is between an end point and the other segment.
+  const qreal distanceSq = std::min(
+      std::min(calcPointSegmentDistanceSq(ax, ay, cx, cy, dx, dy),
+               calcPointSegmentDistanceSq(bx, by, cx, cy, dx, dy)),
+      std::min(calcPointSegmentDistanceSq(cx, cy, ax, ay, bx, by),
+               calcPointSegmentDistanceSq(dx, dy, ax, ay, bx, by)));
+  return std::sqrt(distanceSq);
+}
+
+qreal ClearanceKernel::calcPointSegmentDistanceSq(qreal px, qreal py,
+                                                  qreal ax, qreal ay,
+                                                  qreal bx, qreal by) noexcept {
+  const qreal vx = bx - ax;
+  const qreal vy = by - ay;
+  const qreal wx = px - ax;
+  const qreal wy = py - ay;
+  const qreal lengthSq = vx * vx + vy * vy;
+  qreal t = 0;
+  if (lengthSq > 0) {
+    t = qBound(qreal(0), (wx * vx + wy * vy) / lengthSq, qreal(1));
+  }
+  const qreal ex = wx - t * vx;
+  const qreal ey = wy - t * vy;
+  return ex * ex + ey * ey;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
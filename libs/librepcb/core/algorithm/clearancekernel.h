@@ -0,0 +1,177 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_CLEARANCEKERNEL_H
+#define LIBREPCB_CORE_CLEARANCEKERNEL_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../types/length.h"
+#include "../types/point.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class ClearanceKernel
+ ******************************************************************************/
+
+/**
+ * @brief Analytic clearance check between simple copper primitives
+ *
+ * Every object is a convex hull of one or more points, expanded by a radius
+ * (i.e. a Minkowski sum of a convex polygon and a circle). This covers
+ * circles (one point), capsules like traces or obround pads (two points) and
+ * convex polygons like rectangular or octagonal pads (three or more points,
+ * radius usually zero). The distance between two such objects is calculated
+ * in closed form from segment distances, which is exact and much faster than
+ * offsetting and intersecting polygons with Clipper.
+ *
+ * Each object belongs to a group (e.g. a net signal). Only objects of
+ * different groups are checked against each other.
+ *
+ * The object data is stored as structure of arrays and the broad phase is a
+ * sweep over the sorted bounding boxes, which keeps the hot loops simple
+ * enough to be auto-vectorized by the compiler.
+ */
+class ClearanceKernel final {
+public:
+  // Types
+  struct Violation {
+    int object1;  ///< Index of the first object
+    int object2;  ///< Index of the second object (always > object1)
+  };
+
+  // Constructors / Destructor
+  ClearanceKernel() noexcept;
+  ClearanceKernel(const ClearanceKernel& other) = delete;
+  ~ClearanceKernel() noexcept;
+
+  // Getters
+  int getCount() const noexcept { return mGroups.count(); }
+  int getGroup(int object) const noexcept { return mGroups.at(object); }
+
+  // General Methods
+
+  /**
+   * @brief Add a filled circle
+   *
+   * @param group     Group of the object.
+   * @param center    Center of the circle.
+   * @param diameter  Diameter of the circle.
+   *
+   * @return Index of the added object.
+   */
+  int addCircle(int group, const Point& center,
+                const UnsignedLength& diameter) noexcept;
+
+  /**
+   * @brief Add a capsule (a straight line with round ends)
+   *
+   * @param group     Group of the object.
+   * @param p1        Start point of the center line.
+   * @param p2        End point of the center line.
+   * @param width     Total width of the capsule.
+   *
+   * @return Index of the added object.
+   */
+  int addCapsule(int group, const Point& p1, const Point& p2,
+                 const UnsignedLength& width) noexcept;
+
+  /**
+   * @brief Add a filled convex polygon
+   *
+   * @attention The vertices must describe a convex polygon (in any
+   *            orientation), otherwise the results will be wrong.
+   *
+   * @param group     Group of the object.
+   * @param vertices  Vertices of the polygon, without closing vertex.
+   * @param width     Optional width of the polygon outline.
+   *
+   * @return Index of the added object.
+   */
+  int addConvexPolygon(
+      int group, const QVector<Point>& vertices,
+      const UnsignedLength& width = UnsignedLength(0)) noexcept;
+
+  /**
+   * @brief Calculate the distance between two objects
+   *
+   * @param object1   Index of the first object.
+   * @param object2   Index of the second object.
+   *
+   * @return The distance between the object outlines, or zero if they
+   *         overlap.
+   */
+  Length calcDistance(int object1, int object2) const noexcept;
+
+  /**
+   * @brief Find all pairs of objects which violate a given clearance
+   *
+   * @param clearance   The minimum required distance between objects of
+   *                    different groups.
+   *
+   * @return All object pairs (of different groups) with a distance smaller
+   *         than the given clearance, sorted by object indices.
+   */
+  QVector<Violation> findViolations(const UnsignedLength& clearance) const
+      noexcept;
+
+  // Operator Overloadings
+  ClearanceKernel& operator=(const ClearanceKernel& rhs) = delete;
+
+private:  // Methods
+  int addObject(int group, const QVector<Point>& points, qreal radius) noexcept;
+  qreal calcHullDistance(int object1, int object2) const noexcept;
+  bool containsPoint(int object, qreal x, qreal y) const noexcept;
+  static qreal calcSegmentDistance(qreal ax, qreal ay, qreal bx, qreal by,
+                                   qreal cx, qreal cy, qreal dx,
+                                   qreal dy) noexcept;
+  static qreal calcPointSegmentDistanceSq(qreal px, qreal py, qreal ax,
+                                          qreal ay, qreal bx,
+                                          qreal by) noexcept;
+
+private:  // Data
+  // Per object (all values in nanometers)
+  QVector<int> mGroups;
+  QVector<qreal> mRadii;
+  QVector<int> mFirstVertex;  ///< Index into #mX and #mY
+  QVector<int> mVertexCount;
+  QVector<qreal> mMinX;  ///< Bounding box, including the radius
+  QVector<qreal> mMinY;  ///< Bounding box, including the radius
+  QVector<qreal> mMaxX;  ///< Bounding box, including the radius
+  QVector<qreal> mMaxY;  ///< Bounding box, including the radius
+
+  // Vertices of all objects
+  QVector<qreal> mX;
+  QVector<qreal> mY;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
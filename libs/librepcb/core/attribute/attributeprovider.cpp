@@ -39,6 +39,42 @@ QString AttributeProvider::getAttributeValue(const QString& key) const
   return getAttributeValue(key, backtrace);
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+bool AttributeProvider::isAffectedByChange(
+    const QSet<QString>& usedKeys, const QSet<QString>& changedKeys) noexcept {
+  if (usedKeys.isEmpty()) {
+    return false;  // Text does not use any attributes.
+  } else if (changedKeys.isEmpty()) {
+    return true;  // Any attribute might have changed.
+  }
+  foreach (const QString& key, changedKeys) {
+    if (usedKeys.contains(key)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+QSet<QString> AttributeProvider::getChangedKeys(
+    const AttributeList& a, const AttributeList& b) noexcept {
+  QSet<QString> keys;
+  for (const Attribute& attribute : a) {
+    std::shared_ptr<const Attribute> other = b.find(*attribute.getKey());
+    if ((!other) || (*other != attribute)) {
+      keys.insert(*attribute.getKey());
+    }
+  }
+  for (const Attribute& attribute : b) {
+    if (!a.contains(*attribute.getKey())) {
+      keys.insert(*attribute.getKey());
+    }
+  }
+  return keys;
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
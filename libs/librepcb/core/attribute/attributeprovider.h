@@ -23,6 +23,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "attribute.h"
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -110,6 +112,30 @@ public:
     return QVector<const AttributeProvider*>();
   }
 
+  /**
+   * @brief Check whether a text needs to be substituted again after a change
+   *
+   * @param usedKeys      All keys used by the text (see
+   *                      ::librepcb::AttributeSubstitutor::substitute()).
+   * @param changedKeys   The keys passed to #attributesChanged().
+   *
+   * @return True if the text uses any of the changed attributes.
+   */
+  static bool isAffectedByChange(const QSet<QString>& usedKeys,
+                                 const QSet<QString>& changedKeys) noexcept;
+
+  /**
+   * @brief Determine the keys of all attributes which differ between two lists
+   *
+   * @param a   The first attribute list.
+   * @param b   The second attribute list.
+   *
+   * @return Keys which are contained in only one list, or whose value, type
+   *         or unit differs.
+   */
+  static QSet<QString> getChangedKeys(const AttributeList& a,
+                                      const AttributeList& b) noexcept;
+
 signals:
 
   /**
@@ -118,8 +144,11 @@ signals:
    * All derived classes must emit this signal when some attributes have changed
    * their values (only attributes which can be fetched with
    * #getAttributeValue(), inclusive all attributes from all "parent" classes).
+   *
+   * @param keys  The keys of all attributes which have changed. An empty set
+   *              means that any attribute might have changed.
    */
-  virtual void attributesChanged() = 0;
+  virtual void attributesChanged(const QSet<QString>& keys) = 0;
 
 private:
   QString getAttributeValue(const QString& key,
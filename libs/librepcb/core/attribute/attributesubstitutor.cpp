@@ -35,88 +35,111 @@ namespace librepcb {
  *  Public Methods
  ******************************************************************************/
 
-QString AttributeSubstitutor::substitute(QString str,
+QString AttributeSubstitutor::substitute(const QString& str,
                                          const AttributeProvider* ap,
-                                         FilterFunction filter) noexcept {
-  int startPos = 0;
-  int length = 0;
-  int outerVariableStart = -1;
-  int outerVariableEnd = -1;  // counted from end of string
-  QString value;
-  QStringList keys;
+                                         FilterFunction filter,
+                                         QSet<QString>* usedKeys) noexcept {
+  QString result;
   QSet<QString> keyBacktrace;  // avoid endless recursion
-  while (searchVariablesInText(str, startPos, startPos, length, keys)) {
-    if (filter && (startPos + length > str.length() - outerVariableEnd)) {
-      applyFilter(str, outerVariableStart, outerVariableEnd, filter);
-    }
-    if (filter && (outerVariableStart < 0)) {
-      outerVariableStart = startPos;
-      outerVariableEnd = str.length() - length - startPos;
-    }
-    bool keyFound = false;
-    foreach (const QString& key, keys) {
-      if (key.startsWith('\'') && key.endsWith('\'')) {
-        // replace "{{'VALUE'}}" with "VALUE"
-        str.replace(startPos, length, key.mid(1, key.length() - 2));
-        startPos +=
-            key.length() - 2;  // do not search for variables in the value
-        keyFound = true;
-        break;
-      } else if ((getValueOfKey(key, value, ap)) &&
-                 (!keyBacktrace.contains(key))) {
-        // replace "{{KEY}}" with the value of KEY
-        str.replace(startPos, length, value);
-        keyBacktrace.insert(key);
-        keyFound = true;
-        break;
-      }
-    }
-    if (!keyFound) {
-      // attribute not found, remove "{{KEY}}" from str
-      str.remove(startPos, length);
+  foreach (const Token& token, getTokens(str)) {
+    if (token.keys.isEmpty()) {
+      result += token.text;
+    } else if (filter) {
+      result += filter(
+          substituteVariable(token.keys, ap, keyBacktrace, usedKeys));
+    } else {
+      result += substituteVariable(token.keys, ap, keyBacktrace, usedKeys);
     }
   }
-  if (filter && (outerVariableStart >= 0)) {
-    applyFilter(str, outerVariableStart, outerVariableEnd, filter);
-  }
-  return str;
+  return result;
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-bool AttributeSubstitutor::searchVariablesInText(const QString& text,
-                                                 int startPos, int& pos,
-                                                 int& length,
-                                                 QStringList& keys) noexcept {
-  QRegularExpression re("\\{\\{(.*?)\\}\\}");
-  QRegularExpressionMatch match = re.match(text, startPos);
-  if (match.hasMatch() && match.capturedLength() > 0) {
-    pos = match.capturedStart();
+QVector<AttributeSubstitutor::Token> AttributeSubstitutor::getTokens(
+    const QString& text) noexcept {
+  // Fast path for the very common case of texts without any variables.
+  if (!text.contains("{{")) {
+    return {Token{text, QStringList()}};
+  }
+
+  static QMutex mutex;
+  static QHash<QString, QVector<Token>> cache;
+  QMutexLocker lock(&mutex);
+  auto it = cache.find(text);
+  if (it == cache.end()) {
+    if (cache.count() >= sMaxCachedTokens) {
+      cache.clear();  // Simple but good enough to limit memory usage.
+    }
+    it = cache.insert(text, parseTokens(text));
+  }
+  return *it;
+}
+
+QVector<AttributeSubstitutor::Token> AttributeSubstitutor::parseTokens(
+    const QString& text) noexcept {
+  static const QRegularExpression re("\\{\\{(.*?)\\}\\}");
+  QVector<Token> tokens;
+  int startPos = 0;
+  while (startPos < text.length()) {
+    const QRegularExpressionMatch match = re.match(text, startPos);
+    if ((!match.hasMatch()) || (match.capturedLength() <= 0)) {
+      break;
+    }
+    const int pos = match.capturedStart();
+    if (pos > startPos) {
+      tokens.append(Token{text.mid(startPos, pos - startPos), QStringList()});
+    }
     if (text.midRef(pos).startsWith("{{ '}}' }}")) {
       // special case to escape '}}' as it doesn't work with the regex above
-      length = 10;
-      keys = QStringList{"'}}'"};
+      tokens.append(Token{QString(), QStringList{"'}}'"}});
+      startPos = pos + 10;
     } else {
-      length = match.capturedLength();
-      keys = match.captured(1).split(" or ");
+      QStringList keys = match.captured(1).split(" or ");
       for (QString& key : keys) {
         key = key.trimmed();
       }
+      tokens.append(Token{QString(), keys});
+      startPos = pos + match.capturedLength();
     }
-    return true;
-  } else {
-    return false;
   }
+  if (startPos < text.length()) {
+    tokens.append(Token{text.mid(startPos), QStringList()});
+  }
+  return tokens;
 }
 
-void AttributeSubstitutor::applyFilter(QString& str, int& start, int& end,
-                                       FilterFunction filter) noexcept {
-  int length = str.length() - end - start;
-  str.replace(start, length, filter(str.mid(start, length)));
-  start = -1;
-  end = -1;
+QString AttributeSubstitutor::substituteVariable(
+    const QStringList& keys, const AttributeProvider* ap,
+    QSet<QString>& keyBacktrace, QSet<QString>* usedKeys) noexcept {
+  QString value;
+  foreach (const QString& key, keys) {
+    if (key.startsWith('\'') && key.endsWith('\'')) {
+      // replace "{{'VALUE'}}" with "VALUE" (without substituting VALUE)
+      return key.mid(1, key.length() - 2);
+    }
+    if (usedKeys) {
+      usedKeys->insert(key);
+    }
+    if ((getValueOfKey(key, value, ap)) && (!keyBacktrace.contains(key))) {
+      // replace "{{KEY}}" with the value of KEY, which may contain variables
+      // as well
+      keyBacktrace.insert(key);
+      QString result;
+      foreach (const Token& token, getTokens(value)) {
+        if (token.keys.isEmpty()) {
+          result += token.text;
+        } else {
+          result += substituteVariable(token.keys, ap, keyBacktrace, usedKeys);
+        }
+      }
+      return result;
+    }
+  }
+  // attribute not found, remove "{{KEY}}"
+  return QString();
 }
 
 bool AttributeSubstitutor::getValueOfKey(const QString& key, QString& value,
@@ -46,6 +46,11 @@ class AttributeProvider;
  * Please read the documentation about the @ref doc_attributes_system to get an
  * idea how the @ref doc_attributes_system works in detail.
  *
+ * Strings are parsed only once into a list of tokens (literal text and
+ * variables), which are kept in a global cache. So repeated substitutions of
+ * the same string (e.g. when attributes have changed) only need to look up
+ * the attribute values.
+ *
  * @see librepcb::AttributeProvider
  * @see @ref doc_attributes_system
  *
@@ -79,37 +84,58 @@ public:
    *                  be passed to this function first. This allows for example
    *                  to remove invalid characters if the resulting string is
    *                  used for a file path.
+   * @param usedKeys  If not nullptr, all attribute keys which were looked up
+   *                  (including those of recursively substituted values) will
+   *                  be added to this set. If the returned set is empty, the
+   *                  result does not depend on any attribute at all.
    *
-   * @return True if str was modified in some way, false if not
+   * @return The substituted string
+   */
+  static QString substitute(const QString& str,
+                            const AttributeProvider* ap = nullptr,
+                            FilterFunction filter = nullptr,
+                            QSet<QString>* usedKeys = nullptr) noexcept;
+
+private:  // Types
+  /**
+   * @brief A parsed part of a string, either literal text or a variable
    */
-  static QString substitute(QString str, const AttributeProvider* ap = nullptr,
-                            FilterFunction filter = nullptr) noexcept;
+  struct Token {
+    QString text;  ///< Literal text (only if #keys is empty)
+    QStringList keys;  ///< Variable keys (text between '{{' and '}}', split
+                       ///< by ' or ')
+  };
 
 private:  // Methods
   /**
-   * @brief Search the next variables (e.g. "{{KEY or FALLBACK}}") in a given
-   * text
+   * @brief Get the parsed tokens of a string, from the cache if available
    *
    * @param text      A text which can contain variables
-   * @param startPos  The search start index (use 0 to search in the whole text)
-   * @param pos       The index of the next variable in the specified text
-   * (index of the first '{' character, or -1 if no variable found) will be
-   *                  written into this variable.
-   * @param length    If a variable is found, the length (incl. '{{}}') will be
-   *                  written into this variable.
-   * @param keys      The variable key names (text between '{{' and '}}', split
-   * by ' or ')
    *
-   * @return          true if a variable is found, false if not
+   * @return The tokens of the text
    */
-  static bool searchVariablesInText(const QString& text, int startPos, int& pos,
-                                    int& length, QStringList& keys) noexcept;
+  static QVector<Token> getTokens(const QString& text) noexcept;
 
-  static void applyFilter(QString& str, int& start, int& end,
-                          FilterFunction filter) noexcept;
+  /**
+   * @brief Split a text into literal text and variables (e.g.
+   * "{{KEY or FALLBACK}}")
+   *
+   * @param text      A text which can contain variables
+   *
+   * @return The tokens of the text
+   */
+  static QVector<Token> parseTokens(const QString& text) noexcept;
+
+  static QString substituteVariable(const QStringList& keys,
+                                    const AttributeProvider* ap,
+                                    QSet<QString>& keyBacktrace,
+                                    QSet<QString>* usedKeys) noexcept;
 
   static bool getValueOfKey(const QString& key, QString& value,
                             const AttributeProvider* ap) noexcept;
+
+private:  // Data
+  static constexpr int sMaxCachedTokens = 10000;  ///< Max. cache size
 };
 
 /*******************************************************************************
@@ -80,6 +80,14 @@ ExcellonGenerator::ExcellonGenerator(const QDateTime& creationDate,
 ExcellonGenerator::~ExcellonGenerator() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QByteArray ExcellonGenerator::toByteArray() const noexcept {
+  return mOutput.toLatin1();
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -106,7 +114,7 @@ void ExcellonGenerator::generate() {
 }
 
 void ExcellonGenerator::saveToFile(const FilePath& filepath) const {
-  FileUtils::writeFile(filepath, mOutput.toLatin1());  // can throw
+  FileUtils::writeFile(filepath, toByteArray());  // can throw
 }
 
 /*******************************************************************************
@@ -61,6 +61,17 @@ GerberGenerator::GerberGenerator(const QDateTime& creationDate,
 GerberGenerator::~GerberGenerator() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QByteArray GerberGenerator::toByteArray() const noexcept {
+  // Note: Although we save it as UTF-8, usually it will still contain only
+  // ASCII characters for maximum compatibility with legacy crappy readers.
+  // Unicode is only required when exporting Gerber X3 assembly attributes.
+  return mOutput.toUtf8();
+}
+
 /*******************************************************************************
  *  Plot Methods
  ******************************************************************************/
@@ -378,10 +389,7 @@ void GerberGenerator::generate() {
 }
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const {
-  // Note: Although we save it as UTF-8, usually it will still contain only
-  // ASCII characters for maximum compatibility with legacy crappy readers.
-  // Unicode is only required when exporting Gerber X3 assembly attributes.
-  FileUtils::writeFile(filepath, mOutput.toUtf8());  // can throw
+  FileUtils::writeFile(filepath, toByteArray());  // can throw
 }
 
 /*******************************************************************************
@@ -68,6 +68,7 @@ public:
 
   // Getters
   const QString& toStr() const noexcept { return mOutput; }
+  QByteArray toByteArray() const noexcept;
 
   // Plot Methods
   void setFileFunctionOutlines(bool plated) noexcept;
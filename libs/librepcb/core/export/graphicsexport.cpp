@@ -24,6 +24,7 @@
 
 #include "../fileio/fileutils.h"
 #include "graphicsexportsettings.h"
+#include "svgwriter.h"
 
 #include <QtConcurrent>
 #include <QtCore>
@@ -183,65 +184,24 @@ QString GraphicsExport::run(RunArgs args) noexcept {
       throw RuntimeError(__FILE__, __LINE__, tr("No pages to export/print."));
     }
 
-    // Export all pages.
-    QPainter painter;
-    for (int index = 0; index < args.pages.count(); ++index) {
-      const qreal percentPerPage = qreal(80) / args.pages.count();
-      emit progress(20 + std::ceil(percentPerPage * index), index + 1,
-                    args.pages.count());
-      const Page& page = args.pages.at(index);
-      if (mAbort) {
-        break;
-      }
-
-      // Determine source bounding rect.
-      QRectF sourceRectPx = calcSourceRect(*page.first, *page.second);
-      QTransform sourceTransform = getSourceTransformation(*page.second);
-      QRectF sourceRectTransformedPx = sourceTransform.mapRect(sourceRectPx);
-
-      // Determine output page size.
-      QPageSize pageSize;
-      if (page.second->getPageSize() && page.second->getPageSize()->isValid()) {
-        // Fixed page size is specified.
-        pageSize = *page.second->getPageSize();
-      } else {
-        // Derive page size from source size.
-        Length width = Length::fromPx(sourceRectTransformedPx.width()) +
-            *page.second->getMarginLeft() + *page.second->getMarginRight();
-        Length height = Length::fromPx(sourceRectTransformedPx.height()) +
-            *page.second->getMarginTop() + *page.second->getMarginBottom();
-        pageSize =
-            QPageSize(QSizeF(width.toMm(), height.toMm()),
-                      QPageSize::Millimeter, "Custom", QPageSize::ExactMatch);
-      }
-      if (pagedPaintDevice && (!pagedPaintDevice->setPageSize(pageSize))) {
-        qCritical().nospace()
-            << "Failed to set page size for graphics export to "
-            << pageSize.name() << ".";
-      }
-
-      // Determine output page orientation.
-      const QPageLayout::Orientation pageOrientation =
-          page.second->getOrientation()
-          ? (*page.second->getOrientation())
-          : getOrientation(sourceRectTransformedPx.size());
-      if (pagedPaintDevice) {
-        QPageLayout::Orientation orientation = pageOrientation;
-        if (getOrientation(pageSize.sizePoints()) == QPageLayout::Landscape) {
-          // QPagedPaintDevice orientation seems to be swapped if page size is
-          // landscape (e.g. the Ledger/Tabloid page size).
-          if (orientation == QPageLayout::Landscape) {
-            orientation = QPageLayout::Portrait;
-          } else {
-            orientation = QPageLayout::Landscape;
-          }
-        }
-        if (!pagedPaintDevice->setPageOrientation(orientation)) {
-          qCritical() << "Failed to set page orientation for graphics export!";
-        }
-      }
+    // Determine the output type.
+    Output output = Output::Preview;
+    if (pagedPaintDevice) {
+      output = Output::PagedDevice;
+    } else if (fileExt == "svg") {
+      output = Output::Svg;
+    } else if ((!args.preview) && args.filePath.isValid()) {
+      output = Output::Image;
+    } else if (!args.preview) {
+      output = Output::Clipboard;
+    }
 
-      // Determine DPI.
+    // Prepare the export of all pages.
+    const int pageCount = args.pages.count();
+    QVector<PageJob> jobs;
+    jobs.reserve(pageCount);
+    for (int index = 0; index < pageCount; ++index) {
+      const Page& page = args.pages.at(index);
       int dpi;
       if (printer) {
         dpi = printer->resolution();
@@ -250,129 +210,99 @@ QString GraphicsExport::run(RunArgs args) noexcept {
       } else {
         dpi = page.second->getPixmapDpi();
       }
-      const qreal pxScale = static_cast<qreal>(dpi) / Length(25400000).toPx();
-
-      // Calculate page margins in output device pixels.
-      const QMarginsF pageMarginsPx(
-          page.second->getMarginLeft()->toInch() * dpi,
-          page.second->getMarginTop()->toInch() * dpi,
-          page.second->getMarginRight()->toInch() * dpi,
-          page.second->getMarginBottom()->toInch() * dpi);
-
-      // Determine output page rect.
-      QRect pageRectPx = pageSize.rectPixels(dpi);
-      if (getOrientation(pageRectPx.size()) != pageOrientation) {
-        pageRectPx.setSize(pageRectPx.size().transposed());
-      }
-      const QRectF pageContentRectPx = pageRectPx - pageMarginsPx;
-
-      // Calculate final scale factor.
-      const qreal scale = page.second->getScale()
-          ? pxScale
-          : qMin(pageContentRectPx.width() / sourceRectTransformedPx.width(),
-                 pageContentRectPx.height() / sourceRectTransformedPx.height());
-
-      // Determine output file path.
-      const FilePath outputFilePath = (!outputFilePathTmpl.isEmpty())
+      PageJob job;
+      job.index = index;
+      job.dpi = dpi;
+      job.outputFilePath = (!outputFilePathTmpl.isEmpty())
           ? FilePath(outputFilePathTmpl.arg(index + 1))
           : args.filePath;
+      jobs.append(job);
+    }
 
-      // Last chance to abort before exporting.
-      emit progress(20 + std::ceil(percentPerPage * (index + qreal(0.5))),
-                    index + 1, args.pages.count());
+    // Layout and render all pages concurrently since they are independent
+    // of each other. For printers and PDF files, the pages are only recorded
+    // here and written to the (not thread-safe) paged device in order
+    // afterwards.
+    const qreal renderPercent = (output == Output::PagedDevice) ? 60 : 80;
+    QAtomicInt renderedPages(0);
+    QAtomicInt failed(0);
+    QMutex errorMutex;
+    QString errorMsg;
+    QtConcurrent::blockingMap(jobs, [&](PageJob& job) {
+      if (mAbort || failed.loadAcquire()) {
+        return;
+      }
+      try {
+        const Page& page = args.pages.at(job.index);
+        layoutPage(page, job);
+        renderPage(page, output, job);
+      } catch (const Exception& e) {
+        QMutexLocker lock(&errorMutex);
+        if (errorMsg.isNull()) {
+          errorMsg = e.getMsg().isEmpty() ? "Unknown error" : e.getMsg();
+        }
+        failed.storeRelease(1);  // Don't render any more pages.
+      }
+      const int completed = renderedPages.fetchAndAddOrdered(1) + 1;
+      emit progress(20 + std::ceil(renderPercent * completed / pageCount),
+                    completed, pageCount);
+    });
+    if (!errorMsg.isNull()) {
+      throw RuntimeError(__FILE__, __LINE__, errorMsg);
+    }
+
+    // Copy images to the clipboard in order. This must be performed in the
+    // main thread since QClipboard is not thread-safe. This is done by a
+    // queued signal-slot connection.
+    for (const PageJob& job : jobs) {
+      if (job.image && (!mAbort)) {
+        emit imageCopiedToClipboard(*job.image, QClipboard::Clipboard);
+      }
+    }
+
+    // Write all recorded pages to the paged device.
+    QPainter painter;
+    for (int index = 0; (output == Output::PagedDevice) && (index < pageCount);
+         ++index) {
+      const PageJob& job = jobs.at(index);
       if (mAbort) {
         break;
       }
-
-      // Prepare painter.
-      bool beginSuccess = false;
-      QScopedPointer<QSvgGenerator> svgGenerator;
-      QScopedPointer<QImage> image;
-      std::shared_ptr<QPicture> picture;
-      if (pagedPaintDevice) {
-        qDebug().nospace() << "Export page " << (index + 1) << " to "
-                           << args.printerName % args.filePath.toStr() << "...";
-        if (index == 0) {
-          beginSuccess = painter.begin(pagedPaintDevice);
+      if (!pagedPaintDevice->setPageSize(job.pageSize)) {
+        qCritical().nospace()
+            << "Failed to set page size for graphics export to "
+            << job.pageSize.name() << ".";
+      }
+      QPageLayout::Orientation orientation = job.pageOrientation;
+      if (getOrientation(job.pageSize.sizePoints()) == QPageLayout::Landscape) {
+        // QPagedPaintDevice orientation seems to be swapped if page size is
+        // landscape (e.g. the Ledger/Tabloid page size).
+        if (orientation == QPageLayout::Landscape) {
+          orientation = QPageLayout::Portrait;
         } else {
-          beginSuccess = pagedPaintDevice->newPage();
+          orientation = QPageLayout::Landscape;
         }
-      } else if (fileExt == "svg") {
-        qDebug().nospace() << "Export page " << (index + 1) << " as SVG to "
-                           << outputFilePath.toStr() << "...";
-        svgGenerator.reset(new QSvgGenerator());
-        svgGenerator->setTitle(mDocumentName);
-        svgGenerator->setFileName(outputFilePath.toStr());
-        svgGenerator->setSize(pageRectPx.size());
-        svgGenerator->setViewBox(pageRectPx);
-        svgGenerator->setResolution(dpi);
-        beginSuccess = painter.begin(svgGenerator.data());
-        emit savingFile(outputFilePath);
-      } else if (!args.preview) {
-        QString target =
-            outputFilePath.isValid() ? outputFilePath.toStr() : "clipboard";
-        qDebug().nospace() << "Export page " << (index + 1) << " as pixmap to "
-                           << target << "...";
-        image.reset(
-            new QImage(pageRectPx.size(), QImage::Format_ARGB32_Premultiplied));
-        image->fill(Qt::transparent);
-        beginSuccess = painter.begin(image.data());
-        painter.setRenderHints(QPainter::Antialiasing |
-                               QPainter::SmoothPixmapTransform);
-      } else {
-        qDebug().nospace() << "Generate preview of page " << index + 1 << "...";
-        picture = std::make_shared<QPicture>();
-        beginSuccess = painter.begin(picture.get());
-        painter.setRenderHints(QPainter::Antialiasing |
-                               QPainter::SmoothPixmapTransform);
       }
+      if (!pagedPaintDevice->setPageOrientation(orientation)) {
+        qCritical() << "Failed to set page orientation for graphics export!";
+      }
+      qDebug().nospace() << "Export page " << (index + 1) << " to "
+                         << args.printerName % args.filePath.toStr() << "...";
+      const bool beginSuccess = (index == 0)
+          ? painter.begin(pagedPaintDevice)
+          : pagedPaintDevice->newPage();
       if (!beginSuccess) {
         throw RuntimeError(
             __FILE__, __LINE__,
             "Failed to start printing - invalid printer or output file?");
       }
-
-      // Perform the export.
-      painter.save();
-      if (page.second->getBackgroundColor() != Qt::transparent) {
-        painter.fillRect(pageRectPx, page.second->getBackgroundColor());
-      }
-      painter.translate(pageContentRectPx.center().x(),
-                        pageContentRectPx.center().y());
-      painter.setTransform(sourceTransform, true);
-      painter.scale(scale, scale);
-      painter.translate(-sourceRectPx.center().x(), -sourceRectPx.center().y());
-      page.first->paint(painter, *page.second);
-      painter.restore();
-
-      // Finish painting of current page.
-      if ((!pagedPaintDevice) && (!painter.end())) {
-        throw RuntimeError(__FILE__, __LINE__, "Failed to finish painting.");
-      }
-      if (image && outputFilePath.isValid()) {
-        emit savingFile(outputFilePath);
-        if (!image->save(outputFilePath.toStr())) {
-          throw RuntimeError(
-              __FILE__, __LINE__,
-              tr("Failed to export image \"%1\". Check file permissions and "
-                 "make sure to use a supported image file extension.")
-                  .arg(outputFilePath.toNative()));
-        }
-      } else if (image) {
-        // Copy to clipboard must be performed in the main thread since
-        // QClipboard is not thread-safe. This is done by a queued signal-slot
-        // connection.
-        emit imageCopiedToClipboard(*image, QClipboard::Clipboard);
-      }
-      if (picture) {
-        emit previewReady(index, pageRectPx.size(), pageContentRectPx, picture);
-      }
-      emit progress(20 + std::ceil(percentPerPage * (index + 1)), index + 1,
-                    args.pages.count());
+      painter.drawPicture(0, 0, *job.picture);
+      emit progress(80 + std::ceil(qreal(20) * (index + 1) / pageCount),
+                    index + 1, pageCount);
     }
 
     // Finish export.
-    if ((pagedPaintDevice) && (!painter.end())) {
+    if (painter.isActive() && (!painter.end())) {
       if (pdfWriter) {
         throw RuntimeError(__FILE__, __LINE__,
                            tr("Failed to finish PDF export. Check "
@@ -408,6 +338,190 @@ QString GraphicsExport::run(RunArgs args) noexcept {
   }
 }
 
+void GraphicsExport::layoutPage(const Page& page, PageJob& job) noexcept {
+  const int dpi = job.dpi;
+
+  // Determine source bounding rect.
+  job.sourceRectPx = calcSourceRect(*page.first, *page.second);
+  job.sourceTransform = getSourceTransformation(*page.second);
+  const QRectF sourceRectTransformedPx =
+      job.sourceTransform.mapRect(job.sourceRectPx);
+
+  // Determine output page size.
+  if (page.second->getPageSize() && page.second->getPageSize()->isValid()) {
+    // Fixed page size is specified.
+    job.pageSize = *page.second->getPageSize();
+  } else {
+    // Derive page size from source size.
+    Length width = Length::fromPx(sourceRectTransformedPx.width()) +
+        *page.second->getMarginLeft() + *page.second->getMarginRight();
+    Length height = Length::fromPx(sourceRectTransformedPx.height()) +
+        *page.second->getMarginTop() + *page.second->getMarginBottom();
+    job.pageSize =
+        QPageSize(QSizeF(width.toMm(), height.toMm()), QPageSize::Millimeter,
+                  "Custom", QPageSize::ExactMatch);
+  }
+
+  // Determine output page orientation.
+  job.pageOrientation = page.second->getOrientation()
+      ? (*page.second->getOrientation())
+      : getOrientation(sourceRectTransformedPx.size());
+
+  // Calculate page margins in output device pixels.
+  const QMarginsF pageMarginsPx(page.second->getMarginLeft()->toInch() * dpi,
+                                page.second->getMarginTop()->toInch() * dpi,
+                                page.second->getMarginRight()->toInch() * dpi,
+                                page.second->getMarginBottom()->toInch() * dpi);
+
+  // Determine output page rect.
+  job.pageRectPx = job.pageSize.rectPixels(dpi);
+  if (getOrientation(job.pageRectPx.size()) != job.pageOrientation) {
+    job.pageRectPx.setSize(job.pageRectPx.size().transposed());
+  }
+  job.pageContentRectPx = job.pageRectPx - pageMarginsPx;
+
+  // Calculate final scale factor.
+  const qreal pxScale = static_cast<qreal>(dpi) / Length(25400000).toPx();
+  job.scale = page.second->getScale()
+      ? pxScale
+      : qMin(job.pageContentRectPx.width() / sourceRectTransformedPx.width(),
+             job.pageContentRectPx.height() /
+                 sourceRectTransformedPx.height());
+}
+
+void GraphicsExport::renderPage(const Page& page, Output output, PageJob& job) {
+  // Note: This method is called from multiple threads at the same time!
+
+  // Write SVG natively if supported by the page.
+  if ((output == Output::Svg) && page.first->canPaintSvg()) {
+    renderSvgPage(page, job);
+    return;
+  }
+
+  // Prepare painter.
+  QPainter painter;
+  bool beginSuccess = false;
+  QScopedPointer<QSvgGenerator> svgGenerator;
+  std::shared_ptr<QImage> image;
+  std::shared_ptr<QPicture> picture;
+  if (output == Output::PagedDevice) {
+    picture = std::make_shared<QPicture>();
+    beginSuccess = painter.begin(picture.get());
+  } else if (output == Output::Svg) {
+    qDebug().nospace() << "Export page " << (job.index + 1) << " as SVG to "
+                       << job.outputFilePath.toStr() << "...";
+    svgGenerator.reset(new QSvgGenerator());
+    svgGenerator->setTitle(mDocumentName);
+    svgGenerator->setFileName(job.outputFilePath.toStr());
+    svgGenerator->setSize(job.pageRectPx.size());
+    svgGenerator->setViewBox(job.pageRectPx);
+    svgGenerator->setResolution(job.dpi);
+    beginSuccess = painter.begin(svgGenerator.data());
+    emit savingFile(job.outputFilePath);
+  } else if (output != Output::Preview) {
+    QString target = (output == Output::Image) ? job.outputFilePath.toStr()
+                                               : QString("clipboard");
+    qDebug().nospace() << "Export page " << (job.index + 1)
+                       << " as pixmap to " << target << "...";
+    image = std::make_shared<QImage>(job.pageRectPx.size(),
+                                     QImage::Format_ARGB32_Premultiplied);
+    image->fill(Qt::transparent);
+    beginSuccess = painter.begin(image.get());
+    painter.setRenderHints(QPainter::Antialiasing |
+                           QPainter::SmoothPixmapTransform);
+  } else {
+    qDebug().nospace() << "Generate preview of page " << job.index + 1
+                       << "...";
+    picture = std::make_shared<QPicture>();
+    beginSuccess = painter.begin(picture.get());
+    painter.setRenderHints(QPainter::Antialiasing |
+                           QPainter::SmoothPixmapTransform);
+  }
+  if (!beginSuccess) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        "Failed to start printing - invalid printer or output file?");
+  }
+
+  // Perform the export.
+  painter.save();
+  if (page.second->getBackgroundColor() != Qt::transparent) {
+    painter.fillRect(job.pageRectPx, page.second->getBackgroundColor());
+  }
+  painter.translate(job.pageContentRectPx.center().x(),
+                    job.pageContentRectPx.center().y());
+  painter.setTransform(job.sourceTransform, true);
+  painter.scale(job.scale, job.scale);
+  painter.translate(-job.sourceRectPx.center().x(),
+                    -job.sourceRectPx.center().y());
+  page.first->paint(painter, *page.second);
+  painter.restore();
+
+  // Finish painting of the page.
+  if (!painter.end()) {
+    throw RuntimeError(__FILE__, __LINE__, "Failed to finish painting.");
+  }
+  if (output == Output::Image) {
+    emit savingFile(job.outputFilePath);
+    if (!image->save(job.outputFilePath.toStr())) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          tr("Failed to export image \"%1\". Check file permissions and "
+             "make sure to use a supported image file extension.")
+              .arg(job.outputFilePath.toNative()));
+    }
+  } else if (output == Output::Clipboard) {
+    job.image = image;
+  } else if (output == Output::PagedDevice) {
+    job.picture = picture;
+  } else if (output == Output::Preview) {
+    emit previewReady(job.index, job.pageRectPx.size(), job.pageContentRectPx,
+                      picture);
+  }
+}
+
+void GraphicsExport::renderSvgPage(const Page& page, const PageJob& job) {
+  // Note: This method is called from multiple threads at the same time!
+
+  qDebug().nospace() << "Export page " << (job.index + 1) << " as SVG to "
+                     << job.outputFilePath.toStr() << "...";
+  emit savingFile(job.outputFilePath);
+  QSaveFile file(job.outputFilePath.toStr());
+  if (!file.open(QIODevice::WriteOnly)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not open file \"%1\": %2")
+                           .arg(job.outputFilePath.toNative())
+                           .arg(file.errorString()));
+  }
+
+  // Same transformation as used for the QPainter in renderPage().
+  QTransform transform;
+  transform.translate(job.pageContentRectPx.center().x(),
+                      job.pageContentRectPx.center().y());
+  transform = job.sourceTransform * transform;
+  transform.scale(job.scale, job.scale);
+  transform.translate(-job.sourceRectPx.center().x(),
+                      -job.sourceRectPx.center().y());
+
+  const QSizeF sizeMm = QSizeF(job.pageRectPx.size()) * 25.4 / job.dpi;
+  SvgWriter writer(file);
+  writer.setMinLineWidth(page.second->getMinLineWidth());
+  writer.beginDocument(mDocumentName, sizeMm, job.pageRectPx);
+  if (page.second->getBackgroundColor() != Qt::transparent) {
+    writer.fillRect(job.pageRectPx, page.second->getBackgroundColor());
+  }
+  writer.beginGroup(transform);
+  page.first->paintSvg(writer, *page.second);
+  writer.endGroup();
+  writer.endDocument();
+  if (writer.hasError() || (!file.commit())) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not write file \"%1\": %2")
+                           .arg(job.outputFilePath.toNative())
+                           .arg(file.errorString()));
+  }
+}
+
 QTransform GraphicsExport::getSourceTransformation(
     const GraphicsExportSettings& settings) noexcept {
   QTransform t;
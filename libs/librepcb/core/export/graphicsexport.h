@@ -40,6 +40,8 @@
  ******************************************************************************/
 namespace librepcb {
 
+class SvgWriter;
+
 /*******************************************************************************
  *  Class GraphicsPagePainter
  ******************************************************************************/
@@ -75,6 +77,31 @@ public:
    */
   virtual void paint(QPainter& painter,
                      const GraphicsExportSettings& settings) const noexcept = 0;
+
+  /**
+   * @brief Check whether #paintSvg() is implemented
+   *
+   * @return  If true, SVG files are created with #paintSvg() instead of
+   *          #paint().
+   */
+  virtual bool canPaintSvg() const noexcept { return false; }
+
+  /**
+   * @brief Draw page content directly as SVG
+   *
+   * Optional alternative to #paint() which allows to write the geometry
+   * natively (e.g. arcs and reused footprints) instead of going through
+   * QSvgGenerator. The same notes as for #paint() apply.
+   *
+   * @param writer    Where to write the content to.
+   * @param settings  Helper class to fetch layer colors depending on the
+   *                  current export settings.
+   */
+  virtual void paintSvg(SvgWriter& writer,
+                        const GraphicsExportSettings& settings) const noexcept {
+    Q_UNUSED(writer);
+    Q_UNUSED(settings);
+  }
 };
 
 /*******************************************************************************
@@ -84,6 +111,10 @@ public:
 /**
  * @brief Asynchronously exports graphics to a QPainter
  *
+ * All pages are rendered concurrently on the global thread pool. For printing
+ * and PDF export, the pages are recorded as QPicture first and then written
+ * to the printer or PDF file in order.
+ *
  * Used for graphics printing, PDF export, SVG export etc. without blocking
  * the main thread.
  */
@@ -199,8 +230,34 @@ private:  // Types
     int copies;
   };
 
+  enum class Output {
+    PagedDevice,  ///< Printer or PDF file
+    Svg,  ///< One SVG file per page
+    Image,  ///< One image file per page
+    Clipboard,  ///< One image per page, copied to the clipboard
+    Preview,  ///< One QPicture per page, see #previewReady()
+  };
+
+  struct PageJob {
+    int index;
+    int dpi;
+    QRectF sourceRectPx;
+    QTransform sourceTransform;
+    QPageSize pageSize;
+    QPageLayout::Orientation pageOrientation;
+    QRect pageRectPx;
+    QRectF pageContentRectPx;
+    qreal scale;
+    FilePath outputFilePath;
+    std::shared_ptr<QImage> image;  ///< Only for Output::Clipboard
+    std::shared_ptr<QPicture> picture;  ///< Only for Output::PagedDevice
+  };
+
 private:  // Methods
   QString run(RunArgs args) noexcept;
+  static void layoutPage(const Page& page, PageJob& job) noexcept;
+  void renderPage(const Page& page, Output output, PageJob& job);
+  void renderSvgPage(const Page& page, const PageJob& job);
   static QTransform getSourceTransformation(
       const GraphicsExportSettings& settings) noexcept;
   static QRectF calcSourceRect(const GraphicsPagePainter& page,
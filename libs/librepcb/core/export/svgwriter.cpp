@@ -0,0 +1,352 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "svgwriter.h"
+
+#include "../geometry/path.h"
+#include "../utils/toolbox.h"
+
+#include <QtCore>
+#include <QtGui>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+SvgWriter::SvgWriter(QIODevice& device) noexcept
+  : mWriter(&device), mMinLineWidth(0) {
+  mWriter.setAutoFormatting(false);
+}
+
+SvgWriter::~SvgWriter() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void SvgWriter::beginDocument(const QString& title, const QSizeF& sizeMm,
+                              const QRectF& viewBox) noexcept {
+  mWriter.writeStartDocument();
+  mWriter.writeStartElement("svg");
+  mWriter.writeDefaultNamespace("http://www.w3.org/2000/svg");
+  mWriter.writeNamespace("http://www.w3.org/1999/xlink", "xlink");
+  mWriter.writeAttribute("version", "1.1");
+  mWriter.writeAttribute("width", toNumber(sizeMm.width()) % "mm");
+  mWriter.writeAttribute("height", toNumber(sizeMm.height()) % "mm");
+  mWriter.writeAttribute(
+      "viewBox",
+      QString("%1 %2 %3 %4")
+          .arg(toNumber(viewBox.x()), toNumber(viewBox.y()),
+               toNumber(viewBox.width()), toNumber(viewBox.height())));
+  // Defaults which are inherited by all elements, to keep them small.
+  mWriter.writeAttribute("fill", "none");
+  mWriter.writeAttribute("stroke-linecap", "round");
+  mWriter.writeAttribute("stroke-linejoin", "round");
+  mWriter.writeTextElement("title", title);
+}
+
+void SvgWriter::endDocument() noexcept {
+  mWriter.writeEndElement();  // svg
+  mWriter.writeEndDocument();
+}
+
+void SvgWriter::beginGroup(const QTransform& transform) noexcept {
+  mWriter.writeStartElement("g");
+  if (!transform.isIdentity()) {
+    mWriter.writeAttribute("transform", toTransform(transform));
+  }
+}
+
+void SvgWriter::endGroup() noexcept {
+  mWriter.writeEndElement();  // g
+}
+
+void SvgWriter::beginDefinition(const QString& id) noexcept {
+  mWriter.writeStartElement("defs");
+  mWriter.writeStartElement("g");
+  mWriter.writeAttribute("id", id);
+}
+
+void SvgWriter::endDefinition() noexcept {
+  mWriter.writeEndElement();  // g
+  mWriter.writeEndElement();  // defs
+}
+
+void SvgWriter::drawDefinition(const QString& id,
+                               const QTransform& transform) noexcept {
+  mWriter.writeEmptyElement("use");
+  mWriter.writeAttribute("xlink:href", "#" % id);
+  if (!transform.isIdentity()) {
+    mWriter.writeAttribute("transform", toTransform(transform));
+  }
+}
+
+void SvgWriter::fillRect(const QRectF& rect, const QColor& color) noexcept {
+  if (!color.isValid()) {
+    return;  // Nothing to draw.
+  }
+
+  mWriter.writeEmptyElement("rect");
+  mWriter.writeAttribute("x", toNumber(rect.x()));
+  mWriter.writeAttribute("y", toNumber(rect.y()));
+  mWriter.writeAttribute("width", toNumber(rect.width()));
+  mWriter.writeAttribute("height", toNumber(rect.height()));
+  writeFill(color);
+}
+
+void SvgWriter::drawLine(const Point& p1, const Point& p2, const Length& width,
+                         const QColor& color) noexcept {
+  if (!color.isValid()) {
+    return;  // Nothing to draw.
+  }
+
+  const QPointF p1Px = p1.toPxQPointF();
+  const QPointF p2Px = p2.toPxQPointF();
+  mWriter.writeEmptyElement("line");
+  mWriter.writeAttribute("x1", toNumber(p1Px.x()));
+  mWriter.writeAttribute("y1", toNumber(p1Px.y()));
+  mWriter.writeAttribute("x2", toNumber(p2Px.x()));
+  mWriter.writeAttribute("y2", toNumber(p2Px.y()));
+  writeStroke(color, width);
+}
+
+void SvgWriter::drawPath(const Path& path, const Length& lineWidth,
+                         const QColor& lineColor,
+                         const QColor& fillColor) noexcept {
+  if ((!lineColor.isValid()) && (!fillColor.isValid())) {
+    return;  // Nothing to draw.
+  }
+  if (path.getVertices().count() < 2) {
+    return;  // Nothing to draw.
+  }
+
+  const bool drawLine =
+      lineColor.isValid() && ((lineWidth > 0) || (!fillColor.isValid()));
+  mWriter.writeEmptyElement("path");
+  mWriter.writeAttribute("d", toPathData(path));
+  if (drawLine) {
+    writeStroke(lineColor, lineWidth);
+  }
+  writeFill(fillColor);
+}
+
+void SvgWriter::drawArea(const QVector<Path>& paths,
+                         const QColor& color) noexcept {
+  if (!color.isValid()) {
+    return;  // Nothing to draw.
+  }
+
+  QStringList data;
+  for (const Path& path : paths) {
+    if (path.getVertices().count() >= 2) {
+      data.append(toPathData(path));
+    }
+  }
+  if (data.isEmpty()) {
+    return;  // Nothing to draw.
+  }
+
+  mWriter.writeEmptyElement("path");
+  mWriter.writeAttribute("d", data.join(" "));
+  mWriter.writeAttribute("fill-rule", "evenodd");  // Subtract holes.
+  writeFill(color);
+}
+
+void SvgWriter::drawCircle(const Point& center, const Length& diameter,
+                           const Length& lineWidth, const QColor& lineColor,
+                           const QColor& fillColor) noexcept {
+  if ((!lineColor.isValid()) && (!fillColor.isValid())) {
+    return;  // Nothing to draw.
+  }
+
+  const QPointF centerPx = center.toPxQPointF();
+  const bool drawLine =
+      lineColor.isValid() && ((lineWidth > 0) || (!fillColor.isValid()));
+  mWriter.writeEmptyElement("circle");
+  mWriter.writeAttribute("cx", toNumber(centerPx.x()));
+  mWriter.writeAttribute("cy", toNumber(centerPx.y()));
+  mWriter.writeAttribute("r", toNumber(diameter.toPx() / 2));
+  if (drawLine) {
+    writeStroke(lineColor, lineWidth);
+  }
+  writeFill(fillColor);
+}
+
+void SvgWriter::drawSlot(const Path& path, const PositiveLength& diameter,
+                         const Length& lineWidth, const QColor& lineColor,
+                         const QColor& fillColor) noexcept {
+  for (const Path& segment : path.toOutlineStrokes(diameter)) {
+    drawPath(segment, lineWidth, lineColor, fillColor);
+  }
+}
+
+void SvgWriter::drawInvisibleText(const Point& position, const Angle& rotation,
+                                  const Length& height,
+                                  const Alignment& alignment,
+                                  const QString& text,
+                                  bool mirrorInPlace) noexcept {
+  if (text.trimmed().isEmpty()) {
+    return;  // Nothing to draw.
+  }
+
+  // Same orientation logic as in GraphicsPainter::drawText().
+  const bool rotate180 = Toolbox::isTextUpsideDown(rotation, false);
+  Alignment align = rotate180 ? alignment.mirrored() : alignment;
+  if (mirrorInPlace) {
+    align.mirrorH();
+  }
+  const QPointF posPx = position.toPxQPointF();
+  QString transform =
+      QString("translate(%1 %2) rotate(%3)")
+          .arg(toNumber(posPx.x()), toNumber(posPx.y()),
+               toNumber(-rotation.mappedTo180deg().toDeg() +
+                        (rotate180 ? 180 : 0)));
+  if (mirrorInPlace) {
+    transform += " scale(-1 1)";
+  }
+  QString anchor = "start";
+  if (align.getH() == HAlign::center()) {
+    anchor = "middle";
+  } else if (align.getH() == HAlign::right()) {
+    anchor = "end";
+  }
+  QString baseline = "text-after-edge";
+  if (align.getV() == VAlign::center()) {
+    baseline = "central";
+  } else if (align.getV() == VAlign::top()) {
+    baseline = "text-before-edge";
+  }
+
+  // No fill and no stroke, so the text is invisible but still selectable
+  // and searchable.
+  mWriter.writeStartElement("text");
+  mWriter.writeAttribute("transform", transform);
+  mWriter.writeAttribute("font-family", "monospace");
+  mWriter.writeAttribute("font-size", toNumber(height.toPx()));
+  mWriter.writeAttribute("text-anchor", anchor);
+  mWriter.writeAttribute("dominant-baseline", baseline);
+  mWriter.writeCharacters(text);
+  mWriter.writeEndElement();  // text
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QString SvgWriter::toPathData(const Path& path) noexcept {
+  QString data;
+  const QVector<Vertex>& vertices = path.getVertices();
+  for (int i = 0; i < vertices.count(); ++i) {
+    const Vertex& v = vertices.at(i);
+    const QPointF posPx = v.getPos().toPxQPointF();
+    const QString pos = toNumber(posPx.x()) % " " % toNumber(posPx.y());
+    if (i == 0) {
+      data += "M" % pos;
+      continue;
+    }
+    const Vertex& v0 = vertices.at(i - 1);
+    if ((v0.getAngle() == 0) || (v0.getPos() == v.getPos())) {
+      data += "L" % pos;
+    } else {
+      // Positive angles are counterclockwise, which is a sweep flag of 0
+      // since the Y axis is inverted.
+      const qreal radiusPx =
+          Toolbox::arcRadius(v0.getPos(), v.getPos(), v0.getAngle())
+              .abs()
+              .toPx();
+      const bool largeArc = v0.getAngle().abs() > Angle::deg180();
+      const bool sweep = v0.getAngle() < 0;
+      data += "A" % toNumber(radiusPx) % " " % toNumber(radiusPx) % " 0 " %
+          QString::number(largeArc ? 1 : 0) % " " %
+          QString::number(sweep ? 1 : 0) % " " % pos;
+    }
+  }
+  if ((vertices.count() > 2) && path.isClosed()) {
+    data += "Z";
+  }
+  return data;
+}
+
+QString SvgWriter::toTransform(const QTransform& transform) noexcept {
+  if (transform.type() <= QTransform::TxTranslate) {
+    return QString("translate(%1 %2)")
+        .arg(toNumber(transform.dx()), toNumber(transform.dy()));
+  } else {
+    return QString("matrix(%1 %2 %3 %4 %5 %6)")
+        .arg(toNumber(transform.m11()), toNumber(transform.m12()),
+             toNumber(transform.m21()), toNumber(transform.m22()),
+             toNumber(transform.dx()), toNumber(transform.dy()));
+  }
+}
+
+QString SvgWriter::toNumber(qreal value) noexcept {
+  QString s = QString::number(value, 'f', 5);
+  while (s.endsWith('0')) {
+    s.chop(1);
+  }
+  if (s.endsWith('.')) {
+    s.chop(1);
+  }
+  if (s == "-0") {
+    s = "0";
+  }
+  return s;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void SvgWriter::writeStroke(const QColor& color, const Length& width) noexcept {
+  mWriter.writeAttribute("stroke", color.name());
+  if (color.alpha() < 255) {
+    mWriter.writeAttribute("stroke-opacity", toNumber(color.alphaF()));
+  }
+  mWriter.writeAttribute("stroke-width", toNumber(getLineWidthPx(width)));
+}
+
+void SvgWriter::writeFill(const QColor& color) noexcept {
+  if (color.isValid()) {
+    mWriter.writeAttribute("fill", color.name());
+    if (color.alpha() < 255) {
+      mWriter.writeAttribute("fill-opacity", toNumber(color.alphaF()));
+    }
+  }
+}
+
+qreal SvgWriter::getLineWidthPx(const Length& width) const noexcept {
+  return std::max(width, *mMinLineWidth).toPx();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
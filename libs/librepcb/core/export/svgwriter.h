@@ -0,0 +1,149 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_SVGWRITER_H
+#define LIBREPCB_CORE_SVGWRITER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../types/alignment.h"
+#include "../types/angle.h"
+#include "../types/length.h"
+#include "../types/point.h"
+
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Path;
+
+/*******************************************************************************
+ *  Class SvgWriter
+ ******************************************************************************/
+
+/**
+ * @brief Streaming writer for SVG files with native geometry
+ *
+ * In contrast to QSvgGenerator, this writer takes LibrePCB geometry directly
+ * and writes arcs as SVG arc commands and circles as `<circle>` elements
+ * instead of flattened Bézier curves. Repeated content (e.g. footprints) can
+ * be defined once with #beginDefinition() and then referenced multiple times
+ * with #drawDefinition(). All elements are written immediately to the
+ * output device, so no document is kept in memory.
+ *
+ * The draw methods behave the same way as the corresponding methods of
+ * ::librepcb::GraphicsPainter, i.e. all coordinates are in pixels (with
+ * inverted Y axis) and invalid colors are not drawn.
+ */
+class SvgWriter final {
+public:
+  // Constructors / Destructor
+  SvgWriter() = delete;
+  SvgWriter(const SvgWriter& other) = delete;
+  explicit SvgWriter(QIODevice& device) noexcept;
+  ~SvgWriter() noexcept;
+
+  // Getters
+  bool hasError() const noexcept { return mWriter.hasError(); }
+
+  // Setters
+  void setMinLineWidth(const UnsignedLength& width) noexcept {
+    mMinLineWidth = width;
+  }
+
+  // General Methods
+  void beginDocument(const QString& title, const QSizeF& sizeMm,
+                     const QRectF& viewBox) noexcept;
+  void endDocument() noexcept;
+  void beginGroup(const QTransform& transform) noexcept;
+  void endGroup() noexcept;
+  void beginDefinition(const QString& id) noexcept;
+  void endDefinition() noexcept;
+  void drawDefinition(const QString& id, const QTransform& transform) noexcept;
+  void fillRect(const QRectF& rect, const QColor& color) noexcept;
+  void drawLine(const Point& p1, const Point& p2, const Length& width,
+                const QColor& color) noexcept;
+  void drawPath(const Path& path, const Length& lineWidth,
+                const QColor& lineColor, const QColor& fillColor) noexcept;
+  void drawArea(const QVector<Path>& paths, const QColor& color) noexcept;
+  void drawCircle(const Point& center, const Length& diameter,
+                  const Length& lineWidth, const QColor& lineColor,
+                  const QColor& fillColor) noexcept;
+  void drawSlot(const Path& path, const PositiveLength& diameter,
+                const Length& lineWidth, const QColor& lineColor,
+                const QColor& fillColor) noexcept;
+  void drawInvisibleText(const Point& position, const Angle& rotation,
+                         const Length& height, const Alignment& alignment,
+                         const QString& text, bool mirrorInPlace) noexcept;
+
+  // Operator Overloadings
+  SvgWriter& operator=(const SvgWriter& rhs) = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Convert a path to SVG path data
+   *
+   * @param path  The path to convert.
+   *
+   * @return The path data (the `d` attribute of a `<path>` element) with
+   *         lines and arcs in pixel coordinates.
+   */
+  static QString toPathData(const Path& path) noexcept;
+
+  /**
+   * @brief Convert a transformation to the SVG `transform` attribute
+   *
+   * @param transform The transformation to convert.
+   *
+   * @return The transformation as `matrix()`, or `translate()` if possible.
+   */
+  static QString toTransform(const QTransform& transform) noexcept;
+
+  /**
+   * @brief Convert a number to its shortest SVG representation
+   *
+   * @param value The value to convert.
+   *
+   * @return The value rounded to 5 decimals, without trailing zeros.
+   */
+  static QString toNumber(qreal value) noexcept;
+
+private:  // Methods
+  void writeStroke(const QColor& color, const Length& width) noexcept;
+  void writeFill(const QColor& color) noexcept;
+  qreal getLineWidthPx(const Length& width) const noexcept;
+
+private:  // Data
+  QXmlStreamWriter mWriter;
+  UnsignedLength mMinLineWidth;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
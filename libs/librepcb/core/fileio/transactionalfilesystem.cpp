@@ -25,9 +25,9 @@
 #include "../serialization/sexpression.h"
 #include "../utils/toolbox.h"
 #include "fileutils.h"
+#include "zipwriter.h"
 
 #include <quazip/quazip.h>
-#include <quazip/quazipdir.h>
 #include <quazip/quazipfile.h>
 
 /*******************************************************************************
@@ -240,43 +240,27 @@ void TransactionalFileSystem::loadFromZip(const FilePath& fp) {
 }
 
 QByteArray TransactionalFileSystem::exportToZip(FilterFunction filter) const {
-  FilePath fp = FilePath::getRandomTempPath();
   QBuffer buffer;
-  QuaZip zip(&buffer);
-  if (!zip.open(QuaZip::mdCreate)) {
-    throw RuntimeError(__FILE__, __LINE__, tr("Failed to create ZIP file."));
-  }
-  try {
-    QuaZipFile file(&zip);
-    exportDirToZip(file, fp, "", filter);
-    zip.close();
-  } catch (const Exception& e) {
-    // Remove ZIP file because it is not complete
-    QFile(fp.toStr()).remove();
-    zip.close();
-    throw;
-  }
+  buffer.open(QIODevice::WriteOnly);
+  ZipWriter zip(buffer);
+  exportDirToZip(zip, "", filter);  // can throw
+  zip.finish();  // can throw
   return buffer.buffer();
 }
 
 void TransactionalFileSystem::exportToZip(const FilePath& fp,
                                           FilterFunction filter) const {
-  QuaZip zip(fp.toStr());
-  if (!zip.open(QuaZip::mdCreate)) {
-    throw RuntimeError(
-        __FILE__, __LINE__,
-        tr("Failed to create the ZIP file '%1'.").arg(fp.toNative()));
-  }
-  try {
-    QuaZipFile file(&zip);
-    exportDirToZip(file, fp, "", filter);
-    zip.close();
-  } catch (const Exception& e) {
-    // Remove ZIP file because it is not complete
-    QFile(fp.toStr()).remove();
-    zip.close();
-    throw;
-  }
+  // In case the exported ZIP file is located inside this file system, we
+  // have to skip it. Otherwise we would get a ZIP inside the ZIP file.
+  const QString zipFilePath = fp.toRelative(mFilePath);
+  auto zipFilter = [&filter, &zipFilePath](const QString& filePath) {
+    return (filePath != zipFilePath) && ((!filter) || filter(filePath));
+  };
+
+  // Note: The ZIP file is removed if it is not completed.
+  ZipWriter zip(fp);  // can throw
+  exportDirToZip(zip, "", zipFilter);  // can throw
+  zip.finish();  // can throw
 }
 
 void TransactionalFileSystem::discardChanges() noexcept {
@@ -366,6 +350,19 @@ void TransactionalFileSystem::save() {
  *  Static Methods
  ******************************************************************************/
 
+std::shared_ptr<TransactionalFileSystem>
+    TransactionalFileSystem::openTemporary() {
+  const FilePath fp = FilePath::getRandomTempPath();
+  TransactionalFileSystem* fs = new TransactionalFileSystem(fp, true);
+  // Destroy the file system before removing the directory since it has a
+  // lock on the directory.
+  return std::shared_ptr<TransactionalFileSystem>(
+      fs, [fp](TransactionalFileSystem* obj) {
+        delete obj;
+        QDir(fp.toStr()).removeRecursively();
+      });
+}
+
 QString TransactionalFileSystem::cleanPath(QString path) noexcept {
   return path.trimmed()
       .replace('\\', '/')
@@ -392,8 +389,7 @@ bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   return false;
 }
 
-void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
-                                             const FilePath& zipFp,
+void TransactionalFileSystem::exportDirToZip(ZipWriter& zip,
                                              const QString& dir,
                                              FilterFunction filter) const {
   QString path = dir.isEmpty() ? dir : dir % "/";
@@ -402,36 +398,21 @@ void TransactionalFileSystem::exportDirToZip(QuaZipFile& file,
   foreach (const QString& dirname, getDirs(dir)) {
     // skip dotdirs, e.g. ".git", ".svn", ".autosave", ".backup"
     if (dirname.startsWith('.')) continue;
-    exportDirToZip(file, zipFp, path % dirname, filter);
+    exportDirToZip(zip, path % dirname, filter);
   }
 
   // export files
   foreach (const QString& filename, getFiles(dir)) {
     QString filepath = path % filename;
-    if (filepath == zipFp.toRelative(mFilePath)) {
-      // In case the exported ZIP file is located inside this file system,
-      // we have to skip it. Otherwise we would get a ZIP inside the ZIP file.
-      continue;
-    }
     // skip lock file
     if (filename == ".lock") continue;
     // apply custom filter
     if (filter && (!filter(filepath))) continue;
-    // read file content and add it to the ZIP archive
-    const QByteArray& content = read(filepath);  // can throw
-    QuaZipNewInfo newFileInfo(filepath);
-    newFileInfo.setPermissions(QFileDevice::ReadOwner | QFileDevice::ReadGroup |
-                               QFileDevice::ReadOther |
-                               QFileDevice::WriteOwner);
-    if (!file.open(QIODevice::WriteOnly, newFileInfo)) {
-      throw RuntimeError(__FILE__, __LINE__);
-    }
-    qint64 bytesWritten = file.write(content);
-    file.close();
-    if (bytesWritten != content.length()) {
-      throw RuntimeError(__FILE__, __LINE__,
-                         tr("Failed to write file '%1' to '%2'.")
-                             .arg(filepath, zipFp.toNative()));
+    // add file to the ZIP archive, unmodified files are read by the writer
+    if (mModifiedFiles.contains(filepath)) {
+      zip.addFile(filepath, mModifiedFiles.value(filepath));  // can throw
+    } else {
+      zip.addFile(filepath, mFilePath.getPathTo(filepath));  // can throw
     }
   }
 }
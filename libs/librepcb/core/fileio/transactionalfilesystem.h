@@ -34,11 +34,10 @@
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
-
-class QuaZipFile;
-
 namespace librepcb {
 
+class ZipWriter;
+
 /*******************************************************************************
  *  Class TransactionalFileSystem
  ******************************************************************************/
@@ -194,12 +193,22 @@ public:
       QObject* parent = nullptr) {
     return open(filepath, true, restoreCallback, lockCallback, parent);
   }
+
+  /**
+   * @brief Open a writable file system in a new temporary directory
+   *
+   * The directory is removed when the last reference to the returned file
+   * system is released, so it can safely be shared between several owners.
+   *
+   * @return The new file system.
+   */
+  static std::shared_ptr<TransactionalFileSystem> openTemporary();
   static QString cleanPath(QString path) noexcept;
 
 private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
-  void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
-                      const QString& dir, FilterFunction filter) const;
+  void exportDirToZip(ZipWriter& zip, const QString& dir,
+                      FilterFunction filter) const;
   void saveDiff(const QString& type) const;
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
@@ -0,0 +1,377 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "zipwriter.h"
+
+#include "../exceptions.h"
+#include "../utils/scopeguard.h"
+#include "fileutils.h"
+
+#include <QtConcurrent>
+#include <QtCore>
+
+#include <zlib.h>
+
+#include <cstring>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+// Files larger than this are compressed chunk by chunk on the calling thread.
+static const qint64 sStreamingThreshold = 16 * 1024 * 1024;
+static const qint64 sChunkSize = 1024 * 1024;
+
+// Maximum memory held by compressed files waiting to be written.
+static const qint64 sMaxPendingBytes = 64 * 1024 * 1024;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ZipWriter::ZipWriter(const FilePath& fp)
+  : mFilePath(fp),
+    mFile(new QFile(fp.toStr())),
+    mDevice(*mFile),
+    mDosTime(0),
+    mDosDate(0),
+    mPending(),
+    mPendingBytes(0),
+    mMaxPendingEntries(QThread::idealThreadCount() * 2),
+    mEntries(),
+    mFinished(false) {
+  FileUtils::makePath(fp.getParentDir());  // can throw
+  if (!mFile->open(QIODevice::WriteOnly)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not open or create file \"%1\": %2")
+                           .arg(fp.toNative(), mFile->errorString()));
+  }
+  setModificationTime(QDateTime::currentDateTime());
+}
+
+ZipWriter::ZipWriter(QIODevice& device) noexcept
+  : mFilePath(),
+    mFile(),
+    mDevice(device),
+    mDosTime(0),
+    mDosDate(0),
+    mPending(),
+    mPendingBytes(0),
+    mMaxPendingEntries(QThread::idealThreadCount() * 2),
+    mEntries(),
+    mFinished(false) {
+  Q_ASSERT(mDevice.isWritable() && (!mDevice.isSequential()));
+  setModificationTime(QDateTime::currentDateTime());
+}
+
+ZipWriter::~ZipWriter() noexcept {
+  // Don't leave compression jobs behind.
+  for (PendingEntry& entry : mPending) {
+    entry.future.waitForFinished();
+  }
+
+  // Remove the ZIP file because it is not complete.
+  if (mFile && (!mFinished)) {
+    mFile->close();
+    if (!mFile->remove()) {
+      qWarning() << "Failed to remove incomplete ZIP file:"
+                 << mFilePath.toNative();
+    }
+  }
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ZipWriter::addFile(const QString& path, const QByteArray& content) {
+  makeRoomForPendingEntry(content.size());  // can throw
+  mPending.enqueue(PendingEntry{path, content.size(),
+                                QtConcurrent::run(&ZipWriter::compress,
+                                                  content)});
+  mPendingBytes += content.size();
+}
+
+void ZipWriter::addFile(const QString& path, const FilePath& source) {
+  const qint64 size = QFileInfo(source.toStr()).size();
+  if (size > sStreamingThreshold) {
+    // Keep the order of the files in the archive.
+    while (!mPending.isEmpty()) {
+      writeNextPendingEntry();  // can throw
+    }
+    streamFile(path, source);  // can throw
+  } else {
+    makeRoomForPendingEntry(size);  // can throw
+    mPending.enqueue(PendingEntry{
+        path, size, QtConcurrent::run(&ZipWriter::compressFile, source)});
+    mPendingBytes += size;
+  }
+}
+
+void ZipWriter::finish() {
+  while (!mPending.isEmpty()) {
+    writeNextPendingEntry();  // can throw
+  }
+
+  // Central directory.
+  const quint32 centralDirOffset = toUInt32(mDevice.pos());  // can throw
+  foreach (const Entry& entry, mEntries) {
+    write(createCentralHeader(entry));  // can throw
+  }
+  const quint32 centralDirSize =
+      toUInt32(mDevice.pos() - centralDirOffset);  // can throw
+  if (mEntries.count() > 0xFFFF) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Too many files for a ZIP archive."));
+  }
+
+  // End of central directory record.
+  QByteArray data;
+  QDataStream s(&data, QIODevice::WriteOnly);
+  s.setByteOrder(QDataStream::LittleEndian);
+  s << quint32(0x06054b50) << quint16(0) << quint16(0)
+    << quint16(mEntries.count()) << quint16(mEntries.count())
+    << centralDirSize << centralDirOffset << quint16(0);
+  write(data);  // can throw
+
+  if (mFile) {
+    mFile->close();
+    if (mFile->error() != QFileDevice::NoError) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Could not write to file \"%1\": %2")
+                             .arg(mFilePath.toNative(), mFile->errorString()));
+    }
+  }
+  mFinished = true;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void ZipWriter::setModificationTime(const QDateTime& dt) noexcept {
+  // MS-DOS format, used by all entries of the archive.
+  mDosTime = (dt.time().hour() << 11) | (dt.time().minute() << 5) |
+      (dt.time().second() / 2);
+  mDosDate = ((dt.date().year() - 1980) << 9) | (dt.date().month() << 5) |
+      dt.date().day();
+}
+
+void ZipWriter::makeRoomForPendingEntry(qint64 bytes) {
+  while ((!mPending.isEmpty()) &&
+         ((mPending.count() >= mMaxPendingEntries) ||
+          (mPendingBytes + bytes > sMaxPendingBytes))) {
+    writeNextPendingEntry();  // can throw
+  }
+}
+
+void ZipWriter::writeNextPendingEntry() {
+  const PendingEntry entry = mPending.dequeue();
+  mPendingBytes -= entry.bytes;
+  const Compressed compressed = entry.future.result();  // blocks
+  if (!compressed.error.isNull()) {
+    throw RuntimeError(__FILE__, __LINE__, compressed.error);
+  }
+  writeEntry(entry.path, compressed);  // can throw
+}
+
+void ZipWriter::writeEntry(const QString& path, const Compressed& compressed) {
+  Entry entry = createEntry(path);
+  entry.method = compressed.method;
+  entry.crc = compressed.crc;
+  entry.compressedSize = toUInt32(compressed.data.size());  // can throw
+  entry.size = toUInt32(compressed.size);  // can throw
+  entry.offset = toUInt32(mDevice.pos());  // can throw
+  write(createLocalHeader(entry));  // can throw
+  write(compressed.data);  // can throw
+  mEntries.append(entry);
+}
+
+void ZipWriter::streamFile(const QString& path, const FilePath& source) {
+  QFile file(source.toStr());
+  if (!file.open(QIODevice::ReadOnly)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Could not open file \"%1\": %2")
+                           .arg(source.toNative(), file.errorString()));
+  }
+
+  // Write the local header first, the sizes are updated afterwards.
+  Entry entry = createEntry(path);
+  entry.method = 8;
+  entry.offset = toUInt32(mDevice.pos());  // can throw
+  write(createLocalHeader(entry));  // can throw
+
+  z_stream stream;
+  std::memset(&stream, 0, sizeof(stream));
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw RuntimeError(__FILE__, __LINE__, tr("Failed to initialize zlib."));
+  }
+  auto sg = scopeGuard([&stream]() { deflateEnd(&stream); });
+  QByteArray output(sChunkSize, Qt::Uninitialized);
+  uLong crc = crc32(0L, Z_NULL, 0);
+  qint64 size = 0;
+  qint64 compressedSize = 0;
+  int flush = Z_NO_FLUSH;
+  do {
+    const QByteArray input = file.read(sChunkSize);
+    if (input.isEmpty() && (!file.atEnd())) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Could not read file \"%1\": %2")
+                             .arg(source.toNative(), file.errorString()));
+    }
+    crc = crc32(crc, reinterpret_cast<const Bytef*>(input.constData()),
+                input.size());
+    size += input.size();
+    flush = file.atEnd() ? Z_FINISH : Z_NO_FLUSH;
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = input.size();
+    do {
+      stream.next_out = reinterpret_cast<Bytef*>(output.data());
+      stream.avail_out = output.size();
+      if (deflate(&stream, flush) == Z_STREAM_ERROR) {
+        throw RuntimeError(__FILE__, __LINE__, tr("Failed to compress data."));
+      }
+      const int length = output.size() - stream.avail_out;
+      write(QByteArray::fromRawData(output.constData(), length));  // can throw
+      compressedSize += length;
+    } while (stream.avail_out == 0);
+  } while (flush != Z_FINISH);
+
+  // Update the local header.
+  entry.crc = crc;
+  entry.compressedSize = toUInt32(compressedSize);  // can throw
+  entry.size = toUInt32(size);  // can throw
+  const qint64 endPos = mDevice.pos();
+  const QByteArray header = createLocalHeader(entry);
+  if ((!mDevice.seek(entry.offset)) ||
+      (mDevice.write(header) != header.size()) || (!mDevice.seek(endPos))) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("Failed to write the ZIP file: %1").arg(mDevice.errorString()));
+  }
+  mEntries.append(entry);
+}
+
+void ZipWriter::write(const QByteArray& data) {
+  if (mDevice.write(data) != data.size()) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("Failed to write the ZIP file: %1").arg(mDevice.errorString()));
+  }
+}
+
+ZipWriter::Entry ZipWriter::createEntry(const QString& path) const noexcept {
+  Entry entry{path.toUtf8(), 0, 0, 0, 0, 0, 0};
+  foreach (char c, entry.name) {
+    if (static_cast<uchar>(c) >= 0x80) {
+      entry.flags |= 0x0800;  // File name is UTF-8 encoded.
+      break;
+    }
+  }
+  return entry;
+}
+
+QByteArray ZipWriter::createLocalHeader(const Entry& entry) const noexcept {
+  QByteArray data;
+  QDataStream s(&data, QIODevice::WriteOnly);
+  s.setByteOrder(QDataStream::LittleEndian);
+  s << quint32(0x04034b50) << quint16(20) << entry.flags << entry.method
+    << mDosTime << mDosDate << entry.crc << entry.compressedSize << entry.size
+    << quint16(entry.name.size()) << quint16(0);
+  return data + entry.name;
+}
+
+QByteArray ZipWriter::createCentralHeader(const Entry& entry) const noexcept {
+  // Mark the files as created on Unix, with permissions 0644.
+  const quint16 versionMadeBy = (3 << 8) | 20;
+  const quint32 externalAttributes = 0100644U << 16;
+  QByteArray data;
+  QDataStream s(&data, QIODevice::WriteOnly);
+  s.setByteOrder(QDataStream::LittleEndian);
+  s << quint32(0x02014b50) << versionMadeBy << quint16(20) << entry.flags
+    << entry.method << mDosTime << mDosDate << entry.crc
+    << entry.compressedSize << entry.size << quint16(entry.name.size())
+    << quint16(0) << quint16(0) << quint16(0) << quint16(0)
+    << externalAttributes << entry.offset;
+  return data + entry.name;
+}
+
+ZipWriter::Compressed ZipWriter::compress(const QByteArray& content) noexcept {
+  // Note: This method is called from worker threads.
+  Compressed result{0, 0, content.size(), QByteArray(), QString()};
+  result.crc = crc32(crc32(0L, Z_NULL, 0),
+                     reinterpret_cast<const Bytef*>(content.constData()),
+                     content.size());
+
+  z_stream stream;
+  std::memset(&stream, 0, sizeof(stream));
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    result.error = tr("Failed to initialize zlib.");
+    return result;
+  }
+  result.data.resize(deflateBound(&stream, content.size()));
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(content.data()));
+  stream.avail_in = content.size();
+  stream.next_out = reinterpret_cast<Bytef*>(result.data.data());
+  stream.avail_out = result.data.size();
+  const int ret = deflate(&stream, Z_FINISH);
+  result.data.resize(stream.total_out);
+  deflateEnd(&stream);
+  if (ret != Z_STREAM_END) {
+    result.error = tr("Failed to compress data.");
+    return result;
+  }
+  result.method = 8;
+
+  // Store incompressible content as is, like most ZIP tools do.
+  if (result.data.size() >= content.size()) {
+    result.method = 0;
+    result.data = content;
+  }
+  return result;
+}
+
+ZipWriter::Compressed ZipWriter::compressFile(const FilePath& fp) noexcept {
+  // Note: This method is called from worker threads.
+  try {
+    return compress(FileUtils::readFile(fp));  // can throw
+  } catch (const Exception& e) {
+    return Compressed{0, 0, 0, QByteArray(), e.getMsg()};
+  }
+}
+
+quint32 ZipWriter::toUInt32(qint64 value) {
+  if ((value < 0) || (value > 0xFFFFFFFFLL)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The ZIP archive exceeds the size limit of 4GB."));
+  }
+  return static_cast<quint32>(value);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
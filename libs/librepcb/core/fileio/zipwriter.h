@@ -0,0 +1,174 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_ZIPWRITER_H
+#define LIBREPCB_CORE_ZIPWRITER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "filepath.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class ZipWriter
+ ******************************************************************************/
+
+/**
+ * @brief Writes a ZIP archive sequentially to a file or device
+ *
+ * Added files are compressed concurrently on the global thread pool while
+ * the archive is written in the order the files were added. The number and
+ * total size of the files waiting to be written is limited, so the memory
+ * usage does not depend on the size of the archive. Large files added by
+ * their path are even compressed chunk by chunk instead of being loaded
+ * into memory.
+ *
+ * The archive is complete only after #finish() succeeded. If the writer is
+ * destroyed before, a destination file is removed again.
+ *
+ * @note  ZIP64 is not supported, so the archive size is limited to 4GB and
+ *        65535 files.
+ */
+class ZipWriter final {
+  Q_DECLARE_TR_FUNCTIONS(ZipWriter)
+
+  struct Compressed {
+    quint16 method;  ///< 0 = stored, 8 = deflated
+    quint32 crc;
+    qint64 size;  ///< Uncompressed size
+    QByteArray data;
+    QString error;  ///< Only set if the compression failed
+  };
+
+  struct Entry {
+    QByteArray name;  ///< UTF-8 encoded
+    quint16 flags;
+    quint16 method;
+    quint32 crc;
+    quint32 compressedSize;
+    quint32 size;
+    quint32 offset;  ///< Position of the local header
+  };
+
+  struct PendingEntry {
+    QString path;
+    qint64 bytes;  ///< Memory held until written
+    QFuture<Compressed> future;
+  };
+
+public:
+  // Constructors / Destructor
+  ZipWriter() = delete;
+  ZipWriter(const ZipWriter& other) = delete;
+
+  /**
+   * @brief Constructor to write into a file
+   *
+   * @param fp    The ZIP file to create. Parent directories are created if
+   *              needed, an existing file gets overwritten.
+   *
+   * @throw Exception if the file could not be opened.
+   */
+  explicit ZipWriter(const FilePath& fp);
+
+  /**
+   * @brief Constructor to write into an already opened device
+   *
+   * @param device  The device to write to. Must be writable and random
+   *                access (e.g. a QBuffer), and must outlive this object.
+   */
+  explicit ZipWriter(QIODevice& device) noexcept;
+
+  ~ZipWriter() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Add a file from memory
+   *
+   * @param path      Path within the archive, using '/' as separator.
+   * @param content   File content.
+   *
+   * @throw Exception if writing a previously added file failed.
+   */
+  void addFile(const QString& path, const QByteArray& content);
+
+  /**
+   * @brief Add a file from disk
+   *
+   * The file is read in a worker thread, or chunk by chunk if it is large.
+   *
+   * @param path      Path within the archive, using '/' as separator.
+   * @param source    The file to add.
+   *
+   * @throw Exception if reading or writing a file failed.
+   */
+  void addFile(const QString& path, const FilePath& source);
+
+  /**
+   * @brief Write all pending files and the central directory
+   *
+   * @throw Exception if writing the archive failed.
+   */
+  void finish();
+
+  // Operator Overloadings
+  ZipWriter& operator=(const ZipWriter& rhs) = delete;
+
+private:  // Methods
+  void setModificationTime(const QDateTime& dt) noexcept;
+  void makeRoomForPendingEntry(qint64 bytes);
+  void writeNextPendingEntry();
+  void writeEntry(const QString& path, const Compressed& compressed);
+  void streamFile(const QString& path, const FilePath& source);
+  void write(const QByteArray& data);
+  Entry createEntry(const QString& path) const noexcept;
+  QByteArray createLocalHeader(const Entry& entry) const noexcept;
+  QByteArray createCentralHeader(const Entry& entry) const noexcept;
+  static Compressed compress(const QByteArray& content) noexcept;
+  static Compressed compressFile(const FilePath& fp) noexcept;
+  static quint32 toUInt32(qint64 value);
+
+private:  // Data
+  FilePath mFilePath;  ///< Only valid if writing to a file
+  QScopedPointer<QFile> mFile;  ///< Only valid if writing to a file
+  QIODevice& mDevice;
+  quint16 mDosTime;
+  quint16 mDosDate;
+  QQueue<PendingEntry> mPending;
+  qint64 mPendingBytes;
+  int mMaxPendingEntries;
+  QList<Entry> mEntries;
+  bool mFinished;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
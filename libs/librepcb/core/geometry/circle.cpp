@@ -37,6 +37,7 @@ Circle::Circle(const Circle& other) noexcept
   : onEdited(*this),
     mUuid(other.mUuid),
     mLayerName(other.mLayerName),
+    mLayerId(other.mLayerId),
     mLineWidth(other.mLineWidth),
     mIsFilled(other.mIsFilled),
     mIsGrabArea(other.mIsGrabArea),
@@ -54,6 +55,7 @@ Circle::Circle(const Uuid& uuid, const GraphicsLayerName& layerName,
   : onEdited(*this),
     mUuid(uuid),
     mLayerName(layerName),
+    mLayerId(mLayerName),
     mLineWidth(lineWidth),
     mIsFilled(fill),
     mIsGrabArea(isGrabArea),
@@ -65,6 +67,7 @@ Circle::Circle(const SExpression& node)
   : onEdited(*this),
     mUuid(deserialize<Uuid>(node.getChild("@0"))),
     mLayerName(deserialize<GraphicsLayerName>(node.getChild("layer/@0"))),
+    mLayerId(mLayerName),
     mLineWidth(deserialize<UnsignedLength>(node.getChild("width/@0"))),
     mIsFilled(deserialize<bool>(node.getChild("fill/@0"))),
     mIsGrabArea(deserialize<bool>(node.getChild("grab_area/@0"))),
@@ -85,6 +88,7 @@ bool Circle::setLayerName(const GraphicsLayerName& name) noexcept {
   }
 
   mLayerName = name;
+  mLayerId = GraphicsLayerId(mLayerName);
   onEdited.notify(Event::LayerNameChanged);
   return true;
 }
@@ -106,6 +106,26 @@ Path Path::toClosedPath() const noexcept {
   return p;
 }
 
+Path Path::toSimplifiedPath(const UnsignedLength& tolerance) const noexcept {
+  if ((tolerance == 0) || (mVertices.count() < 3)) {
+    return *this;
+  }
+  Path p;
+  p.mVertices.reserve(mVertices.count());
+  const int lastIndex = mVertices.count() - 1;
+  for (int i = 0; i <= lastIndex; ++i) {
+    const Vertex& v = mVertices.at(i);
+    if ((i > 0) && (i < lastIndex) &&
+        (p.mVertices.last().getAngle() == 0) && (v.getAngle() == 0) &&
+        ((v.getPos() - p.mVertices.last().getPos()).getLength() <
+         tolerance)) {
+      continue;  // Skip vertex of a short straight segment.
+    }
+    p.mVertices.append(v);
+  }
+  return p;
+}
+
 QVector<Path> Path::toOutlineStrokes(const PositiveLength& width) const
     noexcept {
   QVector<Path> paths;
@@ -77,6 +77,20 @@ public:
   UnsignedLength getTotalStraightLength() const noexcept;
   Point calcNearestPointBetweenVertices(const Point& p) const noexcept;
   Path toClosedPath() const noexcept;
+
+  /**
+   * @brief Get a simplified (decimated) version of this path
+   *
+   * Straight segments shorter than the given tolerance are merged by
+   * removing their end vertex, while the first and the last vertex as well
+   * as arc segments are always kept. Intended for drawing paths with many
+   * vertices (e.g. plane fragments) in zoomed out views.
+   *
+   * @param tolerance   Minimum length of straight segments to keep.
+   *
+   * @return The simplified path.
+   */
+  Path toSimplifiedPath(const UnsignedLength& tolerance) const noexcept;
   QVector<Path> toOutlineStrokes(const PositiveLength& width) const noexcept;
   const QPainterPath& toQPainterPathPx() const noexcept;
 
@@ -0,0 +1,139 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "pathdelta.h"
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+PathDelta::PathDelta() noexcept
+  : mOffset(), mReplaceIndex(0), mReplaceCount(0), mReplacement() {
+}
+
+PathDelta::PathDelta(const PathDelta& other) noexcept
+  : mOffset(other.mOffset),
+    mReplaceIndex(other.mReplaceIndex),
+    mReplaceCount(other.mReplaceCount),
+    mReplacement(other.mReplacement) {
+}
+
+PathDelta::PathDelta(const Path& from, const Path& to) noexcept
+  : mOffset(), mReplaceIndex(0), mReplaceCount(0), mReplacement() {
+  const QVector<Vertex>& a = from.getVertices();
+  const QVector<Vertex>& b = to.getVertices();
+
+  // Check if the path was only translated, which is the most common
+  // modification (e.g. when dragging items).
+  if ((a.count() == b.count()) && (!a.isEmpty())) {
+    const Point offset = b.first().getPos() - a.first().getPos();
+    bool translated = true;
+    for (int i = 0; i < a.count(); ++i) {
+      if ((b.at(i).getPos() != (a.at(i).getPos() + offset)) ||
+          (b.at(i).getAngle() != a.at(i).getAngle())) {
+        translated = false;
+        break;
+      }
+    }
+    if (translated) {
+      mOffset = offset;
+      return;
+    }
+  }
+
+  // Otherwise only store the vertices which are different.
+  const int maxCommon = std::min(a.count(), b.count());
+  int prefix = 0;
+  while ((prefix < maxCommon) && (a.at(prefix) == b.at(prefix))) {
+    ++prefix;
+  }
+  int suffix = 0;
+  while ((suffix < (maxCommon - prefix)) &&
+         (a.at(a.count() - 1 - suffix) == b.at(b.count() - 1 - suffix))) {
+    ++suffix;
+  }
+  mReplaceIndex = prefix;
+  mReplaceCount = a.count() - prefix - suffix;
+  mReplacement = b.mid(prefix, b.count() - prefix - suffix);
+}
+
+PathDelta::~PathDelta() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+bool PathDelta::isEmpty() const noexcept {
+  return mOffset.isOrigin() && (mReplaceCount == 0) && mReplacement.isEmpty();
+}
+
+qint64 PathDelta::getRetainedSize() const noexcept {
+  return sizeof(PathDelta) + mReplacement.capacity() * qint64(sizeof(Vertex));
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+Path PathDelta::apply(const Path& from) const noexcept {
+  if (isEmpty()) {
+    return from;  // Keep the vertices implicitly shared.
+  }
+
+  if ((mReplaceCount == 0) && mReplacement.isEmpty()) {
+    return from.translated(mOffset);
+  }
+
+  const QVector<Vertex>& vertices = from.getVertices();
+  const int index = qBound(0, mReplaceIndex, vertices.count());
+  const int count = qBound(0, mReplaceCount, vertices.count() - index);
+  return Path(vertices.mid(0, index) + mReplacement +
+              vertices.mid(index + count));
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+PathDelta& PathDelta::operator=(const PathDelta& rhs) noexcept {
+  mOffset = rhs.mOffset;
+  mReplaceIndex = rhs.mReplaceIndex;
+  mReplaceCount = rhs.mReplaceCount;
+  mReplacement = rhs.mReplacement;
+  return *this;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,103 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_PATHDELTA_H
+#define LIBREPCB_CORE_PATHDELTA_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "path.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class PathDelta
+ ******************************************************************************/
+
+/**
+ * @brief The PathDelta class stores the difference between two paths
+ *
+ * Allows to keep a modified path without a full copy of its vertices, as
+ * long as the original path is available. This is used by undo commands
+ * which otherwise would keep both the old and the new path.
+ *
+ * A translated path is stored as a single offset. For any other
+ * modification, only the range of vertices which differ between the two
+ * paths is stored (vertices at the start and at the end which are equal in
+ * both paths are omitted). So in the worst case, all vertices of the new
+ * path are stored.
+ */
+class PathDelta final {
+public:
+  // Constructors / Destructor
+  PathDelta() noexcept;
+  PathDelta(const PathDelta& other) noexcept;
+  PathDelta(const Path& from, const Path& to) noexcept;
+  ~PathDelta() noexcept;
+
+  // Getters
+
+  /**
+   * @brief Check whether the two paths were equal
+   *
+   * @return True if #apply() returns the original path.
+   */
+  bool isEmpty() const noexcept;
+
+  /**
+   * @brief Estimate the memory occupied by this object
+   *
+   * @return Approximate size in bytes.
+   */
+  qint64 getRetainedSize() const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Restore the modified path
+   *
+   * @param from  The same path as passed to the constructor as `from`.
+   *
+   * @return The same path as passed to the constructor as `to`.
+   */
+  Path apply(const Path& from) const noexcept;
+
+  // Operator Overloadings
+  PathDelta& operator=(const PathDelta& rhs) noexcept;
+
+private:  // Data
+  Point mOffset;  ///< Translation of all vertices
+  int mReplaceIndex;  ///< Index of the first replaced vertex
+  int mReplaceCount;  ///< Number of replaced vertices of the original path
+  QVector<Vertex> mReplacement;  ///< Vertices to insert instead
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -23,7 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-#include "../graphics/graphicslayername.h"
+#include "../graphics/graphicslayerid.h"
 #include "../serialization/serializableobjectlist.h"
 #include "../types/length.h"
 #include "path.h"
@@ -72,6 +72,7 @@ public:
   // Getters
   const Uuid& getUuid() const noexcept { return mUuid; }
   const GraphicsLayerName& getLayerName() const noexcept { return mLayerName; }
+  const GraphicsLayerId& getLayerId() const noexcept { return mLayerId; }
   const UnsignedLength& getLineWidth() const noexcept { return mLineWidth; }
   bool isFilled() const noexcept { return mIsFilled; }
   bool isGrabArea() const noexcept { return mIsGrabArea; }
@@ -101,6 +102,7 @@ public:
 private:  // Data
   Uuid mUuid;
   GraphicsLayerName mLayerName;
+  GraphicsLayerId mLayerId;  ///< Cached ID of #mLayerName
   UnsignedLength mLineWidth;
   bool mIsFilled;
   bool mIsGrabArea;
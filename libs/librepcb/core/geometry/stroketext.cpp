@@ -53,6 +53,7 @@ StrokeText::StrokeText(const StrokeText& other) noexcept
   : onEdited(*this),
     mUuid(other.mUuid),
     mLayerName(other.mLayerName),
+    mLayerId(other.mLayerId),
     mText(other.mText),
     mPosition(other.mPosition),
     mRotation(other.mRotation),
@@ -81,6 +82,7 @@ StrokeText::StrokeText(const Uuid& uuid, const GraphicsLayerName& layerName,
   : onEdited(*this),
     mUuid(uuid),
     mLayerName(layerName),
+    mLayerId(mLayerName),
     mText(text),
     mPosition(pos),
     mRotation(rotation),
@@ -97,6 +99,7 @@ StrokeText::StrokeText(const SExpression& node)
   : onEdited(*this),
     mUuid(deserialize<Uuid>(node.getChild("@0"))),
     mLayerName(deserialize<GraphicsLayerName>(node.getChild("layer/@0"))),
+    mLayerId(mLayerName),
     mText(node.getChild("value/@0").getValue()),
     mPosition(node.getChild("position")),
     mRotation(deserialize<Angle>(node.getChild("rotation/@0"))),
@@ -177,6 +180,7 @@ bool StrokeText::setLayerName(const GraphicsLayerName& name) noexcept {
   }
 
   mLayerName = name;
+  mLayerId = GraphicsLayerId(mLayerName);
   onEdited.notify(Event::LayerNameChanged);
   return true;
 }
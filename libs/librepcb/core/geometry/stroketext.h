@@ -24,7 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../geometry/path.h"
-#include "../graphics/graphicslayername.h"
+#include "../graphics/graphicslayerid.h"
 #include "../serialization/serializableobjectlist.h"
 #include "../types/alignment.h"
 #include "../types/angle.h"
@@ -128,6 +128,7 @@ public:
   // Getters
   const Uuid& getUuid() const noexcept { return mUuid; }
   const GraphicsLayerName& getLayerName() const noexcept { return mLayerName; }
+  const GraphicsLayerId& getLayerId() const noexcept { return mLayerId; }
   const Point& getPosition() const noexcept { return mPosition; }
   const Angle& getRotation() const noexcept { return mRotation; }
   const PositiveLength& getHeight() const noexcept { return mHeight; }
@@ -181,6 +182,7 @@ public:
 private:  // Data
   Uuid mUuid;
   GraphicsLayerName mLayerName;
+  GraphicsLayerId mLayerId;  ///< Cached ID of #mLayerName
   QString mText;
   Point mPosition;
   Angle mRotation;
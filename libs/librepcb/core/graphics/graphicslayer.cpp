@@ -40,6 +40,7 @@ GraphicsLayer::GraphicsLayer(const GraphicsLayer& other) noexcept
   : QObject(nullptr),
     onEdited(*this),
     mName(other.mName),
+    mId(other.mId),
     mNameTr(other.mNameTr),
     mColor(other.mColor),
     mColorHighlighted(other.mColorHighlighted),
@@ -53,6 +54,7 @@ GraphicsLayer::GraphicsLayer(const QString& name, const QColor& color,
   : QObject(nullptr),
     onEdited(*this),
     mName(name),
+    mId(mName),
     mNameTr(getTranslation(mName)),
     mColor(color),
     mColorHighlighted(colorHighlighted),
@@ -106,6 +108,7 @@ void GraphicsLayer::setEnabled(bool enable) noexcept {
 
 GraphicsLayer& GraphicsLayer::operator=(const GraphicsLayer& rhs) noexcept {
   mName = rhs.mName;
+  mId = rhs.mId;
   mNameTr = rhs.mNameTr;
   mColor = rhs.mColor;
   mColorHighlighted = rhs.mColorHighlighted;
@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../utils/signalslot.h"
+#include "graphicslayerid.h"
 #include "graphicslayername.h"
 
 #include <QtCore>
@@ -146,6 +147,7 @@ public:
 
   // Getters
   const QString& getName() const noexcept { return mName; }
+  const GraphicsLayerId& getId() const noexcept { return mId; }
   const QString& getNameTr() const noexcept { return mNameTr; }
   const QColor& getColor(bool highlighted = false) const noexcept {
     return highlighted ? mColorHighlighted : mColor;
@@ -196,6 +198,7 @@ signals:
 
 protected:  // Data
   QString mName;  ///< Unique name which is used for serialization
+  GraphicsLayerId mId;  ///< ID of #mName for fast comparisons
   QString mNameTr;  ///< Layer name (translated into the user's language)
   QColor mColor;  ///< Color of graphics items on that layer
   QColor mColorHighlighted;  ///< Color of highlighted graphics items on that
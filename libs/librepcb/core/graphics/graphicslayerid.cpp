@@ -0,0 +1,202 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "graphicslayerid.h"
+
+#include "graphicslayer.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Table
+ ******************************************************************************/
+
+namespace {
+
+/**
+ * @brief Process wide, immutable table of all built-in layer names
+ *
+ * The table is built on first use (static initialization is thread-safe) and
+ * never modified afterwards, so all lookups are lock-free. ID 0 is reserved
+ * for unknown layer names, which are not added to the table.
+ */
+class GraphicsLayerIdTable final {
+public:
+  struct Entry {
+    QString name;
+    int mirrored;
+    bool copper;
+  };
+
+  static const GraphicsLayerIdTable& instance() noexcept {
+    static const GraphicsLayerIdTable table;
+    return table;
+  }
+
+  int find(const QString& name) const noexcept {
+    return mIds.value(name, -1);
+  }
+
+  int count() const noexcept { return mEntries.count(); }
+
+  const Entry& get(int id) const noexcept { return mEntries.at(id); }
+
+private:
+  GraphicsLayerIdTable() noexcept {
+    mEntries.append(Entry{QString(), 0, false});  // Unknown layer.
+    const char* const names[] = {
+        GraphicsLayer::sSchematicReferences,
+        GraphicsLayer::sSchematicSheetFrames,
+        GraphicsLayer::sSchematicNetLines,
+        GraphicsLayer::sSchematicNetLabels,
+        GraphicsLayer::sSchematicNetLabelAnchors,
+        GraphicsLayer::sSchematicDocumentation,
+        GraphicsLayer::sSchematicComments,
+        GraphicsLayer::sSchematicGuide,
+        GraphicsLayer::sSymbolOutlines,
+        GraphicsLayer::sSymbolGrabAreas,
+        GraphicsLayer::sSymbolHiddenGrabAreas,
+        GraphicsLayer::sSymbolNames,
+        GraphicsLayer::sSymbolValues,
+        GraphicsLayer::sSymbolPinCirclesOpt,
+        GraphicsLayer::sSymbolPinCirclesReq,
+        GraphicsLayer::sSymbolPinLines,
+        GraphicsLayer::sSymbolPinNames,
+        GraphicsLayer::sSymbolPinNumbers,
+        GraphicsLayer::sBoardReferences,
+        GraphicsLayer::sBoardSheetFrames,
+        GraphicsLayer::sBoardOutlines,
+        GraphicsLayer::sBoardMillingPth,
+        GraphicsLayer::sBoardDrillsNpth,
+        GraphicsLayer::sBoardPadsTht,
+        GraphicsLayer::sBoardViasTht,
+        GraphicsLayer::sBoardAirWires,
+        GraphicsLayer::sBoardMeasures,
+        GraphicsLayer::sBoardAlignment,
+        GraphicsLayer::sBoardDocumentation,
+        GraphicsLayer::sBoardComments,
+        GraphicsLayer::sBoardGuide,
+        GraphicsLayer::sTopPlacement,
+        GraphicsLayer::sBotPlacement,
+        GraphicsLayer::sTopDocumentation,
+        GraphicsLayer::sBotDocumentation,
+        GraphicsLayer::sTopGrabAreas,
+        GraphicsLayer::sBotGrabAreas,
+        GraphicsLayer::sTopHiddenGrabAreas,
+        GraphicsLayer::sBotHiddenGrabAreas,
+        GraphicsLayer::sTopReferences,
+        GraphicsLayer::sBotReferences,
+        GraphicsLayer::sTopNames,
+        GraphicsLayer::sBotNames,
+        GraphicsLayer::sTopValues,
+        GraphicsLayer::sBotValues,
+        GraphicsLayer::sTopCourtyard,
+        GraphicsLayer::sBotCourtyard,
+        GraphicsLayer::sTopStopMask,
+        GraphicsLayer::sBotStopMask,
+        GraphicsLayer::sTopSolderPaste,
+        GraphicsLayer::sBotSolderPaste,
+        GraphicsLayer::sTopFinish,
+        GraphicsLayer::sBotFinish,
+        GraphicsLayer::sTopGlue,
+        GraphicsLayer::sBotGlue,
+        GraphicsLayer::sTopCopper,
+        GraphicsLayer::sBotCopper,
+    };
+    for (const char* name : names) {
+      add(name);
+    }
+    for (int i = 1; i <= GraphicsLayer::getInnerLayerCount(); ++i) {
+      add(GraphicsLayer::getInnerLayerName(i));
+    }
+    for (int i = 1; i < mEntries.count(); ++i) {
+      const QString mirrored =
+          GraphicsLayer::getMirroredLayerName(mEntries.at(i).name);
+      mEntries[i].mirrored = mIds.value(mirrored, i);
+    }
+  }
+
+  void add(const QString& name) noexcept {
+    Q_ASSERT(!mIds.contains(name));
+    mIds.insert(name, mEntries.count());
+    mEntries.append(Entry{name, mEntries.count(),
+                          GraphicsLayer::isCopperLayer(name)});
+  }
+
+  QVector<Entry> mEntries;
+  QHash<QString, int> mIds;
+};
+
+}  // namespace
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+GraphicsLayerId::GraphicsLayerId(const QString& name) noexcept
+  : mId(qMax(GraphicsLayerIdTable::instance().find(name), 0)) {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+const QString& GraphicsLayerId::getName() const noexcept {
+  return GraphicsLayerIdTable::instance().get(mId).name;
+}
+
+GraphicsLayerId GraphicsLayerId::getMirrored() const noexcept {
+  return GraphicsLayerId(GraphicsLayerIdTable::instance().get(mId).mirrored);
+}
+
+bool GraphicsLayerId::isCopperLayer() const noexcept {
+  return GraphicsLayerIdTable::instance().get(mId).copper;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+int GraphicsLayerId::getCount() noexcept {
+  return GraphicsLayerIdTable::instance().count();
+}
+
+tl::optional<GraphicsLayerId> GraphicsLayerId::tryGet(
+    const QString& name) noexcept {
+  const int id = GraphicsLayerIdTable::instance().find(name);
+  if (id > 0) {
+    return GraphicsLayerId(id);
+  } else {
+    return tl::nullopt;
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,156 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_GRAPHICSLAYERID_H
+#define LIBREPCB_CORE_GRAPHICSLAYERID_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "graphicslayername.h"
+
+#include <optional.hpp>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class GraphicsLayerId
+ ******************************************************************************/
+
+/**
+ * @brief Interned identifier of a graphics layer name
+ *
+ * Layers are identified by their names (e.g. "top_cu") in the file format and
+ * in the API of ::librepcb::GraphicsLayer. Comparing these strings and looking
+ * up layers by name is quite expensive in hot paths like the Gerber export or
+ * the ::librepcb::BoardPainter, which do it for every item on every layer.
+ *
+ * A GraphicsLayerId maps a layer name to a small integer, using an immutable
+ * table of all built-in layers. Lookups don't need any locking, comparisons
+ * are plain integer compares, and #toInt() can be used as an index into
+ * per-layer arrays (the number of IDs is available with #getCount()).
+ *
+ * Unknown layer names (e.g. from files of newer application versions) are
+ * not added to the table. They all share one ID which is not equal to the ID
+ * of any built-in layer and has an empty name.
+ *
+ * @note The integer values are not guaranteed to be stable between
+ *       application versions. They must never be serialized, the
+ *       (de)serialization always uses the layer name.
+ */
+class GraphicsLayerId final {
+public:
+  // Constructors / Destructor
+  GraphicsLayerId() = delete;
+  GraphicsLayerId(const GraphicsLayerId& other) noexcept : mId(other.mId) {}
+  explicit GraphicsLayerId(const QString& name) noexcept;
+  explicit GraphicsLayerId(const GraphicsLayerName& name) noexcept
+    : GraphicsLayerId(*name) {}
+  ~GraphicsLayerId() noexcept = default;
+
+  // Getters
+  int toInt() const noexcept { return mId; }
+  const QString& getName() const noexcept;
+  GraphicsLayerId getMirrored() const noexcept;
+  bool isCopperLayer() const noexcept;
+
+  // Operator Overloadings
+  GraphicsLayerId& operator=(const GraphicsLayerId& rhs) noexcept {
+    mId = rhs.mId;
+    return *this;
+  }
+  bool operator==(const GraphicsLayerId& rhs) const noexcept {
+    return mId == rhs.mId;
+  }
+  bool operator!=(const GraphicsLayerId& rhs) const noexcept {
+    return mId != rhs.mId;
+  }
+
+  // Static Methods
+
+  /**
+   * @brief Get the number of layer IDs (including the one of unknown layers)
+   *
+   * @return Upper bound (exclusive) of all values returned by #toInt()
+   */
+  static int getCount() noexcept;
+
+  /**
+   * @brief Get the ID of a built-in layer
+   *
+   * In contrast to the constructor, this does not map unknown names to the
+   * shared ID of unknown layers.
+   *
+   * @param name          The layer name to look up
+   *
+   * @retval GraphicsLayerId  The ID of the layer, if it is a built-in layer
+   * @retval tl::nullopt      If there is no built-in layer with this name
+   */
+  static tl::optional<GraphicsLayerId> tryGet(const QString& name) noexcept;
+
+private:  // Methods
+  explicit GraphicsLayerId(int id) noexcept : mId(id) {}
+
+private:  // Data
+  int mId;  ///< Index into the table of built-in layers (0 = unknown)
+};
+
+/*******************************************************************************
+ *  Non-Member Functions
+ ******************************************************************************/
+
+template <>
+inline SExpression serialize(const GraphicsLayerId& obj) {
+  return SExpression::createToken(obj.getName());
+}
+
+template <>
+inline GraphicsLayerId deserialize(const SExpression& node) {
+  const GraphicsLayerName name =
+      deserialize<GraphicsLayerName>(node);  // can throw
+  if (const tl::optional<GraphicsLayerId> id = GraphicsLayerId::tryGet(*name)) {
+    return *id;
+  }
+  throw RuntimeError(__FILE__, __LINE__,
+                     QString(QApplication::translate(
+                                 "GraphicsLayerId", "Unknown layer: '%1'"))
+                         .arg(*name));
+}
+
+inline QDebug operator<<(QDebug stream, const GraphicsLayerId& obj) {
+  stream << QString("GraphicsLayerId('%1')").arg(obj.getName());
+  return stream;
+}
+
+inline uint qHash(const GraphicsLayerId& key, uint seed = 0) noexcept {
+  return ::qHash(key.toInt(), seed);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -127,12 +127,19 @@ void PrimitiveTextGraphicsItem::paint(QPainter* painter,
                                       const QStyleOptionGraphicsItem* option,
                                       QWidget* widget) noexcept {
   Q_UNUSED(widget);
-  painter->setFont(mFont);
-  if (option->state.testFlag(QStyle::State_Selected)) {
-    painter->setPen(mPenHighlighted);
-  } else {
-    painter->setPen(mPen);
+  const bool isSelected = option->state.testFlag(QStyle::State_Selected);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  if (mFont.pixelSize() * lod < sMinTextHeightPx) {
+    // Text is not readable anyway, so only draw its bounding box.
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QBrush((isSelected ? mPenHighlighted : mPen).color(),
+                             Qt::Dense5Pattern));
+    painter->drawRect(mBoundingRect);
+    return;
   }
+  painter->setFont(mFont);
+  painter->setPen(isSelected ? mPenHighlighted : mPen);
   painter->drawText(QRectF(), mTextFlags, mText);
 }
 
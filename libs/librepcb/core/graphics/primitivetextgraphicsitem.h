@@ -95,6 +95,9 @@ private:  // Data
 
   // Slots
   GraphicsLayer::OnEditedSlot mOnLayerEditedSlot;
+
+  // Static Variables
+  static constexpr qreal sMinTextHeightPx = 3;  ///< Draw box if smaller
 };
 
 /*******************************************************************************
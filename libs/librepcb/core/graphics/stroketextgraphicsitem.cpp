@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "stroketextgraphicsitem.h"
 
+#include "../attribute/attributeprovider.h"
 #include "../attribute/attributesubstitutor.h"
 #include "../graphics/graphicslayer.h"
 #include "origincrossgraphicsitem.h"
@@ -46,6 +47,7 @@ StrokeTextGraphicsItem::StrokeTextGraphicsItem(
     mLayerProvider(lp),
     mFont(font),
     mAttributeProvider(nullptr),
+    mAttributeKeys(),
     mSubstitutedText(),
     mOnEditedSlot(*this, &StrokeTextGraphicsItem::strokeTextEdited) {
   // add origin cross
@@ -82,9 +84,10 @@ void StrokeTextGraphicsItem::setAttributeProvider(
 
 void StrokeTextGraphicsItem::updateText() noexcept {
   QString text = mText.getText();
+  mAttributeKeys.clear();
   if (mAttributeProvider) {
-    text =
-        AttributeSubstitutor::substitute(mText.getText(), mAttributeProvider);
+    text = AttributeSubstitutor::substitute(text, mAttributeProvider, nullptr,
+                                            &mAttributeKeys);
   }
   if (text != mSubstitutedText) {
     mSubstitutedText = text;
@@ -92,6 +95,13 @@ void StrokeTextGraphicsItem::updateText() noexcept {
   }
 }
 
+void StrokeTextGraphicsItem::updateText(
+    const QSet<QString>& changedKeys) noexcept {
+  if (AttributeProvider::isAffectedByChange(mAttributeKeys, changedKeys)) {
+    updateText();
+  }
+}
+
 /*******************************************************************************
  *  Inherited from QGraphicsItem
  ******************************************************************************/
@@ -100,6 +110,23 @@ QPainterPath StrokeTextGraphicsItem::shape() const noexcept {
   return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
 
+void StrokeTextGraphicsItem::paint(QPainter* painter,
+                                   const QStyleOptionGraphicsItem* option,
+                                   QWidget* widget) noexcept {
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  if (mText.getHeight()->toPx() * lod >= sMinTextHeightPx) {
+    PrimitivePathGraphicsItem::paint(painter, option, widget);
+  } else if (!mPainterPath.isEmpty()) {
+    // Text is not readable anyway, so only draw its bounding box.
+    const bool isSelected = option->state.testFlag(QStyle::State_Selected);
+    const QColor color = (isSelected ? mPenHighlighted : mPen).color();
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QBrush(color, Qt::Dense5Pattern));
+    painter->drawRect(mPainterPath.boundingRect());
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
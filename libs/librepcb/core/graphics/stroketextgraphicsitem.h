@@ -58,13 +58,26 @@ public:
 
   // Getters
   StrokeText& getText() noexcept { return mText; }
+  const QSet<QString>& getAttributeKeys() const noexcept {
+    return mAttributeKeys;
+  }
 
   // General Methods
   void setAttributeProvider(const AttributeProvider* provider) noexcept;
   void updateText() noexcept;
 
+  /**
+   * @brief Substitute the text again if it uses any of the changed attributes
+   *
+   * @param changedKeys   Keys passed to
+   *                      ::librepcb::AttributeProvider::attributesChanged().
+   */
+  void updateText(const QSet<QString>& changedKeys) noexcept;
+
   // Inherited from QGraphicsItem
   QPainterPath shape() const noexcept override;
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+             QWidget* widget = 0) noexcept override;
 
   // Operator Overloadings
   StrokeTextGraphicsItem& operator=(const StrokeTextGraphicsItem& rhs) = delete;
@@ -86,10 +99,14 @@ private:  // Data
 
   /// Object for substituting placeholders in text
   const AttributeProvider* mAttributeProvider;
+  QSet<QString> mAttributeKeys;  ///< Keys used by the substituted text
   QString mSubstitutedText;
 
   // Slots
   StrokeText::OnEditedSlot mOnEditedSlot;
+
+  // Static Variables
+  static constexpr qreal sMinTextHeightPx = 3;  ///< Draw box if smaller
 };
 
 /*******************************************************************************
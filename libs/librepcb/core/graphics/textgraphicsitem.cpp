@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "textgraphicsitem.h"
 
+#include "../attribute/attributeprovider.h"
 #include "../attribute/attributesubstitutor.h"
 #include "../graphics/graphicslayer.h"
 #include "../utils/toolbox.h"
@@ -46,6 +47,7 @@ TextGraphicsItem::TextGraphicsItem(Text& text,
     mText(text),
     mLayerProvider(lp),
     mAttributeProvider(nullptr),
+    mAttributeKeys(),
     mOnEditedSlot(*this, &TextGraphicsItem::textEdited) {
   setFont(TextGraphicsItem::Font::SansSerif);
   setPosition(mText.getPosition());
@@ -95,12 +97,20 @@ void TextGraphicsItem::setAttributeProvider(
 
 void TextGraphicsItem::updateText() noexcept {
   QString text = mText.getText();
+  mAttributeKeys.clear();
   if (mAttributeProvider) {
-    text = AttributeSubstitutor::substitute(text, mAttributeProvider);
+    text = AttributeSubstitutor::substitute(text, mAttributeProvider, nullptr,
+                                            &mAttributeKeys);
   }
   setText(text);
 }
 
+void TextGraphicsItem::updateText(const QSet<QString>& changedKeys) noexcept {
+  if (AttributeProvider::isAffectedByChange(mAttributeKeys, changedKeys)) {
+    updateText();
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -57,6 +57,9 @@ public:
 
   // Getters
   Text& getText() noexcept { return mText; }
+  const QSet<QString>& getAttributeKeys() const noexcept {
+    return mAttributeKeys;
+  }
 
   // Setters
   void setRotation(const Angle& rot) noexcept override;
@@ -66,6 +69,14 @@ public:
   void setAttributeProvider(const AttributeProvider* provider) noexcept;
   void updateText() noexcept;
 
+  /**
+   * @brief Substitute the text again if it uses any of the changed attributes
+   *
+   * @param changedKeys   Keys passed to
+   *                      ::librepcb::AttributeProvider::attributesChanged().
+   */
+  void updateText(const QSet<QString>& changedKeys) noexcept;
+
   // Operator Overloadings
   TextGraphicsItem& operator=(const TextGraphicsItem& rhs) = delete;
 
@@ -80,6 +91,7 @@ private:  // Data
 
   /// Object for substituting placeholders in text
   const AttributeProvider* mAttributeProvider;
+  QSet<QString> mAttributeKeys;  ///< Keys used by the substituted text
 
   // Slots
   Text::OnEditedSlot mOnEditedSlot;
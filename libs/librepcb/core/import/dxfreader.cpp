@@ -23,6 +23,7 @@
 #include "dxfreader.h"
 
 #include "../fileio/filepath.h"
+#include "../utils/pathsimplifier.h"
 
 #include <dl_creationadapter.h>
 #include <dl_dxf.h>
@@ -51,6 +52,7 @@ public:
   DxfReaderImpl(DxfReader& reader)
     : mReader(reader),
       mScaleToMm(1),
+      mPolylineIgnored(false),
       mPolylineClosed(false),
       mPolylineVertices(0),
       mPolylinePath() {}
@@ -58,15 +60,28 @@ public:
   virtual ~DxfReaderImpl() {}
 
   virtual void addPoint(const DL_PointData& data) override {
-    mReader.mPoints.append(point(data.x, data.y));
+    if (!isImported(DxfReader::Points)) {
+      return;
+    }
+    const Point p = point(data.x, data.y);
+    if (mReader.mPointHandler) {
+      mReader.mPointHandler(p);
+    } else {
+      mReader.mPoints.append(p);
+    }
   }
 
   virtual void addLine(const DL_LineData& data) override {
-    mReader.mPolygons.append(
-        Path::line(point(data.x1, data.y1), point(data.x2, data.y2)));
+    if (!isImported(DxfReader::Lines)) {
+      return;
+    }
+    addPolygon(Path::line(point(data.x1, data.y1), point(data.x2, data.y2)));
   }
 
   virtual void addArc(const DL_ArcData& data) override {
+    if (!isImported(DxfReader::Arcs)) {
+      return;
+    }
     Point center = point(data.cx, data.cy);
     Length radius = length(data.radius);
     Angle angle1 = angle(data.angle1);
@@ -78,14 +93,22 @@ public:
     if (angle < 0) {
       angle.invert();
     }
-    mReader.mPolygons.append(Path::line(p1, p2, angle));
+    addPolygon(Path::line(p1, p2, angle));
   }
 
   virtual void addCircle(const DL_CircleData& data) override {
+    if (!isImported(DxfReader::Circles)) {
+      return;
+    }
     Length diameter = length(data.radius * 2);
     if (diameter > 0) {
-      mReader.mCircles.append(
-          DxfReader::Circle{point(data.cx, data.cy), PositiveLength(diameter)});
+      const DxfReader::Circle circle{point(data.cx, data.cy),
+                                     PositiveLength(diameter)};
+      if (mReader.mCircleHandler) {
+        mReader.mCircleHandler(circle);
+      } else {
+        mReader.mCircles.append(circle);
+      }
     } else {
       qWarning() << "Circle in DXF file ignored due to invalid radius:"
                  << data.radius;
@@ -98,12 +121,16 @@ public:
   }
 
   virtual void addPolyline(const DL_PolylineData& data) override {
+    mPolylineIgnored = !isImported(DxfReader::Polylines);
     mPolylineClosed = (data.flags & DL_CLOSED_PLINE) != 0;
     mPolylineVertices = data.number;
     mPolylinePath = Path();
   }
 
   virtual void addVertex(const DL_VertexData& data) override {
+    if (mPolylineIgnored) {
+      return;
+    }
     mPolylinePath.addVertex(point(data.x, data.y), bulgeToAngle(data.bulge));
     if (mPolylinePath.getVertices().count() == mPolylineVertices) {
       endSequence();
@@ -115,7 +142,11 @@ public:
       if (mPolylineClosed && (mPolylinePath.getVertices().count() >= 3)) {
         mPolylinePath.close();
       }
-      mReader.mPolygons.append(mPolylinePath);
+      if (mReader.mSimplifyTolerance > 0) {
+        mPolylinePath =
+            PathSimplifier::simplify(mPolylinePath, mReader.mSimplifyTolerance);
+      }
+      addPolygon(mPolylinePath);
     }
     mPolylinePath = Path();
   }
@@ -144,6 +175,20 @@ public:
   }
 
 private:  // Methods
+  bool isImported(DxfReader::Entity entity) {
+    const QString layer = QString::fromStdString(getAttributes().getLayer());
+    mReader.mLayerNames.insert(layer);
+    return mReader.mEntityFilter.testFlag(entity) &&
+        (mReader.mLayerFilter.isEmpty() ||
+         mReader.mLayerFilter.contains(layer));
+  }
+  void addPolygon(const Path& path) {
+    if (mReader.mPolygonHandler) {
+      mReader.mPolygonHandler(path);
+    } else {
+      mReader.mPolygons.append(path);
+    }
+  }
   Angle angle(double angle) const { return Angle::fromDeg(angle); }
   Angle bulgeToAngle(double bulge) const {
     // Round to 0.001° to avoid odd numbers like 179.999999°.
@@ -162,6 +207,7 @@ private:  // Data
   qreal mScaleToMm;
 
   // Current polygon state
+  bool mPolylineIgnored;
   bool mPolylineClosed;
   int mPolylineVertices;
   Path mPolylinePath;
@@ -171,7 +217,18 @@ private:  // Data
  *  Constructors / Destructor
  ******************************************************************************/
 
-DxfReader::DxfReader() noexcept : mScaleFactor(1) {
+DxfReader::DxfReader() noexcept
+  : mScaleFactor(1),
+    mLayerFilter(),
+    mEntityFilter(AllEntities),
+    mSimplifyTolerance(0),
+    mPointHandler(),
+    mCircleHandler(),
+    mPolygonHandler(),
+    mLayerNames(),
+    mPoints(),
+    mCircles(),
+    mPolygons() {
 }
 
 DxfReader::~DxfReader() noexcept {
@@ -27,6 +27,8 @@
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -56,6 +58,13 @@ class FilePath;
  * Note that this class tries to read and apply the length unit defined in the
  * DXF file. However, a DXF file is not required to specify the unit. If it is
  * missing, the unit millimeters is assumed.
+ *
+ * For large files, the imported objects can be reduced with a layer filter,
+ * an entity filter and the simplification of polylines (see
+ * ::librepcb::PathSimplifier). Polylines are simplified as soon as they are
+ * read, so their original vertices are never held in memory all at once.
+ * In addition, handlers can be set to receive the objects immediately while
+ * the file is parsed, instead of accumulating them in this object.
  */
 class DxfReader {
   Q_DECLARE_TR_FUNCTIONS(DxfReader)
@@ -66,6 +75,20 @@ public:
     PositiveLength diameter;
   };
 
+  enum Entity {
+    Points = 1 << 0,
+    Circles = 1 << 1,
+    Lines = 1 << 2,
+    Arcs = 1 << 3,
+    Polylines = 1 << 4,
+    AllEntities = Points | Circles | Lines | Arcs | Polylines,
+  };
+  Q_DECLARE_FLAGS(Entities, Entity)
+
+  typedef std::function<void(const Point&)> PointHandler;
+  typedef std::function<void(const Circle&)> CircleHandler;
+  typedef std::function<void(const Path&)> PolygonHandler;
+
   // Constructors / Destructor
 
   /**
@@ -93,6 +116,55 @@ public:
     mScaleFactor = scaleFactor;
   }
 
+  /**
+   * @brief Set the DXF layers to import
+   *
+   * @param layers  Names of the layers to import. If empty (the default),
+   *                objects of all layers are imported.
+   */
+  void setLayerFilter(const QSet<QString>& layers) noexcept {
+    mLayerFilter = layers;
+  }
+
+  /**
+   * @brief Set the entity types to import
+   *
+   * @param entities  Entity types to import (default: all).
+   */
+  void setEntityFilter(Entities entities) noexcept {
+    mEntityFilter = entities;
+  }
+
+  /**
+   * @brief Set the tolerance to simplify polylines
+   *
+   * @param tolerance   Maximum deviation of the simplified polylines. If
+   *                    zero (the default), polylines are not simplified.
+   *
+   * @see ::librepcb::PathSimplifier
+   */
+  void setSimplifyTolerance(const UnsignedLength& tolerance) noexcept {
+    mSimplifyTolerance = tolerance;
+  }
+
+  /**
+   * @brief Set handlers to receive the imported objects while parsing
+   *
+   * Objects of types with a handler set are passed to the handler and not
+   * added to the lists returned by #getPoints(), #getCircles() and
+   * #getPolygons(). Pass `nullptr` to remove a handler.
+   *
+   * @param pointHandler    Handler for points.
+   * @param circleHandler   Handler for circles.
+   * @param polygonHandler  Handler for lines, arcs and polylines.
+   */
+  void setHandlers(PointHandler pointHandler, CircleHandler circleHandler,
+                   PolygonHandler polygonHandler) noexcept {
+    mPointHandler = pointHandler;
+    mCircleHandler = circleHandler;
+    mPolygonHandler = polygonHandler;
+  }
+
   // Getters
 
   /**
@@ -116,6 +188,16 @@ public:
    */
   const QList<Path>& getPolygons() const noexcept { return mPolygons; }
 
+  /**
+   * @brief Get the names of all layers containing any supported objects
+   *
+   * Also contains the layers of objects which were not imported due to the
+   * layer filter or the entity filter.
+   *
+   * @return Layer names
+   */
+  const QSet<QString>& getLayerNames() const noexcept { return mLayerNames; }
+
   // General Methods
 
   /**
@@ -132,7 +214,14 @@ public:
 
 private:
   qreal mScaleFactor;
-
+  QSet<QString> mLayerFilter;
+  Entities mEntityFilter;
+  UnsignedLength mSimplifyTolerance;
+  PointHandler mPointHandler;
+  CircleHandler mCircleHandler;
+  PolygonHandler mPolygonHandler;
+
+  QSet<QString> mLayerNames;
   QList<Point> mPoints;
   QList<Circle> mCircles;
   QList<Path> mPolygons;
@@ -150,4 +239,6 @@ private:
 
 }  // namespace librepcb
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(librepcb::DxfReader::Entities)
+
 #endif
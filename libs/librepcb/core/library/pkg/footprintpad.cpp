@@ -106,6 +106,9 @@ FootprintPad::FootprintPad(const FootprintPad& other) noexcept
     mHeight(other.mHeight),
     mComponentSide(other.mComponentSide),
     mHoles(other.mHoles),
+    mOutlineCache(other.mOutlineCache),
+    mOutlinePxCache(other.mOutlinePxCache),
+    mPainterPathPxCache(other.mPainterPathPxCache),
     mHolesEditedSlot(*this, &FootprintPad::holesEdited) {
   mHoles.onEdited.attach(mHolesEditedSlot);
 }
@@ -164,6 +167,20 @@ QString FootprintPad::getLayerName() const noexcept {
   }
 }
 
+GraphicsLayerId FootprintPad::getLayerId() const noexcept {
+  static const GraphicsLayerId padsTht(GraphicsLayer::sBoardPadsTht);
+  static const GraphicsLayerId botCopper(GraphicsLayer::sBotCopper);
+  static const GraphicsLayerId topCopper(GraphicsLayer::sTopCopper);
+  if (isTht()) {
+    return padsTht;
+  } else if (mComponentSide == ComponentSide::Bottom) {
+    return botCopper;
+  } else {
+    Q_ASSERT(mComponentSide == ComponentSide::Top);
+    return topCopper;
+  }
+}
+
 bool FootprintPad::isTht() const noexcept {
   return !mHoles.isEmpty();
 }
@@ -176,30 +193,39 @@ bool FootprintPad::isOnLayer(const QString& name) const noexcept {
   }
 }
 
+bool FootprintPad::isOnLayer(const GraphicsLayerId& layer) const noexcept {
+  if (isTht()) {
+    return layer.isCopperLayer();
+  } else {
+    return (layer == getLayerId());
+  }
+}
+
 Path FootprintPad::getOutline(const Length& expansion) const noexcept {
-  const Length width = mWidth + (expansion * 2);
-  const Length height = mHeight + (expansion * 2);
-  if (width > 0 && height > 0) {
-    const PositiveLength pWidth(width);
-    const PositiveLength pHeight(height);
-    const UnsignedLength cornerRadius(std::max(expansion, Length(0)));
-    switch (mShape) {
-      case Shape::ROUND:
-        return Path::obround(pWidth, pHeight);
-      case Shape::RECT:
-        return Path::centeredRect(pWidth, pHeight, cornerRadius);
-      case Shape::OCTAGON:
-        return Path::octagon(pWidth, pHeight, cornerRadius);
-      default:
-        Q_ASSERT(false);
-        break;
-    }
+  if (const Path* cached = mOutlineCache.find(expansion)) {
+    return *cached;
   }
-  return Path();
+  const Path outline = generateOutline(expansion);
+  mOutlineCache.insert(expansion, outline);
+  return outline;
+}
+
+QPainterPath FootprintPad::toOutlineQPainterPathPx(
+    const Length& expansion) const noexcept {
+  if (const QPainterPath* cached = mOutlinePxCache.find(expansion)) {
+    return *cached;
+  }
+  const QPainterPath p = getOutline(expansion).toQPainterPathPx();
+  mOutlinePxCache.insert(expansion, p);
+  return p;
 }
 
 QPainterPath FootprintPad::toQPainterPathPx(const Length& expansion) const
     noexcept {
+  if (const QPainterPath* cached = mPainterPathPxCache.find(expansion)) {
+    return *cached;
+  }
+
   QPainterPath holesArea;
   for (const Hole& h : mHoles) {
     for (const Path& p : h.getPath()->toOutlineStrokes(h.getDiameter())) {
@@ -207,9 +233,10 @@ QPainterPath FootprintPad::toQPainterPathPx(const Length& expansion) const
     }
   }
 
-  QPainterPath p = getOutline(expansion).toQPainterPathPx();
+  QPainterPath p = toOutlineQPainterPathPx(expansion);
   p.setFillRule(Qt::OddEvenFill);  // Important to subtract the holes!
   p.addPath(holesArea);
+  mPainterPathPxCache.insert(expansion, p);
   return p;
 }
 
@@ -252,6 +279,7 @@ bool FootprintPad::setShape(Shape shape) noexcept {
   }
 
   mShape = shape;
+  invalidateGeometryCache();
   onEdited.notify(Event::ShapeChanged);
   return true;
 }
@@ -262,6 +290,7 @@ bool FootprintPad::setWidth(const PositiveLength& width) noexcept {
   }
 
   mWidth = width;
+  invalidateGeometryCache();
   onEdited.notify(Event::WidthChanged);
   return true;
 }
@@ -272,6 +301,7 @@ bool FootprintPad::setHeight(const PositiveLength& height) noexcept {
   }
 
   mHeight = height;
+  invalidateGeometryCache();
   onEdited.notify(Event::HeightChanged);
   return true;
 }
@@ -335,6 +365,7 @@ FootprintPad& FootprintPad::operator=(const FootprintPad& rhs) noexcept {
   setHeight(rhs.mHeight);
   setComponentSide(rhs.mComponentSide);
   mHoles = rhs.mHoles;
+  invalidateGeometryCache();
   return *this;
 }
 
@@ -342,6 +373,34 @@ FootprintPad& FootprintPad::operator=(const FootprintPad& rhs) noexcept {
  *  Private Methods
  ******************************************************************************/
 
+Path FootprintPad::generateOutline(const Length& expansion) const noexcept {
+  const Length width = mWidth + (expansion * 2);
+  const Length height = mHeight + (expansion * 2);
+  if (width > 0 && height > 0) {
+    const PositiveLength pWidth(width);
+    const PositiveLength pHeight(height);
+    const UnsignedLength cornerRadius(std::max(expansion, Length(0)));
+    switch (mShape) {
+      case Shape::ROUND:
+        return Path::obround(pWidth, pHeight);
+      case Shape::RECT:
+        return Path::centeredRect(pWidth, pHeight, cornerRadius);
+      case Shape::OCTAGON:
+        return Path::octagon(pWidth, pHeight, cornerRadius);
+      default:
+        Q_ASSERT(false);
+        break;
+    }
+  }
+  return Path();
+}
+
+void FootprintPad::invalidateGeometryCache() noexcept {
+  mOutlineCache.clear();
+  mOutlinePxCache.clear();
+  mPainterPathPxCache.clear();
+}
+
 void FootprintPad::holesEdited(const HoleList& list, int index,
                                const std::shared_ptr<const Hole>& hole,
                                HoleList::Event event) noexcept {
@@ -349,6 +408,7 @@ void FootprintPad::holesEdited(const HoleList& list, int index,
   Q_UNUSED(index);
   Q_UNUSED(hole);
   Q_UNUSED(event);
+  invalidateGeometryCache();
   onEdited.notify(Event::HolesEdited);
 }
 
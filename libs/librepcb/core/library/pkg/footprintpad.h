@@ -26,6 +26,7 @@
 #include "../../exceptions.h"
 #include "../../geometry/hole.h"
 #include "../../geometry/path.h"
+#include "../../graphics/graphicslayerid.h"
 #include "../../serialization/serializableobjectlist.h"
 #include "../../types/angle.h"
 #include "../../types/length.h"
@@ -94,9 +95,13 @@ public:
   const HoleList& getHoles() const noexcept { return mHoles; }
   HoleList& getHoles() noexcept { return mHoles; }
   QString getLayerName() const noexcept;
+  GraphicsLayerId getLayerId() const noexcept;
   bool isTht() const noexcept;
   bool isOnLayer(const QString& name) const noexcept;
+  bool isOnLayer(const GraphicsLayerId& layer) const noexcept;
   Path getOutline(const Length& expansion = Length(0)) const noexcept;
+  QPainterPath toOutlineQPainterPathPx(
+      const Length& expansion = Length(0)) const noexcept;
   QPainterPath toQPainterPathPx(const Length& expansion = Length(0)) const
       noexcept;
 
@@ -125,7 +130,42 @@ public:
   }
   FootprintPad& operator=(const FootprintPad& rhs) noexcept;
 
+private:  // Types
+  /**
+   * @brief Cache of a pad geometry for the most recently used expansions
+   *
+   * Usually only very few expansions are used at the same time (e.g. for the
+   * copper area and the stop mask), so only the last #sSize generated
+   * geometries are kept. Otherwise every queried clearance would be cached
+   * forever.
+   */
+  template <typename T>
+  class ExpansionCache final {
+  public:
+    const T* find(const Length& expansion) const noexcept {
+      for (const auto& entry : mEntries) {
+        if (entry.first == expansion) {
+          return &entry.second;
+        }
+      }
+      return nullptr;
+    }
+    void insert(const Length& expansion, const T& value) noexcept {
+      if (mEntries.count() >= sSize) {
+        mEntries.removeLast();
+      }
+      mEntries.prepend(std::make_pair(expansion, value));
+    }
+    void clear() noexcept { mEntries.clear(); }
+
+  private:
+    QVector<std::pair<Length, T>> mEntries;  ///< Most recent first
+    static constexpr int sSize = 2;
+  };
+
 private:  // Methods
+  Path generateOutline(const Length& expansion) const noexcept;
+  void invalidateGeometryCache() noexcept;
   void holesEdited(const HoleList& list, int index,
                    const std::shared_ptr<const Hole>& hole,
                    HoleList::Event event) noexcept;
@@ -147,6 +187,16 @@ private:  // Data
   ComponentSide mComponentSide;
   HoleList mHoles;  ///< If not empty, it's a THT pad.
 
+  // Cached Attributes
+  //
+  // The pad geometry only depends on shape, size, holes and the expansion,
+  // but not on the pad or device position. All pad instances of a device
+  // refer to the same library pad, so they share these (implicitly shared)
+  // paths instead of generating their own copies.
+  mutable ExpansionCache<Path> mOutlineCache;
+  mutable ExpansionCache<QPainterPath> mOutlinePxCache;
+  mutable ExpansionCache<QPainterPath> mPainterPathPxCache;
+
   // Slots
   HoleList::OnEditedSlot mHolesEditedSlot;
 };
@@ -246,7 +246,7 @@ void PackageCheck::checkPadsAnnularRing(MsgList& msgs) const {
       std::shared_ptr<const PackagePad> pkgPad = pad->getPackagePadUuid()
           ? mPackage.getPads().find(*pad->getPackagePadUuid())
           : nullptr;
-      const QPainterPath padPathPx = pad->getOutline().toQPainterPathPx();
+      const QPainterPath padPathPx = pad->toOutlineQPainterPathPx();
 
       // Check all holes.
       bool emitWarning = false;
@@ -32,11 +32,13 @@
 #include "../../serialization/sexpression.h"
 #include "../../types/lengthunit.h"
 #include "../../utils/scopeguardlist.h"
+#include "../../utils/timingrecorder.h"
 #include "../../utils/toolbox.h"
 #include "../circuit/circuit.h"
 #include "../circuit/componentinstance.h"
 #include "../circuit/netsignal.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "boardairwiresbuilder.h"
 #include "boarddesignrules.h"
@@ -44,6 +46,7 @@
 #include "boardlayerstack.h"
 #include "boardplanefragmentsbuilder.h"
 #include "boardselectionquery.h"
+#include "graphicsitems/bgi_plane.h"
 #include "items/bi_airwire.h"
 #include "items/bi_device.h"
 #include "items/bi_footprintpad.h"
@@ -98,13 +101,14 @@ Board::Board(Project& project,
 
   // Update ERC messages if devices were added/removed.
   connect(&mProject.getCircuit(), &Circuit::componentAdded, this,
-          &Board::updateErcMessages);
+          [this]() { mProject.getErcMsgList().scheduleUpdate(*this); });
   connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
-          &Board::updateErcMessages);
+          [this]() { mProject.getErcMsgList().scheduleUpdate(*this); });
 }
 
 Board::~Board() noexcept {
   Q_ASSERT(!mIsAddedToProject);
+  mProject.getErcMsgList().cancelUpdate(*this);
 
   qDeleteAll(mErcMsgListUnplacedComponentInstances);
   mErcMsgListUnplacedComponentInstances.clear();
@@ -194,7 +198,8 @@ BI_Device* Board::getDeviceInstanceByComponentUuid(const Uuid& uuid) const
 }
 
 void Board::addDeviceInstance(BI_Device& instance) {
-  if ((mDeviceInstances.values().contains(&instance)) ||
+  if ((mDeviceInstances.value(instance.getComponentInstanceUuid()) ==
+       &instance) ||
       (&instance.getBoard() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -208,7 +213,7 @@ void Board::addDeviceInstance(BI_Device& instance) {
     instance.addToBoard();  // can throw
   }
   mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
-  updateErcMessages();
+  mProject.getErcMsgList().scheduleUpdate(*this);
   emit deviceAdded(instance);
 }
 
@@ -221,7 +226,7 @@ void Board::removeDeviceInstance(BI_Device& instance) {
     instance.removeFromBoard();  // can throw
   }
   mDeviceInstances.remove(instance.getComponentInstanceUuid());
-  updateErcMessages();
+  mProject.getErcMsgList().scheduleUpdate(*this);
   emit deviceRemoved(instance);
 }
 
@@ -230,7 +235,7 @@ void Board::removeDeviceInstance(BI_Device& instance) {
  ******************************************************************************/
 
 void Board::addNetSegment(BI_NetSegment& netsegment) {
-  if ((mNetSegments.values().contains(&netsegment)) ||
+  if ((mNetSegments.value(netsegment.getUuid()) == &netsegment) ||
       (&netsegment.getBoard() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -261,7 +266,8 @@ void Board::removeNetSegment(BI_NetSegment& netsegment) {
  ******************************************************************************/
 
 void Board::addPlane(BI_Plane& plane) {
-  if ((mPlanes.values().contains(&plane)) || (&plane.getBoard() != this)) {
+  if ((mPlanes.value(plane.getUuid()) == &plane) ||
+      (&plane.getBoard() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
   if (mPlanes.contains(plane.getUuid())) {
@@ -286,6 +292,7 @@ void Board::removePlane(BI_Plane& plane) {
 }
 
 void Board::rebuildAllPlanes() noexcept {
+  TimingScope scope("Board::rebuildAllPlanes", *mName);
   QList<BI_Plane*> planes = mPlanes.values();
   std::sort(planes.begin(), planes.end(),
             [](const BI_Plane* p1, const BI_Plane* p2) {
@@ -302,7 +309,7 @@ void Board::rebuildAllPlanes() noexcept {
  ******************************************************************************/
 
 void Board::addPolygon(BI_Polygon& polygon) {
-  if ((mPolygons.values().contains(&polygon)) ||
+  if ((mPolygons.value(polygon.getUuid()) == &polygon) ||
       (&polygon.getBoard() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -333,7 +340,8 @@ void Board::removePolygon(BI_Polygon& polygon) {
  ******************************************************************************/
 
 void Board::addStrokeText(BI_StrokeText& text) {
-  if ((mStrokeTexts.values().contains(&text)) || (&text.getBoard() != this)) {
+  if ((mStrokeTexts.value(text.getUuid()) == &text) ||
+      (&text.getBoard() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
   if (mStrokeTexts.contains(text.getUuid())) {
@@ -363,7 +371,7 @@ void Board::removeStrokeText(BI_StrokeText& text) {
  ******************************************************************************/
 
 void Board::addHole(BI_Hole& hole) {
-  if ((mHoles.values().contains(&hole)) || (&hole.getBoard() != this)) {
+  if ((mHoles.value(hole.getUuid()) == &hole) || (&hole.getBoard() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
   if (mHoles.contains(hole.getUuid())) {
@@ -426,6 +434,7 @@ void Board::triggerAirWiresRebuild() noexcept {
 }
 
 void Board::forceAirWiresRebuild() noexcept {
+  TimingScope scope("Board::forceAirWiresRebuild", *mName);
   mScheduledNetSignalsForAirWireRebuild.unite(
       Toolbox::toSet(mProject.getCircuit().getNetSignals().values()));
   mScheduledNetSignalsForAirWireRebuild.unite(Toolbox::toSet(mAirWires.keys()));
@@ -583,7 +592,7 @@ void Board::addToProject() {
 
   mIsAddedToProject = true;
   forceAirWiresRebuild();
-  updateErcMessages();
+  mProject.getErcMsgList().scheduleUpdate(*this);
   sgl.dismiss();
 }
 
@@ -605,7 +614,7 @@ void Board::removeFromProject() {
   mDirectory->moveTo(tmp);  // can throw
 
   mIsAddedToProject = false;
-  updateErcMessages();
+  mProject.getErcMsgList().scheduleUpdate(*this);
   sgl.dismiss();
 }
 
@@ -768,6 +777,31 @@ std::unique_ptr<BoardSelectionQuery> Board::createSelectionQuery() const
       const_cast<Board*>(this)));
 }
 
+void Board::compact() noexcept {
+  TimingScope scope("Board::compact", *mName);
+
+  // Remove airwires, they will be rebuilt by triggerAirWiresRebuild().
+  try {
+    foreach (NetSignal* netsignal, Toolbox::toSet(mAirWires.keys())) {
+      while (BI_AirWire* airWire = mAirWires.take(netsignal)) {
+        airWire->removeFromBoard();  // can throw
+        delete airWire;
+      }
+      mScheduledNetSignalsForAirWireRebuild.insert(netsignal);
+    }
+  } catch (const Exception& e) {
+    qCritical() << "Failed to remove airwires:" << e.getMsg();
+  }
+
+  // Release cached plane areas, they will be rebuilt when painted.
+  foreach (BI_Plane* plane, mPlanes) {
+    plane->getGraphicsItem().releaseCachedAreas();
+  }
+
+  // Release the scene index, it will be rebuilt by GraphicsView::setScene().
+  mGraphicsScene->setItemIndexMethod(QGraphicsScene::NoIndex);
+}
+
 /*******************************************************************************
  *  Inherited from AttributeProvider
  ******************************************************************************/
@@ -225,6 +225,16 @@ public:
   void clearSelection() const noexcept;
   std::unique_ptr<BoardSelectionQuery> createSelectionQuery() const noexcept;
 
+  /**
+   * @brief Release memory of caches which can be rebuilt on demand
+   *
+   * Removes all airwires (they are scheduled for being rebuilt), the cached
+   * areas of planes and the item index of the graphics scene. Intended for
+   * boards which are currently not displayed, since all these caches are
+   * rebuilt as soon as the board is shown again.
+   */
+  void compact() noexcept;
+
   // Inherited from AttributeProvider
   /// @copydoc ::librepcb::AttributeProvider::getBuiltInAttributeValue()
   QString getBuiltInAttributeValue(const QString& key) const noexcept override;
@@ -240,13 +250,13 @@ public:
 signals:
 
   /// @copydoc AttributeProvider::attributesChanged()
-  void attributesChanged() override;
+  void attributesChanged(const QSet<QString>& keys) override;
 
   void deviceAdded(BI_Device& comp);
   void deviceRemoved(BI_Device& comp);
 
 private:
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
   // General
   Project& mProject;  ///< A reference to the Project object (from the ctor)
@@ -25,6 +25,8 @@
 #include "../../attribute/attributesubstitutor.h"
 #include "../../export/excellongenerator.h"
 #include "../../export/gerbergenerator.h"
+#include "../../fileio/fileutils.h"
+#include "../../fileio/zipwriter.h"
 #include "../../geometry/hole.h"
 #include "../../graphics/graphicslayer.h"
 #include "../../library/cmp/componentsignal.h"
@@ -32,6 +34,7 @@
 #include "../../library/pkg/footprintpad.h"
 #include "../../library/pkg/package.h"
 #include "../../library/pkg/packagepad.h"
+#include "../../utils/scopeguard.h"
 #include "../../utils/transform.h"
 #include "../circuit/componentinstance.h"
 #include "../circuit/componentsignalinstance.h"
@@ -52,6 +55,7 @@
 #include "items/bi_stroketext.h"
 #include "items/bi_via.h"
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -63,20 +67,130 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-BoardGerberExport::BoardGerberExport(const Board& board) noexcept
+BoardGerberExport::BoardGerberExport(const Board& board)
   : mProject(board.getProject()),
     mBoard(board),
     mCreationDateTime(QDateTime::currentDateTime()),
     mProjectName(*mProject.getName()),
-    mCurrentInnerCopperLayer(0) {
+    mCurrentInnerCopperLayer(0),
+    mFuture(),
+    mAbort(0),
+    mZipWriter(),
+    mZipFilePath(),
+    mZipRootDir(),
+    mBoardUuid(board.getUuid()),
+    mProjectVersion(mProject.getVersion()),
+    mInnerLayerCount(board.getLayerStack().getInnerLayerCount()),
+    mDesignRules(board.getDesignRules()) {
   // If the project contains multiple boards, add the board name to the
   // Gerber file metadata as well to distinguish between the different boards.
   if (mProject.getBoards().count() > 1) {
     mProjectName += " (" % mBoard.getName() % ")";
   }
+
+  // Copy everything needed for the export, with attributes already
+  // substituted, since the files might be generated in a worker thread.
+  auto getTextPaths = [](const BI_StrokeText& text) {
+    const Transform transform(text.getText());
+    return TextPaths{text.getText().getLayerId(),
+                     text.getText().getStrokeWidth(),
+                     transform.map(text.generatePaths())};  // can throw
+  };
+  foreach (const BI_Device* device, board.getDeviceInstances()) {
+    Footprint fpt;
+    fpt.transform = Transform(*device);
+    fpt.designator = *device->getComponentInstance().getName();
+    fpt.value = device->getComponentInstance().getValue(true).trimmed();
+    fpt.manufacturer =
+        AttributeSubstitutor::substitute("{{MANUFACTURER}}", device).trimmed();
+    fpt.mpn = AttributeSubstitutor::substitute(
+                  "{{MPN or PARTNUMBER or DEVICE}}", device)
+                  .trimmed();
+    // Note: Always use english locale to make PnP files portable.
+    fpt.footprintName = *device->getLibPackage().getNames().getDefaultValue();
+    switch (device->determineMountType()) {
+      case BI_Device::MountType::Tht:
+        fpt.mountType = GerberAttribute::MountType::Tht;
+        break;
+      case BI_Device::MountType::Smt:
+        fpt.mountType = GerberAttribute::MountType::Smt;
+        break;
+      case BI_Device::MountType::Fiducial:
+        fpt.mountType = GerberAttribute::MountType::Fiducial;
+        break;
+      case BI_Device::MountType::None:
+        fpt.mountType = tl::nullopt;  // Not a device to be mounted.
+        break;
+      default:
+        fpt.mountType = GerberAttribute::MountType::Other;
+        break;
+    }
+    foreach (const BI_FootprintPad* pad, device->getPads()) {
+      // Anonymous net has a reserved name by Gerber specs.
+      Pad p{pad->getLibPad(), pad->getPosition(), pad->getRotation(),
+            pad->getMirrored(), "N/C", QString(), QString()};
+      if (const NetSignal* netSignal = pad->getCompSigInstNetSignal()) {
+        p.netName = *netSignal->getName();
+      }
+      if (const PackagePad* pkgPad = pad->getLibPackagePad()) {
+        p.pinName = *pkgPad->getName();
+      }
+      if (ComponentSignalInstance* cmpSig = pad->getComponentSignalInstance()) {
+        p.signalName = *cmpSig->getCompSignal().getName();
+      }
+      fpt.pads.append(p);
+    }
+    for (const Polygon& polygon :
+         device->getLibFootprint().getPolygons().sortedByUuid()) {
+      fpt.polygons.append(polygon);
+    }
+    for (const Circle& circle :
+         device->getLibFootprint().getCircles().sortedByUuid()) {
+      fpt.circles.append(circle);
+    }
+    for (const Hole& hole : device->getLibFootprint().getHoles()) {
+      fpt.holes.append(hole);
+    }
+    // Stroke texts from footprint instance, *NOT* from library footprint!
+    foreach (const BI_StrokeText* text, device->getStrokeTexts()) {
+      fpt.texts.append(getTextPaths(*text));
+    }
+    mFootprints.append(fpt);
+  }
+  foreach (const BI_NetSegment* netsegment, board.getNetSegments()) {
+    NetSegment segment;
+    segment.netName = netsegment->getNetSignal()
+        ? *netsegment->getNetSignal()->getName()  // Named net.
+        : "N/C";  // Anonymous net (reserved name by Gerber specs).
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      segment.vias.append(via->getVia());
+    }
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      segment.traces.append(Trace{netline->getLayer().getId(),
+                                  netline->getStartPoint().getPosition(),
+                                  netline->getEndPoint().getPosition(),
+                                  netline->getWidth()});
+    }
+    mNetSegments.append(segment);
+  }
+  foreach (const BI_Plane* plane, board.getPlanes()) {
+    mPlanes.append(Plane{GraphicsLayerId(plane->getLayerName()),
+                         *plane->getNetSignal().getName(),
+                         plane->getFragments()});
+  }
+  foreach (const BI_Polygon* polygon, board.getPolygons()) {
+    mPolygons.append(polygon->getPolygon());
+  }
+  foreach (const BI_StrokeText* text, board.getStrokeTexts()) {
+    mStrokeTexts.append(getTextPaths(*text));
+  }
+  foreach (const BI_Hole* hole, board.getHoles()) {
+    mHoles.append(hole->getHole());
+  }
 }
 
 BoardGerberExport::~BoardGerberExport() noexcept {
+  cancel();
 }
 
 /*******************************************************************************
@@ -89,153 +203,131 @@ FilePath BoardGerberExport::getOutputDirectory(
       .getParentDir();  // use dummy suffix
 }
 
+FilePath BoardGerberExport::getOutputZipFile(
+    const BoardFabricationOutputSettings& settings) const noexcept {
+  return getOutputFilePath(settings.getOutputBasePath() % ".zip");
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
 void BoardGerberExport::exportPcbLayers(
-    const BoardFabricationOutputSettings& settings) const {
+    const BoardFabricationOutputSettings& settings, bool zip) const {
   mWrittenFiles.clear();
-
-  if (settings.getMergeDrillFiles()) {
-    exportDrills(settings);
-  } else {
-    exportDrillsNpth(settings);
-    exportDrillsPth(settings);
-  }
-  exportLayerBoardOutlines(settings);
-  exportLayerTopCopper(settings);
-  exportLayerInnerCopper(settings);
-  exportLayerBottomCopper(settings);
-  exportLayerTopSolderMask(settings);
-  exportLayerBottomSolderMask(settings);
-  exportLayerTopSilkscreen(settings);
-  exportLayerBottomSilkscreen(settings);
-  if (settings.getEnableSolderPasteTop()) {
-    exportLayerTopSolderPaste(settings);
+  if (zip) {
+    openZipFile(getOutputZipFile(settings),
+                getOutputDirectory(settings));  // can throw
   }
-  if (settings.getEnableSolderPasteBot()) {
-    exportLayerBottomSolderPaste(settings);
+  // Removes the ZIP file if it was not completed.
+  auto sg = scopeGuard([this]() { mZipWriter.reset(); });
+  foreach (const Job& job, prepareJobs(settings)) {
+    job();  // can throw
   }
+  closeZipFile();  // can throw
 }
 
 void BoardGerberExport::exportComponentLayer(BoardSide side,
                                              const FilePath& filePath) const {
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   if (side == BoardSide::Top) {
     gen.setFileFunctionComponent(1, GerberGenerator::BoardSide::Top);
   } else {
-    gen.setFileFunctionComponent(
-        mBoard.getLayerStack().getInnerLayerCount() + 2,
-        GerberGenerator::BoardSide::Bottom);
+    gen.setFileFunctionComponent(mInnerLayerCount + 2,
+                                 GerberGenerator::BoardSide::Bottom);
   }
 
   // Export board outline since this is useful for manual review.
-  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
-    Q_ASSERT(polygon);
-    if (polygon->getPolygon().getLayerName() == GraphicsLayer::sBoardOutlines) {
+  foreach (const Polygon& polygon, mPolygons) {
+    if (polygon.getLayerName() == GraphicsLayer::sBoardOutlines) {
       UnsignedLength lineWidth =
-          calcWidthOfLayer(polygon->getPolygon().getLineWidth(),
-                           *polygon->getPolygon().getLayerName());
-      gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth,
+          calcWidthOfLayer(polygon.getLineWidth(), polygon.getLayerId());
+      gen.drawPathOutline(polygon.getPath(), lineWidth,
                           GerberAttribute::ApertureFunction::Profile,
                           tl::nullopt, QString());
     }
   }
 
   // Export all components on the selected board side.
-  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-    if (device->getMirrored() == (side == BoardSide::Bottom)) {
-      // Skip devices which are considered as no device to be mounted.
-      GerberGenerator::MountType mountType = GerberGenerator::MountType::Other;
-      switch (device->determineMountType()) {
-        case BI_Device::MountType::Tht:
-          mountType = GerberGenerator::MountType::Tht;
-          break;
-        case BI_Device::MountType::Smt:
-          mountType = GerberGenerator::MountType::Smt;
-          break;
-        case BI_Device::MountType::Fiducial:
-          mountType = GerberGenerator::MountType::Fiducial;
-          break;
-        case BI_Device::MountType::None:
-          continue;
-        default:
-          break;
-      }
-
+  foreach (const Footprint& fpt, mFootprints) {
+    // Skip devices which are considered as no device to be mounted.
+    if ((fpt.transform.getMirrored() == (side == BoardSide::Bottom)) &&
+        fpt.mountType) {
       // Export component center and attributes.
-      Angle rotation = device->getMirrored() ? -device->getRotation()
-                                             : device->getRotation();
-      QString designator = *device->getComponentInstance().getName();
-      QString value = device->getComponentInstance().getValue(true).trimmed();
-      QString manufacturer =
-          AttributeSubstitutor::substitute("{{MANUFACTURER}}", device)
-              .trimmed();
-      QString mpn = AttributeSubstitutor::substitute(
-                        "{{MPN or PARTNUMBER or DEVICE}}", device)
-                        .trimmed();
-      // Note: Always use english locale to make PnP files portable.
-      QString footprintName =
-          *device->getLibPackage().getNames().getDefaultValue();
-      gen.flashComponent(device->getPosition(), rotation, designator, value,
-                         mountType, manufacturer, mpn, footprintName);
+      const GerberGenerator::MountType mountType = *fpt.mountType;
+      Angle rotation = fpt.transform.getMirrored()
+          ? -fpt.transform.getRotation()
+          : fpt.transform.getRotation();
+      gen.flashComponent(fpt.transform.getPosition(), rotation,
+                         fpt.designator, fpt.value, mountType,
+                         fpt.manufacturer, fpt.mpn, fpt.footprintName);
 
       // Export component outline. But only closed ones, sunce Gerber specs say
       // that component outlines must be closed.
-      QHash<QString, GerberAttribute::ApertureFunction> layerFunction;
+      QHash<GraphicsLayerId, GerberAttribute::ApertureFunction> layerFunction;
       if (side == BoardSide::Top) {
-        layerFunction[GraphicsLayer::sTopDocumentation] =
+        layerFunction[GraphicsLayerId(GraphicsLayer::sTopDocumentation)] =
             GerberAttribute::ApertureFunction::ComponentOutlineBody;
-        layerFunction[GraphicsLayer::sTopCourtyard] =
+        layerFunction[GraphicsLayerId(GraphicsLayer::sTopCourtyard)] =
             GerberAttribute::ApertureFunction::ComponentOutlineCourtyard;
       } else {
-        layerFunction[GraphicsLayer::sBotDocumentation] =
+        layerFunction[GraphicsLayerId(GraphicsLayer::sBotDocumentation)] =
             GerberAttribute::ApertureFunction::ComponentOutlineBody;
-        layerFunction[GraphicsLayer::sBotCourtyard] =
+        layerFunction[GraphicsLayerId(GraphicsLayer::sBotCourtyard)] =
             GerberAttribute::ApertureFunction::ComponentOutlineCourtyard;
       }
-      const Transform transform(*device);
-      for (const Polygon& polygon :
-           device->getLibFootprint().getPolygons().sortedByUuid()) {
+      foreach (const Polygon& polygon, fpt.polygons) {
         if (!polygon.getPath().isClosed()) {
           continue;
         }
         if (polygon.isFilled()) {
           continue;
         }
-        QString layer = transform.map(*polygon.getLayerName());
+        const GraphicsLayerId layer = fpt.transform.map(polygon.getLayerId());
         if (!layerFunction.contains(layer)) {
           continue;
         }
-        Path path = transform.map(polygon.getPath());
-        gen.drawComponentOutline(path, rotation, designator, value, mountType,
-                                 manufacturer, mpn, footprintName,
-                                 layerFunction[layer]);
+        Path path = fpt.transform.map(polygon.getPath());
+        gen.drawComponentOutline(path, rotation, fpt.designator, fpt.value,
+                                 mountType, fpt.manufacturer, fpt.mpn,
+                                 fpt.footprintName, layerFunction[layer]);
       }
 
       // Export component pins.
-      foreach (const BI_FootprintPad* pad, device->getPads()) {
-        QString pinName, pinSignal;
-        if (const PackagePad* pkgPad = pad->getLibPackagePad()) {
-          pinName = *pkgPad->getName();
-        }
-        if (ComponentSignalInstance* cmpSig =
-                pad->getComponentSignalInstance()) {
-          pinSignal = *cmpSig->getCompSignal().getName();
-        }
-        bool isPin1 = (pinName == "1");  // Very sophisticated algorithm ;-)
-        gen.flashComponentPin(pad->getPosition(), rotation, designator, value,
-                              mountType, manufacturer, mpn, footprintName,
-                              pinName, pinSignal, isPin1);
+      foreach (const Pad& pad, fpt.pads) {
+        bool isPin1 = (pad.pinName == "1");  // Very sophisticated algorithm ;-)
+        gen.flashComponentPin(pad.position, rotation, fpt.designator,
+                              fpt.value, mountType, fpt.manufacturer, fpt.mpn,
+                              fpt.footprintName, pad.pinName, pad.signalName,
+                              isPin1);
       }
     }
   }
 
   gen.generate();
-  gen.saveToFile(filePath);
-  mWrittenFiles.append(filePath);
+  saveFile(filePath, gen.toByteArray());  // can throw
+}
+
+void BoardGerberExport::startPcbLayersExport(
+    const BoardFabricationOutputSettings& settings, bool zip) noexcept {
+  cancel();
+  mWrittenFiles.clear();
+  mFuture = QtConcurrent::run(
+      this, &BoardGerberExport::run, prepareJobs(settings),
+      zip ? getOutputZipFile(settings) : FilePath(),
+      getOutputDirectory(settings));
+}
+
+QString BoardGerberExport::waitForFinished() noexcept {
+  mFuture.waitForFinished();
+  return mFuture.result();
+}
+
+void BoardGerberExport::cancel() noexcept {
+  mAbort.storeRelease(1);
+  mFuture.waitForFinished();
+  mAbort.storeRelease(0);
 }
 
 /*******************************************************************************
@@ -260,27 +352,126 @@ QVector<const AttributeProvider*>
  *  Private Methods
  ******************************************************************************/
 
-void BoardGerberExport::exportDrills(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixDrills());
+QVector<BoardGerberExport::Job> BoardGerberExport::prepareJobs(
+    const BoardFabricationOutputSettings& settings) const noexcept {
+  // Note: The output file paths are resolved here since the attribute
+  //       substitution accesses the board, which is not allowed from the
+  //       worker thread.
+  QVector<Job> jobs;
+  auto addJob = [&](const QString& suffix,
+                    std::function<void(const FilePath&)> exportFunc) {
+    const FilePath fp =
+        getOutputFilePath(settings.getOutputBasePath() % suffix);
+    jobs.append([fp, exportFunc]() { exportFunc(fp); });
+  };
+
+  const bool g85 = settings.getUseG85SlotCommand();
+  if (settings.getMergeDrillFiles()) {
+    addJob(settings.getSuffixDrills(),
+           [this, g85](const FilePath& fp) { exportDrills(fp, g85); });
+  } else {
+    addJob(settings.getSuffixDrillsNpth(),
+           [this, g85](const FilePath& fp) { exportDrillsNpth(fp, g85); });
+    addJob(settings.getSuffixDrillsPth(),
+           [this, g85](const FilePath& fp) { exportDrillsPth(fp, g85); });
+  }
+  addJob(settings.getSuffixOutlines(),
+         [this](const FilePath& fp) { exportLayerBoardOutlines(fp); });
+  addJob(settings.getSuffixCopperTop(),
+         [this](const FilePath& fp) { exportLayerTopCopper(fp); });
+  for (int i = 1; i <= mInnerLayerCount; ++i) {
+    mCurrentInnerCopperLayer = i;  // used for attribute provider
+    addJob(settings.getSuffixCopperInner(),
+           [this, i](const FilePath& fp) { exportLayerInnerCopper(fp, i); });
+  }
+  mCurrentInnerCopperLayer = 0;
+  addJob(settings.getSuffixCopperBot(),
+         [this](const FilePath& fp) { exportLayerBottomCopper(fp); });
+  addJob(settings.getSuffixSolderMaskTop(),
+         [this](const FilePath& fp) { exportLayerTopSolderMask(fp); });
+  addJob(settings.getSuffixSolderMaskBot(),
+         [this](const FilePath& fp) { exportLayerBottomSolderMask(fp); });
+  // Don't create silkscreen files if no layers are selected.
+  const QStringList silkscreenTop = settings.getSilkscreenLayersTop();
+  if (!silkscreenTop.isEmpty()) {
+    addJob(settings.getSuffixSilkscreenTop(),
+           [this, silkscreenTop](const FilePath& fp) {
+             exportLayerTopSilkscreen(fp, silkscreenTop);
+           });
+  }
+  const QStringList silkscreenBot = settings.getSilkscreenLayersBot();
+  if (!silkscreenBot.isEmpty()) {
+    addJob(settings.getSuffixSilkscreenBot(),
+           [this, silkscreenBot](const FilePath& fp) {
+             exportLayerBottomSilkscreen(fp, silkscreenBot);
+           });
+  }
+  if (settings.getEnableSolderPasteTop()) {
+    addJob(settings.getSuffixSolderPasteTop(),
+           [this](const FilePath& fp) { exportLayerTopSolderPaste(fp); });
+  }
+  if (settings.getEnableSolderPasteBot()) {
+    addJob(settings.getSuffixSolderPasteBot(),
+           [this](const FilePath& fp) { exportLayerBottomSolderPaste(fp); });
+  }
+  return jobs;
+}
+
+QString BoardGerberExport::run(QVector<Job> jobs, FilePath zipFp,
+                               FilePath zipRootDir) noexcept {
+  // Note: This method is called from a different thread, thus be careful to
+  //       only access the board snapshot, not the board itself!
+
+  QElapsedTimer timer;
+  timer.start();
+  qDebug() << "Start Gerber export in worker thread...";
+  emit progress(0, 0, jobs.count());
+
+  try {
+    if (zipFp.isValid()) {
+      openZipFile(zipFp, zipRootDir);  // can throw
+    }
+    // Removes the ZIP file if it was not completed.
+    auto sg = scopeGuard([this]() { mZipWriter.reset(); });
+    for (int i = 0; i < jobs.count(); ++i) {
+      if (mAbort.loadAcquire()) {
+        qDebug().nospace() << "Gerber export canceled after " << i
+                           << " files.";
+        return QString();
+      }
+      jobs.at(i)();  // can throw
+      emit progress(((i + 1) * 100) / jobs.count(), i + 1, jobs.count());
+    }
+    closeZipFile();  // can throw
+    qDebug().nospace() << "Successfully exported Gerber files in "
+                       << timer.elapsed() << "ms.";
+    emit succeeded();
+    return QString();
+  } catch (const Exception& e) {
+    QString msg = e.getMsg().isEmpty() ? "Unknown error" : e.getMsg();
+    qCritical().nospace() << "Gerber export failed after " << timer.elapsed()
+                          << "ms: " << msg;
+    emit failed(msg);
+    return msg;
+  }
+}
+
+void BoardGerberExport::exportDrills(const FilePath& fp,
+                                     bool useG85Slots) const {
   std::unique_ptr<ExcellonGenerator> gen =
       BoardGerberExport::createExcellonGenerator(
-          settings, ExcellonGenerator::Plating::Mixed);
+          useG85Slots, ExcellonGenerator::Plating::Mixed);
   drawPthDrills(*gen);
   drawNpthDrills(*gen);
   gen->generate();
-  gen->saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen->toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportDrillsNpth(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixDrillsNpth());
+void BoardGerberExport::exportDrillsNpth(const FilePath& fp,
+                                         bool useG85Slots) const {
   std::unique_ptr<ExcellonGenerator> gen =
       BoardGerberExport::createExcellonGenerator(
-          settings, ExcellonGenerator::Plating::No);
+          useG85Slots, ExcellonGenerator::Plating::No);
   drawNpthDrills(*gen);
 
   // Note that separate NPTH drill files could lead to issues with some PCB
@@ -291,195 +482,141 @@ void BoardGerberExport::exportDrillsNpth(
   // doesn't support a separate NPTH file, the user shall enable the
   // "merge PTH and NPTH drills"  option.
   gen->generate();
-  gen->saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen->toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportDrillsPth(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixDrillsPth());
+void BoardGerberExport::exportDrillsPth(const FilePath& fp,
+                                        bool useG85Slots) const {
   std::unique_ptr<ExcellonGenerator> gen =
       BoardGerberExport::createExcellonGenerator(
-          settings, ExcellonGenerator::Plating::Yes);
+          useG85Slots, ExcellonGenerator::Plating::Yes);
   drawPthDrills(*gen);
   gen->generate();
-  gen->saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen->toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerBoardOutlines(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixOutlines());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+void BoardGerberExport::exportLayerBoardOutlines(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   gen.setFileFunctionOutlines(false);
   drawLayer(gen, GraphicsLayer::sBoardOutlines);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerTopCopper(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixCopperTop());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+void BoardGerberExport::exportLayerTopCopper(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   gen.setFileFunctionCopper(1, GerberGenerator::CopperSide::Top,
                             GerberGenerator::Polarity::Positive);
   drawLayer(gen, GraphicsLayer::sTopCopper);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerBottomCopper(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixCopperBot());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
-  gen.setFileFunctionCopper(mBoard.getLayerStack().getInnerLayerCount() + 2,
+void BoardGerberExport::exportLayerBottomCopper(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
+  gen.setFileFunctionCopper(mInnerLayerCount + 2,
                             GerberGenerator::CopperSide::Bottom,
                             GerberGenerator::Polarity::Positive);
   drawLayer(gen, GraphicsLayer::sBotCopper);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerInnerCopper(
-    const BoardFabricationOutputSettings& settings) const {
-  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
-    mCurrentInnerCopperLayer = i;  // used for attribute provider
-    FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                    settings.getSuffixCopperInner());
-    GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                        mProject.getVersion());
-    gen.setFileFunctionCopper(i + 1, GerberGenerator::CopperSide::Inner,
-                              GerberGenerator::Polarity::Positive);
-    drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-  mCurrentInnerCopperLayer = 0;
+void BoardGerberExport::exportLayerInnerCopper(const FilePath& fp,
+                                               int index) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
+  gen.setFileFunctionCopper(index + 1, GerberGenerator::CopperSide::Inner,
+                            GerberGenerator::Polarity::Positive);
+  drawLayer(gen, GraphicsLayer::getInnerLayerName(index));
+  gen.generate();
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerTopSolderMask(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixSolderMaskTop());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+void BoardGerberExport::exportLayerTopSolderMask(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   gen.setFileFunctionSolderMask(GerberGenerator::BoardSide::Top,
                                 GerberGenerator::Polarity::Negative);
   drawLayer(gen, GraphicsLayer::sTopStopMask);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerBottomSolderMask(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixSolderMaskBot());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+void BoardGerberExport::exportLayerBottomSolderMask(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   gen.setFileFunctionSolderMask(GerberGenerator::BoardSide::Bottom,
                                 GerberGenerator::Polarity::Negative);
   drawLayer(gen, GraphicsLayer::sBotStopMask);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
 void BoardGerberExport::exportLayerTopSilkscreen(
-    const BoardFabricationOutputSettings& settings) const {
-  QStringList layers = settings.getSilkscreenLayersTop();
-  if (layers.count() >
-      0) {  // don't create silkscreen file if no layers selected
-    FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                    settings.getSuffixSilkscreenTop());
-    GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                        mProject.getVersion());
-    gen.setFileFunctionLegend(GerberGenerator::BoardSide::Top,
-                              GerberGenerator::Polarity::Positive);
-    foreach (const QString& layer, layers) { drawLayer(gen, layer); }
-    gen.setLayerPolarity(GerberGenerator::Polarity::Negative);
-    drawLayer(gen, GraphicsLayer::sTopStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
+    const FilePath& fp, const QStringList& layers) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
+  gen.setFileFunctionLegend(GerberGenerator::BoardSide::Top,
+                            GerberGenerator::Polarity::Positive);
+  foreach (const QString& layer, layers) { drawLayer(gen, layer); }
+  gen.setLayerPolarity(GerberGenerator::Polarity::Negative);
+  drawLayer(gen, GraphicsLayer::sTopStopMask);
+  gen.generate();
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
 void BoardGerberExport::exportLayerBottomSilkscreen(
-    const BoardFabricationOutputSettings& settings) const {
-  QStringList layers = settings.getSilkscreenLayersBot();
-  if (layers.count() >
-      0) {  // don't create silkscreen file if no layers selected
-    FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                    settings.getSuffixSilkscreenBot());
-    GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                        mProject.getVersion());
-    gen.setFileFunctionLegend(GerberGenerator::BoardSide::Bottom,
-                              GerberGenerator::Polarity::Positive);
-    foreach (const QString& layer, layers) { drawLayer(gen, layer); }
-    gen.setLayerPolarity(GerberGenerator::Polarity::Negative);
-    drawLayer(gen, GraphicsLayer::sBotStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
+    const FilePath& fp, const QStringList& layers) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
+  gen.setFileFunctionLegend(GerberGenerator::BoardSide::Bottom,
+                            GerberGenerator::Polarity::Positive);
+  foreach (const QString& layer, layers) { drawLayer(gen, layer); }
+  gen.setLayerPolarity(GerberGenerator::Polarity::Negative);
+  drawLayer(gen, GraphicsLayer::sBotStopMask);
+  gen.generate();
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerTopSolderPaste(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixSolderPasteTop());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+void BoardGerberExport::exportLayerTopSolderPaste(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   gen.setFileFunctionPaste(GerberGenerator::BoardSide::Top,
                            GerberGenerator::Polarity::Positive);
   drawLayer(gen, GraphicsLayer::sTopSolderPaste);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
-void BoardGerberExport::exportLayerBottomSolderPaste(
-    const BoardFabricationOutputSettings& settings) const {
-  FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
-                                  settings.getSuffixSolderPasteBot());
-  GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
-                      mProject.getVersion());
+void BoardGerberExport::exportLayerBottomSolderPaste(const FilePath& fp) const {
+  GerberGenerator gen(mCreationDateTime, mProjectName, mBoardUuid,
+                      mProjectVersion);
   gen.setFileFunctionPaste(GerberGenerator::BoardSide::Bottom,
                            GerberGenerator::Polarity::Positive);
   drawLayer(gen, GraphicsLayer::sBotSolderPaste);
   gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveFile(fp, gen.toByteArray());  // can throw
 }
 
 int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
   int count = 0;
 
   // footprint holes
-  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-    const Transform transform(*device);
-    for (const Hole& hole : device->getLibFootprint().getHoles()) {
-      gen.drill(transform.map(hole.getPath()), hole.getDiameter(), false,
+  foreach (const Footprint& fpt, mFootprints) {
+    foreach (const Hole& hole, fpt.holes) {
+      gen.drill(fpt.transform.map(hole.getPath()), hole.getDiameter(), false,
                 ExcellonGenerator::Function::MechanicalDrill);
       ++count;
     }
   }
 
   // board holes
-  foreach (const BI_Hole* hole, mBoard.getHoles()) {
-    gen.drill(hole->getHole().getPath(), hole->getHole().getDiameter(), false,
+  foreach (const Hole& hole, mHoles) {
+    gen.drill(hole.getPath(), hole.getDiameter(), false,
               ExcellonGenerator::Function::MechanicalDrill);
     ++count;
   }
@@ -491,13 +628,12 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
   int count = 0;
 
   // footprint pads
-  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-    const Transform deviceTransform(*device);
-    foreach (const BI_FootprintPad* pad, device->getPads()) {
-      const FootprintPad& libPad = pad->getLibPad();
+  foreach (const Footprint& fpt, mFootprints) {
+    foreach (const Pad& pad, fpt.pads) {
+      const FootprintPad& libPad = pad.libPad;
       const Transform padTransform(libPad.getPosition(), libPad.getRotation());
       for (const Hole& hole : libPad.getHoles()) {
-        gen.drill(deviceTransform.map(padTransform.map(hole.getPath())),
+        gen.drill(fpt.transform.map(padTransform.map(hole.getPath())),
                   hole.getDiameter(), true,
                   ExcellonGenerator::Function::ComponentDrill);  // can throw
         ++count;
@@ -506,9 +642,9 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
   }
 
   // vias
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      gen.drill(via->getPosition(), via->getDrillDiameter(), true,
+  foreach (const NetSegment& segment, mNetSegments) {
+    foreach (const Via& via, segment.vias) {
+      gen.drill(via.getPosition(), via.getDrillDiameter(), true,
                 ExcellonGenerator::Function::ViaDrill);
       ++count;
     }
@@ -519,41 +655,36 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
 
 void BoardGerberExport::drawLayer(GerberGenerator& gen,
                                   const QString& layerName) const {
+  // Look up the layer ID once, so all the per-item layer checks below are
+  // integer comparisons instead of string comparisons.
+  const GraphicsLayerId layer(layerName);
+
   // draw footprints incl. pads
-  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-    Q_ASSERT(device);
-    drawDevice(gen, *device, layerName);
+  foreach (const Footprint& fpt, mFootprints) {
+    drawFootprint(gen, fpt, layer);
   }
 
   // draw vias and traces (grouped by net)
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    Q_ASSERT(netsegment);
-    QString net = netsegment->getNetSignal()
-        ? *netsegment->getNetSignal()->getName()  // Named net.
-        : "N/C";  // Anonymous net (reserved name by Gerber specs).
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      Q_ASSERT(via);
-      drawVia(gen, *via, layerName, net);
+  foreach (const NetSegment& segment, mNetSegments) {
+    foreach (const Via& via, segment.vias) {
+      drawVia(gen, via, layer, segment.netName);
     }
-    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      Q_ASSERT(netline);
-      if (netline->getLayer().getName() == layerName) {
-        gen.drawLine(netline->getStartPoint().getPosition(),
-                     netline->getEndPoint().getPosition(),
-                     positiveToUnsigned(netline->getWidth()),
-                     GerberAttribute::ApertureFunction::Conductor, net,
-                     QString());
+    foreach (const Trace& trace, segment.traces) {
+      if (trace.layer == layer) {
+        gen.drawLine(trace.startPosition, trace.endPosition,
+                     positiveToUnsigned(trace.width),
+                     GerberAttribute::ApertureFunction::Conductor,
+                     segment.netName, QString());
       }
     }
   }
 
   // draw planes
-  foreach (const BI_Plane* plane, mBoard.getPlanes()) {
-    Q_ASSERT(plane);
-    if (plane->getLayerName() == layerName) {
-      foreach (const Path& fragment, plane->getFragments()) {
+  foreach (const Plane& plane, mPlanes) {
+    if (plane.layer == layer) {
+      foreach (const Path& fragment, plane.fragments) {
         gen.drawPathArea(fragment, GerberAttribute::ApertureFunction::Conductor,
-                         *plane->getNetSignal().getName(), QString());
+                         plane.netName, QString());
       }
     }
   }
@@ -567,19 +698,17 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
     graphicsFunction = GerberAttribute::ApertureFunction::Conductor;
     graphicsNet = "";  // Not connected to any net.
   }
-  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
-    Q_ASSERT(polygon);
-    if (layerName == polygon->getPolygon().getLayerName()) {
+  foreach (const Polygon& polygon, mPolygons) {
+    if (layer == polygon.getLayerId()) {
       UnsignedLength lineWidth =
-          calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
-      gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth,
-                          graphicsFunction, graphicsNet, QString());
+          calcWidthOfLayer(polygon.getLineWidth(), layer);
+      gen.drawPathOutline(polygon.getPath(), lineWidth, graphicsFunction,
+                          graphicsNet, QString());
       // Only fill closed paths (for consistency with the appearance in the
       // board editor, and because Gerber expects area outlines as closed).
-      if (polygon->getPolygon().isFilled() &&
-          polygon->getPolygon().getPath().isClosed()) {
-        gen.drawPathArea(polygon->getPolygon().getPath(), graphicsFunction,
-                         graphicsNet, QString());
+      if (polygon.isFilled() && polygon.getPath().isClosed()) {
+        gen.drawPathArea(polygon.getPath(), graphicsFunction, graphicsNet,
+                         QString());
       }
     }
   }
@@ -589,13 +718,10 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
   if (GraphicsLayer::isCopperLayer(layerName)) {
     textFunction = GerberAttribute::ApertureFunction::NonConductor;
   }
-  foreach (const BI_StrokeText* text, mBoard.getStrokeTexts()) {
-    Q_ASSERT(text);
-    if (layerName == text->getText().getLayerName()) {
-      UnsignedLength lineWidth =
-          calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-      const Transform transform(text->getText());
-      foreach (Path path, transform.map(text->generatePaths())) {
+  foreach (const TextPaths& text, mStrokeTexts) {
+    if (layer == text.layer) {
+      UnsignedLength lineWidth = calcWidthOfLayer(text.strokeWidth, layer);
+      foreach (const Path& path, text.paths) {
         gen.drawPathOutline(path, lineWidth, textFunction, graphicsNet,
                             QString());
       }
@@ -603,18 +729,19 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
   }
 }
 
-void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
-                                const QString& layerName,
+void BoardGerberExport::drawVia(GerberGenerator& gen, const Via& via,
+                                const GraphicsLayerId& layer,
                                 const QString& netName) const {
-  bool drawCopper = via.isOnLayer(layerName);
-  bool drawStopMask = (layerName == GraphicsLayer::sTopStopMask ||
-                       layerName == GraphicsLayer::sBotStopMask) &&
-      mBoard.getDesignRules().doesViaRequireStopMask(*via.getDrillDiameter());
+  static const GraphicsLayerId topStopMask(GraphicsLayer::sTopStopMask);
+  static const GraphicsLayerId botStopMask(GraphicsLayer::sBotStopMask);
+  bool drawCopper = layer.isCopperLayer();  // Vias are on all copper layers.
+  bool drawStopMask = (layer == topStopMask || layer == botStopMask) &&
+      mDesignRules.doesViaRequireStopMask(*via.getDrillDiameter());
   if (drawCopper || drawStopMask) {
     PositiveLength outerDiameter = via.getSize();
     UnsignedLength radius(0);
     if (drawStopMask) {
-      radius = mBoard.getDesignRules().calcStopMaskClearance(*via.getSize());
+      radius = mDesignRules.calcStopMaskClearance(*via.getSize());
       outerDiameter += UnsignedLength(radius * 2);
     }
 
@@ -631,32 +758,33 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
   }
 }
 
-void BoardGerberExport::drawDevice(GerberGenerator& gen,
-                                   const BI_Device& device,
-                                   const QString& layerName) const {
+void BoardGerberExport::drawFootprint(GerberGenerator& gen,
+                                      const Footprint& footprint,
+                                      const GraphicsLayerId& layer) const {
+  static const GraphicsLayerId boardOutlines(GraphicsLayer::sBoardOutlines);
   GerberGenerator::Function graphicsFunction = tl::nullopt;
   tl::optional<QString> graphicsNet = tl::nullopt;
-  if (layerName == GraphicsLayer::sBoardOutlines) {
+  if (layer == boardOutlines) {
     graphicsFunction = GerberAttribute::ApertureFunction::Profile;
-  } else if (GraphicsLayer::isCopperLayer(layerName)) {
+  } else if (layer.isCopperLayer()) {
     graphicsFunction = GerberAttribute::ApertureFunction::Conductor;
     graphicsNet = "";  // Not connected to any net.
   }
-  QString component = *device.getComponentInstance().getName();
+  const QString& component = footprint.designator;
 
   // draw pads
-  foreach (const BI_FootprintPad* pad, device.getPads()) {
-    drawFootprintPad(gen, *pad, layerName);
+  foreach (const Pad& pad, footprint.pads) {
+    drawFootprintPad(gen, pad, component, layer);
   }
 
   // draw polygons
-  const Transform transform(device);
-  for (const Polygon& polygon :
-       device.getLibFootprint().getPolygons().sortedByUuid()) {
-    QString layer = transform.map(layerName);
-    if (layer == polygon.getLayerName()) {
+  const Transform& transform = footprint.transform;
+  const GraphicsLayerId libLayer = transform.map(layer);
+  foreach (const Polygon& polygon, footprint.polygons) {
+    if (libLayer == polygon.getLayerId()) {
       Path path = transform.map(polygon.getPath());
-      gen.drawPathOutline(path, calcWidthOfLayer(polygon.getLineWidth(), layer),
+      gen.drawPathOutline(path,
+                          calcWidthOfLayer(polygon.getLineWidth(), libLayer),
                           graphicsFunction, graphicsNet, component);
       // Only fill closed paths (for consistency with the appearance in the
       // board editor, and because Gerber expects area outlines as closed).
@@ -667,10 +795,8 @@ void BoardGerberExport::drawDevice(GerberGenerator& gen,
   }
 
   // draw circles
-  for (const Circle& circle :
-       device.getLibFootprint().getCircles().sortedByUuid()) {
-    QString layer = transform.map(layerName);
-    if (layer == circle.getLayerName()) {
+  foreach (const Circle& circle, footprint.circles) {
+    if (libLayer == circle.getLayerId()) {
       Point absolutePos = transform.map(circle.getCenter());
       if (circle.isFilled()) {
         PositiveLength outerDia = circle.getDiameter() + circle.getLineWidth();
@@ -678,7 +804,7 @@ void BoardGerberExport::drawDevice(GerberGenerator& gen,
                          graphicsFunction, graphicsNet, component);
       } else {
         UnsignedLength lineWidth =
-            calcWidthOfLayer(circle.getLineWidth(), layer);
+            calcWidthOfLayer(circle.getLineWidth(), libLayer);
         gen.drawPathOutline(
             Path::circle(circle.getDiameter()).translated(absolutePos),
             lineWidth, graphicsFunction, graphicsNet, component);
@@ -686,17 +812,15 @@ void BoardGerberExport::drawDevice(GerberGenerator& gen,
     }
   }
 
-  // draw stroke texts (from footprint instance, *NOT* from library footprint!)
+  // draw stroke texts
   GerberGenerator::Function textFunction = tl::nullopt;
-  if (GraphicsLayer::isCopperLayer(layerName)) {
+  if (layer.isCopperLayer()) {
     textFunction = GerberAttribute::ApertureFunction::NonConductor;
   }
-  foreach (const BI_StrokeText* text, device.getStrokeTexts()) {
-    if (layerName == text->getText().getLayerName()) {
-      UnsignedLength lineWidth =
-          calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-      Transform transform(text->getText());
-      foreach (Path path, transform.map(text->generatePaths())) {
+  foreach (const TextPaths& text, footprint.texts) {
+    if (layer == text.layer) {
+      UnsignedLength lineWidth = calcWidthOfLayer(text.strokeWidth, layer);
+      foreach (const Path& path, text.paths) {
         gen.drawPathOutline(path, lineWidth, textFunction, graphicsNet,
                             component);
       }
@@ -704,37 +828,43 @@ void BoardGerberExport::drawDevice(GerberGenerator& gen,
   }
 }
 
-void BoardGerberExport::drawFootprintPad(GerberGenerator& gen,
-                                         const BI_FootprintPad& pad,
-                                         const QString& layerName) const {
-  bool isSmt = !pad.getLibPad().isTht();
-  bool isOnCopperLayer = pad.isOnLayer(layerName);
-  bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) &&
-      (layerName == GraphicsLayer::sTopStopMask);
-  bool isOnSolderMaskBottom = pad.isOnLayer(GraphicsLayer::sBotCopper) &&
-      (layerName == GraphicsLayer::sBotStopMask);
-  bool isOnSolderPasteTop = isSmt && pad.isOnLayer(GraphicsLayer::sTopCopper) &&
-      (layerName == GraphicsLayer::sTopSolderPaste);
-  bool isOnSolderPasteBottom = isSmt &&
-      pad.isOnLayer(GraphicsLayer::sBotCopper) &&
-      (layerName == GraphicsLayer::sBotSolderPaste);
+void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const Pad& pad,
+                                         const QString& component,
+                                         const GraphicsLayerId& layer) const {
+  static const GraphicsLayerId topCopper(GraphicsLayer::sTopCopper);
+  static const GraphicsLayerId botCopper(GraphicsLayer::sBotCopper);
+  static const GraphicsLayerId topStopMask(GraphicsLayer::sTopStopMask);
+  static const GraphicsLayerId botStopMask(GraphicsLayer::sBotStopMask);
+  static const GraphicsLayerId topSolderPaste(GraphicsLayer::sTopSolderPaste);
+  static const GraphicsLayerId botSolderPaste(GraphicsLayer::sBotSolderPaste);
+  const FootprintPad& libPad = pad.libPad;
+  auto isOnLayer = [&](const GraphicsLayerId& l) {
+    return libPad.isOnLayer(pad.mirrored ? l.getMirrored() : l);
+  };
+  bool isSmt = !libPad.isTht();
+  bool isOnCopperLayer = isOnLayer(layer);
+  bool isOnSolderMaskTop = (layer == topStopMask) && isOnLayer(topCopper);
+  bool isOnSolderMaskBottom = (layer == botStopMask) && isOnLayer(botCopper);
+  bool isOnSolderPasteTop =
+      isSmt && (layer == topSolderPaste) && isOnLayer(topCopper);
+  bool isOnSolderPasteBottom =
+      isSmt && (layer == botSolderPaste) && isOnLayer(botCopper);
   if (!isOnCopperLayer && !isOnSolderMaskTop && !isOnSolderMaskBottom &&
       !isOnSolderPasteTop && !isOnSolderPasteBottom) {
     return;
   }
 
-  const FootprintPad& libPad = pad.getLibPad();
   Length width = *libPad.getWidth();
   Length height = *libPad.getHeight();
   UnsignedLength radius(0);
   if (isOnSolderMaskTop || isOnSolderMaskBottom) {
     Length size = qMin(width, height);
-    radius = mBoard.getDesignRules().calcStopMaskClearance(size);
+    radius = mDesignRules.calcStopMaskClearance(size);
     width += radius * 2;
     height += radius * 2;
   } else if (isOnSolderPasteTop || isOnSolderPasteBottom) {
     Length size = qMin(width, height);
-    Length clearance = -mBoard.getDesignRules().calcSolderPasteClearance(size);
+    Length clearance = -mDesignRules.calcSolderPasteClearance(size);
     width += clearance * 2;
     height += clearance * 2;
     if (clearance > 0) {
@@ -744,7 +874,7 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen,
 
   if ((width <= 0) || (height <= 0)) {
     qWarning() << "Pad with zero size ignored in Gerber export:"
-               << pad.getLibPadUuid();
+               << libPad.getUuid();
     return;
   }
 
@@ -754,7 +884,6 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen,
   // Pad attributes (most of them only on copper layers).
   GerberGenerator::Function function = tl::nullopt;
   tl::optional<QString> net = tl::nullopt;
-  QString component = *pad.getDevice().getComponentInstance().getName();
   QString pin, signal;
   if (isOnCopperLayer) {
     if (!isSmt) {
@@ -762,32 +891,25 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen,
     } else {
       function = GerberAttribute::ApertureFunction::SmdPadCopperDefined;
     }
-    net = pad.getCompSigInstNetSignal()
-        ? *pad.getCompSigInstNetSignal()->getName()  // Named net.
-        : "N/C";  // Anonymous net (reserved name by Gerber specs).
-    if (const PackagePad* pkgPad = pad.getLibPackagePad()) {
-      pin = *pkgPad->getName();
-    }
-    if (ComponentSignalInstance* cmpSig = pad.getComponentSignalInstance()) {
-      signal = *cmpSig->getCompSignal().getName();
-    }
+    net = pad.netName;
+    pin = pad.pinName;
+    signal = pad.signalName;
   }
 
   switch (libPad.getShape()) {
     case FootprintPad::Shape::ROUND: {
-      gen.flashObround(pad.getPosition(), pWidth, pHeight, pad.getRotation(),
-                       function, net, component, pin, signal);
+      gen.flashObround(pad.position, pWidth, pHeight, pad.rotation, function,
+                       net, component, pin, signal);
       break;
     }
     case FootprintPad::Shape::RECT: {
-      gen.flashRect(pad.getPosition(), pWidth, pHeight, radius,
-                    pad.getRotation(), function, net, component, pin, signal);
+      gen.flashRect(pad.position, pWidth, pHeight, radius, pad.rotation,
+                    function, net, component, pin, signal);
       break;
     }
     case FootprintPad::Shape::OCTAGON: {
-      gen.flashOctagon(pad.getPosition(), pWidth, pHeight, radius,
-                       pad.getRotation(), function, net, component, pin,
-                       signal);
+      gen.flashOctagon(pad.position, pWidth, pHeight, radius, pad.rotation,
+                       function, net, component, pin, signal);
       break;
     }
     default: { throw LogicError(__FILE__, __LINE__); }
@@ -795,15 +917,43 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen,
 }
 
 std::unique_ptr<ExcellonGenerator> BoardGerberExport::createExcellonGenerator(
-    const BoardFabricationOutputSettings& settings,
-    ExcellonGenerator::Plating plating) const {
+    bool useG85Slots, ExcellonGenerator::Plating plating) const {
   std::unique_ptr<ExcellonGenerator> gen(new ExcellonGenerator(
-      mCreationDateTime, mProjectName, mBoard.getUuid(), mProject.getVersion(),
-      plating, 1, mBoard.getLayerStack().getInnerLayerCount() + 2));
-  gen->setUseG85Slots(settings.getUseG85SlotCommand());
+      mCreationDateTime, mProjectName, mBoardUuid, mProjectVersion, plating, 1,
+      mInnerLayerCount + 2));
+  gen->setUseG85Slots(useG85Slots);
   return gen;
 }
 
+void BoardGerberExport::openZipFile(const FilePath& fp,
+                                    const FilePath& rootDir) const {
+  mZipWriter.reset(new ZipWriter(fp));  // can throw
+  mZipFilePath = fp;
+  mZipRootDir = rootDir;
+}
+
+void BoardGerberExport::closeZipFile() const {
+  if (mZipWriter) {
+    mZipWriter->finish();  // can throw
+    mZipWriter.reset();
+    mWrittenFiles.append(mZipFilePath);
+  }
+}
+
+void BoardGerberExport::saveFile(const FilePath& fp,
+                                 const QByteArray& content) const {
+  if (mZipWriter) {
+    // Files outside the output directory are added to the ZIP root.
+    const QString path = fp.isLocatedInDir(mZipRootDir)
+        ? fp.toRelative(mZipRootDir)
+        : fp.getFilename();
+    mZipWriter->addFile(path, content);  // can throw
+  } else {
+    FileUtils::writeFile(fp, content);  // can throw
+    mWrittenFiles.append(fp);
+  }
+}
+
 FilePath BoardGerberExport::getOutputFilePath(QString path) const noexcept {
   path = AttributeSubstitutor::substitute(path, this, [&](const QString& str) {
     return FilePath::cleanFileName(
@@ -813,7 +963,7 @@ FilePath BoardGerberExport::getOutputFilePath(QString path) const noexcept {
   if (QDir::isAbsolutePath(path)) {
     return FilePath(path);
   } else {
-    return mBoard.getProject().getPath().getPathTo(path);
+    return mProject.getPath().getPathTo(path);
   }
 }
 
@@ -822,9 +972,9 @@ FilePath BoardGerberExport::getOutputFilePath(QString path) const noexcept {
  ******************************************************************************/
 
 UnsignedLength BoardGerberExport::calcWidthOfLayer(
-    const UnsignedLength& width, const QString& name) noexcept {
-  if ((name == GraphicsLayer::sBoardOutlines) &&
-      (width < UnsignedLength(1000))) {
+    const UnsignedLength& width, const GraphicsLayerId& layer) noexcept {
+  static const GraphicsLayerId boardOutlines(GraphicsLayer::sBoardOutlines);
+  if ((layer == boardOutlines) && (width < UnsignedLength(1000))) {
     return UnsignedLength(1000);  // outlines should have a minimum width of 1um
   } else {
     return width;
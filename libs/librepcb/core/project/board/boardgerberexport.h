@@ -25,11 +25,27 @@
  ******************************************************************************/
 #include "../../attribute/attributeprovider.h"
 #include "../../export/excellongenerator.h"
+#include "../../export/gerberattribute.h"
 #include "../../fileio/filepath.h"
+#include "../../geometry/circle.h"
+#include "../../geometry/hole.h"
+#include "../../geometry/path.h"
+#include "../../geometry/polygon.h"
+#include "../../geometry/via.h"
+#include "../../graphics/graphicslayerid.h"
+#include "../../library/pkg/footprintpad.h"
+#include "../../types/angle.h"
 #include "../../types/length.h"
+#include "../../types/point.h"
+#include "../../types/uuid.h"
+#include "../../utils/transform.h"
+#include "boarddesignrules.h"
+
+#include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -37,46 +53,147 @@
  ******************************************************************************/
 namespace librepcb {
 
-class BI_Device;
-class BI_FootprintPad;
-class BI_Via;
 class Board;
 class BoardFabricationOutputSettings;
-class Circle;
 class GerberGenerator;
-class Polygon;
 class Project;
+class ZipWriter;
 
 /*******************************************************************************
  *  Class BoardGerberExport
  ******************************************************************************/
 
 /**
- * @brief The BoardGerberExport class
+ * @brief Exports a ::librepcb::Board to Gerber and Excellon files
+ *
+ * All the board content needed for the export is copied in the constructor,
+ * so the files can be generated from this snapshot in a worker thread (see
+ * #startPcbLayersExport()) while the board is modified in the meantime.
+ * Only the output file paths are still resolved from the board attributes,
+ * on the thread which starts the export.
  */
 class BoardGerberExport final : public QObject, public AttributeProvider {
   Q_OBJECT
 
+  struct Pad {
+    FootprintPad libPad;
+    Point position;
+    Angle rotation;
+    bool mirrored;
+    QString netName;  ///< "N/C" if not connected to a net
+    QString pinName;
+    QString signalName;
+  };
+
+  struct TextPaths {
+    GraphicsLayerId layer;
+    UnsignedLength strokeWidth;
+    QVector<Path> paths;  ///< Already transformed to board coordinates
+  };
+
+  struct Footprint {
+    Transform transform;
+    QString designator;
+    QString value;
+    QString manufacturer;
+    QString mpn;
+    QString footprintName;
+    tl::optional<GerberAttribute::MountType> mountType;  ///< None if no device
+    QList<Pad> pads;
+    QList<Polygon> polygons;  ///< Sorted by UUID
+    QList<Circle> circles;  ///< Sorted by UUID
+    QList<Hole> holes;
+    QList<TextPaths> texts;
+  };
+
+  struct Trace {
+    GraphicsLayerId layer;
+    Point startPosition;
+    Point endPosition;
+    PositiveLength width;
+  };
+
+  struct NetSegment {
+    QString netName;  ///< "N/C" if not connected to a net
+    QList<Via> vias;
+    QList<Trace> traces;
+  };
+
+  struct Plane {
+    GraphicsLayerId layer;
+    QString netName;
+    QVector<Path> fragments;
+  };
+
+  typedef std::function<void()> Job;
+
 public:
   enum class BoardSide { Top, Bottom };
 
   // Constructors / Destructor
   BoardGerberExport() = delete;
   BoardGerberExport(const BoardGerberExport& other) = delete;
-  explicit BoardGerberExport(const Board& board) noexcept;
+  explicit BoardGerberExport(const Board& board);
   ~BoardGerberExport() noexcept;
 
   // Getters
   FilePath getOutputDirectory(
       const BoardFabricationOutputSettings& settings) const noexcept;
+  FilePath getOutputZipFile(
+      const BoardFabricationOutputSettings& settings) const noexcept;
   const QVector<FilePath>& getWrittenFiles() const noexcept {
     return mWrittenFiles;
   }
 
   // General Methods
-  void exportPcbLayers(const BoardFabricationOutputSettings& settings) const;
+
+  /**
+   * @brief Export the PCB layers
+   *
+   * @param settings  The fabrication output settings to use.
+   * @param zip       If true, all files are written into a single ZIP file
+   *                  (see #getOutputZipFile()) instead of separate files.
+   *                  File paths within the ZIP are relative to
+   *                  #getOutputDirectory().
+   */
+  void exportPcbLayers(const BoardFabricationOutputSettings& settings,
+                       bool zip = false) const;
+
   void exportComponentLayer(BoardSide side, const FilePath& filePath) const;
 
+  /**
+   * @brief Start exporting the PCB layers asynchronously
+   *
+   * Generates the same files as #exportPcbLayers(), but in a worker thread.
+   * The signal #progress() is emitted from the worker thread after each
+   * written file, and at the end either #succeeded() or #failed() is
+   * emitted (none of them if the export was canceled).
+   *
+   * @note  #getWrittenFiles() must not be called until the export is
+   *        finished.
+   *
+   * @param settings  The fabrication output settings to use.
+   * @param zip       See #exportPcbLayers().
+   */
+  void startPcbLayersExport(const BoardFabricationOutputSettings& settings,
+                            bool zip = false) noexcept;
+
+  /**
+   * @brief Wait (block) until the asynchronous export is finished
+   *
+   * @return Error message, if an error occurred (null on success).
+   */
+  QString waitForFinished() noexcept;
+
+  /**
+   * @brief Cancel the asynchronous export
+   *
+   * The export is stopped after the file currently being written, files
+   * written so far are kept (except an incomplete ZIP file). Blocks until
+   * the worker thread has stopped.
+   */
+  void cancel() noexcept;
+
   // Inherited from AttributeProvider
   /// @copydoc ::librepcb::AttributeProvider::getBuiltInAttributeValue()
   QString getBuiltInAttributeValue(const QString& key) const noexcept override;
@@ -88,52 +205,53 @@ public:
   BoardGerberExport& operator=(const BoardGerberExport& rhs) = delete;
 
 signals:
-  void attributesChanged() override;
+  void attributesChanged(const QSet<QString>& keys) override;
+  void progress(int percent, int completed, int total);
+  void succeeded();
+  void failed(const QString& error);
 
 private:
   // Private Methods
-  void exportDrills(const BoardFabricationOutputSettings& settings) const;
-  void exportDrillsNpth(const BoardFabricationOutputSettings& settings) const;
-  void exportDrillsPth(const BoardFabricationOutputSettings& settings) const;
-  void exportLayerBoardOutlines(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerTopCopper(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerInnerCopper(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerBottomCopper(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerTopSolderMask(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerBottomSolderMask(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerTopSilkscreen(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerBottomSilkscreen(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerTopSolderPaste(
-      const BoardFabricationOutputSettings& settings) const;
-  void exportLayerBottomSolderPaste(
-      const BoardFabricationOutputSettings& settings) const;
+  QVector<Job> prepareJobs(const BoardFabricationOutputSettings& settings) const
+      noexcept;
+  QString run(QVector<Job> jobs, FilePath zipFp, FilePath zipRootDir) noexcept;
+  void openZipFile(const FilePath& fp, const FilePath& rootDir) const;
+  void closeZipFile() const;
+  void saveFile(const FilePath& fp, const QByteArray& content) const;
+  void exportDrills(const FilePath& fp, bool useG85Slots) const;
+  void exportDrillsNpth(const FilePath& fp, bool useG85Slots) const;
+  void exportDrillsPth(const FilePath& fp, bool useG85Slots) const;
+  void exportLayerBoardOutlines(const FilePath& fp) const;
+  void exportLayerTopCopper(const FilePath& fp) const;
+  void exportLayerInnerCopper(const FilePath& fp, int index) const;
+  void exportLayerBottomCopper(const FilePath& fp) const;
+  void exportLayerTopSolderMask(const FilePath& fp) const;
+  void exportLayerBottomSolderMask(const FilePath& fp) const;
+  void exportLayerTopSilkscreen(const FilePath& fp,
+                                const QStringList& layers) const;
+  void exportLayerBottomSilkscreen(const FilePath& fp,
+                                   const QStringList& layers) const;
+  void exportLayerTopSolderPaste(const FilePath& fp) const;
+  void exportLayerBottomSolderPaste(const FilePath& fp) const;
 
   int drawNpthDrills(ExcellonGenerator& gen) const;
   int drawPthDrills(ExcellonGenerator& gen) const;
   void drawLayer(GerberGenerator& gen, const QString& layerName) const;
-  void drawVia(GerberGenerator& gen, const BI_Via& via,
-               const QString& layerName, const QString& netName) const;
-  void drawDevice(GerberGenerator& gen, const BI_Device& device,
-                  const QString& layerName) const;
-  void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad,
-                        const QString& layerName) const;
+  void drawVia(GerberGenerator& gen, const Via& via,
+               const GraphicsLayerId& layer, const QString& netName) const;
+  void drawFootprint(GerberGenerator& gen, const Footprint& footprint,
+                     const GraphicsLayerId& layer) const;
+  void drawFootprintPad(GerberGenerator& gen, const Pad& pad,
+                        const QString& component,
+                        const GraphicsLayerId& layer) const;
 
   std::unique_ptr<ExcellonGenerator> createExcellonGenerator(
-      const BoardFabricationOutputSettings& settings,
-      ExcellonGenerator::Plating plating) const;
+      bool useG85Slots, ExcellonGenerator::Plating plating) const;
   FilePath getOutputFilePath(QString path) const noexcept;
 
   // Static Methods
   static UnsignedLength calcWidthOfLayer(const UnsignedLength& width,
-                                         const QString& name) noexcept;
+                                         const GraphicsLayerId& layer) noexcept;
 
   // Private Member Variables
   const Project& mProject;
@@ -142,6 +260,23 @@ private:
   QString mProjectName;
   mutable int mCurrentInnerCopperLayer;
   mutable QVector<FilePath> mWrittenFiles;
+  QFuture<QString> mFuture;
+  QAtomicInt mAbort;  ///< Set by cancel(), read by the worker thread
+  mutable std::unique_ptr<ZipWriter> mZipWriter;  ///< Only set during export
+  mutable FilePath mZipFilePath;
+  mutable FilePath mZipRootDir;
+
+  // Snapshot of the board content, accessed from the worker thread
+  Uuid mBoardUuid;
+  QString mProjectVersion;
+  int mInnerLayerCount;
+  BoardDesignRules mDesignRules;
+  QList<Footprint> mFootprints;
+  QList<NetSegment> mNetSegments;
+  QList<Plane> mPlanes;
+  QList<Polygon> mPolygons;
+  QList<TextPaths> mStrokeTexts;
+  QList<Hole> mHoles;
 };
 
 /*******************************************************************************
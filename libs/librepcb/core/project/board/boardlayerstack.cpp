@@ -49,6 +49,7 @@ BoardLayerStack::BoardLayerStack(Board& board)
 }
 
 BoardLayerStack::~BoardLayerStack() noexcept {
+  mLayersById.clear();
   qDeleteAll(mLayers);
   mLayers.clear();
 }
@@ -89,7 +90,7 @@ BoardLayerStack& BoardLayerStack::operator=(
 
 void BoardLayerStack::layerAttributesChanged() noexcept {
   if (!mLayersChanged) {
-    emit mBoard.attributesChanged();
+    emit mBoard.attributesChanged(QSet<QString>());
     mLayersChanged = true;
   }
 }
@@ -163,6 +164,11 @@ void BoardLayerStack::addLayer(GraphicsLayer* layer) noexcept {
   connect(layer, &GraphicsLayer::attributesChanged, this,
           &BoardLayerStack::layerAttributesChanged, Qt::QueuedConnection);
   mLayers.append(layer);
+  const int index = layer->getId().toInt();
+  if (index >= mLayersById.count()) {
+    mLayersById.resize(index + 1);
+  }
+  mLayersById[index] = layer;
 }
 
 /*******************************************************************************
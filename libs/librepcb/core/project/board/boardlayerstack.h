@@ -63,12 +63,19 @@ public:
 
   /// @copydoc ::librepcb::IF_GraphicsLayerProvider::getLayer()
   GraphicsLayer* getLayer(const QString& name) const noexcept override {
-    foreach (GraphicsLayer* layer, mLayers) {
-      if (layer->getName() == name) {
-        return layer;
-      }
-    }
-    return nullptr;
+    const tl::optional<GraphicsLayerId> id = GraphicsLayerId::tryGet(name);
+    return id ? getLayer(*id) : nullptr;
+  }
+
+  /**
+   * @brief Get a layer by its ID (constant time)
+   *
+   * @param id    The ID of the layer
+   *
+   * @return The layer, or nullptr if the board has no such layer
+   */
+  GraphicsLayer* getLayer(const GraphicsLayerId& id) const noexcept {
+    return mLayersById.value(id.toInt(), nullptr);
   }
 
   // Setters
@@ -89,6 +96,7 @@ private:
   // General
   Board& mBoard;  ///< A reference to the Board object (from the ctor)
   QList<GraphicsLayer*> mLayers;
+  QVector<GraphicsLayer*> mLayersById;  ///< Index is GraphicsLayerId::toInt()
   bool mLayersChanged;
 
   // Settings
@@ -25,11 +25,13 @@
 #include "../../application.h"
 #include "../../attribute/attributesubstitutor.h"
 #include "../../export/graphicsexportsettings.h"
+#include "../../export/svgwriter.h"
 #include "../../font/strokefontpool.h"
 #include "../../geometry/text.h"
 #include "../../graphics/graphicslayer.h"
 #include "../../graphics/graphicspainter.h"
 #include "../../library/pkg/footprint.h"
+#include "../../library/pkg/package.h"
 #include "../project.h"
 #include "board.h"
 #include "items/bi_device.h"
@@ -45,6 +47,8 @@
 #include <QtCore>
 #include <QtGui>
 
+#include <algorithm>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -60,6 +64,8 @@ BoardPainter::BoardPainter(const Board& board)
 {
   foreach (const BI_Device* device, board.getDeviceInstances()) {
     Footprint fpt;
+    fpt.libraryKey = device->getLibPackage().getUuid().toStr() % "-" %
+        device->getLibFootprint().getUuid().toStr();
     fpt.transform = Transform(*device);
     foreach (const BI_FootprintPad* pad, device->getPads()) {
       fpt.pads.append(pad->getLibPad());
@@ -81,7 +87,8 @@ BoardPainter::BoardPainter(const Board& board)
     mFootprints.append(fpt);
   }
   foreach (const BI_Plane* plane, board.getPlanes()) {
-    mPlanes.append(Plane{*plane->getLayerName(), plane->getFragments()});
+    mPlanes.append(
+        Plane{GraphicsLayerId(plane->getLayerName()), plane->getFragments()});
   }
   foreach (const BI_Polygon* polygon, board.getPolygons()) {
     mPolygons.append(polygon->getPolygon());
@@ -100,7 +107,7 @@ BoardPainter::BoardPainter(const Board& board)
     }
     for (const BI_NetLine* netline : segment->getNetLines()) {
       mTraces.append(Trace{
-          netline->getLayer().getName(), netline->getStartPoint().getPosition(),
+          netline->getLayer().getId(), netline->getStartPoint().getPosition(),
           netline->getEndPoint().getPosition(), netline->getWidth()});
     }
   }
@@ -128,7 +135,11 @@ void BoardPainter::paint(QPainter& painter,
   GraphicsPainter p(painter);
   p.setMinLineWidth(settings.getMinLineWidth());
   foreach (const QString& layer, settings.getLayerPaintOrder()) {
-    LayerContent content = mContentByLayer.value(layer);
+    const tl::optional<GraphicsLayerId> id = GraphicsLayerId::tryGet(layer);
+    if ((!id) || (id->toInt() >= mContentByLayer.count())) {
+      continue;  // Nothing to paint on this layer.
+    }
+    const LayerContent& content = mContentByLayer.at(id->toInt());
 
     // Draw areas.
     foreach (const QPainterPath& area, content.areas) {
@@ -182,6 +193,104 @@ void BoardPainter::paint(QPainter& painter,
   }
 }
 
+void BoardPainter::paintSvg(SvgWriter& writer,
+                            const GraphicsExportSettings& settings) const
+    noexcept {
+  // Determine what to paint on which layer.
+  initContentByLayer();
+
+  // Draw pad circles only if holes are enabled, but pads not.
+  const bool drawPadHoles =
+      settings.getLayerPaintOrder().contains(GraphicsLayer::sBoardDrillsNpth) &&
+      (!settings.getLayerPaintOrder().contains(GraphicsLayer::sBoardPadsTht));
+
+  // The content of footprints is written only once per library footprint,
+  // mirror state and layer, and then referenced by all devices using it.
+  // Empty IDs mark footprints without content on the corresponding layer.
+  QHash<QString, QString> definitionIds;
+
+  // Draw each layer in reverse order for correct stackup.
+  writer.setMinLineWidth(settings.getMinLineWidth());
+  foreach (const QString& layer, settings.getLayerPaintOrder()) {
+    const tl::optional<GraphicsLayerId> id = GraphicsLayerId::tryGet(layer);
+    if ((!id) || (id->toInt() >= mContentByLayer.count())) {
+      continue;  // Nothing to paint on this layer.
+    }
+    const LayerContent& content = mContentByLayer.at(id->toInt());
+    const QColor color = settings.getColor(layer);
+
+    // Draw footprints.
+    foreach (const Footprint& footprint, mFootprints) {
+      const QString key = footprint.libraryKey %
+          (footprint.transform.getMirrored() ? "-mirrored-" : "-") % layer;
+      auto it = definitionIds.find(key);
+      if (it == definitionIds.end()) {
+        QString definitionId;
+        if (hasFootprintContent(footprint, *id, drawPadHoles)) {
+          definitionId = "footprint" % QString::number(definitionIds.count());
+          writer.beginDefinition(definitionId);
+          paintFootprintSvg(writer, footprint, *id, drawPadHoles, settings);
+          writer.endDefinition();
+        }
+        it = definitionIds.insert(key, definitionId);
+      }
+      if (!it->isEmpty()) {
+        writer.drawDefinition(*it, toQTransformPx(footprint.transform));
+      }
+    }
+
+    // Draw planes.
+    foreach (const Plane& plane, mPlanes) {
+      if (plane.layer == *id) {
+        foreach (const Path& path, plane.fragments) {
+          writer.drawPath(path, Length(0), QColor(), color);
+        }
+      }
+    }
+
+    // Draw vias.
+    if (*id == GraphicsLayerId(GraphicsLayer::sBoardViasTht)) {
+      foreach (const Via& via, mVias) {
+        // Avoid creating inverted graphics if drill>size, like in the editor.
+        const PositiveLength drill =
+            std::min(via.getDrillDiameter(), via.getSize());
+        writer.drawArea({via.getSceneOutline(),
+                         Path::circle(drill).translated(via.getPosition())},
+                        color);
+      }
+    }
+
+    // Draw traces.
+    foreach (const Trace& trace, content.traces) {
+      writer.drawLine(trace.startPosition, trace.endPosition, *trace.width,
+                      color);
+    }
+
+    // Draw polygons which are not part of footprints.
+    for (int i = content.footprintPolygonCount; i < content.polygons.count();
+         ++i) {
+      const Polygon& polygon = content.polygons.at(i);
+      writer.drawPath(polygon.getPath(), *polygon.getLineWidth(), color,
+                      settings.getFillColor(layer, polygon.isFilled(),
+                                            polygon.isGrabArea()));
+    }
+
+    // Draw holes which are not part of footprints.
+    for (int i = content.footprintHoleCount; i < content.holes.count(); ++i) {
+      const Hole& hole = content.holes.at(i);
+      writer.drawSlot(*hole.getPath(), hole.getDiameter(), Length(0), color,
+                      QColor());
+    }
+
+    // Draw invisible texts to make them selectable and searchable.
+    foreach (const Text& text, content.texts) {
+      writer.drawInvisibleText(text.getPosition(), text.getRotation(),
+                               *text.getHeight(), text.getAlign(),
+                               text.getText(), settings.getMirror());
+    }
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -189,78 +298,88 @@ void BoardPainter::paint(QPainter& painter,
 void BoardPainter::initContentByLayer() const noexcept {
   QMutexLocker lock(&mMutex);
   if (mContentByLayer.isEmpty()) {
+    const GraphicsLayerId drillsNpth(GraphicsLayer::sBoardDrillsNpth);
+    const GraphicsLayerId viasTht(GraphicsLayer::sBoardViasTht);
+    mContentByLayer.resize(GraphicsLayerId::getCount());
+
     // Footprints.
     foreach (const Footprint& footprint, mFootprints) {
       // Footprint polygons.
       foreach (Polygon polygon, footprint.polygons) {
         polygon.setLayerName(footprint.transform.map(polygon.getLayerName()));
         polygon.setPath(footprint.transform.map(polygon.getPath()));
-        mContentByLayer[*polygon.getLayerName()].polygons.append(polygon);
+        getContent(polygon.getLayerId()).polygons.append(polygon);
       }
 
       // Footprint circles.
       foreach (Circle circle, footprint.circles) {
         circle.setLayerName(footprint.transform.map(circle.getLayerName()));
         circle.setCenter(footprint.transform.map(circle.getCenter()));
-        mContentByLayer[*circle.getLayerName()].circles.append(circle);
+        getContent(circle.getLayerId()).circles.append(circle);
       }
 
       // Footprint holes.
       foreach (Hole hole, footprint.holes) {
         hole.setPath(NonEmptyPath(footprint.transform.map(hole.getPath())));
-        mContentByLayer[GraphicsLayer::sBoardDrillsNpth].holes.append(hole);
+        getContent(drillsNpth).holes.append(hole);
       }
 
       // Footprint pads.
-      foreach (FootprintPad pad, footprint.pads) {
+      foreach (const FootprintPad& pad, footprint.pads) {
         const Transform transform(pad.getPosition(), pad.getRotation());
         const QPainterPath path =
             footprint.transform.mapPx(transform.mapPx(pad.toQPainterPathPx()));
-        const QString layer = footprint.transform.map(pad.getLayerName());
-        mContentByLayer[layer].areas.append(path);
+        const GraphicsLayerId layer = footprint.transform.map(pad.getLayerId());
+        getContent(layer).areas.append(path);
 
         // Also add the holes for THT pads.
         for (const Hole& hole : pad.getHoles()) {
-          mContentByLayer[GraphicsLayer::sBoardDrillsNpth].padHoles.append(
+          getContent(drillsNpth).padHoles.append(
               Hole(hole.getUuid(), hole.getDiameter(),
                    footprint.transform.map(transform.map(hole.getPath()))));
         }
       }
     }
 
+    // Remember which content belongs to footprints, see #paintSvg().
+    for (LayerContent& content : mContentByLayer) {
+      content.footprintPolygonCount = content.polygons.count();
+      content.footprintHoleCount = content.holes.count();
+    }
+
     // Planes.
     foreach (const Plane& plane, mPlanes) {
       foreach (const Path& path, plane.fragments) {
-        mContentByLayer[plane.layerName].areas.append(path.toQPainterPathPx());
+        getContent(plane.layer).areas.append(path.toQPainterPathPx());
       }
     }
 
     // Vias.
     foreach (const Via& via, mVias) {
-      mContentByLayer[GraphicsLayer::sBoardViasTht].areas.append(
+      getContent(viasTht).areas.append(
           via.toQPainterPathPx().translated(via.getPosition().toPxQPointF()));
     }
 
     // Traces.
     foreach (const Trace& trace, mTraces) {
-      mContentByLayer[trace.layerName].traces.append(trace);
+      getContent(trace.layer).traces.append(trace);
     }
 
     // Polygons.
     foreach (const Polygon& polygon, mPolygons) {
-      mContentByLayer[*polygon.getLayerName()].polygons.append(polygon);
+      getContent(polygon.getLayerId()).polygons.append(polygon);
     }
 
     // Holes.
     foreach (const Hole& hole, mHoles) {
-      mContentByLayer[GraphicsLayer::sBoardDrillsNpth].holes.append(hole);
+      getContent(drillsNpth).holes.append(hole);
     }
 
     // Texts.
     foreach (StrokeText text, mStrokeTexts) {
       Transform transform(text);
       foreach (Path path, transform.map(text.generatePaths(mStrokeFont))) {
-        mContentByLayer[*text.getLayerName()].polygons.append(
+        getContent(text.getLayerId()).polygons.append(
             Polygon(text.getUuid(), text.getLayerName(), text.getStrokeWidth(),
                     false, false, path));
       }
@@ -278,12 +397,133 @@ void BoardPainter::initContentByLayer() const noexcept {
         baselineOffset.setY(baseline);
       }
       baselineOffset.rotate(rotation);
-      mContentByLayer[*text.getLayerName()].texts.append(
+      getContent(text.getLayerId()).texts.append(
           Text(text.getUuid(), text.getLayerName(), text.getText(),
                text.getPosition() + baselineOffset, rotation,
                PositiveLength(totalHeight), align));
     }
+
+    // Fill the painter path caches now since #paint() and #paintSvg() may be
+    // called from several threads at the same time and must not modify them
+    // anymore. The caches of the footprint pads are already filled above.
+    for (const LayerContent& content : mContentByLayer) {
+      for (const Polygon& polygon : content.polygons) {
+        polygon.getPath().toQPainterPathPx();
+      }
+    }
+  }
+}
+
+BoardPainter::LayerContent& BoardPainter::getContent(
+    const GraphicsLayerId& layer) const noexcept {
+  if (layer.toInt() >= mContentByLayer.count()) {
+    mContentByLayer.resize(layer.toInt() + 1);
+  }
+  return mContentByLayer[layer.toInt()];
+}
+
+bool BoardPainter::hasFootprintContent(const Footprint& footprint,
+                                       const GraphicsLayerId& layer,
+                                       bool drawPadHoles) const noexcept {
+  const Transform& transform = footprint.transform;
+  if (layer == GraphicsLayerId(GraphicsLayer::sBoardDrillsNpth)) {
+    if (!footprint.holes.isEmpty()) {
+      return true;
+    }
+    foreach (const FootprintPad& pad, footprint.pads) {
+      if (drawPadHoles && (!pad.getHoles().isEmpty())) {
+        return true;
+      }
+    }
+  }
+  foreach (const FootprintPad& pad, footprint.pads) {
+    if (transform.map(pad.getLayerId()) == layer) {
+      return true;
+    }
+  }
+  foreach (const Polygon& polygon, footprint.polygons) {
+    if (transform.map(polygon.getLayerId()) == layer) {
+      return true;
+    }
+  }
+  foreach (const Circle& circle, footprint.circles) {
+    if (transform.map(circle.getLayerId()) == layer) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void BoardPainter::paintFootprintSvg(
+    SvgWriter& writer, const Footprint& footprint, const GraphicsLayerId& layer,
+    bool drawPadHoles, const GraphicsExportSettings& settings) const noexcept {
+  // Note: The content is drawn in footprint coordinates, the transformation
+  // is applied when referencing the definition.
+  const Transform& transform = footprint.transform;
+  const QString layerName = layer.getName();
+  const QColor color = settings.getColor(layerName);
+
+  // Pads.
+  foreach (const FootprintPad& pad, footprint.pads) {
+    if (transform.map(pad.getLayerId()) == layer) {
+      const Transform padTransform(pad.getPosition(), pad.getRotation());
+      QVector<Path> paths{padTransform.map(pad.getOutline())};
+      for (const Hole& hole : pad.getHoles()) {
+        paths += padTransform.map(
+            hole.getPath()->toOutlineStrokes(hole.getDiameter()));
+      }
+      writer.drawArea(paths, color);
+    }
+  }
+
+  // Polygons.
+  foreach (const Polygon& polygon, footprint.polygons) {
+    if (transform.map(polygon.getLayerId()) == layer) {
+      writer.drawPath(polygon.getPath(), *polygon.getLineWidth(), color,
+                      settings.getFillColor(layerName, polygon.isFilled(),
+                                            polygon.isGrabArea()));
+    }
+  }
+
+  // Circles.
+  foreach (const Circle& circle, footprint.circles) {
+    if (transform.map(circle.getLayerId()) == layer) {
+      writer.drawCircle(
+          circle.getCenter(), *circle.getDiameter(), *circle.getLineWidth(),
+          color,
+          settings.getFillColor(layerName, circle.isFilled(),
+                                circle.isGrabArea()));
+    }
+  }
+
+  // Holes.
+  if (layer == GraphicsLayerId(GraphicsLayer::sBoardDrillsNpth)) {
+    foreach (const Hole& hole, footprint.holes) {
+      writer.drawSlot(*hole.getPath(), hole.getDiameter(), Length(0), color,
+                      QColor());
+    }
+    if (drawPadHoles) {
+      foreach (const FootprintPad& pad, footprint.pads) {
+        const Transform padTransform(pad.getPosition(), pad.getRotation());
+        for (const Hole& hole : pad.getHoles()) {
+          writer.drawSlot(*padTransform.map(hole.getPath()),
+                          hole.getDiameter(), Length(0), color, QColor());
+        }
+      }
+    }
+  }
+}
+
+QTransform BoardPainter::toQTransformPx(const Transform& transform) noexcept {
+  // Same as Transform::mapPx().
+  QTransform t;
+  t.translate(transform.getPosition().toPxQPointF().x(),
+              transform.getPosition().toPxQPointF().y());
+  if (transform.getMirrored()) {
+    t.scale(-1, 1);
   }
+  t.rotate(-transform.getRotation().toDeg());
+  return t;
 }
 
 /*******************************************************************************
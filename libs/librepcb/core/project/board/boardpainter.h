@@ -24,7 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../../export/graphicsexport.h"
-#include "../../graphics/graphicslayername.h"
+#include "../../graphics/graphicslayerid.h"
 #include "../../types/length.h"
 #include "../../utils/transform.h"
 
@@ -44,6 +44,7 @@ class Path;
 class Polygon;
 class StrokeFont;
 class StrokeText;
+class SvgWriter;
 class Text;
 class Via;
 
@@ -58,13 +59,14 @@ class Via;
  */
 class BoardPainter final : public GraphicsPagePainter {
   struct Trace {
-    QString layerName;
+    GraphicsLayerId layer;
     Point startPosition;
     Point endPosition;
     PositiveLength width;
   };
 
   struct Footprint {
+    QString libraryKey;  ///< Same for all devices with identical content
     Transform transform;
     QList<FootprintPad> pads;
     QList<Polygon> polygons;
@@ -73,7 +75,7 @@ class BoardPainter final : public GraphicsPagePainter {
   };
 
   struct Plane {
-    QString layerName;
+    GraphicsLayerId layer;
     QVector<Path> fragments;
   };
 
@@ -85,6 +87,8 @@ class BoardPainter final : public GraphicsPagePainter {
     QList<Hole> holes;
     QList<Hole> padHoles;
     QList<Text> texts;
+    int footprintPolygonCount = 0;  ///< Leading polygons from footprints
+    int footprintHoleCount = 0;  ///< Leading holes from footprints
   };
 
 public:
@@ -97,12 +101,24 @@ public:
   // General Methods
   void paint(QPainter& painter, const GraphicsExportSettings& settings) const
       noexcept override;
+  bool canPaintSvg() const noexcept override { return true; }
+  void paintSvg(SvgWriter& writer, const GraphicsExportSettings& settings) const
+      noexcept override;
 
   // Operator Overloadings
   BoardPainter& operator=(const BoardPainter& rhs) = delete;
 
 private:  // Methods
   void initContentByLayer() const noexcept;
+  LayerContent& getContent(const GraphicsLayerId& layer) const noexcept;
+  bool hasFootprintContent(const Footprint& footprint,
+                           const GraphicsLayerId& layer,
+                           bool drawPadHoles) const noexcept;
+  void paintFootprintSvg(SvgWriter& writer, const Footprint& footprint,
+                         const GraphicsLayerId& layer, bool drawPadHoles,
+                         const GraphicsExportSettings& settings) const
+      noexcept;
+  static QTransform toQTransformPx(const Transform& transform) noexcept;
 
 private:  // Data
   const StrokeFont& mStrokeFont;
@@ -116,7 +132,7 @@ private:  // Data
   QList<Hole> mHoles;
 
   mutable QMutex mMutex;
-  mutable QHash<QString, LayerContent> mContentByLayer;
+  mutable QVector<LayerContent> mContentByLayer;  ///< Index: GraphicsLayerId
 };
 
 /*******************************************************************************
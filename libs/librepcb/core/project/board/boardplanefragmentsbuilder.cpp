@@ -130,6 +130,7 @@ void BoardPlaneFragmentsBuilder::clipToBoardOutline() {
 void BoardPlaneFragmentsBuilder::subtractOtherObjects() {
   ClipperLib::Clipper c;
   c.AddPaths(mResult, ClipperLib::ptSubject, true);
+  const GraphicsLayerId layer(mPlane.getLayerName());
 
   // subtract other planes
   foreach (const BI_Plane* plane, mPlane.getBoard().getPlanes()) {
@@ -158,7 +159,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects() {
       }
     }
     foreach (const BI_FootprintPad* pad, device->getPads()) {
-      if (!pad->isOnLayer(*mPlane.getLayerName())) continue;
+      if (!pad->isOnLayer(layer)) continue;
       if (pad->getCompSigInstNetSignal() == &mPlane.getNetSignal()) {
         ClipperLib::Path path =
             ClipperHelpers::convert(pad->getSceneOutline(), maxArcTolerance());
@@ -195,7 +196,7 @@ void BoardPlaneFragmentsBuilder::subtractOtherObjects() {
 
     // subtract netlines
     foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      if (netline->getLayer().getName() != mPlane.getLayerName()) continue;
+      if (netline->getLayer().getId() != layer) continue;
       if (netsegment->getNetSignal() == &mPlane.getNetSignal()) {
         ClipperLib::Path path = ClipperHelpers::convert(
             netline->getSceneOutline(), maxArcTolerance());
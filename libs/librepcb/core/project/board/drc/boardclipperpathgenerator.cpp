@@ -122,9 +122,12 @@ void BoardClipperPathGenerator::addHoles(const Length& offset) {
 
 void BoardClipperPathGenerator::addCopper(
     const QString& layerName, const QSet<const NetSignal*>& netsignals) {
+  // Look up the layer ID once to get cheap layer comparisons below.
+  const GraphicsLayerId layer(layerName);
+
   // polygons
   foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
-    if (polygon->getPolygon().getLayerName() != layerName) {
+    if (polygon->getPolygon().getLayerId() != layer) {
       continue;
     }
     if ((!netsignals.isEmpty()) && (!netsignals.contains(nullptr))) {
@@ -152,7 +155,7 @@ void BoardClipperPathGenerator::addCopper(
 
   // stroke texts
   foreach (const BI_StrokeText* text, mBoard.getStrokeTexts()) {
-    if (text->getText().getLayerName() != layerName) {
+    if (text->getText().getLayerId() != layer) {
       continue;
     }
     if ((!netsignals.isEmpty()) && (!netsignals.contains(nullptr))) {
@@ -187,11 +190,11 @@ void BoardClipperPathGenerator::addCopper(
   // devices
   foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
     Transform transform(*device);
+    const GraphicsLayerId libLayer = transform.map(layer);
 
     // polygons
     for (const Polygon& polygon : device->getLibFootprint().getPolygons()) {
-      GraphicsLayerName polygonLayer = transform.map(polygon.getLayerName());
-      if (polygonLayer != layerName) {
+      if (polygon.getLayerId() != libLayer) {
         continue;
       }
       if ((!netsignals.isEmpty()) && (!netsignals.contains(nullptr))) {
@@ -217,8 +220,7 @@ void BoardClipperPathGenerator::addCopper(
 
     // circles
     for (const Circle& circle : device->getLibFootprint().getCircles()) {
-      GraphicsLayerName circleLayer = transform.map(circle.getLayerName());
-      if (circleLayer != layerName) {
+      if (circle.getLayerId() != libLayer) {
         continue;
       }
       if ((!netsignals.isEmpty()) && (!netsignals.contains(nullptr))) {
@@ -245,7 +247,7 @@ void BoardClipperPathGenerator::addCopper(
     // stroke texts
     foreach (const BI_StrokeText* text, device->getStrokeTexts()) {
       // Do *not* mirror layer since it is independent of the device!
-      if (*text->getText().getLayerName() != layerName) {
+      if (text->getText().getLayerId() != layer) {
         continue;
       }
       if ((!netsignals.isEmpty()) && (!netsignals.contains(nullptr))) {
@@ -263,7 +265,7 @@ void BoardClipperPathGenerator::addCopper(
 
     // pads
     foreach (const BI_FootprintPad* pad, device->getPads()) {
-      if (!pad->isOnLayer(layerName)) {
+      if (!pad->isOnLayer(layer)) {
         continue;
       }
       if ((!netsignals.isEmpty()) &&
@@ -287,7 +289,7 @@ void BoardClipperPathGenerator::addCopper(
 
     // vias
     foreach (const BI_Via* via, netsegment->getVias()) {
-      if (!via->isOnLayer(layerName)) {
+      if (!via->isOnLayer(layer)) {
         continue;
       }
       ClipperHelpers::unite(
@@ -298,7 +300,7 @@ void BoardClipperPathGenerator::addCopper(
 
     // netlines
     foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      if (&netline->getLayer().getName() != layerName) {
+      if (netline->getLayer().getId() != layer) {
         continue;
       }
       ClipperHelpers::unite(mPaths,
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "boarddesignrulecheck.h"
 
+#include "../../../algorithm/clearancekernel.h"
 #include "../../../geometry/hole.h"
 #include "../../../geometry/stroketext.h"
 #include "../../../library/pkg/footprint.h"
@@ -42,6 +43,7 @@
 #include "../items/bi_netline.h"
 #include "../items/bi_netsegment.h"
 #include "../items/bi_plane.h"
+#include "../items/bi_polygon.h"
 #include "../items/bi_stroketext.h"
 #include "../items/bi_via.h"
 #include "boardclipperpathgenerator.h"
@@ -223,34 +225,58 @@ void BoardDesignRuleCheck::checkCopperCopperClearances(int progressStart,
       mBoard.getProject().getCircuit().getNetSignals().values();
   netsignals.append(nullptr);  // also check unconnected copper objects
 
+  auto emitClearanceMessage = [&](const GraphicsLayer& layer, int i, int k,
+                                  const Path& location) {
+    QString name1 = netsignals[i] ? *netsignals[i]->getName() : "";
+    QString name2 = netsignals[k] ? *netsignals[k]->getName() : "";
+    QString msg = tr("Clearance (%1): '%2' <-> '%3'",
+                     "Placeholders are layer name + net names")
+                      .arg(layer.getNameTr(), name1, name2);
+    emitMessage(BoardDesignRuleCheckMessage(msg, location));
+  };
+
   auto layers = mBoard.getLayerStack().getAllLayers();
   for (int layerIndex = 0; layerIndex < layers.count(); ++layerIndex) {
     const GraphicsLayer* layer = layers[layerIndex];
     if ((!layer->isCopperLayer()) || (!layer->isEnabled())) {
       continue;
     }
+
+    // Traces, vias and pads are checked analytically, which is exact and
+    // much faster than polygon clipping. Only net signals which contain other
+    // shapes (e.g. planes) need to be checked with polygon clipping.
+    ClearanceKernel kernel;
+    QVector<Path> outlines;
+    const QSet<int> fallbackGroups =
+        buildClearanceKernel(*layer, netsignals, kernel, outlines);
+
+    // Like polygon clipping, tolerate the maximum arc approximation error to
+    // avoid false positives. Both checks must use the same clearance to get
+    // consistent results for all kinds of objects.
+    const UnsignedLength clearance(qMax(
+        *mOptions.minCopperCopperClearance - *maxArcTolerance(), Length(0)));
+
+    // Fallback for arbitrary shapes: Offset the copper of both net signals by
+    // half the clearance and check for intersections.
+    QHash<int, ClipperLib::Paths> offsetPaths;
+    auto getOffsetPaths = [&](int i) -> const ClipperLib::Paths& {
+      if (!offsetPaths.contains(i)) {
+        ClipperLib::Paths paths = getCopperPaths(*layer, {netsignals[i]});
+        ClipperHelpers::offset(paths, *clearance / 2, maxArcTolerance());
+        offsetPaths.insert(i, paths);
+      }
+      return offsetPaths[i];
+    };
     for (int i = 0; i < netsignals.count(); ++i) {
-      ClipperLib::Paths paths1 = getCopperPaths(*layer, {netsignals[i]});
-      ClipperHelpers::offset(
-          paths1, (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
-          maxArcTolerance());
       for (int k = i + 1; k < netsignals.count(); ++k) {
-        ClipperLib::Paths paths2 = getCopperPaths(*layer, {netsignals[k]});
-        ClipperHelpers::offset(
-            paths2,
-            (*mOptions.minCopperCopperClearance - *maxArcTolerance()) / 2,
-            maxArcTolerance());
+        if ((!fallbackGroups.contains(i)) && (!fallbackGroups.contains(k))) {
+          continue;
+        }
         std::unique_ptr<ClipperLib::PolyTree> intersections =
-            ClipperHelpers::intersect(paths1, paths2);
+            ClipperHelpers::intersect(getOffsetPaths(i), getOffsetPaths(k));
         for (const ClipperLib::Path& path :
              ClipperHelpers::flattenTree(*intersections)) {
-          QString name1 = netsignals[i] ? *netsignals[i]->getName() : "";
-          QString name2 = netsignals[k] ? *netsignals[k]->getName() : "";
-          QString msg = tr("Clearance (%1): '%2' <-> '%3'",
-                           "Placeholders are layer name + net names")
-                            .arg(layer->getNameTr(), name1, name2);
-          Path location = ClipperHelpers::convert(path);
-          emitMessage(BoardDesignRuleCheckMessage(msg, location));
+          emitClearanceMessage(*layer, i, k, ClipperHelpers::convert(path));
         }
       }
       qreal progress = progressSpan *
@@ -258,6 +284,56 @@ void BoardDesignRuleCheck::checkCopperCopperClearances(int progressStart,
           qreal(layers.count() * netsignals.count());
       emit progressPercent(progressStart + static_cast<int>(progress));
     }
+
+    // Analytic check. Violating objects are grouped by net signal pairs and
+    // their intersection area is used as message location.
+    QMap<QPair<int, int>, QPair<QSet<int>, QSet<int>>> violations;
+    for (const ClearanceKernel::Violation& violation :
+         kernel.findViolations(clearance)) {
+      int object1 = violation.object1;
+      int object2 = violation.object2;
+      if (kernel.getGroup(object1) > kernel.getGroup(object2)) {
+        std::swap(object1, object2);
+      }
+      const int i = kernel.getGroup(object1);
+      const int k = kernel.getGroup(object2);
+      if (fallbackGroups.contains(i) || fallbackGroups.contains(k)) {
+        continue;  // Already checked above.
+      }
+      auto& objects = violations[qMakePair(i, k)];
+      objects.first.insert(object1);
+      objects.second.insert(object2);
+    }
+    for (auto it = violations.begin(); it != violations.end(); ++it) {
+      ClipperLib::Paths paths1, paths2;
+      foreach (int object, it.value().first) {
+        ClipperHelpers::unite(paths1, ClipperHelpers::convert(
+                                          outlines[object], maxArcTolerance()));
+      }
+      foreach (int object, it.value().second) {
+        ClipperHelpers::unite(paths2, ClipperHelpers::convert(
+                                          outlines[object], maxArcTolerance()));
+      }
+      ClipperLib::Paths location = paths1;
+      ClipperHelpers::unite(location, paths2);
+      ClipperHelpers::offset(paths1, *clearance / 2, maxArcTolerance());
+      ClipperHelpers::offset(paths2, *clearance / 2, maxArcTolerance());
+      std::unique_ptr<ClipperLib::PolyTree> intersections =
+          ClipperHelpers::intersect(paths1, paths2);
+      const ClipperLib::Paths areas =
+          ClipperHelpers::flattenTree(*intersections);
+      if (areas.empty()) {
+        // Might happen due to arc approximation if the distance is just below
+        // the clearance, then mark the objects instead.
+        foreach (const Path& path, ClipperHelpers::convert(location)) {
+          emitClearanceMessage(*layer, it.key().first, it.key().second, path);
+        }
+      }
+      for (const ClipperLib::Path& path : areas) {
+        emitClearanceMessage(*layer, it.key().first, it.key().second,
+                             ClipperHelpers::convert(path));
+      }
+    }
   }
 }
 
@@ -704,6 +780,115 @@ void BoardDesignRuleCheck::processHoleSlotWarning(const Hole& hole,
   }
 }
 
+QSet<int> BoardDesignRuleCheck::buildClearanceKernel(
+    const GraphicsLayer& layer, const QList<NetSignal*>& netsignals,
+    ClearanceKernel& kernel, QVector<Path>& outlines) const {
+  QHash<const NetSignal*, int> groups;
+  for (int i = 0; i < netsignals.count(); ++i) {
+    groups.insert(netsignals.at(i), i);
+  }
+  const int noNetGroup = groups.value(nullptr, -1);
+  const GraphicsLayerId& layerId = layer.getId();
+  QSet<int> fallbackGroups;
+
+  // Polygons, stroke texts and circles are not connected to any net signal.
+  foreach (const BI_Polygon* polygon, mBoard.getPolygons()) {
+    if (polygon->getPolygon().getLayerId() == layerId) {
+      fallbackGroups.insert(noNetGroup);
+    }
+  }
+  foreach (const BI_StrokeText* text, mBoard.getStrokeTexts()) {
+    if (text->getText().getLayerId() == layerId) {
+      fallbackGroups.insert(noNetGroup);
+    }
+  }
+  foreach (const BI_Plane* plane, mBoard.getPlanes()) {
+    if (plane->getLayerName() == layer.getName()) {
+      fallbackGroups.insert(groups.value(&plane->getNetSignal(), noNetGroup));
+    }
+  }
+
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    Transform transform(*device);
+    const GraphicsLayerId libLayer = transform.map(layerId);
+    for (const Polygon& polygon : device->getLibFootprint().getPolygons()) {
+      if (polygon.getLayerId() == libLayer) {
+        fallbackGroups.insert(noNetGroup);
+      }
+    }
+    for (const Circle& circle : device->getLibFootprint().getCircles()) {
+      if (circle.getLayerId() == libLayer) {
+        fallbackGroups.insert(noNetGroup);
+      }
+    }
+    foreach (const BI_StrokeText* text, device->getStrokeTexts()) {
+      if (text->getText().getLayerId() == layerId) {
+        fallbackGroups.insert(noNetGroup);
+      }
+    }
+
+    // Round pads are capsules, all other pad shapes are convex polygons.
+    foreach (const BI_FootprintPad* pad, device->getPads()) {
+      if (!pad->isOnLayer(layerId)) {
+        continue;
+      }
+      const int group =
+          groups.value(pad->getCompSigInstNetSignal(), noNetGroup);
+      const FootprintPad& libPad = pad->getLibPad();
+      Transform padTransform(*pad);
+      const Path outline = padTransform.map(pad->getOutline());
+      if (libPad.getShape() == FootprintPad::Shape::ROUND) {
+        const Length w = *libPad.getWidth();
+        const Length h = *libPad.getHeight();
+        const Point offset =
+            (w > h) ? Point((w - h) / 2, 0) : Point(0, (h - w) / 2);
+        kernel.addCapsule(group, padTransform.map(offset),
+                          padTransform.map(-offset),
+                          UnsignedLength(std::min(w, h)));
+        outlines.append(outline);
+      } else {
+        QVector<Point> vertices;
+        bool isCurved = false;
+        for (const Vertex& vertex : outline.getVertices()) {
+          vertices.append(vertex.getPos());
+          isCurved = isCurved || (vertex.getAngle() != 0);
+        }
+        if ((vertices.count() > 1) && (vertices.first() == vertices.last())) {
+          vertices.removeLast();
+        }
+        if (isCurved || vertices.isEmpty()) {
+          fallbackGroups.insert(group);
+        } else {
+          kernel.addConvexPolygon(group, vertices);
+          outlines.append(outline);
+        }
+      }
+    }
+  }
+
+  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
+    const int group = groups.value(netsegment->getNetSignal(), noNetGroup);
+    foreach (const BI_Via* via, netsegment->getVias()) {
+      if (via->isOnLayer(layerId)) {
+        kernel.addCircle(group, via->getPosition(),
+                         positiveToUnsigned(via->getVia().getSize()));
+        outlines.append(via->getVia().getSceneOutline());
+      }
+    }
+    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
+      if (netline->getLayer().getId() == layerId) {
+        kernel.addCapsule(group, netline->getStartPoint().getPosition(),
+                          netline->getEndPoint().getPosition(),
+                          positiveToUnsigned(netline->getWidth()));
+        outlines.append(netline->getSceneOutline());
+      }
+    }
+  }
+
+  Q_ASSERT(outlines.count() == kernel.getCount());
+  return fallbackGroups;
+}
+
 const ClipperLib::Paths& BoardDesignRuleCheck::getCopperPaths(
     const GraphicsLayer& layer, const QSet<const NetSignal*>& netsignals) {
   const auto key = qMakePair(&layer, netsignals);
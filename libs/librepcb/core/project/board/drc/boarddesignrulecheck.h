@@ -37,6 +37,7 @@ namespace librepcb {
 
 class BI_Device;
 class Board;
+class ClearanceKernel;
 class GraphicsLayer;
 class Hole;
 class NetSignal;
@@ -170,6 +171,10 @@ private:  // Methods
   void processHoleSlotWarning(const Hole& hole, SlotsWarningLevel level,
                               const Transform& transform1 = Transform(),
                               const Transform& transform2 = Transform());
+  QSet<int> buildClearanceKernel(const GraphicsLayer& layer,
+                                 const QList<NetSignal*>& netsignals,
+                                 ClearanceKernel& kernel,
+                                 QVector<Path>& outlines) const;
   const ClipperLib::Paths& getCopperPaths(
       const GraphicsLayer& layer, const QSet<const NetSignal*>& netsignals);
   ClipperLib::Paths getDeviceCourtyardPaths(const BI_Device& device,
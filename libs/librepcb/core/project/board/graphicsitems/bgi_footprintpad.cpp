@@ -120,11 +120,12 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
   Length solderPasteClearance =
       -mPad.getBoard().getDesignRules().calcSolderPasteClearance(*size);
 
-  // set shapes and bounding rect
-  mShape = mLibPad.getOutline().toQPainterPathPx();
+  // set shapes and bounding rect (shared with all other instances of the same
+  // library pad, thus no geometry is generated if it's already cached)
+  mShape = mLibPad.toOutlineQPainterPathPx();
   mCopper = mLibPad.toQPainterPathPx();
-  mStopMask = mLibPad.getOutline(stopMaskClearance).toQPainterPathPx();
-  mSolderPaste = mLibPad.getOutline(solderPasteClearance).toQPainterPathPx();
+  mStopMask = mLibPad.toOutlineQPainterPathPx(stopMaskClearance);
+  mSolderPaste = mLibPad.toOutlineQPainterPathPx(solderPasteClearance);
   mBoundingRect = mStopMask.boundingRect();
 
   update();
@@ -137,8 +138,15 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept {
 void BGI_FootprintPad::paint(QPainter* painter,
                              const QStyleOptionGraphicsItem* option,
                              QWidget* widget) {
-  Q_UNUSED(option);
   Q_UNUSED(widget);
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+
+  // In zoomed out views, pads are drawn as simple rects and the pad text is
+  // omitted since the details would not be visible anyway.
+  const QRectF copperRect = mCopper.boundingRect();
+  const qreal copperSizePx =
+      std::max(copperRect.width(), copperRect.height()) * lod;
 
   const NetSignal* netsignal = mPad.getCompSigInstNetSignal();
   bool highlight =
@@ -162,12 +170,18 @@ void BGI_FootprintPad::paint(QPainter* painter,
     // draw pad
     painter->setPen(Qt::NoPen);
     painter->setBrush(mPadLayer->getColor(highlight));
-    painter->drawPath(mCopper);
+    if (copperSizePx >= sMinCopperSizePx) {
+      painter->drawPath(mCopper);
+    } else {
+      painter->drawRect(copperRect);
+    }
     // draw pad text
-    painter->setFont(mFont);
-    painter->setPen(mPadLayer->getColor(highlight).lighter(150));
-    painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
-                      mPad.getDisplayText());
+    if (copperSizePx >= sMinTextPadSizePx) {
+      painter->setFont(mFont);
+      painter->setPen(mPadLayer->getColor(highlight).lighter(150));
+      painter->drawText(mShape.boundingRect(), Qt::AlignCenter,
+                        mPad.getDisplayText());
+    }
   }
 
   if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
@@ -96,6 +96,10 @@ private:  // Data
 
   // Slots
   GraphicsLayer::OnEditedSlot mOnLayerEditedSlot;
+
+  // Static Variables
+  static constexpr qreal sMinCopperSizePx = 4;  ///< Draw rect if smaller
+  static constexpr qreal sMinTextPadSizePx = 20;  ///< Hide text if smaller
 };
 
 /*******************************************************************************
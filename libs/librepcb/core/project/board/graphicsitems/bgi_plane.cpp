@@ -47,6 +47,7 @@ BGI_Plane::BGI_Plane(BI_Plane& plane) noexcept
     mPlane(plane),
     mLayer(nullptr),
     mBoundingRectMarginPx(0),
+    mAreasReleased(false),
     mLineWidthPx(0),
     mVertexHandleRadiusPx(0),
     mVertexHandles(),
@@ -105,6 +106,17 @@ QVector<int> BGI_Plane::getVertexIndicesAtPosition(const Point& pos) const
   return indices.values(indices.uniqueKeys().value(0)).toVector();
 }
 
+qint64 BGI_Plane::getCachedAreasMemoryUsage() const noexcept {
+  qint64 size = 0;
+  foreach (const QPainterPath& area, mAreas) {
+    size += Toolbox::approximateMemoryUsage(area);
+  }
+  foreach (const QPainterPath& area, mSimplifiedAreas) {
+    size += Toolbox::approximateMemoryUsage(area);
+  }
+  return size;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -153,10 +165,21 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
     mAreas.append(r.toQPainterPathPx());
     mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
   }
+  mAreasReleased = false;
+  mSimplifiedAreas.clear();
+  mSimplifiedAreasLodLevel = tl::nullopt;
 
   updateBoundingRectMargin();
 }
 
+void BGI_Plane::releaseCachedAreas() noexcept {
+  // The bounding rect stays valid since the fragments did not change.
+  mAreas.clear();
+  mAreasReleased = true;
+  mSimplifiedAreas.clear();
+  mSimplifiedAreasLodLevel = tl::nullopt;
+}
+
 /*******************************************************************************
  *  Inherited from QGraphicsItem
  ******************************************************************************/
@@ -219,7 +242,9 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     if (mPlane.isVisible()) {
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(selected));
-      foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+      foreach (const QPainterPath& area, getAreas(lod)) {
+        painter->drawPath(area);
+      }
     }
   }
 }
@@ -273,6 +298,33 @@ void BGI_Plane::updateBoundingRectMargin() noexcept {
   update();
 }
 
+const QVector<QPainterPath>& BGI_Plane::getAreas(qreal lod) noexcept {
+  // In zoomed out views, drawing the full resolution fragments is very slow
+  // for complex planes, and the details are not visible anyway. So the
+  // fragments are decimated with a tolerance of about one pixel, cached for
+  // the current power-of-two zoom level.
+  const int level = qFloor(std::log2(std::max(lod, qreal(1e-6))));
+  if (level >= sFullDetailLodLevel) {
+    if (mAreasReleased) {
+      for (const Path& r : mPlane.getFragments()) {
+        mAreas.append(r.toQPainterPathPx());
+      }
+      mAreasReleased = false;
+    }
+    return mAreas;
+  }
+  if (mSimplifiedAreasLodLevel != level) {
+    const UnsignedLength tolerance(
+        Length::fromPx(std::pow(qreal(2), -level)).abs());
+    mSimplifiedAreas.clear();
+    for (const Path& r : mPlane.getFragments()) {
+      mSimplifiedAreas.append(r.toSimplifiedPath(tolerance).toQPainterPathPx());
+    }
+    mSimplifiedAreasLodLevel = level;
+  }
+  return mSimplifiedAreas;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
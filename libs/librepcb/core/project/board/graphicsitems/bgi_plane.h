@@ -26,6 +26,8 @@
 #include "../../../graphics/graphicslayer.h"
 #include "bgi_base.h"
 
+#include <optional/tl/optional.hpp>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -71,9 +73,21 @@ public:
   /// @return       All indices of the vertices at the specified position.
   QVector<int> getVertexIndicesAtPosition(const Point& pos) const noexcept;
 
+  /// Get the approximate memory used by the cached plane areas
+  ///
+  /// @return       Size in bytes.
+  qint64 getCachedAreasMemoryUsage() const noexcept;
+
   // General Methods
   void updateCacheAndRepaint() noexcept;
 
+  /// Release the cached plane areas
+  ///
+  /// The areas are rebuilt from the plane fragments when the plane gets
+  /// painted the next time, thus this is intended to be called on planes of
+  /// boards which are currently not displayed.
+  void releaseCachedAreas() noexcept;
+
   // Inherited from QGraphicsItem
   QVariant itemChange(GraphicsItemChange change,
                       const QVariant& value) noexcept override;
@@ -95,6 +109,7 @@ private:  // Methods
                    GraphicsLayer::Event event) noexcept;
   void updateVisibility() noexcept;
   void updateBoundingRectMargin() noexcept;
+  const QVector<QPainterPath>& getAreas(qreal lod) noexcept;
 
 private:  // Data
   // General Attributes
@@ -107,6 +122,9 @@ private:  // Data
   QPainterPath mShape;
   QPainterPath mOutline;
   QVector<QPainterPath> mAreas;
+  bool mAreasReleased;  ///< #mAreas need to be rebuilt before painting
+  QVector<QPainterPath> mSimplifiedAreas;  ///< Decimated #mAreas
+  tl::optional<int> mSimplifiedAreasLodLevel;  ///< log2 of the LOD
   qreal mLineWidthPx;
   qreal mVertexHandleRadiusPx;
   struct VertexHandle {
@@ -117,6 +135,9 @@ private:  // Data
 
   // Slots
   GraphicsLayer::OnEditedSlot mOnLayerEditedSlot;
+
+  // Static Variables
+  static constexpr int sFullDetailLodLevel = 2;  ///< Min. LOD level (log2)
 };
 
 /*******************************************************************************
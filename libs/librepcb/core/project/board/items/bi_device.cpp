@@ -241,7 +241,7 @@ StrokeTextList BI_Device::getDefaultStrokeTexts() const noexcept {
 }
 
 void BI_Device::addStrokeText(BI_StrokeText& text) {
-  if ((mStrokeTexts.values().contains(&text)) ||
+  if ((mStrokeTexts.value(text.getUuid()) == &text) ||
       (&text.getBoard() != &mBoard)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -313,8 +313,9 @@ void BI_Device::setMirrored(bool mirror) {
 
 void BI_Device::setAttributes(const AttributeList& attributes) noexcept {
   if (attributes != mAttributes) {
+    const QSet<QString> keys = getChangedKeys(mAttributes, attributes);
     mAttributes = attributes;
-    emit attributesChanged();
+    emit attributesChanged(keys);
   }
 }
 
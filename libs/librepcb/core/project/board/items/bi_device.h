@@ -155,7 +155,7 @@ public:
 
 signals:
   /// @copydoc AttributeProvider::attributesChanged()
-  void attributesChanged() override;
+  void attributesChanged(const QSet<QString>& keys) override;
 
 private:
   bool checkAttributesValidity() const noexcept;
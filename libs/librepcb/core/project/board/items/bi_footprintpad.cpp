@@ -133,6 +133,10 @@ bool BI_FootprintPad::isOnLayer(const QString& layerName) const noexcept {
   }
 }
 
+bool BI_FootprintPad::isOnLayer(const GraphicsLayerId& layer) const noexcept {
+  return mFootprintPad->isOnLayer(getMirrored() ? layer.getMirrored() : layer);
+}
+
 NetSignal* BI_FootprintPad::getCompSigInstNetSignal() const noexcept {
   if (mComponentSignalInstance) {
     return mComponentSignalInstance->getNetSignal();
@@ -85,6 +85,7 @@ public:
   BI_Device& getDevice() const noexcept { return mDevice; }
   QString getLayerName() const noexcept;
   bool isOnLayer(const QString& layerName) const noexcept;
+  bool isOnLayer(const GraphicsLayerId& layer) const noexcept;
   const FootprintPad& getLibPad() const noexcept { return *mFootprintPad; }
   const PackagePad* getLibPackagePad() const noexcept { return mPackagePad; }
   ComponentSignalInstance* getComponentSignalInstance() const noexcept {
@@ -153,7 +153,8 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
                                 const QList<BI_NetLine*>& netlines) {
   ScopeGuardList sgl(netpoints.count() + netlines.count());
   foreach (BI_Via* via, vias) {
-    if ((mVias.values().contains(via)) || (&via->getNetSegment() != this)) {
+    if ((mVias.value(via->getUuid()) == via) ||
+        (&via->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
     if (mVias.contains(via->getUuid())) {
@@ -173,7 +174,7 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
     });
   }
   foreach (BI_NetPoint* netpoint, netpoints) {
-    if ((mNetPoints.values().contains(netpoint)) ||
+    if ((mNetPoints.value(netpoint->getUuid()) == netpoint) ||
         (&netpoint->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
@@ -195,7 +196,7 @@ void BI_NetSegment::addElements(const QList<BI_Via*>& vias,
     });
   }
   foreach (BI_NetLine* netline, netlines) {
-    if ((mNetLines.values().contains(netline)) ||
+    if ((mNetLines.value(netline->getUuid()) == netline) ||
         (&netline->getNetSegment() != this)) {
       throw LogicError(__FILE__, __LINE__);
     }
@@ -174,8 +174,9 @@ void BI_StrokeText::setSelected(bool selected) noexcept {
  *  Private Slots
  ******************************************************************************/
 
-void BI_StrokeText::boardOrDeviceAttributesChanged() {
-  mGraphicsItem->updateText();
+void BI_StrokeText::boardOrDeviceAttributesChanged(
+    const QSet<QString>& keys) {
+  mGraphicsItem->updateText(keys);
 }
 
 /*******************************************************************************
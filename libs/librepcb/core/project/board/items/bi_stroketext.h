@@ -88,7 +88,7 @@ public:
   BI_StrokeText& operator=(const BI_StrokeText& rhs) = delete;
 
 private slots:
-  void boardOrDeviceAttributesChanged();
+  void boardOrDeviceAttributesChanged(const QSet<QString>& keys);
 
 private:  // Methods
   void updatePaths() noexcept;
@@ -61,6 +61,10 @@ bool BI_Via::isOnLayer(const QString& layerName) const noexcept {
   return GraphicsLayer::isCopperLayer(layerName);
 }
 
+bool BI_Via::isOnLayer(const GraphicsLayerId& layer) const noexcept {
+  return layer.isCopperLayer();
+}
+
 TraceAnchor BI_Via::toTraceAnchor() const noexcept {
   return TraceAnchor::via(mVia.getUuid());
 }
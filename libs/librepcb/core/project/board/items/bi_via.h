@@ -63,6 +63,7 @@ public:
   const PositiveLength& getSize() const noexcept { return mVia.getSize(); }
   bool isUsed() const noexcept { return (mRegisteredNetLines.count() > 0); }
   bool isOnLayer(const QString& layerName) const noexcept;
+  bool isOnLayer(const GraphicsLayerId& layer) const noexcept;
   bool isSelectable() const noexcept override;
   TraceAnchor toTraceAnchor() const noexcept override;
 
@@ -88,7 +88,7 @@ NetClass* Circuit::getNetClassByName(const ElementName& name) const noexcept {
 }
 
 void Circuit::addNetClass(NetClass& netclass) {
-  if ((mNetClasses.values().contains(&netclass)) ||
+  if ((mNetClasses.value(netclass.getUuid()) == &netclass) ||
       (&netclass.getCircuit() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -137,11 +137,16 @@ void Circuit::setNetClassName(NetClass& netclass, const ElementName& newName) {
  ******************************************************************************/
 
 QString Circuit::generateAutoNetSignalName() const noexcept {
+  // Collect the names first to avoid a linear search for each candidate.
+  QSet<QString> names;
+  foreach (const NetSignal* netsignal, mNetSignals) {
+    names.insert(*netsignal->getName());
+  }
   QString name;
   int i = 1;
   do {
     name = QString("N%1").arg(i++);
-  } while (getNetSignalByName(name));
+  } while (names.contains(name));
   return name;
 }
 
@@ -167,7 +172,7 @@ NetSignal* Circuit::getNetSignalWithMostElements() const noexcept {
 }
 
 void Circuit::addNetSignal(NetSignal& netsignal) {
-  if ((mNetSignals.values().contains(&netsignal)) ||
+  if ((mNetSignals.value(netsignal.getUuid()) == &netsignal) ||
       (&netsignal.getCircuit() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -225,12 +230,17 @@ void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept {
 
 QString Circuit::generateAutoComponentInstanceName(
     const ComponentPrefix& cmpPrefix) const noexcept {
+  // Collect the names first to avoid a linear search for each candidate.
+  QSet<QString> names;
+  foreach (const ComponentInstance* cmp, mComponentInstances) {
+    names.insert(*cmp->getName());
+  }
   QString name;
   int i = 1;
   do {
     name =
         QString("%1%2").arg(cmpPrefix->isEmpty() ? "?" : *cmpPrefix).arg(i++);
-  } while (getComponentInstanceByName(name));
+  } while (names.contains(name));
   return name;
 }
 
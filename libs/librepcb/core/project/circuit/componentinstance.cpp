@@ -28,6 +28,7 @@
 #include "../../utils/scopeguardlist.h"
 #include "../board/items/bi_device.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "../projectlibrary.h"
 #include "../projectsettings.h"
@@ -85,6 +86,7 @@ ComponentInstance::ComponentInstance(Circuit& circuit, const Uuid& uuid,
 
 ComponentInstance::~ComponentInstance() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
+  mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
   Q_ASSERT(!isUsed());
 
   qDeleteAll(mSignals);
@@ -156,23 +158,24 @@ bool ComponentInstance::isUsed() const noexcept {
 void ComponentInstance::setName(const CircuitIdentifier& name) noexcept {
   if (name != mName) {
     mName = name;
-    updateErcMessages();
-    emit attributesChanged();
+    mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+    emit attributesChanged({"NAME"});
   }
 }
 
 void ComponentInstance::setValue(const QString& value) noexcept {
   if (value != mValue) {
     mValue = value;
-    emit attributesChanged();
+    emit attributesChanged({"VALUE"});
   }
 }
 
 void ComponentInstance::setAttributes(
     const AttributeList& attributes) noexcept {
   if (attributes != *mAttributes) {
+    const QSet<QString> keys = getChangedKeys(*mAttributes, attributes);
     *mAttributes = attributes;
-    emit attributesChanged();
+    emit attributesChanged(keys);
   }
 }
 
@@ -180,7 +183,7 @@ void ComponentInstance::setDefaultDeviceUuid(
     const tl::optional<Uuid>& device) noexcept {
   if (device != mDefaultDeviceUuid) {
     mDefaultDeviceUuid = device;
-    emit attributesChanged();
+    emit attributesChanged(QSet<QString>());
   }
 }
 
@@ -198,7 +201,7 @@ void ComponentInstance::addToCircuit() {
     sgl.add([signal]() { signal->removeFromCircuit(); });
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
   sgl.dismiss();
 }
 
@@ -218,7 +221,7 @@ void ComponentInstance::removeFromCircuit() {
     sgl.add([signal]() { signal->addToCircuit(); });
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
   sgl.dismiss();
 }
 
@@ -252,7 +255,7 @@ void ComponentInstance::registerSymbol(SI_Symbol& symbol) {
     }
   }
   mRegisteredSymbols.insert(itemUuid, &symbol);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void ComponentInstance::unregisterSymbol(SI_Symbol& symbol) {
@@ -262,7 +265,7 @@ void ComponentInstance::unregisterSymbol(SI_Symbol& symbol) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSymbols.remove(itemUuid);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void ComponentInstance::registerDevice(BI_Device& device) {
@@ -272,8 +275,9 @@ void ComponentInstance::registerDevice(BI_Device& device) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredDevices.append(&device);
-  updateErcMessages();
-  emit attributesChanged();  // parent attribute provider may have changed!
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+  // Parent attribute provider may have changed, thus any attribute.
+  emit attributesChanged(QSet<QString>());
 }
 
 void ComponentInstance::unregisterDevice(BI_Device& device) {
@@ -281,8 +285,9 @@ void ComponentInstance::unregisterDevice(BI_Device& device) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredDevices.removeOne(&device);
-  updateErcMessages();
-  emit attributesChanged();  // parent attribute provider may have changed!
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+  // Parent attribute provider may have changed, thus any attribute.
+  emit attributesChanged(QSet<QString>());
 }
 
 void ComponentInstance::serialize(SExpression& root) const {
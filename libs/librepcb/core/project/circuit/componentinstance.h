@@ -160,11 +160,11 @@ public:
 signals:
 
   /// @copydoc AttributeProvider::attributesChanged()
-  void attributesChanged() override;
+  void attributesChanged(const QSet<QString>& keys) override;
 
 private:
   bool checkAttributesValidity() const noexcept;
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
   const QStringList& getLocaleOrder() const noexcept;
 
   // General
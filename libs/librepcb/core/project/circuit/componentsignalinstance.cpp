@@ -28,6 +28,7 @@
 #include "../../utils/scopeguardlist.h"
 #include "../board/items/bi_footprintpad.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../project.h"
 #include "../projectsettings.h"
 #include "../schematic/items/si_symbolpin.h"
@@ -74,7 +75,9 @@ ComponentSignalInstance::ComponentSignalInstance(
 
   // register to component attributes changed
   connect(&mComponentInstance, &ComponentInstance::attributesChanged, this,
-          &ComponentSignalInstance::updateErcMessages);
+          [this]() {
+            mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
+          });
 
   // register to net signal name changed
   if (mNetSignal) {
@@ -85,6 +88,7 @@ ComponentSignalInstance::ComponentSignalInstance(
 
 ComponentSignalInstance::~ComponentSignalInstance() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
+  mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
   Q_ASSERT(!isUsed());
   Q_ASSERT(!arePinsOrPadsUsed());
 }
@@ -164,7 +168,7 @@ void ComponentSignalInstance::setNetSignal(NetSignal* netsignal) {
   }
   NetSignal* old = mNetSignal;
   mNetSignal = netsignal;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
   sgl.dismiss();
   emit netSignalChanged(old, mNetSignal);
 }
@@ -181,7 +185,7 @@ void ComponentSignalInstance::addToCircuit() {
     mNetSignal->registerComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void ComponentSignalInstance::removeFromCircuit() {
@@ -198,7 +202,7 @@ void ComponentSignalInstance::removeFromCircuit() {
     mNetSignal->unregisterComponentSignal(*this);  // can throw
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void ComponentSignalInstance::registerSymbolPin(SI_SymbolPin& pin) {
@@ -245,7 +249,7 @@ void ComponentSignalInstance::serialize(SExpression& root) const {
 void ComponentSignalInstance::netSignalNameChanged(
     const CircuitIdentifier& newName) noexcept {
   Q_UNUSED(newName);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void ComponentSignalInstance::updateErcMessages() noexcept {
@@ -123,7 +123,7 @@ signals:
 private slots:
 
   void netSignalNameChanged(const CircuitIdentifier& newName) noexcept;
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
 private:
   // General
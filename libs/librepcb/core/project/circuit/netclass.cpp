@@ -24,6 +24,8 @@
 
 #include "../../exceptions.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "circuit.h"
 #include "netsignal.h"
 
@@ -48,6 +50,7 @@ NetClass::NetClass(Circuit& circuit, const Uuid& uuid, const ElementName& name)
 
 NetClass::~NetClass() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
+  mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
   Q_ASSERT(!isUsed());
 }
 
@@ -60,7 +63,7 @@ void NetClass::setName(const ElementName& name) noexcept {
     return;
   }
   mName = name;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 /*******************************************************************************
@@ -72,7 +75,7 @@ void NetClass::addToCircuit() {
     throw LogicError(__FILE__, __LINE__);
   }
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetClass::removeFromCircuit() {
@@ -86,7 +89,7 @@ void NetClass::removeFromCircuit() {
                            .arg(*mName));
   }
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetClass::registerNetSignal(NetSignal& signal) {
@@ -96,7 +99,7 @@ void NetClass::registerNetSignal(NetSignal& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredNetSignals.insert(signal.getUuid(), &signal);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetClass::unregisterNetSignal(NetSignal& signal) {
@@ -105,7 +108,7 @@ void NetClass::unregisterNetSignal(NetSignal& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredNetSignals.remove(signal.getUuid());
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetClass::serialize(SExpression& root) const {
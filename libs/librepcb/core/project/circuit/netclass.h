@@ -86,7 +86,7 @@ public:
   NetClass& operator=(const NetClass& rhs) = delete;
 
 private:
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
   // General
   Circuit& mCircuit;
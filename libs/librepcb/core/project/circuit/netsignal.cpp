@@ -27,6 +27,8 @@
 #include "../board/items/bi_netsegment.h"
 #include "../board/items/bi_plane.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
+#include "../project.h"
 #include "../schematic/items/si_netsegment.h"
 #include "circuit.h"
 #include "componentinstance.h"
@@ -58,6 +60,7 @@ NetSignal::NetSignal(Circuit& circuit, const Uuid& uuid, NetClass& netclass,
 
 NetSignal::~NetSignal() noexcept {
   Q_ASSERT(!mIsAddedToCircuit);
+  mCircuit.getProject().getErcMsgList().cancelUpdate(*this);
   Q_ASSERT(!isUsed());
 }
 
@@ -98,7 +101,7 @@ void NetSignal::setName(const CircuitIdentifier& name,
   }
   mName = name;
   mHasAutoName = isAutoName;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
   emit nameChanged(mName);
 }
 
@@ -119,7 +122,7 @@ void NetSignal::addToCircuit() {
   }
   mNetClass.registerNetSignal(*this);  // can throw
   mIsAddedToCircuit = true;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::removeFromCircuit() {
@@ -134,7 +137,7 @@ void NetSignal::removeFromCircuit() {
   }
   mNetClass.unregisterNetSignal(*this);  // can throw
   mIsAddedToCircuit = false;
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
@@ -143,7 +146,7 @@ void NetSignal::registerComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.append(&signal);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
@@ -152,7 +155,7 @@ void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredComponentSignals.removeOne(&signal);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -166,7 +169,7 @@ void NetSignal::registerSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__, "NetSegment is from other circuit.");
   }
   mRegisteredSchematicNetSegments.append(&netsegment);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
@@ -175,7 +178,7 @@ void NetSignal::unregisterSchematicNetSegment(SI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredSchematicNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
@@ -185,7 +188,7 @@ void NetSignal::registerBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.append(&netsegment);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
@@ -194,7 +197,7 @@ void NetSignal::unregisterBoardNetSegment(BI_NetSegment& netsegment) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardNetSegments.removeOne(&netsegment);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::registerBoardPlane(BI_Plane& plane) {
@@ -203,7 +206,7 @@ void NetSignal::registerBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.append(&plane);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
@@ -211,7 +214,7 @@ void NetSignal::unregisterBoardPlane(BI_Plane& plane) {
     throw LogicError(__FILE__, __LINE__);
   }
   mRegisteredBoardPlanes.removeOne(&plane);
-  updateErcMessages();
+  mCircuit.getProject().getErcMsgList().scheduleUpdate(*this);
 }
 
 void NetSignal::serialize(SExpression& root) const {
@@ -121,7 +121,7 @@ signals:
   void highlightedChanged(bool isHighlighted);
 
 private:
-  void updateErcMessages() noexcept;
+  void updateErcMessages() noexcept override;
 
   // General
   Circuit& mCircuit;
@@ -39,11 +39,15 @@ namespace librepcb {
  ******************************************************************************/
 
 ErcMsgList::ErcMsgList(Project& project)
-  : QObject(&project), mProject(project) {
+  : QObject(&project),
+    mProject(project),
+    mRequestedUpdates(0),
+    mPerformedUpdates(0) {
 }
 
 ErcMsgList::~ErcMsgList() noexcept {
   Q_ASSERT(mItems.isEmpty());
+  Q_ASSERT(mScheduledUpdates.isEmpty());
 }
 
 /*******************************************************************************
@@ -73,6 +77,43 @@ void ErcMsgList::update(ErcMsg* ercMsg) noexcept {
   emit ercMsgChanged(ercMsg);
 }
 
+void ErcMsgList::scheduleUpdate(IF_ErcMsgProvider& provider) noexcept {
+  ++mRequestedUpdates;
+  if (mScheduledUpdatesSet.contains(&provider)) {
+    return;
+  }
+  if (mScheduledUpdates.isEmpty()) {
+    QTimer::singleShot(0, this, &ErcMsgList::processScheduledUpdates);
+  }
+  mScheduledUpdates.append(&provider);
+  mScheduledUpdatesSet.insert(&provider);
+}
+
+void ErcMsgList::cancelUpdate(IF_ErcMsgProvider& provider) noexcept {
+  if (mScheduledUpdatesSet.remove(&provider)) {
+    mScheduledUpdates.removeOne(&provider);
+  }
+}
+
+void ErcMsgList::processScheduledUpdates() noexcept {
+  if (mScheduledUpdates.isEmpty()) {
+    return;
+  }
+  const QVector<IF_ErcMsgProvider*> providers = mScheduledUpdates;
+  mScheduledUpdates.clear();
+  mScheduledUpdatesSet.clear();
+  foreach (IF_ErcMsgProvider* provider, providers) {
+    provider->updateErcMessages();
+    ++mPerformedUpdates;
+  }
+  if (providers.count() >= 100) {
+    qDebug().nospace() << "Updated ERC messages of " << providers.count()
+                       << " objects in one batch ("
+                       << (mRequestedUpdates - mPerformedUpdates)
+                       << " redundant updates avoided so far).";
+  }
+}
+
 void ErcMsgList::serialize(SExpression& root) const {
   foreach (const ErcMsg* msg, mItems) {
     if (msg->isIgnored()) {
@@ -31,6 +31,7 @@
 namespace librepcb {
 
 class ErcMsg;
+class IF_ErcMsgProvider;
 class Project;
 class SExpression;
 
@@ -41,6 +42,12 @@ class SExpression;
 /**
  * @brief The ErcMsgList class contains a list of ERC messages which are visible
  * for the user
+ *
+ * Objects providing ERC messages don't re-evaluate them immediately on every
+ * modification, but request an update with #scheduleUpdate(). All requested
+ * updates are then processed in one batch by #processScheduledUpdates(),
+ * which is called automatically in the next event loop iteration. So bulk
+ * operations like pasting many components evaluate each object only once.
  */
 class ErcMsgList final : public QObject {
   Q_OBJECT
@@ -54,11 +61,36 @@ public:
 
   // Getters
   const QList<ErcMsg*>& getItems() const noexcept { return mItems; }
+  int getRequestedUpdatesCount() const noexcept { return mRequestedUpdates; }
+  int getPerformedUpdatesCount() const noexcept { return mPerformedUpdates; }
 
   // General Methods
   void add(ErcMsg* ercMsg) noexcept;
   void remove(ErcMsg* ercMsg) noexcept;
   void update(ErcMsg* ercMsg) noexcept;
+
+  /**
+   * @brief Request re-evaluation of the ERC messages of an object
+   *
+   * @param provider  The object to update. It must call #cancelUpdate() when
+   *                  it gets destroyed.
+   */
+  void scheduleUpdate(IF_ErcMsgProvider& provider) noexcept;
+
+  /**
+   * @brief Discard a requested update of an object
+   *
+   * @param provider  The object which doesn't need to be updated anymore.
+   */
+  void cancelUpdate(IF_ErcMsgProvider& provider) noexcept;
+
+  /**
+   * @brief Immediately process all requested updates
+   *
+   * Must be called before the ERC messages are evaluated synchronously, e.g.
+   * before saving the project.
+   */
+  void processScheduledUpdates() noexcept;
   void restoreIgnoreState();
 
   /**
@@ -82,6 +114,12 @@ private:
 
   // Misc
   QList<ErcMsg*> mItems;  ///< contains all visible ERC messages
+
+  // Scheduled updates
+  QVector<IF_ErcMsgProvider*> mScheduledUpdates;  ///< In order of requests
+  QSet<IF_ErcMsgProvider*> mScheduledUpdatesSet;  ///< For fast lookup
+  int mRequestedUpdates;  ///< Total number of #scheduleUpdate() calls
+  int mPerformedUpdates;  ///< Total number of actual updates
 };
 
 /*******************************************************************************
@@ -63,6 +63,17 @@ public:
 
   // Getters
   virtual const char* getErcMsgOwnerClassName() const noexcept = 0;
+
+  // General Methods
+
+  /**
+   * @brief Re-evaluate all ERC messages of this object
+   *
+   * Called by ::librepcb::ErcMsgList::processScheduledUpdates() for objects
+   * which have requested an update with
+   * ::librepcb::ErcMsgList::scheduleUpdate().
+   */
+  virtual void updateErcMessages() noexcept {}
 };
 
 /*******************************************************************************
@@ -121,47 +121,48 @@ Project::~Project() noexcept {
 void Project::setUuid(const Uuid& newUuid) noexcept {
   if (newUuid != mUuid) {
     mUuid = newUuid;
-    emit attributesChanged();
+    emit attributesChanged(QSet<QString>());
   }
 }
 
 void Project::setName(const ElementName& newName) noexcept {
   if (newName != mName) {
     mName = newName;
-    emit attributesChanged();
+    emit attributesChanged({"PROJECT"});
   }
 }
 
 void Project::setAuthor(const QString& newAuthor) noexcept {
   if (newAuthor != mAuthor) {
     mAuthor = newAuthor;
-    emit attributesChanged();
+    emit attributesChanged({"AUTHOR"});
   }
 }
 
 void Project::setVersion(const QString& newVersion) noexcept {
   if (newVersion != mVersion) {
     mVersion = newVersion;
-    emit attributesChanged();
+    emit attributesChanged({"VERSION"});
   }
 }
 
 void Project::setCreated(const QDateTime& newCreated) noexcept {
   if (newCreated != mCreated) {
     mCreated = newCreated;
-    emit attributesChanged();
+    emit attributesChanged({"CREATED_DATE", "CREATED_TIME"});
   }
 }
 
 void Project::updateLastModified() noexcept {
   mLastModified = QDateTime::currentDateTime();
-  emit attributesChanged();
+  emit attributesChanged({"MODIFIED_DATE", "MODIFIED_TIME"});
 }
 
 void Project::setAttributes(const AttributeList& newAttributes) noexcept {
   if (newAttributes != mAttributes) {
+    const QSet<QString> keys = getChangedKeys(mAttributes, newAttributes);
     mAttributes = newAttributes;
-    emit attributesChanged();
+    emit attributesChanged(keys);
   }
 }
 
@@ -223,7 +224,7 @@ void Project::addSchematic(Schematic& schematic, int newIndex) {
   }
 
   emit schematicAdded(newIndex);
-  emit attributesChanged();
+  emit attributesChanged(QSet<QString>());
 }
 
 void Project::removeSchematic(Schematic& schematic, bool deleteSchematic) {
@@ -244,7 +245,7 @@ void Project::removeSchematic(Schematic& schematic, bool deleteSchematic) {
   mSchematics.removeAt(index);
 
   emit schematicRemoved(index);
-  emit attributesChanged();
+  emit attributesChanged(QSet<QString>());
 
   if (deleteSchematic) {
     delete &schematic;
@@ -310,7 +311,7 @@ void Project::addBoard(Board& board, int newIndex) {
   }
 
   emit boardAdded(newIndex);
-  emit attributesChanged();
+  emit attributesChanged(QSet<QString>());
 }
 
 void Project::removeBoard(Board& board, bool deleteBoard) {
@@ -325,7 +326,7 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
   mBoards.removeAt(index);
 
   emit boardRemoved(index);
-  emit attributesChanged();
+  emit attributesChanged(QSet<QString>());
 
   if (deleteBoard) {
     delete &board;
@@ -383,6 +384,7 @@ void Project::save() {
   // ERC.
   {
     SExpression root = SExpression::createList("librepcb_erc");
+    mErcMsgList->processScheduledUpdates();
     mErcMsgList->serialize(root);
     mDirectory->write("circuit/erc.lp", root.toByteArray());
   }
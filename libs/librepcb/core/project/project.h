@@ -436,7 +436,7 @@ public:
 signals:
 
   /// @copydoc AttributeProvider::attributesChanged()
-  void attributesChanged() override;
+  void attributesChanged(const QSet<QString>& keys) override;
 
   /**
    * @brief This signal is emitted after a schematic was added to the project
@@ -29,6 +29,7 @@
 #include "../library/pkg/package.h"
 #include "../library/sym/symbol.h"
 #include "../serialization/fileformatmigration.h"
+#include "../utils/timingrecorder.h"
 #include "board/board.h"
 #include "board/boarddesignrules.h"
 #include "board/boardfabricationoutputsettings.h"
@@ -63,6 +64,7 @@
 #include "schematic/items/si_text.h"
 #include "schematic/schematic.h"
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -74,7 +76,8 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-ProjectLoader::ProjectLoader(QObject* parent) noexcept : QObject(parent) {
+ProjectLoader::ProjectLoader(QObject* parent) noexcept
+  : QObject(parent), mAbort(0) {
 }
 
 ProjectLoader::~ProjectLoader() noexcept {
@@ -87,13 +90,22 @@ ProjectLoader::~ProjectLoader() noexcept {
 std::unique_ptr<Project> ProjectLoader::open(
     std::unique_ptr<TransactionalDirectory> directory,
     const QString& filename) {
+  TimingScope scope("ProjectLoader::open", filename);
+  read(std::move(directory), filename);  // can throw
+  return build();  // can throw
+}
+
+void ProjectLoader::read(std::unique_ptr<TransactionalDirectory> directory,
+                         const QString& filename) {
   Q_ASSERT(directory);
+  clear();
   mUpgradeMessages = tl::nullopt;
 
-  QElapsedTimer timer;
-  timer.start();
+  TimingScope scope("ProjectLoader::read", filename);
+  mTimer.start();
   const FilePath fp = directory->getAbsPath(filename);
   qDebug().nospace() << "Open project " << fp.toNative() << "...";
+  checkCanceled();
 
   // Check if the project file exists.
   if (!directory->fileExists(filename)) {
@@ -126,38 +138,168 @@ std::unique_ptr<Project> ProjectLoader::open(
   for (auto migration : FileFormatMigration::getMigrations(fileFormat)) {
     if (!mUpgradeMessages) {
       mUpgradeMessages = QList<FileFormatMigration::Message>();
+      emit progress(0, tr("Upgrading file format..."));
     }
     qInfo().nospace().noquote()
         << "Project file format is outdated, upgrading from v"
         << migration->getFromVersion().toStr() << " to v"
         << migration->getToVersion().toStr() << "...";
+    TimingScope migrationScope("FileFormatMigration::upgradeProject",
+                               migration->getFromVersion().toStr() % " -> " %
+                                   migration->getToVersion().toStr());
     migration->upgradeProject(*directory, *mUpgradeMessages);
+    checkCanceled();
+  }
+  mDirectory = std::move(directory);
+  mFilename = filename;
+
+  // Read library.
+  emit progress(5, tr("Loading library..."));
+  readLibraryElements<Symbol>("sym", "symbols", mSymbols);
+  readLibraryElements<Package>("pkg", "packages", mPackages);
+  readLibraryElements<Component>("cmp", "components", mComponents);
+  readLibraryElements<Device>("dev", "devices", mDevices);
+
+  // Read circuit & project settings.
+  emit progress(40, tr("Loading circuit..."));
+  readFile("project/metadata.lp");
+  readFile("project/settings.lp");
+  readFile("circuit/circuit.lp");
+  readFile("circuit/erc.lp");
+
+  // Read schematics.
+  emit progress(45, tr("Loading schematics..."));
+  mSchematicFiles = readIndex("schematics/schematics.lp", "schematic");
+  parseFiles(mSchematicFiles);
+
+  // Read boards.
+  emit progress(60, tr("Loading boards..."));
+  mBoardFiles = readIndex("boards/boards.lp", "board");
+  parseFiles(mBoardFiles);
+  foreach (const QString& boardFilePath, mBoardFiles) {
+    // Errors are handled by loadBoardUserSettings().
+    try {
+      readFile(getBoardUserSettingsFilePath(boardFilePath));
+    } catch (const Exception&) {
+    }
   }
+  checkCanceled();
+}
 
-  // Load project.
-  std::unique_ptr<Project> p(new Project(std::move(directory), filename));
+std::unique_ptr<Project> ProjectLoader::build() {
+  if (!mDirectory) {
+    throw LogicError(__FILE__, __LINE__, "No project read.");
+  }
+
+  TimingScope scope("ProjectLoader::build", mFilename);
+  emit progress(75, tr("Creating project..."));
+  std::unique_ptr<Project> p(new Project(std::move(mDirectory), mFilename));
   loadMetadata(*p);
   loadSettings(*p);
   loadLibrary(*p);
   loadCircuit(*p);
+  emit progress(80, tr("Creating schematics..."));
   loadSchematics(*p);
+  emit progress(90, tr("Creating boards..."));
   loadBoards(*p);
   restoreApprovedErcMessages(*p);
+  clear();
 
   // Done!
-  qDebug() << "Successfully opened project in" << timer.elapsed() << "ms.";
+  qDebug() << "Successfully opened project in" << mTimer.elapsed() << "ms.";
   return p;
 }
 
+void ProjectLoader::cancel() noexcept {
+  mAbort.storeRelease(1);
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
+void ProjectLoader::clear() noexcept {
+  mDirectory.reset();
+  mFilename.clear();
+  mFiles.clear();
+  mSchematicFiles.clear();
+  mBoardFiles.clear();
+  mSymbols.clear();
+  mPackages.clear();
+  mComponents.clear();
+  mDevices.clear();
+}
+
+void ProjectLoader::checkCanceled() const {
+  if (mAbort.loadAcquire()) {
+    throw UserCanceled(__FILE__, __LINE__);
+  }
+}
+
+void ProjectLoader::readFile(const QString& relativeFilePath) {
+  checkCanceled();
+  mFiles.insert(relativeFilePath,
+                SExpression::parse(mDirectory->read(relativeFilePath),
+                                   mDirectory->getAbsPath(relativeFilePath)));
+}
+
+const SExpression& ProjectLoader::getFile(
+    const QString& relativeFilePath) const {
+  auto it = mFiles.constFind(relativeFilePath);
+  if (it == mFiles.constEnd()) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString("File has not been read: '%1'").arg(relativeFilePath));
+  }
+  return *it;
+}
+
+template <typename ElementType>
+void ProjectLoader::readLibraryElements(
+    const QString& dirname, const QString& type,
+    std::vector<std::unique_ptr<ElementType>>& list) {
+  TimingScope scope("ProjectLoader::readLibraryElements", type);
+  // Search all subdirectories which have a valid UUID as directory name.
+  const QString libDir = "library/" % dirname;
+  foreach (const QString& sub, mDirectory->getDirs(libDir)) {
+    checkCanceled();
+    std::unique_ptr<TransactionalDirectory> dir(
+        new TransactionalDirectory(*mDirectory, libDir % "/" % sub));
+
+    // Check if directory is a valid library element.
+    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir, "")) {
+      qWarning() << "Invalid directory in project library, ignoring it:"
+                 << dir->getAbsPath().toNative();
+      continue;
+    }
+
+    // Load the library element. If this is executed in a worker thread, the
+    // element must be moved to the GUI thread before it gets a parent.
+    std::unique_ptr<ElementType> element =
+        ElementType::open(std::move(dir));  // can throw
+    element->moveToThread(QCoreApplication::instance()->thread());
+    list.push_back(std::move(element));
+  }
+
+  qDebug().nospace().noquote()
+      << "Successfully loaded " << list.size() << " " << type << ".";
+}
+
+QStringList ProjectLoader::readIndex(const QString& relativeFilePath,
+                                     const QString& childName) {
+  readFile(relativeFilePath);
+  QStringList filePaths;
+  foreach (const SExpression* node,
+           getFile(relativeFilePath).getChildren(childName)) {
+    filePaths.append(node->getChild("@0").getValue());
+  }
+  return filePaths;
+}
+
 void ProjectLoader::loadMetadata(Project& p) {
+  TimingScope scope("ProjectLoader::loadMetadata");
   qDebug() << "Load project metadata...";
-  const QString fp = "project/metadata.lp";
-  SExpression root = SExpression::parse(p.getDirectory().read(fp),
-                                        p.getDirectory().getAbsPath(fp));
+  const SExpression& root = getFile("project/metadata.lp");
 
   p.setUuid(deserialize<Uuid>(root.getChild("@0")));
   p.setName(deserialize<ElementName>(root.getChild("name/@0")));
@@ -170,10 +312,9 @@ void ProjectLoader::loadMetadata(Project& p) {
 }
 
 void ProjectLoader::loadSettings(Project& p) {
+  TimingScope scope("ProjectLoader::loadSettings");
   qDebug() << "Load project settings...";
-  const QString fp = "project/settings.lp";
-  const SExpression root = SExpression::parse(p.getDirectory().read(fp),
-                                              p.getDirectory().getAbsPath(fp));
+  const SExpression& root = getFile("project/settings.lp");
   {
     QStringList l;
     foreach (const SExpression* node,
@@ -196,51 +337,32 @@ void ProjectLoader::loadSettings(Project& p) {
 }
 
 void ProjectLoader::loadLibrary(Project& p) {
+  TimingScope scope("ProjectLoader::loadLibrary");
   qDebug() << "Load project library...";
 
-  loadLibraryElements<Symbol>(p, "sym", "symbols", &ProjectLibrary::addSymbol);
-  loadLibraryElements<Package>(p, "pkg", "packages",
-                               &ProjectLibrary::addPackage);
-  loadLibraryElements<Component>(p, "cmp", "components",
-                                 &ProjectLibrary::addComponent);
-  loadLibraryElements<Device>(p, "dev", "devices", &ProjectLibrary::addDevice);
+  loadLibraryElements<Symbol>(p, mSymbols, &ProjectLibrary::addSymbol);
+  loadLibraryElements<Package>(p, mPackages, &ProjectLibrary::addPackage);
+  loadLibraryElements<Component>(p, mComponents, &ProjectLibrary::addComponent);
+  loadLibraryElements<Device>(p, mDevices, &ProjectLibrary::addDevice);
 
   qDebug() << "Successfully loaded project library.";
 }
 
 template <typename ElementType>
 void ProjectLoader::loadLibraryElements(
-    Project& p, const QString& dirname, const QString& type,
+    Project& p, std::vector<std::unique_ptr<ElementType>>& list,
     void (ProjectLibrary::*addFunction)(ElementType&)) {
-  // Search all subdirectories which have a valid UUID as directory name.
-  int count = 0;
-  foreach (const QString& sub, p.getLibrary().getDirectory().getDirs(dirname)) {
-    std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
-        p.getLibrary().getDirectory(), dirname % "/" % sub));
-
-    // Check if directory is a valid library element.
-    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir, "")) {
-      qWarning() << "Invalid directory in project library, ignoring it:"
-                 << dir->getAbsPath().toNative();
-      continue;
-    }
-
-    // Load the library element.
-    ElementType* element =
-        ElementType::open(std::move(dir)).release();  // can throw
-    (p.getLibrary().*addFunction)(*element);
-    ++count;
+  for (std::unique_ptr<ElementType>& element : list) {
+    (p.getLibrary().*addFunction)(*element);  // can throw
+    element.release();
   }
-
-  qDebug().nospace().noquote()
-      << "Successfully loaded " << count << " " << type << ".";
+  list.clear();
 }
 
 void ProjectLoader::loadCircuit(Project& p) {
+  TimingScope scope("ProjectLoader::loadCircuit");
   qDebug() << "Load circuit...";
-  const QString fp = "circuit/circuit.lp";
-  SExpression root = SExpression::parse(p.getDirectory().read(fp),
-                                        p.getDirectory().getAbsPath(fp));
+  const SExpression& root = getFile("circuit/circuit.lp");
 
   // Load net classes.
   foreach (const SExpression* node, root.getChildren("netclass")) {
@@ -328,22 +450,21 @@ void ProjectLoader::loadCircuit(Project& p) {
 }
 
 void ProjectLoader::loadSchematics(Project& p) {
+  TimingScope scope("ProjectLoader::loadSchematics");
   qDebug() << "Load schematics...";
-  const QString fp = "schematics/schematics.lp";
-  const SExpression indexRoot = SExpression::parse(
-      p.getDirectory().read(fp), p.getDirectory().getAbsPath(fp));
-  foreach (const SExpression* indexNode, indexRoot.getChildren("schematic")) {
-    loadSchematic(p, indexNode->getChild("@0").getValue());
+  foreach (const QString& filePath, mSchematicFiles) {
+    loadSchematic(p, filePath, getFile(filePath));
   }
   qDebug() << "Successfully loaded" << p.getSchematics().count()
            << "schematics.";
 }
 
-void ProjectLoader::loadSchematic(Project& p, const QString& relativeFilePath) {
+void ProjectLoader::loadSchematic(Project& p, const QString& relativeFilePath,
+                                  const SExpression& root) {
+  TimingScope scope("ProjectLoader::loadSchematic", relativeFilePath);
   const FilePath fp = FilePath::fromRelative(p.getPath(), relativeFilePath);
   std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
       p.getDirectory(), fp.getParentDir().toRelative(p.getPath())));
-  const SExpression root = SExpression::parse(dir->read(fp.getFilename()), fp);
 
   Schematic* schematic =
       new Schematic(p, std::move(dir), fp.getParentDir().getFilename(),
@@ -474,21 +595,20 @@ void ProjectLoader::loadSchematicNetSegment(Schematic& s,
 }
 
 void ProjectLoader::loadBoards(Project& p) {
+  TimingScope scope("ProjectLoader::loadBoards");
   qDebug() << "Load boards...";
-  const QString fp = "boards/boards.lp";
-  const SExpression indexRoot = SExpression::parse(
-      p.getDirectory().read(fp), p.getDirectory().getAbsPath(fp));
-  foreach (const SExpression* node, indexRoot.getChildren("board")) {
-    loadBoard(p, node->getChild("@0").getValue());
+  foreach (const QString& filePath, mBoardFiles) {
+    loadBoard(p, filePath, getFile(filePath));
   }
   qDebug() << "Successfully loaded" << p.getBoards().count() << "boards.";
 }
 
-void ProjectLoader::loadBoard(Project& p, const QString& relativeFilePath) {
+void ProjectLoader::loadBoard(Project& p, const QString& relativeFilePath,
+                              const SExpression& root) {
+  TimingScope scope("ProjectLoader::loadBoard", relativeFilePath);
   const FilePath fp = FilePath::fromRelative(p.getPath(), relativeFilePath);
   std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
       p.getDirectory(), fp.getParentDir().toRelative(p.getPath())));
-  const SExpression root = SExpression::parse(dir->read(fp.getFilename()), fp);
 
   Board* board = new Board(p, std::move(dir), fp.getParentDir().getFilename(),
                            deserialize<Uuid>(root.getChild("@0")),
@@ -530,7 +650,7 @@ void ProjectLoader::loadBoard(Project& p, const QString& relativeFilePath) {
   board->rebuildAllPlanes();
 
   // Load user settings.
-  loadBoardUserSettings(*board);
+  loadBoardUserSettings(*board, relativeFilePath);
 }
 
 void ProjectLoader::loadBoardDeviceInstance(Board& b, const SExpression& node) {
@@ -682,11 +802,11 @@ void ProjectLoader::loadBoardPlane(Board& b, const SExpression& node) {
   b.addPlane(*plane);
 }
 
-void ProjectLoader::loadBoardUserSettings(Board& b) {
+void ProjectLoader::loadBoardUserSettings(Board& b,
+                                          const QString& relativeFilePath) {
   try {
-    const QString fp = "settings.user.lp";
-    const SExpression root = SExpression::parse(
-        b.getDirectory().read(fp), b.getDirectory().getAbsPath(fp));
+    const SExpression& root =
+        getFile(getBoardUserSettingsFilePath(relativeFilePath));
 
     // Layers.
     for (const SExpression* node : root.getChildren("layer")) {
@@ -721,10 +841,11 @@ void ProjectLoader::loadBoardUserSettings(Board& b) {
 }
 
 void ProjectLoader::restoreApprovedErcMessages(Project& p) {
-  const QString fp = "circuit/erc.lp";
-  const SExpression root = SExpression::parse(p.getDirectory().read(fp),
-                                              p.getDirectory().getAbsPath(fp));
+  TimingScope scope("ProjectLoader::restoreApprovedErcMessages");
+  const SExpression& root = getFile("circuit/erc.lp");
 
+  // Make sure all ERC messages are up to date before restoring their state.
+  p.getErcMsgList().processScheduledUpdates();
   foreach (const SExpression* node, root.getChildren("approved")) {
     foreach (ErcMsg* ercMsg, p.getErcMsgList().getItems()) {
       if ((ercMsg->getOwner().getErcMsgOwnerClassName() ==
@@ -737,6 +858,42 @@ void ProjectLoader::restoreApprovedErcMessages(Project& p) {
   }
 }
 
+void ProjectLoader::parseFiles(const QStringList& relativeFilePaths) {
+  TimingScope scope("ProjectLoader::parseFiles");
+  struct File {
+    QString relativePath;
+    FilePath absolutePath;
+    QByteArray content;
+  };
+
+  // The file system is not thread-safe, so read all files in advance.
+  QVector<File> files;
+  foreach (const QString& relativeFilePath, relativeFilePaths) {
+    checkCanceled();
+    files.append(File{relativeFilePath,
+                      mDirectory->getAbsPath(relativeFilePath),
+                      mDirectory->read(relativeFilePath)});
+  }
+
+  // Parsing the files is independent of any project state, so parse them
+  // concurrently. The result is in the same order as the given files, and
+  // exceptions are rethrown in the calling thread.
+  std::function<SExpression(const File&)> parse = [](const File& file) {
+    return SExpression::parse(file.content, file.absolutePath);
+  };
+  const QVector<SExpression> roots =
+      QtConcurrent::blockingMapped<QVector<SExpression>>(files, parse);
+  for (int i = 0; i < files.count(); ++i) {
+    mFiles.insert(files.at(i).relativePath, roots.at(i));
+  }
+}
+
+QString ProjectLoader::getBoardUserSettingsFilePath(
+    const QString& relativeBoardFilePath) noexcept {
+  const int pos = relativeBoardFilePath.lastIndexOf("/");
+  return relativeBoardFilePath.left(pos + 1) % "settings.user.lp";
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
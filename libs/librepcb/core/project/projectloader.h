@@ -24,12 +24,14 @@
  *  Includes
  ******************************************************************************/
 #include "../serialization/fileformatmigration.h"
+#include "../serialization/sexpression.h"
 
 #include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
 #include <memory>
+#include <vector>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -37,10 +39,13 @@
 namespace librepcb {
 
 class Board;
+class Component;
+class Device;
+class Package;
 class Project;
 class ProjectLibrary;
-class SExpression;
 class Schematic;
+class Symbol;
 class TransactionalDirectory;
 
 /*******************************************************************************
@@ -49,6 +54,11 @@ class TransactionalDirectory;
 
 /**
  * @brief Helper to load a ::librepcb::Project from the file system
+ *
+ * Loading is split into two stages: #read() upgrades, reads and parses all
+ * files and may be executed in a worker thread, while #build() creates the
+ * project with all its QObjects and graphics items and thus needs to be
+ * executed in the GUI thread. #open() executes both stages at once.
  */
 class ProjectLoader final : public QObject {
   Q_OBJECT
@@ -63,6 +73,40 @@ public:
   std::unique_ptr<Project> open(
       std::unique_ptr<TransactionalDirectory> directory,
       const QString& filename);
+
+  /**
+   * @brief First stage: Upgrade, read and parse all files of a project
+   *
+   * Does not create any object which depends on the GUI thread, thus it
+   * is safe to call this from a worker thread as long as the file system is
+   * not accessed by other threads in the meantime. Loaded library elements
+   * are moved to the thread of the application object.
+   *
+   * @param directory   Directory of the project.
+   * @param filename    Filename of the *.lpp file within the directory.
+   *
+   * @throw ::librepcb::UserCanceled if #cancel() was called.
+   */
+  void read(std::unique_ptr<TransactionalDirectory> directory,
+            const QString& filename);
+
+  /**
+   * @brief Second stage: Create the project from the data read by #read()
+   *
+   * @note Must be called from the GUI thread.
+   *
+   * @return The loaded project.
+   */
+  std::unique_ptr<Project> build();
+
+  /**
+   * @brief Abort #read() as soon as possible
+   *
+   * This method is thread-safe. Once canceled, the loader cannot be used
+   * to load a project anymore.
+   */
+  void cancel() noexcept;
+
   const tl::optional<QList<FileFormatMigration::Message>>& getUpgradeMessages()
       const noexcept {
     return mUpgradeMessages;
@@ -71,29 +115,68 @@ public:
   // Operator Overloadings
   ProjectLoader& operator=(const ProjectLoader& rhs) = delete;
 
+signals:
+  /**
+   * @brief Reports the currently loaded stage
+   *
+   * @note While #read() is executed in a worker thread, this signal is
+   *       emitted from that thread as well.
+   *
+   * @param percent   Estimated overall progress (0..100).
+   * @param status    Description of the current stage.
+   */
+  void progress(int percent, const QString& status);
+
 private:  // Methods
+  void clear() noexcept;
+  void checkCanceled() const;
+  void readFile(const QString& relativeFilePath);
+  const SExpression& getFile(const QString& relativeFilePath) const;
+  template <typename ElementType>
+  void readLibraryElements(const QString& dirname, const QString& type,
+                           std::vector<std::unique_ptr<ElementType>>& list);
+  QStringList readIndex(const QString& relativeFilePath,
+                        const QString& childName);
   void loadMetadata(Project& p);
   void loadSettings(Project& p);
   void loadLibrary(Project& p);
   template <typename ElementType>
-  void loadLibraryElements(Project& p, const QString& dirname,
-                           const QString& type,
+  void loadLibraryElements(Project& p,
+                           std::vector<std::unique_ptr<ElementType>>& list,
                            void (ProjectLibrary::*addFunction)(ElementType&));
   void loadCircuit(Project& p);
   void loadSchematics(Project& p);
-  void loadSchematic(Project& p, const QString& relativeFilePath);
+  void loadSchematic(Project& p, const QString& relativeFilePath,
+                     const SExpression& root);
   void loadSchematicSymbol(Schematic& s, const SExpression& node);
   void loadSchematicNetSegment(Schematic& s, const SExpression& node);
   void loadBoards(Project& p);
-  void loadBoard(Project& p, const QString& relativeFilePath);
+  void loadBoard(Project& p, const QString& relativeFilePath,
+                 const SExpression& root);
   void loadBoardDeviceInstance(Board& b, const SExpression& node);
   void loadBoardNetSegment(Board& b, const SExpression& node);
   void loadBoardPlane(Board& b, const SExpression& node);
-  void loadBoardUserSettings(Board& b);
+  void loadBoardUserSettings(Board& b, const QString& relativeFilePath);
   void restoreApprovedErcMessages(Project& p);
+  void parseFiles(const QStringList& relativeFilePaths);
+  static QString getBoardUserSettingsFilePath(
+      const QString& relativeBoardFilePath) noexcept;
 
 private:  // Data
   tl::optional<QList<FileFormatMigration::Message>> mUpgradeMessages;
+  QAtomicInt mAbort;
+  QElapsedTimer mTimer;
+
+  // Data read by read(), consumed by build()
+  std::unique_ptr<TransactionalDirectory> mDirectory;
+  QString mFilename;
+  QHash<QString, SExpression> mFiles;  ///< Key: Path relative to project
+  QStringList mSchematicFiles;
+  QStringList mBoardFiles;
+  std::vector<std::unique_ptr<Symbol>> mSymbols;
+  std::vector<std::unique_ptr<Package>> mPackages;
+  std::vector<std::unique_ptr<Component>> mComponents;
+  std::vector<std::unique_ptr<Device>> mDevices;
 };
 
 /*******************************************************************************
@@ -0,0 +1,315 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "projectmemoryreport.h"
+
+#include "../geometry/polygon.h"
+#include "../graphics/graphicsscene.h"
+#include "../library/cmp/component.h"
+#include "../library/dev/device.h"
+#include "../library/pkg/footprint.h"
+#include "../library/pkg/package.h"
+#include "../library/sym/symbol.h"
+#include "board/board.h"
+#include "board/graphicsitems/bgi_plane.h"
+#include "board/items/bi_airwire.h"
+#include "board/items/bi_device.h"
+#include "board/items/bi_footprintpad.h"
+#include "board/items/bi_hole.h"
+#include "board/items/bi_netline.h"
+#include "board/items/bi_netpoint.h"
+#include "board/items/bi_netsegment.h"
+#include "board/items/bi_plane.h"
+#include "board/items/bi_polygon.h"
+#include "board/items/bi_stroketext.h"
+#include "board/items/bi_via.h"
+#include "project.h"
+#include "projectlibrary.h"
+#include "schematic/items/si_netlabel.h"
+#include "schematic/items/si_netline.h"
+#include "schematic/items/si_netpoint.h"
+#include "schematic/items/si_netsegment.h"
+#include "schematic/items/si_polygon.h"
+#include "schematic/items/si_symbol.h"
+#include "schematic/items/si_symbolpin.h"
+#include "schematic/items/si_text.h"
+#include "schematic/schematic.h"
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+static qint64 getPathSize(const Path& path) noexcept {
+  return sizeof(Path) + path.getVertices().count() * qint64(sizeof(Vertex));
+}
+
+template <typename T>
+static qint64 getObjectsSize(const T& objects) noexcept {
+  return objects.count() * qint64(sizeof(**objects.begin()));
+}
+
+template <typename T, typename P, typename... OnEditedArgs>
+static qint64 getObjectsSize(
+    const SerializableObjectList<T, P, OnEditedArgs...>& objects) noexcept {
+  return objects.count() * qint64(sizeof(T));
+}
+
+static qint64 getPolygonsSize(const PolygonList& polygons) noexcept {
+  qint64 size = 0;
+  for (const Polygon& polygon : polygons) {
+    size += sizeof(Polygon) + getPathSize(polygon.getPath());
+  }
+  return size;
+}
+
+static qint64 getElementSize(const Symbol& symbol) noexcept {
+  return sizeof(Symbol) + getObjectsSize(symbol.getPins()) +
+      getPolygonsSize(symbol.getPolygons()) +
+      getObjectsSize(symbol.getCircles()) + getObjectsSize(symbol.getTexts());
+}
+
+static qint64 getElementSize(const Package& package) noexcept {
+  qint64 size = sizeof(Package) + getObjectsSize(package.getPads());
+  for (const Footprint& footprint : package.getFootprints()) {
+    size += sizeof(Footprint) + getObjectsSize(footprint.getPads()) +
+        getPolygonsSize(footprint.getPolygons()) +
+        getObjectsSize(footprint.getCircles()) +
+        getObjectsSize(footprint.getStrokeTexts()) +
+        getObjectsSize(footprint.getHoles());
+  }
+  return size;
+}
+
+static qint64 getElementSize(const Component& component) noexcept {
+  return sizeof(Component) + getObjectsSize(component.getAttributes()) +
+      getObjectsSize(component.getSignals()) +
+      getObjectsSize(component.getSymbolVariants());
+}
+
+static qint64 getElementSize(const Device& device) noexcept {
+  return sizeof(Device) + getObjectsSize(device.getAttributes()) +
+      getObjectsSize(device.getPadSignalMap());
+}
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ProjectMemoryReport::ProjectMemoryReport(const Project& project) noexcept
+  : mEntries() {
+  addLibraryElements(project);
+  addBoards(project);
+  addSchematics(project);
+}
+
+ProjectMemoryReport::~ProjectMemoryReport() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+const ProjectMemoryReport::Entry* ProjectMemoryReport::getEntry(
+    const QString& id) const noexcept {
+  foreach (const Entry& entry, mEntries) {
+    if (entry.id == id) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+qint64 ProjectMemoryReport::getTotalBytes() const noexcept {
+  qint64 total = 0;
+  foreach (const Entry& entry, mEntries) {
+    total += std::max(entry.bytes, qint64(0));
+  }
+  return total;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ProjectMemoryReport::addEntry(const QString& id, const QString& name,
+                                   int count, qint64 bytes) noexcept {
+  mEntries.append(Entry{id, name, count, bytes});
+}
+
+QString ProjectMemoryReport::toString() const noexcept {
+  int nameWidth = tr("Total").length();
+  foreach (const Entry& entry, mEntries) {
+    nameWidth = std::max(nameWidth, entry.name.length());
+  }
+  QStringList lines;
+  foreach (const Entry& entry, mEntries) {
+    lines.append(entry.name.leftJustified(nameWidth) %
+                 QString::number(entry.count).rightJustified(10) %
+                 formatBytes(entry.bytes).rightJustified(12));
+  }
+  lines.append(tr("Total").leftJustified(nameWidth + 10) %
+               formatBytes(getTotalBytes()).rightJustified(12));
+  return lines.join("\n");
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QString ProjectMemoryReport::formatBytes(qint64 bytes) noexcept {
+  if (bytes < 0) {
+    return tr("unknown");
+  } else if (bytes >= 1024 * 1024) {
+    return QString::number(bytes / qreal(1024 * 1024), 'f', 1) % " MiB";
+  } else if (bytes >= 1024) {
+    return QString::number(bytes / qreal(1024), 'f', 1) % " KiB";
+  } else {
+    return QString::number(bytes) % " B";
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void ProjectMemoryReport::addLibraryElements(const Project& project) noexcept {
+  const ProjectLibrary& library = project.getLibrary();
+  int count = 0;
+  qint64 bytes = 0;
+  foreach (const Symbol* element, library.getSymbols()) {
+    ++count;
+    bytes += getElementSize(*element);
+  }
+  foreach (const Package* element, library.getPackages()) {
+    ++count;
+    bytes += getElementSize(*element);
+  }
+  foreach (const Component* element, library.getComponents()) {
+    ++count;
+    bytes += getElementSize(*element);
+  }
+  foreach (const Device* element, library.getDevices()) {
+    ++count;
+    bytes += getElementSize(*element);
+  }
+  addEntry("library_elements", tr("Library elements"), count, bytes);
+}
+
+void ProjectMemoryReport::addBoards(const Project& project) noexcept {
+  int itemCount = 0;
+  qint64 itemBytes = 0;
+  int graphicsCount = 0;
+  int fragmentCount = 0;
+  qint64 fragmentBytes = 0;
+  int planeAreaCount = 0;
+  qint64 planeAreaBytes = 0;
+  foreach (const Board* board, project.getBoards()) {
+    foreach (const BI_Device* device, board->getDeviceInstances()) {
+      itemCount += 1 + device->getPads().count() +
+          device->getStrokeTexts().count();
+      itemBytes += sizeof(BI_Device) + getObjectsSize(device->getPads()) +
+          getObjectsSize(device->getStrokeTexts());
+    }
+    foreach (const BI_NetSegment* segment, board->getNetSegments()) {
+      itemCount += 1 + segment->getVias().count() +
+          segment->getNetPoints().count() + segment->getNetLines().count();
+      itemBytes += sizeof(BI_NetSegment) + getObjectsSize(segment->getVias()) +
+          getObjectsSize(segment->getNetPoints()) +
+          getObjectsSize(segment->getNetLines());
+    }
+    foreach (BI_Plane* plane, board->getPlanes()) {
+      ++itemCount;
+      itemBytes += sizeof(BI_Plane) + getPathSize(plane->getOutline());
+      foreach (const Path& fragment, plane->getFragments()) {
+        ++fragmentCount;
+        fragmentBytes += getPathSize(fragment);
+      }
+      ++planeAreaCount;
+      planeAreaBytes += plane->getGraphicsItem().getCachedAreasMemoryUsage();
+    }
+    foreach (const BI_Polygon* polygon, board->getPolygons()) {
+      ++itemCount;
+      itemBytes += sizeof(BI_Polygon) +
+          getPathSize(polygon->getPolygon().getPath());
+    }
+    itemCount += board->getStrokeTexts().count() + board->getHoles().count() +
+        board->getAirWires().count();
+    itemBytes += getObjectsSize(board->getStrokeTexts()) +
+        getObjectsSize(board->getHoles()) +
+        getObjectsSize(board->getAirWires());
+
+    // The shapes of graphics items are not measured since some of them are
+    // computed on demand, which would allocate the memory to be reported.
+    graphicsCount += board->getGraphicsScene().items().count();
+  }
+  addEntry("board_items", tr("Board items"), itemCount, itemBytes);
+  addEntry("board_graphics", tr("Board graphics items"), graphicsCount, -1);
+  addEntry("plane_fragments", tr("Plane fragments"), fragmentCount,
+           fragmentBytes);
+  addEntry("plane_areas", tr("Cached plane areas"), planeAreaCount,
+           planeAreaBytes);
+}
+
+void ProjectMemoryReport::addSchematics(const Project& project) noexcept {
+  int itemCount = 0;
+  qint64 itemBytes = 0;
+  int graphicsCount = 0;
+  foreach (const Schematic* schematic, project.getSchematics()) {
+    foreach (const SI_Symbol* symbol, schematic->getSymbols()) {
+      itemCount += 1 + symbol->getPins().count() + symbol->getTexts().count();
+      itemBytes += sizeof(SI_Symbol) + getObjectsSize(symbol->getPins()) +
+          getObjectsSize(symbol->getTexts());
+    }
+    foreach (const SI_NetSegment* segment, schematic->getNetSegments()) {
+      itemCount += 1 + segment->getNetPoints().count() +
+          segment->getNetLines().count() + segment->getNetLabels().count();
+      itemBytes += sizeof(SI_NetSegment) +
+          getObjectsSize(segment->getNetPoints()) +
+          getObjectsSize(segment->getNetLines()) +
+          getObjectsSize(segment->getNetLabels());
+    }
+    foreach (const SI_Polygon* polygon, schematic->getPolygons()) {
+      ++itemCount;
+      itemBytes += sizeof(SI_Polygon) +
+          getPathSize(polygon->getPolygon().getPath());
+    }
+    itemCount += schematic->getTexts().count();
+    itemBytes += getObjectsSize(schematic->getTexts());
+    graphicsCount += schematic->getGraphicsScene().items().count();
+  }
+  addEntry("schematic_items", tr("Schematic items"), itemCount, itemBytes);
+  addEntry("schematic_graphics", tr("Schematic graphics items"), graphicsCount,
+           -1);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
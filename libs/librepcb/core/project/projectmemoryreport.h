@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef LIBREPCB_CORE_PROJECTMEMORYREPORT_H
+#define LIBREPCB_CORE_PROJECTMEMORYREPORT_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Project;
+
+/*******************************************************************************
+ *  Class ProjectMemoryReport
+ ******************************************************************************/
+
+/**
+ * @brief Estimates the memory used by the subsystems of an opened project
+ *
+ * The sizes are rough estimates based on object sizes and the amount of
+ * contained geometry. They are intended to find out where the memory goes
+ * (e.g. whether compacting hidden boards is worth it), not for exact
+ * accounting. Creating a report only looks at data which is already in
+ * memory, it neither reads files nor builds any caches. Thus the size of
+ * graphics items is unknown, only their count is reported.
+ */
+class ProjectMemoryReport final {
+  Q_DECLARE_TR_FUNCTIONS(ProjectMemoryReport)
+
+public:
+  // Types
+  struct Entry {
+    QString id;  ///< Stable identifier, e.g. "board_items"
+    QString name;  ///< Name in the user's language
+    int count;  ///< Number of objects
+    qint64 bytes;  ///< Approximate size, or -1 if unknown
+  };
+
+  // Constructors / Destructor
+  ProjectMemoryReport() = delete;
+  ProjectMemoryReport(const ProjectMemoryReport& other) = default;
+  explicit ProjectMemoryReport(const Project& project) noexcept;
+  ~ProjectMemoryReport() noexcept;
+
+  // Getters
+  const QVector<Entry>& getEntries() const noexcept { return mEntries; }
+  const Entry* getEntry(const QString& id) const noexcept;
+  qint64 getTotalBytes() const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Add an entry for a subsystem which is not owned by the project
+   *
+   * For example the undo stack, which belongs to the project editor.
+   *
+   * @param id      Stable identifier.
+   * @param name    Name in the user's language.
+   * @param count   Number of objects.
+   * @param bytes   Approximate size, or -1 if unknown.
+   */
+  void addEntry(const QString& id, const QString& name, int count,
+                qint64 bytes) noexcept;
+
+  /**
+   * @brief Format the report as a table with one line per entry
+   *
+   * @return Multi-line text, including the total size in the last line.
+   */
+  QString toString() const noexcept;
+
+  // Operator Overloadings
+  ProjectMemoryReport& operator=(const ProjectMemoryReport& rhs) = default;
+
+  // Static Methods
+  static QString formatBytes(qint64 bytes) noexcept;
+
+private:  // Methods
+  void addLibraryElements(const Project& project) noexcept;
+  void addBoards(const Project& project) noexcept;
+  void addSchematics(const Project& project) noexcept;
+
+private:  // Data
+  QVector<Entry> mEntries;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -138,9 +138,11 @@ void SI_Text::setSelected(bool selected) noexcept {
  *  Private Methods
  ******************************************************************************/
 
-void SI_Text::schematicOrSymbolAttributesChanged() noexcept {
-  // Attribute changed -> graphics item needs to perform attribute substitution.
-  mGraphicsItem->updateText();
+void SI_Text::schematicOrSymbolAttributesChanged(
+    const QSet<QString>& keys) noexcept {
+  // Attribute changed -> graphics item needs to perform attribute substitution,
+  // but only if the text is using any of the changed attributes.
+  mGraphicsItem->updateText(keys);
 }
 
 void SI_Text::textEdited(const Text& text, Text::Event event) noexcept {
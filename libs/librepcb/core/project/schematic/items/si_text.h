@@ -80,7 +80,7 @@ public:
   SI_Text& operator=(const SI_Text& rhs) = delete;
 
 private:  // Methods
-  void schematicOrSymbolAttributesChanged() noexcept;
+  void schematicOrSymbolAttributesChanged(const QSet<QString>& keys) noexcept;
   void textEdited(const Text& text, Text::Event event) noexcept;
 
 private:  // Attributes
@@ -106,7 +106,7 @@ bool Schematic::isEmpty() const noexcept {
 
 void Schematic::setName(const ElementName& name) noexcept {
   mName = name;
-  emit mProject.attributesChanged();
+  emit mProject.attributesChanged({"SHEET"});
 }
 
 /*******************************************************************************
@@ -114,7 +114,7 @@ void Schematic::setName(const ElementName& name) noexcept {
  ******************************************************************************/
 
 void Schematic::addSymbol(SI_Symbol& symbol) {
-  if ((!mIsAddedToProject) || (mSymbols.values().contains(&symbol)) ||
+  if ((!mIsAddedToProject) || (mSymbols.value(symbol.getUuid()) == &symbol) ||
       (&symbol.getSchematic() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -143,7 +143,8 @@ void Schematic::removeSymbol(SI_Symbol& symbol) {
  ******************************************************************************/
 
 void Schematic::addNetSegment(SI_NetSegment& netsegment) {
-  if ((!mIsAddedToProject) || (mNetSegments.values().contains(&netsegment)) ||
+  if ((!mIsAddedToProject) ||
+      (mNetSegments.value(netsegment.getUuid()) == &netsegment) ||
       (&netsegment.getSchematic() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -171,7 +172,8 @@ void Schematic::removeNetSegment(SI_NetSegment& netsegment) {
  ******************************************************************************/
 
 void Schematic::addPolygon(SI_Polygon& polygon) {
-  if ((!mIsAddedToProject) || (mPolygons.values().contains(&polygon)) ||
+  if ((!mIsAddedToProject) ||
+      (mPolygons.value(polygon.getUuid()) == &polygon) ||
       (&polygon.getSchematic() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -199,7 +201,7 @@ void Schematic::removePolygon(SI_Polygon& polygon) {
  ******************************************************************************/
 
 void Schematic::addText(SI_Text& text) {
-  if ((!mIsAddedToProject) || (mTexts.values().contains(&text)) ||
+  if ((!mIsAddedToProject) || (mTexts.value(text.getUuid()) == &text) ||
       (&text.getSchematic() != this)) {
     throw LogicError(__FILE__, __LINE__);
   }
@@ -377,6 +379,11 @@ std::unique_ptr<SchematicSelectionQuery> Schematic::createSelectionQuery() const
       mSymbols, mNetSegments, mPolygons, mTexts, const_cast<Schematic*>(this)));
 }
 
+void Schematic::compact() noexcept {
+  // Release the scene index, it will be rebuilt by GraphicsView::setScene().
+  mGraphicsScene->setItemIndexMethod(QGraphicsScene::NoIndex);
+}
+
 /*******************************************************************************
  *  Inherited from AttributeProvider
  ******************************************************************************/
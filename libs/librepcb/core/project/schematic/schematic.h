@@ -175,6 +175,15 @@ public:
   std::unique_ptr<SchematicSelectionQuery> createSelectionQuery() const
       noexcept;
 
+  /**
+   * @brief Release memory of caches which can be rebuilt on demand
+   *
+   * Releases the item index of the graphics scene. Intended for schematics
+   * which are currently not displayed, since the index is rebuilt as soon as
+   * the schematic is shown again.
+   */
+  void compact() noexcept;
+
   // Inherited from AttributeProvider
   /// @copydoc ::librepcb::AttributeProvider::getBuiltInAttributeValue()
   QString getBuiltInAttributeValue(const QString& key) const noexcept override;
@@ -192,7 +201,7 @@ signals:
   void symbolRemoved(SI_Symbol& symbol);
 
   /// @copydoc AttributeProvider::attributesChanged()
-  void attributesChanged() override;
+  void attributesChanged(const QSet<QString>& keys) override;
 
 private:
   // General
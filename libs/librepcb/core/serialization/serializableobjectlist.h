@@ -31,6 +31,7 @@
 #include <QtCore>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -57,6 +58,8 @@ namespace librepcb {
  *   `T`).
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by
  *   UUID.
+ * - Constant-time lookup by pointer, UUID and name for large lists (see
+ *   #sIndexThreshold).
  * - Signals to get notified about added, removed and modified elements.
  * - Undo commands ::librepcb::editor::CmdListElementInsert,
  *   ::librepcb::editor::CmdListElementRemove and
@@ -87,6 +90,16 @@ namespace librepcb {
  * same address over the whole lifetime. To still minimize the risk of memory
  * leaks, `std::shared_ptr` is used instead of raw pointers.
  *
+ * @note    For lists with at least #sIndexThreshold elements, lookups are
+ * done with hash indices which are built lazily on the first lookup. Appending
+ * and removing the last element as well as modifying an element (e.g.
+ * renaming it) keep the indices up to date, while inserting or removing
+ * elements in the middle of the list invalidates them.
+ *
+ * @warning Since the indices are built lazily, even const lookups modify the
+ * list internally. So a list must not be accessed from multiple threads at the
+ * same time, not even by const methods only.
+ *
  * @warning Using Qt's `foreach` keyword on a ::librepcb::SerializableObjectList
  * is not recommended because it always creates a deep copy of the list! You
  * should use range based for loops (since C++11) instead.
@@ -215,6 +228,10 @@ public:
 
   // Element Query
   int indexOf(const T* obj) const noexcept {
+    if (count() >= sIndexThreshold) {
+      mPointerIndex.update(mObjects, [](const T& o) { return &o; });
+      return mPointerIndex.hash.value(obj, -1);
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i].get() == obj) {
         return i;
@@ -223,6 +240,10 @@ public:
     return -1;
   }
   int indexOf(const Uuid& key) const noexcept {
+    if (count() >= sIndexThreshold) {
+      mUuidIndex.update(mObjects, [](const T& o) { return o.getUuid(); });
+      return mUuidIndex.hash.value(key, -1);
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i]->getUuid() == key) {
         return i;
@@ -231,6 +252,11 @@ public:
     return -1;
   }
   int indexOf(const QString& name) const noexcept {
+    if (count() >= sIndexThreshold) {
+      mNameIndex.update(mObjects,
+                        [](const T& o) { return nameToString(o.getName()); });
+      return mNameIndex.hash.value(name, -1);
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i]->getName() == name) {
         return i;
@@ -444,11 +470,27 @@ public:
 protected:  // Methods
   void insertElement(int index, const std::shared_ptr<T>& obj) noexcept {
     mObjects.insert(index, obj);
+    if (index == (mObjects.count() - 1)) {
+      // Appending keeps the indices valid, so bulk appends stay linear.
+      mPointerIndex.appendPending();
+      mUuidIndex.appendPending();
+      mNameIndex.appendPending();
+    } else {
+      invalidateIndices();
+    }
     obj->onEdited.attach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementAdded);
   }
   std::shared_ptr<T> takeElement(int index) noexcept {
     std::shared_ptr<T> obj = mObjects.takeAt(index);
+    if (index == mObjects.count()) {
+      // Removing the last element keeps the indices valid.
+      mPointerIndex.removeLast(index);
+      mUuidIndex.removeLast(index);
+      mNameIndex.removeLast(index);
+    } else {
+      invalidateIndices();
+    }
     obj->onEdited.detach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementRemoved);
     return obj;
@@ -456,12 +498,27 @@ protected:  // Methods
   void elementEditedHandler(const T& obj, OnEditedArgs... args) noexcept {
     int index = indexOf(&obj);
     if (contains(index)) {
+      // The UUID or name might have changed. The pointer index stays valid.
+      mUuidIndex.updateElement(index, obj);
+      mNameIndex.updateElement(index, obj);
       onElementEdited.notify(index, at(index), args...);
       onEdited.notify(index, at(index), Event::ElementEdited);
     } else {
       qCritical() << "Received notification from unknown list element!";
     }
   }
+  void invalidateIndices() noexcept {
+    mPointerIndex.invalidate();
+    mUuidIndex.invalidate();
+    mNameIndex.invalidate();
+  }
+  static const QString& nameToString(const QString& name) noexcept {
+    return name;
+  }
+  template <typename N>
+  static const QString& nameToString(const N& name) noexcept {
+    return *name;  // E.g. librepcb::CircuitIdentifier
+  }
   void throwKeyNotFoundException(const Uuid& key) const {
     throw RuntimeError(
         __FILE__, __LINE__,
@@ -481,9 +538,104 @@ protected:  // Methods
             .arg(name));
   }
 
+protected:  // Types
+  /**
+   * @brief A lazily built hash index from keys to element indices
+   *
+   * If the same key exists multiple times, the index of the first element is
+   * stored to be consistent with a linear search.
+   */
+  template <typename K>
+  struct Index {
+    QHash<K, int> hash;
+    QVector<K> keys;  ///< Key of each element, except the pending ones
+    std::function<K(const T&)> keyOf;  ///< Set by the first #update()
+    bool valid = false;
+    int pendingCount = 0;  ///< Appended elements not added to #hash yet
+    int duplicateCount = 0;  ///< Elements with a key already in #hash
+
+    /**
+     * @brief Rebuild the index if invalid, or add pending elements
+     *
+     * Appended elements are only added here since the key getter might not
+     * be available for every type `T`.
+     */
+    template <typename F>
+    void update(const QVector<std::shared_ptr<T>>& objects, F getter) noexcept {
+      if (!keyOf) {
+        keyOf = getter;
+      }
+      if (!valid) {
+        hash.clear();
+        hash.reserve(objects.count());
+        keys.clear();
+        keys.reserve(objects.count());
+        duplicateCount = 0;
+        valid = true;
+        pendingCount = objects.count();
+      }
+      for (int i = objects.count() - pendingCount; i < objects.count(); ++i) {
+        const K key = getter(*objects.at(i));
+        keys.append(key);
+        if (!hash.contains(key)) {
+          hash.insert(key, i);
+        } else {
+          ++duplicateCount;
+        }
+      }
+      pendingCount = 0;
+    }
+    void updateElement(int index, const T& obj) noexcept {
+      if ((!valid) || (index >= keys.count())) {
+        return;  // Nothing to update, or key not determined yet.
+      }
+      const K key = keyOf(obj);
+      const K oldKey = keys.at(index);
+      if (key == oldKey) {
+        return;  // Most modifications don't change the key.
+      }
+      if ((duplicateCount > 0) || hash.contains(key)) {
+        invalidate();  // Rare, thus no need to handle it efficiently.
+        return;
+      }
+      hash.remove(oldKey);
+      hash.insert(key, index);
+      keys[index] = key;
+    }
+    void invalidate() noexcept {
+      valid = false;
+      pendingCount = 0;
+    }
+    void appendPending() noexcept {
+      if (valid) {
+        ++pendingCount;
+      }
+    }
+    void removeLast(int index) noexcept {
+      if (!valid) {
+        return;
+      } else if (pendingCount > 0) {
+        --pendingCount;
+      } else {
+        const K key = keys.takeLast();
+        if (hash.value(key, -1) == index) {
+          hash.remove(key);
+        } else {
+          --duplicateCount;
+        }
+      }
+    }
+  };
+
+  // Static Variables
+  static constexpr int sIndexThreshold = 32;  ///< Min. count to use indices
+
 protected:  // Data
   QVector<std::shared_ptr<T>> mObjects;
   Slot<T, OnEditedArgs...> mOnEditedSlot;
+  mutable Index<const T*> mPointerIndex;
+  mutable Index<Uuid> mUuidIndex;
+  mutable Index<QString> mNameIndex;
 };
 
 }  // namespace librepcb
@@ -23,6 +23,7 @@
 #include "sexpression.h"
 
 #include "../exceptions.h"
+#include "../utils/timingrecorder.h"
 
 #include <QtCore>
 
@@ -270,7 +271,7 @@ bool SExpression::isValidToken(const QString& token) noexcept {
 }
 
 bool SExpression::isValidTokenChar(const QChar& c) noexcept {
-  static QSet<QChar> allowedSpecialChars = {'\\', '.', ':', '_', '-'};
+  static const QSet<QChar> allowedSpecialChars = {'\\', '.', ':', '_', '-'};
   return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) ||
       ((c >= '0') && (c <= '9')) || allowedSpecialChars.contains(c);
 }
@@ -338,6 +339,7 @@ SExpression SExpression::createLineBreak() {
 
 SExpression SExpression::parse(const QByteArray& content,
                                const FilePath& filePath) {
+  TimingScope scope("SExpression::parse");
   int index = 0;
   QString contentStr = QString::fromUtf8(content);
   skipWhitespaceAndComments(contentStr, index, true);  // Skip newlines as well.
@@ -450,7 +452,7 @@ QString SExpression::parseString(const QString& content, int& index,
   // strings. This library escaped more characters than we do now. To still
   // support reading the file format 0.1, we have to keep support for the
   // old escaping behavior.
-  static QHash<QChar, QChar> escapedChars = {
+  static const QHash<QChar, QChar> escapedChars = {
       {'\'', '\''},  // Single quote
       {'"', '"'},  // Double quote
       {'?', '\?'},  // Question mark
@@ -474,7 +476,7 @@ QString SExpression::parseString(const QString& content, int& index,
     const QChar& c = content.at(index);
     if (escaped) {
       if (escapedChars.contains(c)) {
-        string += escapedChars[c];
+        string += escapedChars.value(c);
         ++index;
         escaped = false;
       } else {
@@ -498,7 +500,7 @@ QString SExpression::parseString(const QString& content, int& index,
 
 void SExpression::skipWhitespaceAndComments(const QString& content, int& index,
                                             bool skipNewline) {
-  static QSet<QChar> spaces = {' ', '\f', '\r', '\t', '\v'};
+  static const QSet<QChar> spaces = {' ', '\f', '\r', '\t', '\v'};
 
   bool isComment = false;
   while (index < content.length()) {
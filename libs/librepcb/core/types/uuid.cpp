@@ -25,7 +25,6 @@
 #include "../exceptions.h"
 #include "../serialization/sexpression.h"
 
-#include <QRegularExpressionValidator>
 #include <QtCore>
 
 /*******************************************************************************
@@ -38,69 +37,17 @@ namespace librepcb {
  ******************************************************************************/
 
 bool Uuid::isValid(const QString& str) noexcept {
-  // Note: This used to be done using a RegEx, but when profiling and
-  // optimizing the library rescan code we found that a manually unrolled
-  // comparison loop performs much better than the previous RegEx.
-  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
-  if (str.length() != 36) return false;
-
-  // Helper function
-  auto isLowerHex = [](const QChar& chr) {
-    return (chr >= QChar('0') && chr <= QChar('9')) ||
-        (chr >= QChar('a') && chr <= QChar('f'));
-  };
-
-  if (!isLowerHex(str[0])) return false;
-  if (!isLowerHex(str[1])) return false;
-  if (!isLowerHex(str[2])) return false;
-  if (!isLowerHex(str[3])) return false;
-  if (!isLowerHex(str[4])) return false;
-  if (!isLowerHex(str[5])) return false;
-  if (!isLowerHex(str[6])) return false;
-  if (!isLowerHex(str[7])) return false;
-  if (str[8] != QChar('-')) return false;
-  if (!isLowerHex(str[9])) return false;
-  if (!isLowerHex(str[10])) return false;
-  if (!isLowerHex(str[11])) return false;
-  if (!isLowerHex(str[12])) return false;
-  if (str[13] != QChar('-')) return false;
-  if (!isLowerHex(str[14])) return false;
-  if (!isLowerHex(str[15])) return false;
-  if (!isLowerHex(str[16])) return false;
-  if (!isLowerHex(str[17])) return false;
-  if (str[18] != QChar('-')) return false;
-  if (!isLowerHex(str[19])) return false;
-  if (!isLowerHex(str[20])) return false;
-  if (!isLowerHex(str[21])) return false;
-  if (!isLowerHex(str[22])) return false;
-  if (str[23] != QChar('-')) return false;
-  if (!isLowerHex(str[24])) return false;
-  if (!isLowerHex(str[25])) return false;
-  if (!isLowerHex(str[26])) return false;
-  if (!isLowerHex(str[27])) return false;
-  if (!isLowerHex(str[28])) return false;
-  if (!isLowerHex(str[29])) return false;
-  if (!isLowerHex(str[30])) return false;
-  if (!isLowerHex(str[31])) return false;
-  if (!isLowerHex(str[32])) return false;
-  if (!isLowerHex(str[33])) return false;
-  if (!isLowerHex(str[34])) return false;
-  if (!isLowerHex(str[35])) return false;
-
-  // check type of uuid
-  QUuid quuid(str);
-  if (quuid.isNull()) return false;
-  if (quuid.variant() != QUuid::DCE) return false;
-  if (quuid.version() != QUuid::Random) return false;
-
-  return true;
+  return parse(str).has_value();
 }
 
 Uuid Uuid::createRandom() noexcept {
-  QString str =
-      QUuid::createUuid().toString().remove("{").remove("}").toLower();
-  if (isValid(str)) {
-    return Uuid(str);
+  const QByteArray bytes = QUuid::createUuid().toRfc4122();
+  Data data;
+  if ((bytes.size() == static_cast<int>(data.size())) &&
+      ((static_cast<quint8>(bytes.at(6)) >> 4) == 4) &&  // version: random
+      ((static_cast<quint8>(bytes.at(8)) & 0xC0) == 0x80)) {  // variant: DCE
+    std::memcpy(data.data(), bytes.constData(), data.size());
+    return Uuid(data);
   } else {
     // Calls abort()!
     qFatal("Not able to generate valid random UUID, terminating application!");
@@ -108,8 +55,8 @@ Uuid Uuid::createRandom() noexcept {
 }
 
 Uuid Uuid::fromString(const QString& str) {
-  if (isValid(str)) {
-    return Uuid(str);
+  if (tl::optional<Data> data = parse(str)) {
+    return Uuid(*data);
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        tr("String is not a valid UUID: \"%1\"").arg(str));
@@ -117,13 +64,75 @@ Uuid Uuid::fromString(const QString& str) {
 }
 
 tl::optional<Uuid> Uuid::tryFromString(const QString& str) noexcept {
-  if (isValid(str)) {
-    return Uuid(str);
+  if (tl::optional<Data> data = parse(str)) {
+    return Uuid(*data);
   } else {
     return tl::nullopt;
   }
 }
 
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QString Uuid::toStr() const noexcept {
+  static const char hex[] = "0123456789abcdef";
+  QString str(36, QChar('-'));
+  QChar* out = str.data();
+  for (std::size_t i = 0; i < mData.size(); ++i) {
+    if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+      ++out;  // Skip the '-' separator.
+    }
+    *out++ = QLatin1Char(hex[mData[i] >> 4]);
+    *out++ = QLatin1Char(hex[mData[i] & 0x0F]);
+  }
+  return str;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+tl::optional<Uuid::Data> Uuid::parse(const QString& str) noexcept {
+  // Note: This used to be done using a RegEx, but when profiling and
+  // optimizing the library rescan code we found that a manually unrolled
+  // comparison loop performs much better than the previous RegEx.
+  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
+  // Now the string is decoded directly into the raw bytes while checking the
+  // format, so no intermediate QUuid is needed anymore.
+  if (str.length() != 36) return tl::nullopt;
+
+  // Helper function, returns -1 if the character is not a lowercase hex digit
+  auto lowerHexValue = [](const QChar& chr) {
+    const ushort c = chr.unicode();
+    if ((c >= '0') && (c <= '9')) {
+      return static_cast<int>(c - '0');
+    } else if ((c >= 'a') && (c <= 'f')) {
+      return static_cast<int>(c - 'a' + 10);
+    } else {
+      return -1;
+    }
+  };
+
+  Data data;
+  const QChar* in = str.constData();
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    if ((i == 4) || (i == 6) || (i == 8) || (i == 10)) {
+      if (*in++ != QChar('-')) return tl::nullopt;
+    }
+    const int high = lowerHexValue(*in++);
+    const int low = lowerHexValue(*in++);
+    if ((high < 0) || (low < 0)) return tl::nullopt;
+    data[i] = static_cast<quint8>((high << 4) | low);
+  }
+
+  // check type of uuid
+  if ((data[6] >> 4) != 4) return tl::nullopt;  // version: random
+  if ((data[8] & 0xC0) != 0x80) return tl::nullopt;  // variant: DCE
+
+  return data;
+}
+
 /*******************************************************************************
  *  Non-Member Functions
  ******************************************************************************/
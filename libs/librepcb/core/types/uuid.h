@@ -27,6 +27,9 @@
 
 #include <optional.hpp>
 
+#include <array>
+#include <cstring>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -50,6 +53,13 @@ namespace librepcb {
  * can be created (in opposite to QUuid which allows "Null UUIDs")! If you need
  * a nullable UUID, use tl::optional<librepcb::Uuid> instead.
  *
+ * @note Internally the UUID is stored as its 16 raw bytes (in RFC4122 byte
+ * order) instead of a string, since UUIDs are used as keys in many hot maps
+ * and hashes. Strings are only parsed/formatted at (de)serialization
+ * boundaries, i.e. in #fromString() and #toStr(). The ordering of the raw
+ * bytes is identical to the ordering of the lowercase string representation,
+ * so sorting by UUID gives the same result as before.
+ *
  * @see https://de.wikipedia.org/wiki/Universally_Unique_Identifier
  * @see https://tools.ietf.org/html/rfc4122
  */
@@ -69,7 +79,7 @@ public:
    *
    * @param other     Another ::librepcb::Uuid object
    */
-  Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+  Uuid(const Uuid& other) noexcept : mData(other.mData) {}
 
   /**
    * @brief Destructor
@@ -83,7 +93,14 @@ public:
    *
    * @return The UUID as a string
    */
-  QString toStr() const noexcept { return mUuid; }
+  QString toStr() const noexcept;
+
+  /**
+   * @brief Get the raw bytes of the UUID
+   *
+   * @return The 16 bytes of the UUID in RFC4122 (big endian) byte order
+   */
+  const std::array<quint8, 16>& getBytes() const noexcept { return mData; }
 
   //@{
   /**
@@ -91,18 +108,19 @@ public:
    *
    * @param rhs   The other object to compare
    *
-   * @return Result of comparing the UUIDs as strings
+   * @return Result of comparing the UUIDs (same result as comparing them as
+   *         strings)
    */
   Uuid& operator=(const Uuid& rhs) noexcept {
-    mUuid = rhs.mUuid;
+    mData = rhs.mData;
     return *this;
   }
-  bool operator==(const Uuid& rhs) const noexcept { return mUuid == rhs.mUuid; }
-  bool operator!=(const Uuid& rhs) const noexcept { return mUuid != rhs.mUuid; }
-  bool operator<(const Uuid& rhs) const noexcept { return mUuid < rhs.mUuid; }
-  bool operator>(const Uuid& rhs) const noexcept { return mUuid > rhs.mUuid; }
-  bool operator<=(const Uuid& rhs) const noexcept { return mUuid <= rhs.mUuid; }
-  bool operator>=(const Uuid& rhs) const noexcept { return mUuid >= rhs.mUuid; }
+  bool operator==(const Uuid& rhs) const noexcept { return compare(rhs) == 0; }
+  bool operator!=(const Uuid& rhs) const noexcept { return compare(rhs) != 0; }
+  bool operator<(const Uuid& rhs) const noexcept { return compare(rhs) < 0; }
+  bool operator>(const Uuid& rhs) const noexcept { return compare(rhs) > 0; }
+  bool operator<=(const Uuid& rhs) const noexcept { return compare(rhs) <= 0; }
+  bool operator>=(const Uuid& rhs) const noexcept { return compare(rhs) >= 0; }
   //@}
 
   // Static Methods
@@ -146,16 +164,40 @@ public:
    */
   static tl::optional<Uuid> tryFromString(const QString& str) noexcept;
 
+private:  // Types
+  typedef std::array<quint8, 16> Data;
+
 private:  // Methods
   /**
-   * @brief Constructor which creates a Uuid object from a string
+   * @brief Constructor which creates a Uuid object from raw bytes
+   *
+   * @param data      The 16 bytes of a valid UUID
+   */
+  explicit Uuid(const Data& data) noexcept : mData(data) {}
+
+  /**
+   * @brief Compare the raw bytes with another UUID
+   *
+   * @param rhs       The other UUID
+   *
+   * @return <0, 0 or >0, like std::memcmp()
+   */
+  int compare(const Uuid& rhs) const noexcept {
+    return std::memcmp(mData.data(), rhs.mData.data(), mData.size());
+  }
+
+  /**
+   * @brief Parse a string into raw bytes
+   *
+   * @param str       The string to parse
    *
-   * @param str       The uuid as a string (lowercase and without braces)
+   * @retval Data         The parsed bytes if str contains a valid UUID
+   * @retval tl::nullopt  If str is not a valid UUID
    */
-  explicit Uuid(const QString& str) noexcept : mUuid(str) {}
+  static tl::optional<Data> parse(const QString& str) noexcept;
 
 private:  // Data
-  QString mUuid;  ///< Guaranteed to always contain a valid UUID
+  Data mData;  ///< Guaranteed to always contain a valid UUID
 };
 
 /*******************************************************************************
@@ -173,14 +215,19 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid) noexcept {
 }
 
 inline uint qHash(const Uuid& key, uint seed) noexcept {
-  return ::qHash(key.toStr(), seed);
+  // Version 4 UUIDs are mostly random, so simply folding the two halves
+  // together gives a well distributed hash without touching any string.
+  quint64 high, low;
+  std::memcpy(&high, key.getBytes().data(), sizeof(high));
+  std::memcpy(&low, key.getBytes().data() + sizeof(high), sizeof(low));
+  return ::qHash(high ^ low, seed);
 }
 
 }  // namespace librepcb
 
 namespace tl {
 inline uint qHash(const optional<librepcb::Uuid>& key, uint seed) noexcept {
-  return ::qHash(key ? key->toStr() : QString(), seed);
+  return key ? librepcb::qHash(*key, seed) : ::qHash(QString(), seed);
 }
 }  // namespace tl
 
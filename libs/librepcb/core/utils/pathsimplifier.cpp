@@ -0,0 +1,285 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "pathsimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+// Minimum number of straight segments to be replaced by an arc.
+static const int sMinArcSegments = 3;
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+Path PathSimplifier::simplify(const Path& path,
+                              const UnsignedLength& tolerance) noexcept {
+  const QVector<Vertex>& vertices = path.getVertices();
+  if ((tolerance == 0) || (vertices.count() < 3)) {
+    return path;
+  }
+
+  QVector<Vertex> result;
+  std::vector<int> stack;
+  const int last = vertices.count() - 1;
+  int i = 0;
+  while (i < last) {
+    if (vertices.at(i).getAngle() != 0) {
+      // Keep arc segments as-is.
+      result.append(vertices.at(i));
+      ++i;
+    } else {
+      int end = i + 1;
+      while ((end < last) && (vertices.at(end).getAngle() == 0)) {
+        ++end;
+      }
+      appendStraightRun(vertices, i, end, tolerance->toNm(), stack, result);
+      i = end;
+    }
+  }
+  result.append(vertices.last());
+  return Path(result);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void PathSimplifier::appendStraightRun(const QVector<Vertex>& vertices,
+                                       int begin, int end, qreal tolerance,
+                                       std::vector<int>& stack,
+                                       QVector<Vertex>& result) noexcept {
+  int collinearBegin = begin;
+  int i = begin;
+  while (i + sMinArcSegments <= end) {
+    Angle angle;
+    const int arcEnd = findArcEnd(vertices, i, end, tolerance, angle);
+    if ((arcEnd > i) && (angle != 0)) {
+      appendCollinearRun(vertices, collinearBegin, i, tolerance, stack, result);
+      result.append(Vertex(vertices.at(i).getPos(), angle));
+      collinearBegin = arcEnd;
+      i = arcEnd;
+    } else if (arcEnd > i) {
+      // Almost straight, skip it to avoid searching arcs again and again.
+      i = arcEnd;
+    } else {
+      ++i;
+    }
+  }
+  appendCollinearRun(vertices, collinearBegin, end, tolerance, stack, result);
+}
+
+void PathSimplifier::appendCollinearRun(const QVector<Vertex>& vertices,
+                                        int begin, int end, qreal tolerance,
+                                        std::vector<int>& stack,
+                                        QVector<Vertex>& result) noexcept {
+  if (begin >= end) {
+    return;
+  }
+
+  // Douglas-Peucker with an explicit stack to avoid deep recursion.
+  std::vector<bool> keep(end - begin + 1, false);
+  keep.front() = true;
+  keep.back() = true;
+  stack.clear();
+  stack.push_back(begin);
+  stack.push_back(end);
+  while (!stack.empty()) {
+    const int last = stack.back();
+    stack.pop_back();
+    const int first = stack.back();
+    stack.pop_back();
+    const Point& a = vertices.at(first).getPos();
+    const Point& b = vertices.at(last).getPos();
+    int index = -1;
+    qreal maxDistance = tolerance;
+    for (int i = first + 1; i < last; ++i) {
+      const qreal distance =
+          getDistanceToSegment(vertices.at(i).getPos(), a, b);
+      if (distance > maxDistance) {
+        maxDistance = distance;
+        index = i;
+      }
+    }
+    if (index >= 0) {
+      keep[index - begin] = true;
+      stack.push_back(first);
+      stack.push_back(index);
+      stack.push_back(index);
+      stack.push_back(last);
+    }
+  }
+
+  // The last vertex is the start of the next run, thus not appended here.
+  for (int i = begin; i < end; ++i) {
+    if (keep[i - begin]) {
+      result.append(Vertex(vertices.at(i).getPos(), Angle(0)));
+    }
+  }
+}
+
+int PathSimplifier::findArcEnd(const QVector<Vertex>& vertices, int begin,
+                               int end, qreal tolerance,
+                               Angle& angle) noexcept {
+  int good = begin + sMinArcSegments;
+  qreal sagitta = 0;
+  if (!fitArc(vertices, begin, good, tolerance, angle, sagitta)) {
+    return begin;
+  }
+
+  // Exponential search followed by a binary search, so long arcs don't
+  // lead to quadratic runtime.
+  int bad = -1;
+  int step = sMinArcSegments;
+  while (good < end) {
+    const int candidate = std::min(good + step, end);
+    Angle candidateAngle;
+    qreal candidateSagitta = 0;
+    if (fitArc(vertices, begin, candidate, tolerance, candidateAngle,
+               candidateSagitta)) {
+      good = candidate;
+      angle = candidateAngle;
+      sagitta = candidateSagitta;
+      step *= 2;
+    } else {
+      bad = candidate;
+      break;
+    }
+  }
+  if (bad > 0) {
+    while (bad - good > 1) {
+      const int candidate = (good + bad) / 2;
+      Angle candidateAngle;
+      qreal candidateSagitta = 0;
+      if (fitArc(vertices, begin, candidate, tolerance, candidateAngle,
+                 candidateSagitta)) {
+        good = candidate;
+        angle = candidateAngle;
+        sagitta = candidateSagitta;
+      } else {
+        bad = candidate;
+      }
+    }
+  }
+
+  // Almost straight arcs are left to the collinear simplification.
+  if (sagitta <= tolerance) {
+    angle = Angle(0);
+  }
+  return good;
+}
+
+bool PathSimplifier::fitArc(const QVector<Vertex>& vertices, int begin,
+                            int end, qreal tolerance, Angle& angle,
+                            qreal& sagitta) noexcept {
+  Circle circle;
+  if (!getCircle(vertices.at(begin).getPos(),
+                 vertices.at((begin + end) / 2).getPos(),
+                 vertices.at(end).getPos(), circle)) {
+    return false;
+  }
+
+  // Half of the tolerance is allowed for the deviation of the vertices from
+  // the circle, the other half for the deviation of the segments from the
+  // arc between their vertices.
+  const qreal maxDeviation = tolerance / 2;
+  qreal totalAngle = 0;
+  for (int i = begin; i <= end; ++i) {
+    const Point& p = vertices.at(i).getPos();
+    const qreal dx = p.getX().toNm() - circle.x;
+    const qreal dy = p.getY().toNm() - circle.y;
+    if (std::abs(std::hypot(dx, dy) - circle.radius) > maxDeviation) {
+      return false;
+    }
+    if (i < end) {
+      const Point& next = vertices.at(i + 1).getPos();
+      const qreal nx = next.getX().toNm() - circle.x;
+      const qreal ny = next.getY().toNm() - circle.y;
+      const qreal segmentAngle =
+          std::atan2(dx * ny - dy * nx, dx * nx + dy * ny);
+      if ((segmentAngle == 0) || (segmentAngle * totalAngle < 0)) {
+        return false;  // Change of direction.
+      }
+      totalAngle += segmentAngle;
+      const qreal segmentSagitta =
+          circle.radius * (1 - std::cos(std::abs(segmentAngle) / 2));
+      if (segmentSagitta > maxDeviation) {
+        return false;
+      }
+    }
+  }
+
+  // Only arcs up to 180° are unambiguous.
+  if (std::abs(totalAngle) > M_PI) {
+    return false;
+  }
+  angle = Angle::fromRad(totalAngle);
+  sagitta = circle.radius * (1 - std::cos(std::abs(totalAngle) / 2));
+  return true;
+}
+
+bool PathSimplifier::getCircle(const Point& p1, const Point& p2,
+                               const Point& p3, Circle& circle) noexcept {
+  // Calculate relative to p1 to keep the numbers small.
+  const qreal bx = (p2.getX() - p1.getX()).toNm();
+  const qreal by = (p2.getY() - p1.getY()).toNm();
+  const qreal cx = (p3.getX() - p1.getX()).toNm();
+  const qreal cy = (p3.getY() - p1.getY()).toNm();
+  const qreal d = 2 * (bx * cy - by * cx);
+  if (d == 0) {
+    return false;  // Collinear.
+  }
+  const qreal b2 = bx * bx + by * by;
+  const qreal c2 = cx * cx + cy * cy;
+  const qreal ux = (cy * b2 - by * c2) / d;
+  const qreal uy = (bx * c2 - cx * b2) / d;
+  circle.x = p1.getX().toNm() + ux;
+  circle.y = p1.getY().toNm() + uy;
+  circle.radius = std::hypot(ux, uy);
+  return true;
+}
+
+qreal PathSimplifier::getDistanceToSegment(const Point& p, const Point& a,
+                                           const Point& b) noexcept {
+  const qreal abx = (b.getX() - a.getX()).toNm();
+  const qreal aby = (b.getY() - a.getY()).toNm();
+  const qreal apx = (p.getX() - a.getX()).toNm();
+  const qreal apy = (p.getY() - a.getY()).toNm();
+  const qreal lengthSquared = abx * abx + aby * aby;
+  qreal t = 0;
+  if (lengthSquared > 0) {
+    t = qBound(qreal(0), (apx * abx + apy * aby) / lengthSquared, qreal(1));
+  }
+  return std::hypot(apx - t * abx, apy - t * aby);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_PATHSIMPLIFIER_H
+#define LIBREPCB_CORE_PATHSIMPLIFIER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../geometry/path.h"
+
+#include <QtCore>
+
+#include <vector>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class PathSimplifier
+ ******************************************************************************/
+
+/**
+ * @brief Helper class to reduce the number of vertices of a path
+ *
+ * Intended for imported geometry (e.g. DXF files) where curves are often
+ * approximated by a huge number of tiny straight segments. Only runs of
+ * straight segments are modified, existing arc segments are kept as-is:
+ *
+ *   - Runs of at least three straight segments whose vertices lie on a
+ *     common circle are replaced by a single arc segment (max. 180°).
+ *   - Remaining vertices are removed with the Douglas-Peucker algorithm
+ *     if they are (almost) collinear with their neighbors.
+ *
+ * The first and the last vertex are always kept, so closed paths stay
+ * closed and the endpoints of open paths don't move. The simplified path
+ * deviates from the original path by not more than the given tolerance.
+ */
+class PathSimplifier {
+public:
+  // Constructors / Destructor
+  PathSimplifier() = delete;
+  PathSimplifier(const PathSimplifier& other) = delete;
+  ~PathSimplifier() = delete;
+
+  // General Methods
+
+  /**
+   * @brief Simplify a path
+   *
+   * @param path        The path to simplify.
+   * @param tolerance   Maximum allowed deviation from the original path.
+   *                    If zero, the path is returned unmodified.
+   *
+   * @return The simplified path.
+   */
+  static Path simplify(const Path& path,
+                       const UnsignedLength& tolerance) noexcept;
+
+  // Operator Overloadings
+  PathSimplifier& operator=(const PathSimplifier& rhs) = delete;
+
+private:  // Types
+  struct Circle {
+    qreal x;
+    qreal y;
+    qreal radius;
+  };
+
+private:  // Methods
+  static void appendStraightRun(const QVector<Vertex>& vertices, int begin,
+                                int end, qreal tolerance,
+                                std::vector<int>& stack,
+                                QVector<Vertex>& result) noexcept;
+  static void appendCollinearRun(const QVector<Vertex>& vertices, int begin,
+                                 int end, qreal tolerance,
+                                 std::vector<int>& stack,
+                                 QVector<Vertex>& result) noexcept;
+  static int findArcEnd(const QVector<Vertex>& vertices, int begin, int end,
+                        qreal tolerance, Angle& angle) noexcept;
+  static bool fitArc(const QVector<Vertex>& vertices, int begin, int end,
+                     qreal tolerance, Angle& angle, qreal& sagitta) noexcept;
+  static bool getCircle(const Point& p1, const Point& p2, const Point& p3,
+                        Circle& circle) noexcept;
+  static qreal getDistanceToSegment(const Point& p, const Point& a,
+                                    const Point& b) noexcept;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "tangentpathjoiner.h"
 
+#include <algorithm>
 #include <functional>
 
 /*******************************************************************************
@@ -29,12 +30,16 @@
  ******************************************************************************/
 namespace librepcb {
 
+// Limits of the exhaustive search, per group of connected paths and in total.
+// This avoids exponential runtime for highly ambiguous input like grids.
+static const qint64 sMaxStepsPerSearch = 100000;
+static const qint64 sMaxStepsTotal = 2000000;
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
-QVector<Path> TangentPathJoiner::join(QVector<Path> paths,
-                                      qint64 timeoutMs) noexcept {
+QVector<Path> TangentPathJoiner::join(QVector<Path> paths) noexcept {
   QVector<Path> result;
 
   // Return closed paths as-is and skip invalid paths.
@@ -115,45 +120,76 @@ QVector<Path> TangentPathJoiner::join(QVector<Path> paths,
     }
   }
 
-  // Find all paths and sort by relevance.
-  QVector<Result> found;
-  QElapsedTimer timer;
-  timer.start();
-  findAllPaths(found, paths, timer, timeoutMs);
-  std::sort(found.begin(), found.end(), [](const Result& r1, const Result& r2) {
-    // Prio 1: Closed paths
-    if (r1.isClosed() != r2.isClosed()) {
-      return r1.isClosed();
-    }
-    // Prio 2: Long paths
-    if (r1.length != r2.length) {
-      return r1.length > r2.length;
+  // Build the graph of connected paths and split it into groups of connected
+  // paths, which can be searched independently.
+  Graph g;
+  buildGraph(paths, g);
+  const int nodeCount = static_cast<int>(g.nodeVisits.size());
+  std::vector<int> parents(nodeCount);
+  for (int i = 0; i < nodeCount; ++i) {
+    parents[i] = i;
+  }
+  auto findRoot = [&parents](int node) {
+    while (parents[node] != node) {
+      parents[node] = parents[parents[node]];
+      node = parents[node];
     }
-    // Prio 3: Paths consisting of many joints
-    int c1 = r1.segments.count();
-    int c2 = r2.segments.count();
-    if (c1 != c2) {
-      return c1 > c2;
+    return node;
+  };
+  for (int i = 0; i < paths.count(); ++i) {
+    parents[findRoot(g.edgeStart[i])] = findRoot(g.edgeEnd[i]);
+  }
+  QHash<int, int> groupIndices;
+  std::vector<std::vector<int>> groups;
+  for (int i = 0; i < paths.count(); ++i) {
+    const int root = findRoot(g.edgeStart[i]);
+    auto it = groupIndices.find(root);
+    if (it == groupIndices.end()) {
+      it = groupIndices.insert(root, static_cast<int>(groups.size()));
+      groups.emplace_back();
     }
-    // Prio 4: Lower, non-reversed indices
-    for (int i = 0; i < c1; ++i) {
-      if (r1.segments.at(i).reverse != r2.segments.at(i).reverse) {
-        return r2.segments.at(i).reverse;
+    groups[*it].push_back(i);
+  }
+
+  // Repeatedly take the best trail of each group until all paths are used.
+  std::vector<Trail> found;
+  Trail best, current;
+  std::vector<int> order;
+  for (const std::vector<int>& edges : groups) {
+    // Candidates for greedy trails, the longest paths first.
+    order = edges;
+    std::sort(order.begin(), order.end(), [&g](int a, int b) {
+      if (g.edgeLength[a] != g.edgeLength[b]) {
+        return g.edgeLength[a] > g.edgeLength[b];
+      }
+      return a < b;
+    });
+    std::size_t next = 0;
+    std::size_t remaining = edges.size();
+    while (remaining > 0) {
+      while (g.consumed[order[next]]) {
+        ++next;
       }
-      if (r1.segments.at(i).index != r2.segments.at(i).index) {
-        return r1.segments.at(i).index < r2.segments.at(i).index;
+      buildGreedyTrail(g, order[next], best);
+      if ((remaining > 1) && (g.remainingSteps > 0)) {
+        refineTrail(g, edges, best, current);
       }
+      for (const Segment& segment : best.segments) {
+        g.consumed[segment.index] = true;
+      }
+      remaining -= best.segments.size();
+      found.push_back(best);
     }
-    return false;
-  });
+  }
+  if (g.remainingSteps <= 0) {
+    qWarning() << "Tangent path joining search limit reached, the result "
+                  "might not be optimal.";
+  }
 
-  // Add found paths to result.
-  QSet<int> consumedIndices;
-  foreach (const auto& f, found) {
-    if ((f.indices & consumedIndices).isEmpty()) {
-      result.append(f.buildPath(paths));
-      consumedIndices.unite(f.indices);
-    }
+  // Add found paths to result, sorted by relevance.
+  std::sort(found.begin(), found.end(), &isBetter);
+  for (const Trail& trail : found) {
+    result.append(buildPath(paths, trail));
   }
 
   return result;
@@ -163,50 +199,257 @@ QVector<Path> TangentPathJoiner::join(QVector<Path> paths,
  *  Private Methods
  ******************************************************************************/
 
-void TangentPathJoiner::findAllPaths(QVector<Result>& result,
-                                     const QVector<Path>& paths,
-                                     const QElapsedTimer& timer,
-                                     qint64 timeoutMs,
-                                     const Result& prefix) noexcept {
-  for (int i = 0; i < paths.count(); ++i) {
-    if ((timeoutMs >= 0) && (timer.elapsed() > timeoutMs)) {
-      qWarning() << "Tangent path joining algorithm aborted due to timeout.";
+void TangentPathJoiner::buildGraph(const QVector<Path>& paths,
+                                   Graph& g) noexcept {
+  const int edgeCount = paths.count();
+  g.edgeStart.resize(edgeCount);
+  g.edgeEnd.resize(edgeCount);
+  g.edgeLength.resize(edgeCount);
+  g.consumed.assign(edgeCount, false);
+  g.used.assign(edgeCount, false);
+  g.remainingSteps = sMaxStepsTotal;
+
+  // Assign a node to each distinct endpoint.
+  QHash<Point, int> nodes;
+  nodes.reserve(edgeCount * 2);
+  auto getNode = [&nodes](const Point& pos) {
+    auto it = nodes.find(pos);
+    if (it == nodes.end()) {
+      it = nodes.insert(pos, nodes.count());
+    }
+    return *it;
+  };
+  for (int i = 0; i < edgeCount; ++i) {
+    const Path& path = paths.at(i);
+    g.edgeStart[i] = getNode(path.getVertices().first().getPos());
+    g.edgeEnd[i] = getNode(path.getVertices().last().getPos());
+    g.edgeLength[i] = path.getTotalStraightLength()->toNm();
+  }
+  const int nodeCount = nodes.count();
+  g.nodeVisits.assign(nodeCount, 0);
+
+  // Build the links of each node, stored contiguously.
+  g.linkOffsets.assign(nodeCount + 1, 0);
+  for (int i = 0; i < edgeCount; ++i) {
+    ++g.linkOffsets[g.edgeStart[i] + 1];
+    ++g.linkOffsets[g.edgeEnd[i] + 1];
+  }
+  for (int i = 0; i < nodeCount; ++i) {
+    g.linkOffsets[i + 1] += g.linkOffsets[i];
+  }
+  g.links.resize(edgeCount * 2);
+  std::vector<int> positions(g.linkOffsets.begin(), g.linkOffsets.end() - 1);
+  for (int i = 0; i < edgeCount; ++i) {
+    g.links[positions[g.edgeStart[i]]++] = Link{i, false, g.edgeEnd[i]};
+    g.links[positions[g.edgeEnd[i]]++] = Link{i, true, g.edgeStart[i]};
+  }
+
+  // Try the most promising links first to find good trails early.
+  for (int i = 0; i < nodeCount; ++i) {
+    std::sort(g.links.begin() + g.linkOffsets[i],
+              g.links.begin() + g.linkOffsets[i + 1],
+              [&g](const Link& a, const Link& b) {
+                if (g.edgeLength[a.edge] != g.edgeLength[b.edge]) {
+                  return g.edgeLength[a.edge] > g.edgeLength[b.edge];
+                }
+                if (a.edge != b.edge) {
+                  return a.edge < b.edge;
+                }
+                return (!a.reverse) && b.reverse;
+              });
+  }
+}
+
+void TangentPathJoiner::buildGreedyTrail(Graph& g, int edge,
+                                         Trail& trail) noexcept {
+  trail.segments.clear();
+  trail.startNode = g.edgeStart[edge];
+  trail.endNode = trail.startNode;
+  trail.length = 0;
+  ++g.nodeVisits[trail.startNode];
+  appendSegment(g, trail, edge, false);
+  ++g.nodeVisits[trail.endNode];
+
+  // Extend forward, always with the first unused link.
+  while (!trail.isClosed()) {
+    const Link* next = nullptr;
+    for (int i = g.linkOffsets[trail.endNode];
+         i < g.linkOffsets[trail.endNode + 1]; ++i) {
+      const Link& link = g.links[i];
+      if ((!g.consumed[link.edge]) && (!g.used[link.edge])) {
+        next = &link;
+        break;
+      }
+    }
+    if (!next) {
       break;
     }
-    if (!prefix.indices.contains(i)) {
-      if (tl::optional<Result> r = join(paths, prefix, i, false)) {
-        result.append(*r);
-        if (!r->isClosed()) {
-          findAllPaths(result, paths, timer, timeoutMs, *r);
-        }
+    appendSegment(g, trail, next->edge, next->reverse);
+    ++g.nodeVisits[trail.endNode];
+  }
+
+  // Extend backward the same way, but the new start node must not be
+  // visited already (except for closing the trail) since the exhaustive
+  // search would not find such a trail.
+  g.buffer.clear();
+  int startNode = trail.startNode;
+  while (!trail.isClosed()) {
+    const Link* next = nullptr;
+    for (int i = g.linkOffsets[startNode]; i < g.linkOffsets[startNode + 1];
+         ++i) {
+      const Link& link = g.links[i];
+      const int visits = g.nodeVisits[link.target];
+      const bool closing = (link.target == trail.endNode) && (visits == 1);
+      if ((!g.consumed[link.edge]) && (!g.used[link.edge]) &&
+          ((visits == 0) || closing)) {
+        next = &link;
+        break;
       }
-      if (tl::optional<Result> r = join(paths, prefix, i, true)) {
-        result.append(*r);
-        if (!r->isClosed()) {
-          findAllPaths(result, paths, timer, timeoutMs, *r);
+    }
+    if (!next) {
+      break;
+    }
+    g.buffer.push_back(Segment{next->edge, !next->reverse});
+    g.used[next->edge] = true;
+    startNode = next->target;
+    trail.length += g.edgeLength[next->edge];
+    if (startNode == trail.endNode) {
+      trail.startNode = startNode;  // Closed.
+    }
+    ++g.nodeVisits[startNode];
+  }
+  if (!g.buffer.empty()) {
+    trail.segments.insert(trail.segments.begin(), g.buffer.rbegin(),
+                          g.buffer.rend());
+    trail.startNode = startNode;
+  }
+
+  // Reset the temporary state.
+  g.nodeVisits[trail.startNode] = 0;
+  for (const Segment& segment : trail.segments) {
+    g.used[segment.index] = false;
+    g.nodeVisits[g.edgeStart[segment.index]] = 0;
+    g.nodeVisits[g.edgeEnd[segment.index]] = 0;
+  }
+}
+
+void TangentPathJoiner::refineTrail(Graph& g, const std::vector<int>& edges,
+                                    Trail& best, Trail& current) noexcept {
+  const qint64 maxSteps = std::min(g.remainingSteps, sMaxStepsPerSearch);
+  qint64 steps = 0;
+  for (int edge : edges) {
+    if (g.consumed[edge]) {
+      continue;
+    }
+    for (int reverse = 0; reverse < 2; ++reverse) {
+      // Start a new trail with this path.
+      current.segments.clear();
+      current.startNode = reverse ? g.edgeEnd[edge] : g.edgeStart[edge];
+      current.endNode = current.startNode;
+      current.length = 0;
+      appendSegment(g, current, edge, reverse);
+      if (isBetter(current, best)) {
+        best = current;
+      }
+
+      // Depth-first search of all trails starting with this path. Each stack
+      // frame belongs to the segment with the same index.
+      g.stack.clear();
+      g.stack.push_back(Frame{current.endNode, g.linkOffsets[current.endNode]});
+      while ((!g.stack.empty()) && (steps < maxSteps)) {
+        Frame& frame = g.stack.back();
+        const int end = g.linkOffsets[frame.node + 1];
+        while ((frame.link < end) && (g.consumed[g.links[frame.link].edge] ||
+                                      g.used[g.links[frame.link].edge])) {
+          ++frame.link;
+        }
+        if (frame.link == end) {
+          g.stack.pop_back();
+          removeLastSegment(g, current);
+          continue;
         }
+        const Link& link = g.links[frame.link++];
+        ++steps;
+        appendSegment(g, current, link.edge, link.reverse);
+        if (isBetter(current, best)) {
+          best = current;
+        }
+        if (current.isClosed()) {
+          removeLastSegment(g, current);
+        } else {
+          g.stack.push_back(Frame{link.target, g.linkOffsets[link.target]});
+        }
+      }
+
+      // Clean up if the search was aborted.
+      while (!current.segments.empty()) {
+        removeLastSegment(g, current);
       }
+      ++steps;
+    }
+    if (steps >= maxSteps) {
+      break;
+    }
+  }
+  g.remainingSteps -= steps;
+}
+
+void TangentPathJoiner::appendSegment(Graph& g, Trail& trail, int edge,
+                                      bool reverse) noexcept {
+  trail.segments.push_back(Segment{edge, reverse});
+  trail.endNode = reverse ? g.edgeStart[edge] : g.edgeEnd[edge];
+  trail.length += g.edgeLength[edge];
+  g.used[edge] = true;
+}
+
+void TangentPathJoiner::removeLastSegment(Graph& g, Trail& trail) noexcept {
+  const Segment segment = trail.segments.back();
+  trail.segments.pop_back();
+  trail.endNode = segment.reverse ? g.edgeEnd[segment.index]
+                                  : g.edgeStart[segment.index];
+  trail.length -= g.edgeLength[segment.index];
+  g.used[segment.index] = false;
+}
+
+bool TangentPathJoiner::isBetter(const Trail& a, const Trail& b) noexcept {
+  // Prio 1: Closed paths
+  if (a.isClosed() != b.isClosed()) {
+    return a.isClosed();
+  }
+  // Prio 2: Long paths
+  if (a.length != b.length) {
+    return a.length > b.length;
+  }
+  // Prio 3: Paths consisting of many joints
+  if (a.segments.size() != b.segments.size()) {
+    return a.segments.size() > b.segments.size();
+  }
+  // Prio 4: Lower, non-reversed indices
+  for (std::size_t i = 0; i < a.segments.size(); ++i) {
+    if (a.segments[i].reverse != b.segments[i].reverse) {
+      return b.segments[i].reverse;
+    }
+    if (a.segments[i].index != b.segments[i].index) {
+      return a.segments[i].index < b.segments[i].index;
     }
   }
+  return false;
 }
 
-tl::optional<TangentPathJoiner::Result> TangentPathJoiner::join(
-    const QVector<Path>& paths, const Result& prefix, int index,
-    bool reverse) noexcept {
-  const Path& path = paths.at(index);
-  const Point& start = reverse ? path.getVertices().last().getPos()
-                               : path.getVertices().first().getPos();
-  const Point& end = reverse ? path.getVertices().first().getPos()
-                             : path.getVertices().last().getPos();
-  if (prefix.segments.isEmpty()) {
-    return prefix.sub(index, reverse, start, end,
-                      path.getTotalStraightLength());
-  } else if (start == prefix.endPos) {
-    return prefix.sub(index, reverse, start, end,
-                      path.getTotalStraightLength());
-  } else {
-    return tl::nullopt;
+Path TangentPathJoiner::buildPath(const QVector<Path>& paths,
+                                  const Trail& trail) noexcept {
+  QVector<Vertex> vertices;
+  for (const Segment& segment : trail.segments) {
+    if (!vertices.isEmpty()) {
+      vertices.removeLast();
+    }
+    if (segment.reverse) {
+      vertices.append(paths.at(segment.index).reversed().getVertices());
+    } else {
+      vertices.append(paths.at(segment.index).getVertices());
+    }
   }
+  return Path(vertices);
 }
 
 /*******************************************************************************
@@ -25,10 +25,10 @@
  ******************************************************************************/
 #include "../geometry/path.h"
 
-#include <optional/tl/optional.hpp>
-
 #include <QtCore>
 
+#include <vector>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -49,10 +49,15 @@ namespace librepcb {
  *   - Then joined, open paths are searched, starting with the longest path.
  *   - Any remaining (non tangent) paths are returned as-is.
  *
+ * The path endpoints are indexed in a hash table and only paths connected to
+ * each other are searched together. Within each group of connected paths, a
+ * greedy solution is refined by an exhaustive search.
+ *
  * @note If there are many possible solutions (many paths located at the same
- *       coordinate), finding the solution can take a lot of time. Therefore
- *       a timeout can be specified to abort a too long operation, then a non-
- *       optimal (but still valid) result is returned.
+ *       coordinate), the exhaustive search can take a lot of time. Therefore
+ *       it is limited to a fixed number of search steps, then a non-optimal
+ *       (but still valid) result is returned. As this limit does not depend
+ *       on time, the result is always deterministic.
  */
 class TangentPathJoiner {
   Q_DECLARE_TR_FUNCTIONS(TangentPathJoiner)
@@ -64,67 +69,68 @@ public:
   ~TangentPathJoiner() = delete;
 
   // General Methods
-  static QVector<Path> join(QVector<Path> paths,
-                            qint64 timeoutMs = -1) noexcept;
+  static QVector<Path> join(QVector<Path> paths) noexcept;
 
   // Operator Overloadings
   TangentPathJoiner& operator=(const TangentPathJoiner& rhs) = delete;
 
-private:
+private:  // Types
   struct Segment {
     int index;
     bool reverse;
   };
 
-  struct Result {
-    QVector<Segment> segments;
-    QSet<int> indices;
-    Point startPos;
-    Point endPos;
-    UnsignedLength length;
+  struct Trail {
+    std::vector<Segment> segments;
+    int startNode;
+    int endNode;
+    qint64 length;
 
-    Result() : segments(), indices(), startPos(), endPos(), length(0) {}
+    Trail() : segments(), startNode(-1), endNode(-1), length(0) {}
 
     bool isClosed() const noexcept {
-      return (!segments.isEmpty()) && (startPos == endPos);
+      return (!segments.empty()) && (startNode == endNode);
     }
+  };
 
-    Result sub(int index, bool reverse, const Point& start, const Point& end,
-               const UnsignedLength& l) const {
-      Result r(*this);
-      r.segments.append(Segment{index, reverse});
-      r.indices.insert(index);
-      if (segments.isEmpty()) {
-        r.startPos = start;
-      }
-      r.endPos = end;
-      r.length += l;
-      return r;
-    }
+  /// Entry in the list of paths connected to a node
+  struct Link {
+    int edge;  ///< Index of the path
+    bool reverse;  ///< Whether the path ends at this node
+    int target;  ///< Node at the other end of the path
+  };
 
-    Path buildPath(const QVector<Path>& paths) const {
-      QVector<Vertex> vertices;
-      foreach (const Segment& segment, segments) {
-        if (!vertices.isEmpty()) {
-          vertices.takeLast();
-        }
-        Path p = paths.at(segment.index);
-        if (segment.reverse) {
-          p.reverse();
-        }
-        vertices.append(p.getVertices());
-      }
-      return Path(vertices);
-    }
+  struct Frame {
+    int node;
+    int link;  ///< Index of the next link of the node to try
   };
 
-  static void findAllPaths(QVector<Result>& result, const QVector<Path>& paths,
-                           const QElapsedTimer& timer, qint64 timeoutMs,
-                           const Result& prefix = Result()) noexcept;
+  /// Paths (edges) connected by their endpoints (nodes)
+  struct Graph {
+    std::vector<int> edgeStart;  ///< Node of the first vertex of each path
+    std::vector<int> edgeEnd;  ///< Node of the last vertex of each path
+    std::vector<qint64> edgeLength;
+    std::vector<int> linkOffsets;  ///< Range of #links for each node
+    std::vector<Link> links;
+    std::vector<bool> consumed;  ///< Paths used by already found trails
+    std::vector<bool> used;  ///< Paths used by the currently built trail
+    std::vector<int> nodeVisits;  ///< Only used by #buildGreedyTrail()
+    std::vector<Segment> buffer;  ///< Only used by #buildGreedyTrail()
+    std::vector<Frame> stack;  ///< Only used by #refineTrail()
+    qint64 remainingSteps;
+  };
 
-  static tl::optional<Result> join(const QVector<Path>& paths,
-                                   const Result& prefix, int index,
-                                   bool reverse) noexcept;
+private:  // Methods
+  static void buildGraph(const QVector<Path>& paths, Graph& g) noexcept;
+  static void buildGreedyTrail(Graph& g, int edge, Trail& trail) noexcept;
+  static void refineTrail(Graph& g, const std::vector<int>& edges,
+                          Trail& best, Trail& current) noexcept;
+  static void appendSegment(Graph& g, Trail& trail, int edge,
+                            bool reverse) noexcept;
+  static void removeLastSegment(Graph& g, Trail& trail) noexcept;
+  static bool isBetter(const Trail& a, const Trail& b) noexcept;
+  static Path buildPath(const QVector<Path>& paths,
+                        const Trail& trail) noexcept;
 };
 
 /*******************************************************************************
@@ -0,0 +1,214 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "timingrecorder.h"
+
+#include "../fileio/fileutils.h"
+#include "../fileio/filepath.h"
+
+#include <QtCore>
+
+#include <algorithm>
+
+#if defined(Q_OS_LINUX)
+#include <unistd.h>
+#endif
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+// Nesting level of the currently active scopes of each thread.
+static thread_local int sScopeDepth = 0;
+
+/*******************************************************************************
+ *  Class TimingRecorder
+ ******************************************************************************/
+
+TimingRecorder::TimingRecorder() noexcept : mRecording(0) {
+  mTimer.start();
+}
+
+TimingRecorder::~TimingRecorder() noexcept {
+}
+
+QVector<TimingRecorder::Event> TimingRecorder::getEvents() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mEvents;
+}
+
+void TimingRecorder::start() noexcept {
+  QMutexLocker lock(&mMutex);
+  mEvents.clear();
+  mThreadIndices.clear();
+  mTimer.restart();
+  mRecording.storeRelease(1);
+}
+
+void TimingRecorder::stop() noexcept {
+  mRecording.storeRelease(0);
+}
+
+QByteArray TimingRecorder::toChromeTrace() const noexcept {
+  QJsonArray events;
+  foreach (const Event& event, getEvents()) {
+    QJsonObject args;
+    if (!event.detail.isEmpty()) {
+      args.insert("detail", event.detail);
+    }
+    args.insert("memory_delta_kb", event.memoryDeltaKb);
+    QJsonObject obj;
+    obj.insert("name", event.name);
+    obj.insert("cat", "librepcb");
+    obj.insert("ph", "X");  // Complete event.
+    obj.insert("ts", event.startUs);
+    obj.insert("dur", event.durationUs);
+    obj.insert("pid", 1);
+    obj.insert("tid", event.thread);
+    obj.insert("args", args);
+    events.append(obj);
+  }
+  QJsonObject root;
+  root.insert("traceEvents", events);
+  root.insert("displayTimeUnit", "ms");
+  return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+void TimingRecorder::writeChromeTrace(const FilePath& fp) const {
+  FileUtils::writeFile(fp, toChromeTrace());  // can throw
+}
+
+QString TimingRecorder::toSummary() const noexcept {
+  QVector<Event> events = getEvents();
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event& a, const Event& b) {
+                     if (a.thread != b.thread) {
+                       return a.thread < b.thread;
+                     } else if (a.startUs != b.startUs) {
+                       return a.startUs < b.startUs;
+                     } else {
+                       return a.depth < b.depth;  // Parents first.
+                     }
+                   });
+  QStringList lines;
+  foreach (const Event& event, events) {
+    QString line = QString(event.depth * 2, ' ') % event.name;
+    if (!event.detail.isEmpty()) {
+      line += " (" % event.detail % ")";
+    }
+    line += ": " % QString::number(event.durationUs / qreal(1000), 'f', 1) %
+        " ms";
+    if (event.memoryDeltaKb != 0) {
+      line += QString(", %1%2 kB")
+                  .arg(event.memoryDeltaKb > 0 ? "+" : "")
+                  .arg(event.memoryDeltaKb);
+    }
+    if (event.thread != 0) {
+      line += QString(" [thread %1]").arg(event.thread);
+    }
+    lines.append(line);
+  }
+  return lines.join("\n");
+}
+
+TimingRecorder& TimingRecorder::instance() noexcept {
+  static TimingRecorder recorder;
+  return recorder;
+}
+
+qint64 TimingRecorder::getElapsedUs() const noexcept {
+  QMutexLocker lock(&mMutex);
+  return mTimer.nsecsElapsed() / 1000;
+}
+
+void TimingRecorder::addEvent(Event event) noexcept {
+  QMutexLocker lock(&mMutex);
+  const Qt::HANDLE threadId = QThread::currentThreadId();
+  auto it = mThreadIndices.find(threadId);
+  if (it == mThreadIndices.end()) {
+    it = mThreadIndices.insert(threadId, mThreadIndices.count());
+  }
+  event.thread = *it;
+  mEvents.append(event);
+}
+
+qint64 TimingRecorder::getResidentMemoryKb() noexcept {
+#if defined(Q_OS_LINUX)
+  // The second value is the number of resident pages.
+  QFile file("/proc/self/statm");
+  if (file.open(QIODevice::ReadOnly)) {
+    const QList<QByteArray> values = file.readAll().split(' ');
+    bool ok = false;
+    const qint64 pages = values.value(1).toLongLong(&ok);
+    if (ok) {
+      return (pages * sysconf(_SC_PAGESIZE)) / 1024;
+    }
+  }
+#endif
+  return -1;
+}
+
+/*******************************************************************************
+ *  Class TimingScope
+ ******************************************************************************/
+
+TimingScope::TimingScope(const char* name, const QString& detail) noexcept
+  : mActive(TimingRecorder::instance().isRecording()),
+    mName(name),
+    mDetail(),
+    mStartUs(0),
+    mStartMemoryKb(-1),
+    mDepth(0) {
+  if (mActive) {
+    mDetail = detail;
+    mDepth = sScopeDepth++;
+    mStartMemoryKb = TimingRecorder::getResidentMemoryKb();
+    mStartUs = TimingRecorder::instance().getElapsedUs();
+  }
+}
+
+TimingScope::~TimingScope() noexcept {
+  if (mActive) {
+    TimingRecorder& recorder = TimingRecorder::instance();
+    const qint64 endUs = recorder.getElapsedUs();
+    const qint64 endMemoryKb = TimingRecorder::getResidentMemoryKb();
+    --sScopeDepth;
+    TimingRecorder::Event event;
+    event.name = QString::fromUtf8(mName);
+    event.detail = mDetail;
+    event.startUs = mStartUs;
+    event.durationUs = endUs - mStartUs;
+    event.memoryDeltaKb = ((mStartMemoryKb >= 0) && (endMemoryKb >= 0))
+        ? (endMemoryKb - mStartMemoryKb)
+        : 0;
+    event.thread = 0;
+    event.depth = mDepth;
+    recorder.addEvent(event);
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
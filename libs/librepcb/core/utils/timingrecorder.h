@@ -0,0 +1,184 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_TIMINGRECORDER_H
+#define LIBREPCB_CORE_TIMINGRECORDER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+/*******************************************************************************
+ *  Class TimingRecorder
+ ******************************************************************************/
+
+/**
+ * @brief Records the duration and memory usage of nested operations
+ *
+ * Operations are measured with ::librepcb::TimingScope objects which are
+ * placed at interesting locations like the stages of
+ * ::librepcb::ProjectLoader. As long as the recorder is not started, these
+ * scopes cost only a single atomic load. Once started, every scope adds an
+ * event with its duration, its nesting depth and the change of the resident
+ * memory of the process (only available on Linux) when it is left.
+ *
+ * The recorded events can be exported as Chrome trace JSON (to be viewed in
+ * `chrome://tracing` or https://ui.perfetto.dev/) or as a plain text summary.
+ *
+ * @note This class is thread-safe.
+ */
+class TimingRecorder final {
+public:
+  // Types
+  struct Event {
+    QString name;  ///< Name of the operation
+    QString detail;  ///< Optional details (e.g. file name), may be empty
+    qint64 startUs;  ///< Start time relative to the start of the recording
+    qint64 durationUs;  ///< Duration in microseconds
+    qint64 memoryDeltaKb;  ///< Change of resident memory (0 if unknown)
+    int thread;  ///< Index of the thread, in order of appearance
+    int depth;  ///< Nesting level within the thread (0 = outermost)
+  };
+
+  // Constructors / Destructor
+  TimingRecorder(const TimingRecorder& other) = delete;
+  ~TimingRecorder() noexcept;
+
+  // Getters
+  bool isRecording() const noexcept { return mRecording.loadAcquire() != 0; }
+  QVector<Event> getEvents() const noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Discard all recorded events and start a new recording
+   */
+  void start() noexcept;
+
+  /**
+   * @brief Stop recording (the recorded events are kept)
+   */
+  void stop() noexcept;
+
+  /**
+   * @brief Export the recorded events in the Chrome trace event format
+   *
+   * @return JSON document
+   */
+  QByteArray toChromeTrace() const noexcept;
+
+  /**
+   * @brief Write the recorded events to a Chrome trace JSON file
+   *
+   * @param fp  File to write.
+   *
+   * @throw Exception if writing the file failed.
+   */
+  void writeChromeTrace(const FilePath& fp) const;
+
+  /**
+   * @brief Get a human readable, indented summary of all recorded events
+   *
+   * @return One line per event, ordered by thread and start time.
+   */
+  QString toSummary() const noexcept;
+
+  // Operator Overloadings
+  TimingRecorder& operator=(const TimingRecorder& rhs) = delete;
+
+  // Static Methods
+  static TimingRecorder& instance() noexcept;
+
+  /**
+   * @brief Get the current resident memory of the process
+   *
+   * @return Resident memory in kB, or -1 if not available on this platform.
+   */
+  static qint64 getResidentMemoryKb() noexcept;
+
+private:  // Methods
+  TimingRecorder() noexcept;
+  qint64 getElapsedUs() const noexcept;
+  void addEvent(Event event) noexcept;
+
+private:  // Data
+  QAtomicInt mRecording;
+  QElapsedTimer mTimer;
+  mutable QMutex mMutex;
+  QVector<Event> mEvents;
+  QHash<Qt::HANDLE, int> mThreadIndices;
+
+  friend class TimingScope;
+};
+
+/*******************************************************************************
+ *  Class TimingScope
+ ******************************************************************************/
+
+/**
+ * @brief Measures an operation for ::librepcb::TimingRecorder
+ *
+ * The measured operation starts with the construction of the object and ends
+ * with its destruction. If the recorder is not recording at construction
+ * time, the scope does nothing.
+ *
+ * Example:
+ * @code
+ * void Board::rebuildAllPlanes() noexcept {
+ *   TimingScope scope("Board::rebuildAllPlanes");
+ *   ...
+ * }
+ * @endcode
+ */
+class TimingScope final {
+public:
+  // Constructors / Destructor
+  TimingScope() = delete;
+  TimingScope(const TimingScope& other) = delete;
+  explicit TimingScope(const char* name,
+                       const QString& detail = QString()) noexcept;
+  ~TimingScope() noexcept;
+
+  // Operator Overloadings
+  TimingScope& operator=(const TimingScope& rhs) = delete;
+
+private:  // Data
+  bool mActive;
+  const char* mName;
+  QString mDetail;
+  qint64 mStartUs;
+  qint64 mStartMemoryKb;
+  int mDepth;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
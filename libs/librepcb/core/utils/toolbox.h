@@ -128,6 +128,19 @@ public:
       const QPainterPath& path, const QPen& pen, const QBrush& brush,
       const UnsignedLength& minWidth = UnsignedLength(0)) noexcept;
 
+  /**
+   * @brief Estimate the memory occupied by the elements of a QPainterPath
+   *
+   * @note  This is only a rough estimate, allocation overhead and implicit
+   *        sharing between multiple paths are not taken into account.
+   *
+   * @param path  The path to estimate.
+   * @return Approximate size in bytes.
+   */
+  static qint64 approximateMemoryUsage(const QPainterPath& path) noexcept {
+    return path.elementCount() * qint64(sizeof(QPainterPath::Element));
+  }
+
   static Length arcRadius(const Point& p1, const Point& p2,
                           const Angle& a) noexcept;
   static Point arcCenter(const Point& p1, const Point& p2,
@@ -80,6 +80,10 @@ GraphicsLayerName Transform::map(const GraphicsLayerName& layerName) const
   return GraphicsLayerName(map(*layerName));
 }
 
+GraphicsLayerId Transform::map(const GraphicsLayerId& layer) const noexcept {
+  return mMirrored ? layer.getMirrored() : layer;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -24,7 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../geometry/path.h"
-#include "../graphics/graphicslayername.h"
+#include "../graphics/graphicslayerid.h"
 #include "../types/angle.h"
 #include "../types/point.h"
 
@@ -177,6 +177,15 @@ public:
    */
   GraphicsLayerName map(const GraphicsLayerName& layerName) const noexcept;
 
+  /**
+   * @brief Map a given layer ID to the transformed coordinate system
+   *
+   * @param layer The layer to map.
+   * @return The mirrored layer if it's a symetric layer and the
+   *         transformation is mirroring, otherwise the layer is returned as-is.
+   */
+  GraphicsLayerId map(const GraphicsLayerId& layer) const noexcept;
+
   /**
    * @brief Map all items of a container to the transformed coordinate system
    *
@@ -292,6 +292,57 @@ bool WorkspaceLibraryDb::getTranslations(const QString& elementsTable,
   return elementFound;
 }
 
+QHash<FilePath, QString> WorkspaceLibraryDb::getAllNames(
+    const QString& elementsTable, const QStringList& localeOrder,
+    const FilePath& lib) const {
+  if (lib.isValid() && (elementsTable == "libraries")) {
+    throw LogicError(__FILE__, __LINE__,
+                     "Filtering for libraries makes no sense and doesn't work "
+                     "for libraries!");
+  }
+
+  QString sql =
+      "SELECT %elements.filepath, %elements_tr.locale, %elements_tr.name "
+      "FROM %elements "
+      "LEFT JOIN %elements_tr "
+      "ON %elements.id = %elements_tr.element_id ";
+  if (lib.isValid()) {
+    sql +=
+        "LEFT JOIN libraries ON %elements.library_id = libraries.id "
+        "WHERE libraries.filepath = :filepath";
+  }
+  QSqlQuery query = mDb->prepareQuery(sql, {{"%elements", elementsTable}});
+  if (lib.isValid()) {
+    query.bindValue(":filepath", lib.toRelative(mLibrariesPath));
+  }
+  mDb->exec(query);
+
+  // One row per translation, or a single row with NULL locale if the element
+  // has no translations at all.
+  QHash<QString, LocalizedDescriptionMap> nameMaps;
+  while (query.next()) {
+    const QString filepath = query.value(0).toString();
+    auto it = nameMaps.find(filepath);
+    if (it == nameMaps.end()) {
+      it = nameMaps.insert(filepath, LocalizedDescriptionMap(QString{}));
+    }
+    const QString name = query.value(2).toString();
+    if ((!query.value(1).isNull()) && (!name.isNull())) {
+      it->insert(query.value(1).toString(), name);
+    }
+  }
+
+  QHash<FilePath, QString> names;
+  for (auto it = nameMaps.constBegin(); it != nameMaps.constEnd(); ++it) {
+    FilePath filepath(FilePath::fromRelative(mLibrariesPath, it.key()));
+    if (!filepath.isValid()) {
+      throw LogicError(__FILE__, __LINE__);
+    }
+    names.insert(filepath, it.value().value(localeOrder));
+  }
+  return names;
+}
+
 bool WorkspaceLibraryDb::getMetadata(const QString& elementsTable,
                                      const FilePath elemDir, Uuid* uuid,
                                      Version* version, bool* deprecated) const {
@@ -373,6 +424,123 @@ QSet<Uuid> WorkspaceLibraryDb::getChilds(
   return getUuidSet(query);
 }
 
+QList<WorkspaceLibraryDb::Category> WorkspaceLibraryDb::getCategories(
+    const QString& categoriesTable, const QStringList& localeOrder) const {
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT %categories.filepath, %categories.uuid, %categories.version, "
+      "%categories.parent_uuid, %categories_tr.locale, %categories_tr.name, "
+      "%categories_tr.description "
+      "FROM %categories "
+      "LEFT JOIN %categories_tr "
+      "ON %categories.id = %categories_tr.element_id",
+      {
+          {"%categories", categoriesTable},
+      });
+  mDb->exec(query);
+
+  // One row per translation of each category version. Collect the
+  // translations of all versions, but keep only the highest version of each
+  // category.
+  struct Entry {
+    Uuid uuid;
+    Version version;
+    FilePath filePath;
+    tl::optional<Uuid> parent;
+    LocalizedDescriptionMap names;
+    LocalizedDescriptionMap descriptions;
+  };
+  QHash<QString, std::shared_ptr<Entry>> entries;  // Key: Relative filepath
+  QHash<Uuid, std::shared_ptr<Entry>> latest;
+  while (query.next()) {
+    const QString filepath = query.value(0).toString();
+    std::shared_ptr<Entry> entry = entries.value(filepath);
+    if (!entry) {
+      entry = std::make_shared<Entry>(Entry{
+          Uuid::fromString(query.value(1).toString()),  // can throw
+          Version::fromString(query.value(2).toString()),  // can throw
+          FilePath::fromRelative(mLibrariesPath, filepath),
+          Uuid::tryFromString(query.value(3).toString()),
+          LocalizedDescriptionMap(QString{}),
+          LocalizedDescriptionMap(QString{}),
+      });
+      if (!entry->filePath.isValid()) {
+        throw LogicError(__FILE__, __LINE__);
+      }
+      entries.insert(filepath, entry);
+      std::shared_ptr<Entry> other = latest.value(entry->uuid);
+      if ((!other) || (other->version < entry->version)) {
+        latest.insert(entry->uuid, entry);
+      }
+    }
+    if (!query.value(4).isNull()) {
+      const QString locale = query.value(4).toString();
+      const QString name = query.value(5).toString();
+      const QString description = query.value(6).toString();
+      if (!name.isNull()) {
+        entry->names.insert(locale, name);
+      }
+      if (!description.isNull()) {
+        entry->descriptions.insert(locale, description);
+      }
+    }
+  }
+
+  QList<Category> categories;
+  foreach (const std::shared_ptr<Entry>& entry, latest) {
+    tl::optional<Uuid> parent = entry->parent;
+    if (parent && (!latest.contains(*parent))) {
+      parent = tl::nullopt;
+    }
+    categories.append(Category{entry->uuid, parent, entry->filePath,
+                               entry->names.value(localeOrder),
+                               entry->descriptions.value(localeOrder)});
+  }
+  return categories;
+}
+
+QHash<tl::optional<Uuid>, int> WorkspaceLibraryDb::getElementCountPerCategory(
+    const QString& elementsTable, const QString& categoryTable) const {
+  SQLiteDatabase::Replacements replacements = {
+      {"%elements", elementsTable},
+      {"%categories", categoryTable},
+  };
+  QHash<tl::optional<Uuid>, int> counts;
+
+  // Elements assigned to categories, no matter if the categories exist.
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT %elements_cat.category_uuid, COUNT(DISTINCT %elements.uuid) "
+      "FROM %elements "
+      "INNER JOIN %elements_cat "
+      "ON %elements.id = %elements_cat.element_id "
+      "GROUP BY %elements_cat.category_uuid",
+      replacements);
+  mDb->exec(query);
+  while (query.next()) {
+    if (tl::optional<Uuid> uuid =
+            Uuid::tryFromString(query.value(0).toString())) {
+      counts.insert(uuid, query.value(1).toInt());
+    }
+  }
+
+  // Elements with no (existent) category.
+  query = mDb->prepareQuery(
+      "SELECT COUNT(*) FROM ("
+      "SELECT %elements.uuid FROM %elements "
+      "LEFT JOIN %elements_cat "
+      "ON %elements.id = %elements_cat.element_id "
+      "LEFT JOIN %categories "
+      "ON %elements_cat.category_uuid = %categories.uuid "
+      "GROUP BY %elements.uuid "
+      "HAVING COUNT(%categories.uuid) = 0"
+      ")",
+      replacements);
+  mDb->exec(query);
+  if (query.next() && (query.value(0).toInt() > 0)) {
+    counts.insert(tl::nullopt, query.value(0).toInt());
+  }
+  return counts;
+}
+
 QSet<Uuid> WorkspaceLibraryDb::getByCategory(const QString& elementsTable,
                                              const QString& categoryTable,
                                              const tl::optional<Uuid>& category,
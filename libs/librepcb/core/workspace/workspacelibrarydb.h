@@ -56,6 +56,19 @@ class WorkspaceLibraryDb final : public QObject {
   Q_OBJECT
 
 public:
+  // Types
+
+  /**
+   * @brief A category with its translations, as returned by #getCategories()
+   */
+  struct Category {
+    Uuid uuid;
+    tl::optional<Uuid> parent;  ///< nullopt if the parent does not exist
+    FilePath filePath;  ///< Directory of the highest version
+    QString name;  ///< Name in the requested locale
+    QString description;  ///< Description in the requested locale
+  };
+
   // Constructors / Destructor
   WorkspaceLibraryDb() = delete;
   WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -170,6 +183,29 @@ public:
                            description, keywords);
   }
 
+  /**
+   * @brief Get elements together with their translated names
+   *
+   * Returns the same as calling #getTranslations() for every element
+   * returned by #getAll(), but with a single database query.
+   *
+   * @tparam ElementType  Type of the library element.
+   *
+   * @param localeOrder   Locale order (highest priority first).
+   * @param lib           If valid, only elements from this library are
+   *                      returned.
+   *                      Attention: Must not be used when ElementType is
+   *                      Library!
+   *
+   * @return Filepaths of all elements matching the criteria, with their
+   *         names (empty if the element has no translations).
+   */
+  template <typename ElementType>
+  QHash<FilePath, QString> getAllNames(const QStringList& localeOrder,
+                                       const FilePath& lib = FilePath()) const {
+    return getAllNames(getTable<ElementType>(), localeOrder, lib);
+  }
+
   /**
    * @brief Get metadata of a specific element
    *
@@ -263,6 +299,50 @@ public:
     return getChilds(getTable<ElementType>(), parent);
   }
 
+  /**
+   * @brief Get all categories with their translations
+   *
+   * This allows to build the whole category tree with a single database
+   * query, instead of calling #getChilds(), #getLatest() and
+   * #getTranslations() for every category.
+   *
+   * @tparam ElementType  Type of the category.
+   *
+   * @param localeOrder   Locale order (highest priority first).
+   *
+   * @return  The highest version of every category, in no particular order.
+   *          Categories with an inexistent parent are returned with a
+   *          parent of nullopt, like in #getChilds().
+   */
+  template <typename ElementType>
+  QList<Category> getCategories(const QStringList& localeOrder) const {
+    static_assert(std::is_same<ElementType, ComponentCategory>::value ||
+                      std::is_same<ElementType, PackageCategory>::value,
+                  "Unsupported ElementType");
+    return getCategories(getTable<ElementType>(), localeOrder);
+  }
+
+  /**
+   * @brief Get the number of elements in each category
+   *
+   * @tparam ElementType  Type of the library element.
+   *
+   * @return  Number of distinct element UUIDs per category UUID. Categories
+   *          without elements are not contained. Elements with no category
+   *          at all, or with only inexistent categories, are counted with
+   *          the key nullopt (like in #getByCategory()).
+   */
+  template <typename ElementType>
+  QHash<tl::optional<Uuid>, int> getElementCountPerCategory() const {
+    static_assert(std::is_same<ElementType, Symbol>::value ||
+                      std::is_same<ElementType, Package>::value ||
+                      std::is_same<ElementType, Component>::value ||
+                      std::is_same<ElementType, Device>::value,
+                  "Unsupported ElementType");
+    return getElementCountPerCategory(getTable<ElementType>(),
+                                      getCategoryTable<ElementType>());
+  }
+
   /**
    * @brief Get elements of a specific category
    *
@@ -330,6 +410,9 @@ private:
   bool getTranslations(const QString& elementsTable, const FilePath& elemDir,
                        const QStringList& localeOrder, QString* name,
                        QString* description, QString* keywords) const;
+  QHash<FilePath, QString> getAllNames(const QString& elementsTable,
+                                       const QStringList& localeOrder,
+                                       const FilePath& lib) const;
   bool getMetadata(const QString& elementsTable, const FilePath elemDir,
                    Uuid* uuid, Version* version, bool* deprecated) const;
   bool getCategoryMetadata(const QString& categoriesTable,
@@ -337,6 +420,10 @@ private:
                            tl::optional<Uuid>* parent) const;
   QSet<Uuid> getChilds(const QString& categoriesTable,
                        const tl::optional<Uuid>& categoryUuid) const;
+  QList<Category> getCategories(const QString& categoriesTable,
+                                const QStringList& localeOrder) const;
+  QHash<tl::optional<Uuid>, int> getElementCountPerCategory(
+      const QString& elementsTable, const QString& categoryTable) const;
   QSet<Uuid> getByCategory(const QString& elementsTable,
                            const QString& categoryTable,
                            const tl::optional<Uuid>& category, int limit) const;
@@ -47,7 +47,9 @@ WorkspaceSettings::WorkspaceSettings(QObject* parent)
     applicationLocale("application_locale", "", this),
     defaultLengthUnit("default_length_unit", LengthUnit::millimeters(), this),
     projectAutosaveIntervalSeconds("project_autosave_interval", 600U, this),
+    projectUndoMemoryBudgetMb("project_undo_memory_budget", 256U, this),
     useOpenGl("use_opengl", false, this),
+    useTileCache("use_tile_cache", false, this),
     libraryLocaleOrder("library_locale_order", "locale", QStringList(), this),
     libraryNormOrder("library_norm_order", "norm", QStringList(), this),
     repositoryUrls("repositories", "repository",
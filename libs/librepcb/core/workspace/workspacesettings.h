@@ -169,6 +169,16 @@ public:
    */
   WorkspaceSettingsItem_GenericValue<uint> projectAutosaveIntervalSeconds;
 
+  /**
+   * @brief Memory budget of the undo history of projects [MiB] (0 = unlimited)
+   *
+   * If the undo stack of a project exceeds this (approximate) size, the
+   * oldest undo commands are discarded.
+   *
+   * Default: 256
+   */
+  WorkspaceSettingsItem_GenericValue<uint> projectUndoMemoryBudgetMb;
+
   /**
    * @brief Use OpenGL hardware acceleration
    *
@@ -176,6 +186,16 @@ public:
    */
   WorkspaceSettingsItem_GenericValue<bool> useOpenGl;
 
+  /**
+   * @brief Cache the rendered board in tiles for faster panning
+   *
+   * Speeds up panning of large boards without OpenGL, but needs more memory
+   * and makes repainting changed areas slower.
+   *
+   * Default: False
+   */
+  WorkspaceSettingsItem_GenericValue<bool> useTileCache;
+
   /**
    * @brief Preferred library locales (like "de_CH") in the right order
    *
@@ -34,6 +34,7 @@
 #include <librepcb/core/utils/tangentpathjoiner.h>
 #include <parseagle/library.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -54,12 +55,16 @@ EagleLibraryImport::EagleLibraryImport(const FilePath& dstLibFp,
     mVersion(Version::fromString("0.1")),
     mAuthor("EAGLE Import"),
     mKeywords("eagle,import"),
-    mAbort(false) {
+    mUuidSeed(),
+    mMaxThreadCount(QThread::idealThreadCount()),
+    mAbort(0),
+    mProgressCount(0),
+    mProgressTotal(0) {
 }
 
 EagleLibraryImport::~EagleLibraryImport() noexcept {
   // Deleting a QThread while it is running will lead to a crash.
-  mAbort = true;
+  mAbort.storeRelease(1);
   wait();
 }
 
@@ -214,7 +219,7 @@ QStringList EagleLibraryImport::open(const FilePath& lbr) {
                 return collator(lhs.displayName, rhs.displayName);
               });
 
-    mAbort = false;
+    mAbort.storeRelease(0);
     mLoadedFilePath = lbr;
   } catch (const std::exception& e) {
     qWarning() << "Failed to parse EAGLE library:" << e.what();
@@ -300,14 +305,304 @@ bool EagleLibraryImport::setElementDependent(T& element,
   return false;
 }
 
+template <typename TResult, typename T, typename Func>
+QVector<TResult> EagleLibraryImport::importElements(
+    const QVector<T>& elements, const QByteArray& uuidSeed,
+    const QString& errorMsg, Func func) noexcept {
+  // Each element is only accessed by the thread importing it, so results
+  // and errors are collected without locking. Raw pointers avoid detaching
+  // the vectors from multiple threads.
+  QVector<TResult> results(elements.count());
+  QVector<ElementContext> contexts(elements.count());
+  TResult* resultsData = results.data();
+  ElementContext* contextsData = contexts.data();
+  runConcurrently(elements.count(), [&](int index) {
+    const T& element = elements.at(index);
+    if (element.checkState == Qt::Unchecked) {
+      return;
+    }
+    ElementContext& ctx = contextsData[index];
+    ctx.displayName = element.displayName;
+    ctx.uuidSeed = uuidSeed % "/" % QByteArray::number(index);
+    ctx.uuidCount = 0;
+    try {
+      func(element, ctx, resultsData[index]);
+    } catch (const Exception& e) {
+      raiseImportError(ctx, errorMsg.arg(e.getMsg()));
+    }
+
+    QMutexLocker lock(&mProgressMutex);
+    ++mProgressCount;
+    emit progressStatus(QString("[%1/%2] %3")
+                            .arg(mProgressCount)
+                            .arg(mProgressTotal)
+                            .arg(element.displayName));
+    emit progressPercent((100 * mProgressCount) /
+                         std::max(mProgressTotal, 1));
+  });
+
+  // Report errors in the order of the elements, not in the order of
+  // processing.
+  foreach (const ElementContext& ctx, contexts) {
+    mImportErrors.append(ctx.errors);
+  }
+  return results;
+}
+
+void EagleLibraryImport::runConcurrently(
+    int count, const std::function<void(int)>& func) noexcept {
+  QAtomicInt nextIndex(0);
+  auto worker = [this, count, &nextIndex, &func]() {
+    int index;
+    while ((!mAbort.loadAcquire()) &&
+           ((index = nextIndex.fetchAndAddOrdered(1)) < count)) {
+      func(index);
+    }
+  };
+  QVector<QFuture<void> > futures;
+  for (int i = 1; i < std::min(mMaxThreadCount, count); ++i) {
+    futures.append(QtConcurrent::run(worker));
+  }
+  worker();  // The import thread works as well.
+  foreach (QFuture<void> future, futures) { future.waitForFinished(); }
+}
+
+void EagleLibraryImport::importSymbol(const Symbol& sym, ElementContext& ctx,
+                                      ImportedSymbol& result) {
+  auto uuid = [&ctx]() { return createUuid(ctx); };
+  auto symbol = std::make_shared<librepcb::Symbol>(
+      createUuid(ctx), mVersion, mAuthor,
+      EagleTypeConverter::convertElementName(mNamePrefix + sym.displayName),
+      EagleTypeConverter::convertElementDescription(sym.description),
+      mKeywords);
+  symbol->setCategories(mSymbolCategories);
+  foreach (const auto& obj, convertWires(ctx, sym.symbol->getWires())) {
+    if (obj->getPath().isClosed()) {
+      obj->setIsGrabArea(true);
+    }
+    symbol->getPolygons().append(obj);
+  }
+  foreach (const auto& obj, sym.symbol->getRectangles()) {
+    tryOrRaiseError(ctx, [&]() {
+      symbol->getPolygons().append(
+          EagleTypeConverter::convertRectangle(obj, true, uuid));
+    });
+  }
+  foreach (const auto& obj, sym.symbol->getPolygons()) {
+    tryOrRaiseError(ctx, [&]() {
+      symbol->getPolygons().append(
+          EagleTypeConverter::convertPolygon(obj, true, uuid));
+    });
+  }
+  foreach (const auto& obj, sym.symbol->getCircles()) {
+    tryOrRaiseError(ctx, [&]() {
+      symbol->getCircles().append(
+          EagleTypeConverter::convertCircle(obj, true, uuid));
+    });
+  }
+  foreach (const auto& obj, sym.symbol->getTexts()) {
+    tryOrRaiseError(ctx, [&]() {
+      symbol->getTexts().append(
+          EagleTypeConverter::convertSchematicText(obj, uuid));
+    });
+  }
+  foreach (const auto& obj, sym.symbol->getPins()) {
+    tryOrRaiseError(ctx, [&]() {
+      auto pin = EagleTypeConverter::convertSymbolPin(obj, uuid);
+      symbol->getPins().append(pin);
+      result.pins[obj.getName()] = pin->getUuid();
+    });
+  }
+  TransactionalDirectory dir(TransactionalFileSystem::openRW(
+      mDestinationLibraryFp.getPathTo(librepcb::Symbol::getShortElementName())
+          .getPathTo(symbol->getUuid().toStr())));
+  symbol->saveTo(dir);
+  dir.getFileSystem()->save();
+  result.uuid = symbol->getUuid();
+}
+
+void EagleLibraryImport::importPackage(const Package& pkg, ElementContext& ctx,
+                                       ImportedPackage& result) {
+  auto uuid = [&ctx]() { return createUuid(ctx); };
+  auto package = std::make_shared<librepcb::Package>(
+      createUuid(ctx), mVersion, mAuthor,
+      EagleTypeConverter::convertElementName(mNamePrefix + pkg.displayName),
+      EagleTypeConverter::convertElementDescription(pkg.description),
+      mKeywords);
+  package->setCategories(mPackageCategories);
+  auto footprint = std::make_shared<Footprint>(createUuid(ctx),
+                                               ElementName("default"), "");
+  package->getFootprints().append(footprint);
+  foreach (const auto& obj, convertWires(ctx, pkg.package->getWires())) {
+    footprint->getPolygons().append(obj);
+  }
+  foreach (const auto& obj, pkg.package->getRectangles()) {
+    tryOrRaiseError(ctx, [&]() {
+      footprint->getPolygons().append(
+          EagleTypeConverter::convertRectangle(obj, false, uuid));
+    });
+  }
+  foreach (const auto& obj, pkg.package->getPolygons()) {
+    tryOrRaiseError(ctx, [&]() {
+      footprint->getPolygons().append(
+          EagleTypeConverter::convertPolygon(obj, false, uuid));
+    });
+  }
+  foreach (const auto& obj, pkg.package->getCircles()) {
+    tryOrRaiseError(ctx, [&]() {
+      footprint->getCircles().append(
+          EagleTypeConverter::convertCircle(obj, false, uuid));
+    });
+  }
+  foreach (const auto& obj, pkg.package->getTexts()) {
+    tryOrRaiseError(ctx, [&]() {
+      footprint->getStrokeTexts().append(
+          EagleTypeConverter::convertBoardText(obj, uuid));
+    });
+  }
+  foreach (const auto& obj, pkg.package->getHoles()) {
+    tryOrRaiseError(ctx, [&]() {
+      footprint->getHoles().append(EagleTypeConverter::convertHole(obj, uuid));
+    });
+  }
+  foreach (const auto& obj, pkg.package->getThtPads()) {
+    tryOrRaiseError(ctx, [&]() {
+      auto pair = EagleTypeConverter::convertThtPad(obj, uuid);
+      package->getPads().append(pair.first);
+      footprint->getPads().append(pair.second);
+      result.pads[obj.getName()] = pair.first->getUuid();
+    });
+  }
+  foreach (const auto& obj, pkg.package->getSmtPads()) {
+    tryOrRaiseError(ctx, [&]() {
+      auto pair = EagleTypeConverter::convertSmtPad(obj, uuid);
+      package->getPads().append(pair.first);
+      footprint->getPads().append(pair.second);
+      result.pads[obj.getName()] = pair.first->getUuid();
+    });
+  }
+  TransactionalDirectory dir(TransactionalFileSystem::openRW(
+      mDestinationLibraryFp.getPathTo(librepcb::Package::getShortElementName())
+          .getPathTo(package->getUuid().toStr())));
+  package->saveTo(dir);
+  dir.getFileSystem()->save();
+  result.uuid = package->getUuid();
+}
+
+void EagleLibraryImport::importComponent(const Component& cmp,
+                                         const ImportedElements& imported,
+                                         ElementContext& ctx,
+                                         ImportedComponent& result) {
+  auto component = std::make_shared<librepcb::Component>(
+      createUuid(ctx), mVersion, mAuthor,
+      EagleTypeConverter::convertElementName(mNamePrefix + cmp.displayName),
+      EagleTypeConverter::convertElementDescription(cmp.description),
+      mKeywords);
+  component->setCategories(mComponentCategories);
+  component->setPrefixes(NormDependentPrefixMap(
+      ComponentPrefix(cmp.deviceSet->getPrefix().trimmed())));
+  component->setDefaultValue("{{ PARTNUMBER or DEVICE }}");
+  auto symbolVariant = std::make_shared<ComponentSymbolVariant>(
+      createUuid(ctx), "", ElementName("default"), "");
+  component->getSymbolVariants().append(symbolVariant);
+  QHash<QString, int> pinCount;
+  foreach (const auto& gate, cmp.deviceSet->getGates()) {
+    foreach (const QString& pin,
+             imported.symbols.value(gate.getSymbol()).pins.keys()) {
+      pinCount[pin]++;
+    }
+  }
+  foreach (const auto& gate, cmp.deviceSet->getGates()) {
+    const ImportedSymbol symbol = imported.symbols.value(gate.getSymbol());
+    if (!symbol.uuid) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          tr("Dependent symbol \"%1\" not imported.").arg(gate.getSymbol()));
+    }
+    auto item = std::make_shared<ComponentSymbolVariantItem>(
+        createUuid(ctx), *symbol.uuid,
+        EagleTypeConverter::convertPoint(gate.getPosition()), Angle(0), true,
+        EagleTypeConverter::convertGateName(gate.getName()));
+    symbolVariant->getSymbolItems().append(item);
+    for (auto pinIt = symbol.pins.constBegin(); pinIt != symbol.pins.constEnd();
+         pinIt++) {
+      Uuid signalUuid = createUuid(ctx);
+      QString signalName = pinIt.key();
+      if ((pinCount[signalName] > 1) ||
+          (component->getSignals().contains(signalName))) {
+        // Name conflict -> add prefix to ensure unique signal names.
+        signalName.prepend(*item->getSuffix() % "_");
+      }
+      component->getSignals().append(std::make_shared<ComponentSignal>(
+          signalUuid, EagleTypeConverter::convertPinOrPadName(signalName),
+          SignalRole::passive(), QString(), false, false, false));
+      item->getPinSignalMap().append(
+          std::make_shared<ComponentPinSignalMapItem>(
+              pinIt->value(), signalUuid,
+              CmpSigPinDisplayType::componentSignal()));
+      result.signalMap[gate.getName()][pinIt.key()] = signalUuid;
+    }
+  }
+  TransactionalDirectory dir(TransactionalFileSystem::openRW(
+      mDestinationLibraryFp
+          .getPathTo(librepcb::Component::getShortElementName())
+          .getPathTo(component->getUuid().toStr())));
+  component->saveTo(dir);
+  dir.getFileSystem()->save();
+  result.uuid = component->getUuid();
+}
+
+void EagleLibraryImport::importDevice(const Device& dev,
+                                      const ImportedElements& imported,
+                                      ElementContext& ctx) {
+  const ImportedComponent component =
+      imported.components.value(dev.deviceSet->getName());
+  if (!component.uuid) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Dependent component \"%1\" not imported.")
+                           .arg(dev.componentDisplayName));
+  }
+  const ImportedPackage package =
+      imported.packages.value(dev.device->getPackage());
+  if (!package.uuid) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Dependent package \"%1\" not imported.")
+                           .arg(dev.packageDisplayName));
+  }
+  std::unique_ptr<librepcb::Device> device(new librepcb::Device(
+      createUuid(ctx), mVersion, mAuthor,
+      EagleTypeConverter::convertElementName(mNamePrefix + dev.displayName),
+      EagleTypeConverter::convertElementDescription(dev.description),
+      mKeywords, *component.uuid, *package.uuid));
+  device->setCategories(mDeviceCategories);
+  for (auto padIt = package.pads.constBegin(); padIt != package.pads.constEnd();
+       padIt++) {
+    tl::optional<Uuid> signalUuid;
+    foreach (const auto& connection, dev.device->getConnections()) {
+      if (connection.getPads().contains(padIt.key())) {
+        signalUuid = component.signalMap.value(connection.getGate())
+                         .value(connection.getPin());
+      }
+    }
+    device->getPadSignalMap().append(
+        std::make_shared<DevicePadSignalMapItem>(padIt->value(), signalUuid));
+  }
+  TransactionalDirectory dir(TransactionalFileSystem::openRW(
+      mDestinationLibraryFp.getPathTo(librepcb::Device::getShortElementName())
+          .getPathTo(device->getUuid().toStr())));
+  device->saveTo(dir);
+  dir.getFileSystem()->save();
+}
+
 QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
-    const QString& element, const QList<parseagle::Wire>& wires) {
+    ElementContext& ctx, const QList<parseagle::Wire>& wires) {
   QMap<std::pair<GraphicsLayerName, UnsignedLength>,
        QVector<std::shared_ptr<Polygon> > >
       joinablePolygons;
   foreach (const parseagle::Wire& wire, wires) {
-    tryOrRaiseError(element, [&joinablePolygons, &wire]() {
-      auto polygon = EagleTypeConverter::convertWire(wire);
+    tryOrRaiseError(ctx, [&joinablePolygons, &wire, &ctx]() {
+      auto polygon = EagleTypeConverter::convertWire(
+          wire, [&ctx]() { return createUuid(ctx); });
       auto key =
           std::make_pair(polygon->getLayerName(), polygon->getLineWidth());
       joinablePolygons[key].append(polygon);
@@ -320,9 +615,9 @@ QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
     foreach (const auto& polygon, it.value()) {
       paths.append(polygon->getPath());
     }
-    foreach (const Path& path, TangentPathJoiner::join(paths, 5000)) {
-      std::shared_ptr<Polygon> polygon =
-          std::make_shared<Polygon>(*it.value().first());
+    foreach (const Path& path, TangentPathJoiner::join(paths)) {
+      std::shared_ptr<Polygon> polygon = std::make_shared<Polygon>(
+          createUuid(ctx), *it.value().first());
       polygon->setPath(path);
       polygons.append(polygon);
     }
@@ -330,326 +625,99 @@ QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
   return polygons;
 }
 
-void EagleLibraryImport::tryOrRaiseError(const QString& element,
+void EagleLibraryImport::tryOrRaiseError(ElementContext& ctx,
                                          std::function<void()> func) {
   try {
     func();
   } catch (const Exception& e) {
-    raiseImportError(element, e.getMsg());
+    raiseImportError(ctx, e.getMsg());
   }
 }
 
-void EagleLibraryImport::raiseImportError(const QString& element,
+void EagleLibraryImport::raiseImportError(ElementContext& ctx,
                                           const QString& error) noexcept {
-  QString msg = QString("[%1] ").arg(element) % error;
-  mImportErrors.append(msg);
+  QString msg = QString("[%1] ").arg(ctx.displayName) % error;
+  ctx.errors.append(msg);
   emit errorOccurred(msg);
 }
 
+Uuid EagleLibraryImport::createUuid(ElementContext& ctx) noexcept {
+  // Random-looking version 4 UUID, derived from the seed of the element.
+  QByteArray hex =
+      QCryptographicHash::hash(
+          ctx.uuidSeed % "/" % QByteArray::number(ctx.uuidCount++),
+          QCryptographicHash::Sha256)
+          .toHex();
+  hex[12] = '4';  // Version: random.
+  hex[16] = "89ab"[QByteArray(1, hex.at(16)).toInt(nullptr, 16) & 0x3];
+  return Uuid::fromString(QString("%1-%2-%3-%4-%5")
+                              .arg(QString(hex.mid(0, 8)))
+                              .arg(QString(hex.mid(8, 4)))
+                              .arg(QString(hex.mid(12, 4)))
+                              .arg(QString(hex.mid(16, 4)))
+                              .arg(QString(hex.mid(20, 12))));
+}
+
 void EagleLibraryImport::run() noexcept {
   // Note: This method is called from a different thread, thus be careful with
-  //       calling other methods to only call thread-safe methods!
+  //       calling other methods to only call thread-safe methods! Elements
+  //       are imported concurrently by several threads.
 
   mImportErrors.clear();
-  int totalCount = getCheckedElementsCount();
-  int count = 0;
-
-  QHash<QString, tl::optional<Uuid> > symbolMap;
-  QHash<QString, QHash<QString, tl::optional<Uuid> > > symbolPinMap;
-  foreach (const Symbol& sym, mSymbols) {
-    if (mAbort) {
-      break;
-    }
-    if (sym.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(sym.displayName);
-      auto symbol = std::make_shared<librepcb::Symbol>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + sym.displayName),
-          EagleTypeConverter::convertElementDescription(sym.description),
-          mKeywords);
-      symbol->setCategories(mSymbolCategories);
-      foreach (const auto& obj,
-               convertWires(sym.displayName, sym.symbol->getWires())) {
-        if (obj->getPath().isClosed()) {
-          obj->setIsGrabArea(true);
-        }
-        symbol->getPolygons().append(obj);
-      }
-      foreach (const auto& obj, sym.symbol->getRectangles()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getPolygons().append(
-              EagleTypeConverter::convertRectangle(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getPolygons()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getPolygons().append(
-              EagleTypeConverter::convertPolygon(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getCircles()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getCircles().append(
-              EagleTypeConverter::convertCircle(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getTexts()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getTexts().append(
-              EagleTypeConverter::convertSchematicText(obj));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getPins()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          auto pin = EagleTypeConverter::convertSymbolPin(obj);
-          symbol->getPins().append(pin);
-          symbolPinMap[sym.symbol->getName()][obj.getName()] = pin->getUuid();
-        });
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Symbol::getShortElementName())
-              .getPathTo(symbol->getUuid().toStr())));
-      symbol->saveTo(dir);
-      dir.getFileSystem()->save();
-      symbolMap[sym.symbol->getName()] = symbol->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(sym.displayName,
-                       tr("Skipped symbol due to error: %1").arg(e.getMsg()));
+  mProgressCount = 0;
+  mProgressTotal = getCheckedElementsCount();
+  const QByteArray seed = mUuidSeed.isEmpty()
+      ? Uuid::createRandom().toStr().toUtf8()
+      : mUuidSeed;
+
+  ImportedElements imported;
+  QVector<ImportedSymbol> symbols = importElements<ImportedSymbol>(
+      mSymbols, seed % "/sym", tr("Skipped symbol due to error: %1"),
+      [this](const Symbol& sym, ElementContext& ctx, ImportedSymbol& result) {
+        importSymbol(sym, ctx, result);
+      });
+  for (int i = 0; i < mSymbols.count(); ++i) {
+    if (mSymbols.at(i).checkState != Qt::Unchecked) {
+      imported.symbols.insert(mSymbols.at(i).symbol->getName(), symbols.at(i));
     }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
 
-  QHash<QString, tl::optional<Uuid> > packageMap;
-  QHash<QString, QHash<QString, tl::optional<Uuid> > > packagePadMap;
-  foreach (const Package& pkg, mPackages) {
-    if (mAbort) {
-      break;
-    }
-    if (pkg.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(pkg.displayName);
-      auto package = std::make_shared<librepcb::Package>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + pkg.displayName),
-          EagleTypeConverter::convertElementDescription(pkg.description),
-          mKeywords);
-      package->setCategories(mPackageCategories);
-      auto footprint = std::make_shared<Footprint>(Uuid::createRandom(),
-                                                   ElementName("default"), "");
-      package->getFootprints().append(footprint);
-      foreach (const auto& obj,
-               convertWires(pkg.displayName, pkg.package->getWires())) {
-        footprint->getPolygons().append(obj);
-      }
-      foreach (const auto& obj, pkg.package->getRectangles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getPolygons().append(
-              EagleTypeConverter::convertRectangle(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getPolygons()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getPolygons().append(
-              EagleTypeConverter::convertPolygon(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getCircles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getCircles().append(
-              EagleTypeConverter::convertCircle(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getTexts()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getStrokeTexts().append(
-              EagleTypeConverter::convertBoardText(obj));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getHoles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getHoles().append(EagleTypeConverter::convertHole(obj));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getThtPads()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          auto pair = EagleTypeConverter::convertThtPad(obj);
-          package->getPads().append(pair.first);
-          footprint->getPads().append(pair.second);
-          packagePadMap[pkg.package->getName()][obj.getName()] =
-              pair.first->getUuid();
-        });
-      }
-      foreach (const auto& obj, pkg.package->getSmtPads()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          auto pair = EagleTypeConverter::convertSmtPad(obj);
-          package->getPads().append(pair.first);
-          footprint->getPads().append(pair.second);
-          packagePadMap[pkg.package->getName()][obj.getName()] =
-              pair.first->getUuid();
-        });
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Package::getShortElementName())
-              .getPathTo(package->getUuid().toStr())));
-      package->saveTo(dir);
-      dir.getFileSystem()->save();
-      packageMap[pkg.package->getName()] = package->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(pkg.displayName,
-                       tr("Skipped package due to error: %1").arg(e.getMsg()));
+  QVector<ImportedPackage> packages = importElements<ImportedPackage>(
+      mPackages, seed % "/pkg", tr("Skipped package due to error: %1"),
+      [this](const Package& pkg, ElementContext& ctx,
+             ImportedPackage& result) { importPackage(pkg, ctx, result); });
+  for (int i = 0; i < mPackages.count(); ++i) {
+    if (mPackages.at(i).checkState != Qt::Unchecked) {
+      imported.packages.insert(mPackages.at(i).package->getName(),
+                               packages.at(i));
     }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
 
-  QHash<QString, tl::optional<Uuid> > componentMap;
-  QHash<QString, QHash<QString, QHash<QString, tl::optional<Uuid> > > >
-      componentSignalMap;
-  foreach (const Component& cmp, mComponents) {
-    if (mAbort) {
-      break;
-    }
-    if (cmp.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(cmp.displayName);
-      auto component = std::make_shared<librepcb::Component>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + cmp.displayName),
-          EagleTypeConverter::convertElementDescription(cmp.description),
-          mKeywords);
-      component->setCategories(mComponentCategories);
-      component->setPrefixes(NormDependentPrefixMap(
-          ComponentPrefix(cmp.deviceSet->getPrefix().trimmed())));
-      component->setDefaultValue("{{ PARTNUMBER or DEVICE }}");
-      auto symbolVariant = std::make_shared<ComponentSymbolVariant>(
-          Uuid::createRandom(), "", ElementName("default"), "");
-      component->getSymbolVariants().append(symbolVariant);
-      QHash<QString, int> pinCount;
-      foreach (const auto& gate, cmp.deviceSet->getGates()) {
-        for (auto pinIt = symbolPinMap[gate.getSymbol()].constBegin();
-             pinIt != symbolPinMap[gate.getSymbol()].constEnd(); pinIt++) {
-          pinCount[pinIt.key()]++;
-        }
-      }
-      foreach (const auto& gate, cmp.deviceSet->getGates()) {
-        tl::optional<Uuid> symbolUuid = symbolMap[gate.getSymbol()];
-        if (!symbolUuid) {
-          throw RuntimeError(__FILE__, __LINE__,
-                             tr("Dependent symbol \"%1\" not imported.")
-                                 .arg(gate.getSymbol()));
-        }
-        auto item = std::make_shared<ComponentSymbolVariantItem>(
-            Uuid::createRandom(), *symbolUuid,
-            EagleTypeConverter::convertPoint(gate.getPosition()), Angle(0),
-            true, EagleTypeConverter::convertGateName(gate.getName()));
-        symbolVariant->getSymbolItems().append(item);
-        for (auto pinIt = symbolPinMap[gate.getSymbol()].constBegin();
-             pinIt != symbolPinMap[gate.getSymbol()].constEnd(); pinIt++) {
-          Uuid signalUuid = Uuid::createRandom();
-          QString signalName = pinIt.key();
-          if ((pinCount[signalName] > 1) ||
-              (component->getSignals().contains(signalName))) {
-            // Name conflict -> add prefix to ensure unique signal names.
-            signalName.prepend(*item->getSuffix() % "_");
-          }
-          component->getSignals().append(std::make_shared<ComponentSignal>(
-              signalUuid, EagleTypeConverter::convertPinOrPadName(signalName),
-              SignalRole::passive(), QString(), false, false, false));
-          item->getPinSignalMap().append(
-              std::make_shared<ComponentPinSignalMapItem>(
-                  pinIt->value(), signalUuid,
-                  CmpSigPinDisplayType::componentSignal()));
-          componentSignalMap[cmp.deviceSet->getName()][gate.getName()]
-                            [pinIt.key()] = signalUuid;
-        }
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Component::getShortElementName())
-              .getPathTo(component->getUuid().toStr())));
-      component->saveTo(dir);
-      dir.getFileSystem()->save();
-      componentMap[cmp.deviceSet->getName()] = component->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(
-          cmp.displayName,
-          tr("Skipped component due to error: %1").arg(e.getMsg()));
+  QVector<ImportedComponent> components = importElements<ImportedComponent>(
+      mComponents, seed % "/cmp", tr("Skipped component due to error: %1"),
+      [this, &imported](const Component& cmp, ElementContext& ctx,
+                        ImportedComponent& result) {
+        importComponent(cmp, imported, ctx, result);
+      });
+  for (int i = 0; i < mComponents.count(); ++i) {
+    if (mComponents.at(i).checkState != Qt::Unchecked) {
+      imported.components.insert(mComponents.at(i).deviceSet->getName(),
+                                 components.at(i));
     }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
 
-  foreach (const Device& dev, mDevices) {
-    if (mAbort) {
-      break;
-    }
-    if (dev.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(dev.displayName);
-      tl::optional<Uuid> componentUuid = componentMap[dev.deviceSet->getName()];
-      if (!componentUuid) {
-        throw RuntimeError(__FILE__, __LINE__,
-                           tr("Dependent component \"%1\" not imported.")
-                               .arg(dev.componentDisplayName));
-      }
-      tl::optional<Uuid> packageUuid = packageMap[dev.device->getPackage()];
-      if (!packageUuid) {
-        throw RuntimeError(__FILE__, __LINE__,
-                           tr("Dependent package \"%1\" not imported.")
-                               .arg(dev.packageDisplayName));
-      }
-      std::unique_ptr<librepcb::Device> device(new librepcb::Device(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + dev.displayName),
-          EagleTypeConverter::convertElementDescription(dev.description),
-          mKeywords, *componentUuid, *packageUuid));
-      device->setCategories(mDeviceCategories);
-      for (auto padIt = packagePadMap[dev.device->getPackage()].constBegin();
-           padIt != packagePadMap[dev.device->getPackage()].constEnd();
-           padIt++) {
-        tl::optional<Uuid> signalUuid;
-        foreach (const auto& connection, dev.device->getConnections()) {
-          if (connection.getPads().contains(padIt.key())) {
-            signalUuid =
-                componentSignalMap[dev.deviceSet->getName()]
-                                  [connection.getGate()][connection.getPin()];
-          }
-        }
-        device->getPadSignalMap().append(
-            std::make_shared<DevicePadSignalMapItem>(padIt->value(),
-                                                     signalUuid));
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Device::getShortElementName())
-              .getPathTo(device->getUuid().toStr())));
-      device->saveTo(dir);
-      dir.getFileSystem()->save();
-    } catch (const Exception& e) {
-      raiseImportError(dev.displayName,
-                       tr("Skipped device due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
-  }
+  importElements<bool>(
+      mDevices, seed % "/dev", tr("Skipped device due to error: %1"),
+      [this, &imported](const Device& dev, ElementContext& ctx, bool& result) {
+        importDevice(dev, imported, ctx);
+        result = true;
+      });
 
   emit progressPercent(100);
   emit progressStatus(tr("Finished: %1 of %2 element(s) imported",
-                         "Placeholders are numbers", totalCount)
-                          .arg(count)
-                          .arg(totalCount));
+                         "Placeholders are numbers", mProgressTotal)
+                          .arg(mProgressCount)
+                          .arg(mProgressTotal));
   emit finished(mImportErrors);
 }
 
@@ -26,9 +26,11 @@
 #include <librepcb/core/fileio/filepath.h>
 #include <librepcb/core/types/uuid.h>
 #include <librepcb/core/types/version.h>
+#include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -54,6 +56,12 @@ namespace eagleimport {
 
 /**
  * @brief EAGLE library (*.lbr) import
+ *
+ * Elements of the same type don't depend on each other, so they are
+ * converted concurrently (symbols, then packages, then components, then
+ * devices). The UUIDs of each element are derived from a seed, the element
+ * type and the element index, so the output does not depend on the number
+ * of threads or the order in which the threads process the elements.
  */
 class EagleLibraryImport final : public QThread {
   Q_OBJECT
@@ -126,6 +134,25 @@ public:
   void setDeviceCategories(const QSet<Uuid>& uuids) noexcept {
     mDeviceCategories = uuids;
   }
+
+  /**
+   * @brief Set the seed to derive the UUIDs of the imported elements from
+   *
+   * @param seed  Seed for the UUIDs. If empty (the default), a random seed
+   *              is used for each import. Only intended for testing, since
+   *              importing twice with the same seed leads to the same UUIDs.
+   */
+  void setUuidSeed(const QByteArray& seed) noexcept { mUuidSeed = seed; }
+
+  /**
+   * @brief Set the maximum number of elements to convert concurrently
+   *
+   * @param count   Number of threads (default: QThread::idealThreadCount()).
+   *                If 1, all elements are converted on the import thread.
+   */
+  void setMaxThreadCount(int count) noexcept {
+    mMaxThreadCount = qMax(count, 1);
+  }
   void setSymbolChecked(const QString& name, bool checked) noexcept;
   void setPackageChecked(const QString& name, bool checked) noexcept;
   void setComponentChecked(const QString& name, bool checked) noexcept;
@@ -147,6 +174,38 @@ signals:
   void errorOccurred(const QString& error);
   void finished(const QStringList& errors);
 
+private:  // Types
+  /// State of a single element import, only accessed by one thread
+  struct ElementContext {
+    QString displayName;
+    QByteArray uuidSeed;  ///< Seed for the UUIDs of this element
+    int uuidCount;  ///< Number of already created UUIDs
+    QStringList errors;
+  };
+
+  struct ImportedSymbol {
+    tl::optional<Uuid> uuid;
+    QMap<QString, tl::optional<Uuid> > pins;  ///< Key: EAGLE pin name
+  };
+
+  struct ImportedPackage {
+    tl::optional<Uuid> uuid;
+    QMap<QString, tl::optional<Uuid> > pads;  ///< Key: EAGLE pad name
+  };
+
+  struct ImportedComponent {
+    tl::optional<Uuid> uuid;
+    /// Key: EAGLE gate name and pin name
+    QHash<QString, QHash<QString, tl::optional<Uuid> > > signalMap;
+  };
+
+  /// Already imported elements, by EAGLE name
+  struct ImportedElements {
+    QHash<QString, ImportedSymbol> symbols;
+    QHash<QString, ImportedPackage> packages;
+    QHash<QString, ImportedComponent> components;
+  };
+
 private:  // Methods
   template <typename T>
   int getCheckedElementsCount(const QVector<T>& elements) const noexcept;
@@ -156,10 +215,25 @@ private:  // Methods
   void updateDependencies() noexcept;
   template <typename T>
   bool setElementDependent(T& element, bool dependent) noexcept;
+  template <typename TResult, typename T, typename Func>
+  QVector<TResult> importElements(const QVector<T>& elements,
+                                  const QByteArray& uuidSeed,
+                                  const QString& errorMsg, Func func) noexcept;
+  void runConcurrently(int count,
+                       const std::function<void(int)>& func) noexcept;
+  void importSymbol(const Symbol& sym, ElementContext& ctx,
+                    ImportedSymbol& result);
+  void importPackage(const Package& pkg, ElementContext& ctx,
+                     ImportedPackage& result);
+  void importComponent(const Component& cmp, const ImportedElements& imported,
+                       ElementContext& ctx, ImportedComponent& result);
+  void importDevice(const Device& dev, const ImportedElements& imported,
+                    ElementContext& ctx);
   QVector<std::shared_ptr<Polygon> > convertWires(
-      const QString& element, const QList<parseagle::Wire>& wires);
-  void tryOrRaiseError(const QString& element, std::function<void()> func);
-  void raiseImportError(const QString& element, const QString& error) noexcept;
+      ElementContext& ctx, const QList<parseagle::Wire>& wires);
+  void tryOrRaiseError(ElementContext& ctx, std::function<void()> func);
+  void raiseImportError(ElementContext& ctx, const QString& error) noexcept;
+  static Uuid createUuid(ElementContext& ctx) noexcept;
   void run() noexcept override;
 
 private:  // Data
@@ -173,11 +247,16 @@ private:  // Data
   QSet<Uuid> mPackageCategories;
   QSet<Uuid> mComponentCategories;
   QSet<Uuid> mDeviceCategories;
+  QByteArray mUuidSeed;
+  int mMaxThreadCount;
 
   // State
-  bool mAbort;
+  QAtomicInt mAbort;
   FilePath mLoadedFilePath;
   QStringList mImportErrors;
+  QMutex mProgressMutex;
+  int mProgressCount;  ///< Protected by #mProgressMutex
+  int mProgressTotal;
 
   // Library elements
   QVector<Symbol> mSymbols;
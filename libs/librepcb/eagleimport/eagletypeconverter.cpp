@@ -255,9 +255,9 @@ Path EagleTypeConverter::convertVertices(const QList<parseagle::Vertex>& v,
 }
 
 std::shared_ptr<Polygon> EagleTypeConverter::convertWire(
-    const parseagle::Wire& w) {
+    const parseagle::Wire& w, const UuidGenerator& createUuid) {
   return std::make_shared<Polygon>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       convertLayer(w.getLayer()),  // Layer
       UnsignedLength(convertLength(w.getWidth())),  // Line width
       false,  // Filled
@@ -268,13 +268,14 @@ std::shared_ptr<Polygon> EagleTypeConverter::convertWire(
 }
 
 std::shared_ptr<Polygon> EagleTypeConverter::convertRectangle(
-    const parseagle::Rectangle& r, bool isGrabArea) {
+    const parseagle::Rectangle& r, bool isGrabArea,
+    const UuidGenerator& createUuid) {
   Point p1 = convertPoint(r.getP1());
   Point p2 = convertPoint(r.getP2());
   Point center = (p1 + p2) / 2;
   Path path = Path::rect(p1, p2);
   path.rotate(convertAngle(r.getRotation().getAngle()), center);
-  return std::make_shared<Polygon>(Uuid::createRandom(),  // UUID
+  return std::make_shared<Polygon>(createUuid(),  // UUID
                                    convertLayer(r.getLayer()),  // Layer
                                    UnsignedLength(0),  // Line width
                                    true,  // Filled
@@ -284,9 +285,10 @@ std::shared_ptr<Polygon> EagleTypeConverter::convertRectangle(
 }
 
 std::shared_ptr<Polygon> EagleTypeConverter::convertPolygon(
-    const parseagle::Polygon& p, bool isGrabArea) {
+    const parseagle::Polygon& p, bool isGrabArea,
+    const UuidGenerator& createUuid) {
   return std::make_shared<Polygon>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       convertLayer(p.getLayer()),  // Layer
       UnsignedLength(convertLength(p.getWidth())),  // Line width
       true,  // Filled (EAGLE polygons are always filled)
@@ -296,11 +298,12 @@ std::shared_ptr<Polygon> EagleTypeConverter::convertPolygon(
 }
 
 std::shared_ptr<Circle> EagleTypeConverter::convertCircle(
-    const parseagle::Circle& c, bool isGrabArea) {
+    const parseagle::Circle& c, bool isGrabArea,
+    const UuidGenerator& createUuid) {
   UnsignedLength lineWidth(convertLength(c.getWidth()));
   bool filled = (lineWidth == 0);  // EAGLE fills circles of zero width!
   return std::make_shared<Circle>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       convertLayer(c.getLayer()),  // Layer
       lineWidth,  // Line width
       filled,  // Filled
@@ -311,9 +314,9 @@ std::shared_ptr<Circle> EagleTypeConverter::convertCircle(
 }
 
 std::shared_ptr<Hole> EagleTypeConverter::convertHole(
-    const parseagle::Hole& h) {
+    const parseagle::Hole& h, const UuidGenerator& createUuid) {
   return std::make_shared<Hole>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       PositiveLength(convertLength(h.getDiameter())),  // Diameter
       makeNonEmptyPath(convertPoint(h.getPosition()))  // Path
   );
@@ -328,9 +331,9 @@ QString EagleTypeConverter::convertTextValue(const QString& v) {
 }
 
 std::shared_ptr<Text> EagleTypeConverter::convertSchematicText(
-    const parseagle::Text& t) {
+    const parseagle::Text& t, const UuidGenerator& createUuid) {
   return std::make_shared<Text>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       convertLayer(t.getLayer()),  // Layer
       convertTextValue(t.getValue()),  // Text
       convertPoint(t.getPosition()),  // Position
@@ -341,9 +344,9 @@ std::shared_ptr<Text> EagleTypeConverter::convertSchematicText(
 }
 
 std::shared_ptr<StrokeText> EagleTypeConverter::convertBoardText(
-    const parseagle::Text& t) {
+    const parseagle::Text& t, const UuidGenerator& createUuid) {
   return std::make_shared<StrokeText>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       convertLayer(t.getLayer()),  // Layer
       convertTextValue(t.getValue()),  // Text
       convertPoint(t.getPosition()),  // Position
@@ -359,10 +362,10 @@ std::shared_ptr<StrokeText> EagleTypeConverter::convertBoardText(
 }
 
 std::shared_ptr<SymbolPin> EagleTypeConverter::convertSymbolPin(
-    const parseagle::Pin& p) {
+    const parseagle::Pin& p, const UuidGenerator& createUuid) {
   UnsignedLength length(convertLength(p.getLengthInMillimeters()));
   return std::make_shared<SymbolPin>(
-      Uuid::createRandom(),  // UUID
+      createUuid(),  // UUID
       convertPinOrPadName(p.getName()),  // Name
       convertPoint(p.getPosition()),  // Position
       length,  // Length
@@ -375,8 +378,9 @@ std::shared_ptr<SymbolPin> EagleTypeConverter::convertSymbolPin(
 }
 
 std::pair<std::shared_ptr<PackagePad>, std::shared_ptr<FootprintPad> >
-    EagleTypeConverter::convertThtPad(const parseagle::ThtPad& p) {
-  Uuid uuid = Uuid::createRandom();
+    EagleTypeConverter::convertThtPad(const parseagle::ThtPad& p,
+                                      const UuidGenerator& createUuid) {
+  Uuid uuid = createUuid();
   Length size = convertLength(p.getOuterDiameter());
   if (size <= 0) {
     // If the pad size is set to "auto", it will be zero.
@@ -418,15 +422,16 @@ std::pair<std::shared_ptr<PackagePad>, std::shared_ptr<FootprintPad> >
           height,  // Height
           FootprintPad::ComponentSide::Top,  // Side
           HoleList{std::make_shared<Hole>(
-              Uuid::createRandom(),
+              createUuid(),
               PositiveLength(convertLength(p.getDrillDiameter())),
               makeNonEmptyPath(Point(0, 0)))}  // Holes
           ));
 }
 
 std::pair<std::shared_ptr<PackagePad>, std::shared_ptr<FootprintPad> >
-    EagleTypeConverter::convertSmtPad(const parseagle::SmtPad& p) {
-  Uuid uuid = Uuid::createRandom();
+    EagleTypeConverter::convertSmtPad(const parseagle::SmtPad& p,
+                                      const UuidGenerator& createUuid) {
+  Uuid uuid = createUuid();
   GraphicsLayerName layer = convertLayer(p.getLayer());
   FootprintPad::ComponentSide side;
   if (layer == GraphicsLayer::sTopCopper) {
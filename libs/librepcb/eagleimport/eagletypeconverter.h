@@ -41,6 +41,7 @@
 
 #include <QtCore>
 
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -79,6 +80,9 @@ class EagleTypeConverter final {
   Q_DECLARE_TR_FUNCTIONS(EagleTypeConverter)
 
 public:
+  // Types
+  typedef std::function<Uuid()> UuidGenerator;
+
   // Constructors / Destructor
   EagleTypeConverter() = delete;
   EagleTypeConverter(const EagleTypeConverter& other) = delete;
@@ -192,53 +196,65 @@ public:
   /**
    * @brief Convert a wire
    *
-   * @param w   EAGLE wire (line segment)
+   * @param w           EAGLE wire (line segment)
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB polygon containing 1 line segment
    */
-  static std::shared_ptr<Polygon> convertWire(const parseagle::Wire& w);
+  static std::shared_ptr<Polygon> convertWire(
+      const parseagle::Wire& w,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a rectangle
    *
    * @param r           EAGLE rectangle
    * @param isGrabArea  If the returned polygon should be a grab area
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB polygon containing 4 line segments
    */
   static std::shared_ptr<Polygon> convertRectangle(
-      const parseagle::Rectangle& r, bool isGrabArea);
+      const parseagle::Rectangle& r, bool isGrabArea,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a polygon
    *
    * @param p           EAGLE polygon
    * @param isGrabArea  If the returned polygon should be a grab area
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB polygon (always closed)
    */
-  static std::shared_ptr<Polygon> convertPolygon(const parseagle::Polygon& p,
-                                                 bool isGrabArea);
+  static std::shared_ptr<Polygon> convertPolygon(
+      const parseagle::Polygon& p, bool isGrabArea,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a circle
    *
    * @param c           EAGLE circle
    * @param isGrabArea  If the returned circle should be a grab area
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB circle
    */
-  static std::shared_ptr<Circle> convertCircle(const parseagle::Circle& c,
-                                               bool isGrabArea);
+  static std::shared_ptr<Circle> convertCircle(
+      const parseagle::Circle& c, bool isGrabArea,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a hole
    *
-   * @param h   EAGLE hole
+   * @param h           EAGLE hole
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB hole
    */
-  static std::shared_ptr<Hole> convertHole(const parseagle::Hole& h);
+  static std::shared_ptr<Hole> convertHole(
+      const parseagle::Hole& h,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a text value
@@ -252,49 +268,62 @@ public:
   /**
    * @brief Convert a schematic/symbol text
    *
-   * @param t   EAGLE text
+   * @param t           EAGLE text
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB text
    */
-  static std::shared_ptr<Text> convertSchematicText(const parseagle::Text& t);
+  static std::shared_ptr<Text> convertSchematicText(
+      const parseagle::Text& t,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a board/footprint text
    *
-   * @param t   EAGLE text
+   * @param t           EAGLE text
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB text
    */
-  static std::shared_ptr<StrokeText> convertBoardText(const parseagle::Text& t);
+  static std::shared_ptr<StrokeText> convertBoardText(
+      const parseagle::Text& t,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a symbol pin
    *
-   * @param p   EAGLE pin
+   * @param p           EAGLE pin
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB pin
    */
-  static std::shared_ptr<SymbolPin> convertSymbolPin(const parseagle::Pin& p);
+  static std::shared_ptr<SymbolPin> convertSymbolPin(
+      const parseagle::Pin& p,
+      const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert a THT pad
    *
-   * @param p   EAGLE pad
+   * @param p           EAGLE pad
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB package pad + footprint pad
    */
   static std::pair<std::shared_ptr<PackagePad>, std::shared_ptr<FootprintPad> >
-      convertThtPad(const parseagle::ThtPad& p);
+      convertThtPad(const parseagle::ThtPad& p,
+                    const UuidGenerator& createUuid = &Uuid::createRandom);
 
   /**
    * @brief Convert an SMT pad
    *
-   * @param p   EAGLE pad
+   * @param p           EAGLE pad
+   * @param createUuid  Generator for the UUIDs of the created objects
    *
    * @return LibrePCB package pad + footprint pad
    */
   static std::pair<std::shared_ptr<PackagePad>, std::shared_ptr<FootprintPad> >
-      convertSmtPad(const parseagle::SmtPad& p);
+      convertSmtPad(const parseagle::SmtPad& p,
+                    const UuidGenerator& createUuid = &Uuid::createRandom);
 
   // Operator Overloadings
   EagleTypeConverter& operator=(const EagleTypeConverter& rhs) = delete;
@@ -47,8 +47,10 @@ CmdPolygonEdit::CmdPolygonEdit(Polygon& polygon) noexcept
     mNewIsFilled(mOldIsFilled),
     mOldIsGrabArea(polygon.isGrabArea()),
     mNewIsGrabArea(mOldIsGrabArea),
-    mOldPath(polygon.getPath()),
-    mNewPath(mOldPath) {
+    // Don't retain the cached painter path of the polygon.
+    mOldPath(polygon.getPath().getVertices()),
+    mNewPath(mOldPath),
+    mNewPathDelta() {
 }
 
 CmdPolygonEdit::~CmdPolygonEdit() noexcept {
@@ -57,6 +59,16 @@ CmdPolygonEdit::~CmdPolygonEdit() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPolygonEdit::getRetainedSize() const noexcept {
+  return UndoCommand::getRetainedSize() +
+      (mOldPath.getVertices().capacity() + mNewPath.getVertices().capacity()) *
+      qint64(sizeof(Vertex)) + mNewPathDelta.getRetainedSize();
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -124,13 +136,18 @@ void CmdPolygonEdit::mirrorLayer(bool immediate) noexcept {
  ******************************************************************************/
 
 bool CmdPolygonEdit::performExecute() {
+  // From now on, the new path is only kept as difference to the old path to
+  // reduce the memory retained in the undo stack.
+  mNewPathDelta = PathDelta(mOldPath, mNewPath);
+  mNewPath = Path();
+
   performRedo();  // can throw
 
   if (mNewLayerName != mOldLayerName) return true;
   if (mNewLineWidth != mOldLineWidth) return true;
   if (mNewIsFilled != mOldIsFilled) return true;
   if (mNewIsGrabArea != mOldIsGrabArea) return true;
-  if (mNewPath != mOldPath) return true;
+  if (!mNewPathDelta.isEmpty()) return true;
   return false;
 }
 
@@ -147,7 +164,7 @@ void CmdPolygonEdit::performRedo() {
   mPolygon.setLineWidth(mNewLineWidth);
   mPolygon.setIsFilled(mNewIsFilled);
   mPolygon.setIsGrabArea(mNewIsGrabArea);
-  mPolygon.setPath(mNewPath);
+  mPolygon.setPath(mNewPathDelta.apply(mOldPath));
 }
 
 /*******************************************************************************
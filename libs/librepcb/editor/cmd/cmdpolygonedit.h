@@ -28,6 +28,7 @@
 #include "cmdlistelementremove.h"
 #include "cmdlistelementsswap.h"
 
+#include <librepcb/core/geometry/pathdelta.h>
 #include <librepcb/core/geometry/polygon.h>
 
 #include <QtCore>
@@ -53,6 +54,11 @@ public:
   explicit CmdPolygonEdit(Polygon& polygon) noexcept;
   ~CmdPolygonEdit() noexcept;
 
+  // Getters
+
+  /// @copydoc ::librepcb::editor::UndoCommand::getRetainedSize()
+  qint64 getRetainedSize() const noexcept override;
+
   // Setters
   void setLayerName(const GraphicsLayerName& name, bool immediate) noexcept;
   void setLineWidth(const UnsignedLength& width, bool immediate) noexcept;
@@ -96,7 +102,8 @@ private:
   bool mOldIsGrabArea;
   bool mNewIsGrabArea;
   Path mOldPath;
-  Path mNewPath;
+  Path mNewPath;  ///< Only used until the command is executed
+  PathDelta mNewPathDelta;  ///< Used instead of #mNewPath once executed
 };
 
 /*******************************************************************************
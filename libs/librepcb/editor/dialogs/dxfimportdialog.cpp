@@ -59,6 +59,9 @@ DxfImportDialog::DxfImportDialog(QList<GraphicsLayer*> layers,
                           settingsPrefix % "/pos_x");
   mUi->edtPosY->configure(lengthUnit, LengthEditBase::Steps::generic(),
                           settingsPrefix % "/pos_y");
+  mUi->edtSimplifyTolerance->configure(lengthUnit,
+                                       LengthEditBase::Steps::generic(),
+                                       settingsPrefix % "/simplify_tolerance");
   connect(mUi->cbxInteractivePlacement, &QCheckBox::toggled, mUi->edtPosX,
           &QCheckBox::setDisabled);
   connect(mUi->cbxInteractivePlacement, &QCheckBox::toggled, mUi->edtPosY,
@@ -87,6 +90,11 @@ DxfImportDialog::DxfImportDialog(QList<GraphicsLayer*> layers,
     mUi->cbxCirclesAsDrills->setChecked(
         clientSettings.value(settingsPrefix % "/circles_as_drills", false)
             .toBool());
+    mUi->edtDxfLayers->setText(
+        clientSettings.value(settingsPrefix % "/dxf_layers").toString());
+    mUi->edtSimplifyTolerance->setValue(UnsignedLength(Length::fromMm(
+        clientSettings.value(settingsPrefix % "/simplify_tolerance", "0")
+            .toString())));
     restoreGeometry(clientSettings.value(settingsPrefix % "/window_geometry")
                         .toByteArray());
   } catch (const Exception& e) {
@@ -114,6 +122,10 @@ DxfImportDialog::~DxfImportDialog() noexcept {
                           mUi->cbxJoinTangentPolylines->isChecked());
   clientSettings.setValue(mSettingsPrefix % "/circles_as_drills",
                           mUi->cbxCirclesAsDrills->isChecked());
+  clientSettings.setValue(mSettingsPrefix % "/dxf_layers",
+                          mUi->edtDxfLayers->text().trimmed());
+  clientSettings.setValue(mSettingsPrefix % "/simplify_tolerance",
+                          mUi->edtSimplifyTolerance->getValue()->toMmString());
   clientSettings.setValue(mSettingsPrefix % "/window_geometry", saveGeometry());
 }
 
@@ -153,6 +165,20 @@ bool DxfImportDialog::getImportCirclesAsDrills() const noexcept {
   return mUi->cbxCirclesAsDrills->isChecked();
 }
 
+QSet<QString> DxfImportDialog::getDxfLayers() const noexcept {
+  QSet<QString> layers;
+  foreach (const QString& layer, mUi->edtDxfLayers->text().split(',')) {
+    if (!layer.trimmed().isEmpty()) {
+      layers.insert(layer.trimmed());
+    }
+  }
+  return layers;
+}
+
+UnsignedLength DxfImportDialog::getSimplifyTolerance() const noexcept {
+  return mUi->edtSimplifyTolerance->getValue();
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -75,6 +75,8 @@ public:
   tl::optional<Point> getPlacementPosition() const noexcept;
   bool getJoinTangentPolylines() const noexcept;
   bool getImportCirclesAsDrills() const noexcept;
+  QSet<QString> getDxfLayers() const noexcept;
+  UnsignedLength getSimplifyTolerance() const noexcept;
 
   // General Methods
   FilePath chooseFile() const noexcept;
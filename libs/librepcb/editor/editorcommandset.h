@@ -325,6 +325,15 @@ public:
       {QKeySequence(Qt::CTRL + Qt::Key_F5)},
       &categoryEditor,
   };
+  EditorCommand memoryUsage{
+      "memory_usage",  // clang-format break
+      QT_TR_NOOP("Memory Usage"),
+      QT_TR_NOOP("Show the approximate memory usage of the project"),
+      QIcon(),
+      EditorCommand::Flag::OpensPopup,
+      {},
+      &categoryEditor,
+  };
   EditorCommand schematicEditor{
       "schematic_editor",  // clang-format break
       QT_TR_NOOP("Schematic Editor"),
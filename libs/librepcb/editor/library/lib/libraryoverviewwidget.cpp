@@ -390,16 +390,9 @@ void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
 
   try {
     // get all library element names
-    QMultiMap<Version, FilePath> elements =
-        mContext.workspace.getLibraryDb().getAll<ElementType>(
-            tl::nullopt,
-            mLibrary->getDirectory().getAbsPath());  // can throw
-    foreach (const FilePath& filepath, elements) {
-      QString name;
-      mContext.workspace.getLibraryDb().getTranslations<ElementType>(
-          filepath, getLibLocaleOrder(), &name);  // can throw
-      elementNames.insert(filepath, name);
-    }
+    elementNames = mContext.workspace.getLibraryDb().getAllNames<ElementType>(
+        getLibLocaleOrder(),
+        mLibrary->getDirectory().getAbsPath());  // can throw
   } catch (const Exception& e) {
     listWidget.clear();
     QListWidgetItem* item = new QListWidgetItem(&listWidget);
@@ -139,7 +139,9 @@ public:
   FootprintGraphicsItem& operator=(const FootprintGraphicsItem& rhs) = delete;
 
 signals:
-  void attributesChanged() override {}
+  void attributesChanged(const QSet<QString>& keys) override {
+    Q_UNUSED(keys);
+  }
 
 private:  // Methods
   void syncPads() noexcept;
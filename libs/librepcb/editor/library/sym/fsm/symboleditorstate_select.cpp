@@ -46,6 +46,7 @@
 #include <librepcb/core/graphics/textgraphicsitem.h>
 #include <librepcb/core/import/dxfreader.h>
 #include <librepcb/core/library/sym/symbol.h>
+#include <librepcb/core/utils/pathsimplifier.h>
 #include <librepcb/core/utils/scopeguard.h>
 #include <librepcb/core/utils/tangentpathjoiner.h>
 
@@ -509,15 +510,28 @@ bool SymbolEditorState_Select::processImportDxf() noexcept {
     auto cursorScopeGuard =
         scopeGuard([this]() { mContext.editorWidget.unsetCursor(); });
 
-    // Read DXF file.
+    // Read DXF file. Points are not imported at all, so skip them early.
     DxfReader import;
     import.setScaleFactor(dialog.getScaleFactor());
+    import.setLayerFilter(dialog.getDxfLayers());
+    import.setEntityFilter(DxfReader::Circles | DxfReader::Lines |
+                           DxfReader::Arcs | DxfReader::Polylines);
+    import.setSimplifyTolerance(dialog.getSimplifyTolerance());
+    QVector<Path> paths;
+    import.setHandlers(nullptr, nullptr,
+                       [&paths](const Path& path) { paths.append(path); });
     import.parse(fp);  // can throw
 
-    // If enabled, join tangent paths.
-    QVector<Path> paths = import.getPolygons().toVector();
+    // If enabled, join tangent paths. Simplify them (again) afterwards since
+    // joining makes vertices of adjacent paths (e.g. DXF lines) simplifiable.
     if (dialog.getJoinTangentPolylines()) {
-      paths = TangentPathJoiner::join(paths, 2000);
+      paths = TangentPathJoiner::join(paths);
+      const UnsignedLength tolerance = dialog.getSimplifyTolerance();
+      if (tolerance > 0) {
+        for (Path& path : paths) {
+          path = PathSimplifier::simplify(path, tolerance);
+        }
+      }
     }
 
     // Build elements to import. ALthough this has nothing to do with the
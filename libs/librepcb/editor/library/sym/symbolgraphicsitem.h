@@ -123,7 +123,9 @@ public:
   SymbolGraphicsItem& operator=(const SymbolGraphicsItem& rhs) = delete;
 
 signals:
-  void attributesChanged() override {}
+  void attributesChanged(const QSet<QString>& keys) override {
+    Q_UNUSED(keys);
+  }
 
 private:  // Methods
   void syncPins() noexcept;
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "boardclipboarddata.h"
 
+#include <librepcb/core/exceptions.h>
 #include <librepcb/core/fileio/transactionaldirectory.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
 #include <librepcb/core/project/circuit/netsignal.h>
@@ -35,13 +36,66 @@
 namespace librepcb {
 namespace editor {
 
+/*******************************************************************************
+ *  Class BoardClipboardData::MimeData
+ ******************************************************************************/
+
+/**
+ * @brief MIME data holding a copy of the clipboard data
+ *
+ * The serialized data is created on the first request only, so it is not
+ * needed at all when pasting within the same application.
+ */
+class BoardClipboardData::MimeData final : public QMimeData {
+public:
+  explicit MimeData(std::unique_ptr<BoardClipboardData> data) noexcept
+    : QMimeData(), mData(std::move(data)), mSerialized(false) {}
+  const BoardClipboardData& getData() const noexcept { return *mData; }
+  QStringList formats() const override {
+    return {getMimeType(), "application/zip", "text/plain"};
+  }
+  bool hasFormat(const QString& mimeType) const override {
+    return formats().contains(mimeType);
+  }
+
+protected:
+  QVariant retrieveData(const QString& mimeType,
+                        QVariant::Type type) const override {
+    if (!formats().contains(mimeType)) {
+      return QMimeData::retrieveData(mimeType, type);
+    }
+    if (!mSerialized) {
+      mSerialized = true;
+      try {
+        mContent = mData->serialize().toByteArray();
+        mData->mFileSystem->write("board.lp", mContent);
+        mZip = mData->mFileSystem->exportToZip();
+      } catch (const Exception& e) {
+        qCritical() << "Failed to serialize board clipboard data:"
+                    << e.getMsg();
+      }
+    }
+    if (mimeType == "text/plain") {
+      return mContent;  // TODO: Remove this
+    } else {
+      return mZip;
+    }
+  }
+
+private:
+  std::unique_ptr<BoardClipboardData> mData;
+  mutable bool mSerialized;
+  mutable QByteArray mContent;
+  mutable QByteArray mZip;
+};
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 BoardClipboardData::BoardClipboardData(const Uuid& boardUuid,
                                        const Point& cursorPos) noexcept
-  : mFileSystem(TransactionalFileSystem::openRW(FilePath::getRandomTempPath())),
+  : mFileSystem(TransactionalFileSystem::openTemporary()),
     mBoardUuid(boardUuid),
     mCursorPos(cursorPos),
     mDevices(),
@@ -76,12 +130,22 @@ BoardClipboardData::BoardClipboardData(const QByteArray& mimeData)
   }
 }
 
+BoardClipboardData::BoardClipboardData(const BoardClipboardData& other) noexcept
+  : mFileSystem(other.mFileSystem),
+    mBoardUuid(other.mBoardUuid),
+    mCursorPos(other.mCursorPos),
+    mDevices(other.mDevices),
+    mNetSegments(other.mNetSegments),
+    mPlanes(other.mPlanes),
+    mPolygons(other.mPolygons),
+    mStrokeTexts(other.mStrokeTexts),
+    mHoles(other.mHoles),
+    mPadPositions(other.mPadPositions) {
+}
+
 BoardClipboardData::~BoardClipboardData() noexcept {
-  // Clean up the temporary directory, but destroy the TransactionalFileSystem
-  // object first since it has a lock on the directory.
-  FilePath fp = mFileSystem->getAbsPath();
-  mFileSystem.reset();
-  QDir(fp.toStr()).removeRecursively();
+  // Note: The temporary directory is removed by the file system itself as
+  // soon as it is not used anymore.
 }
 
 /*******************************************************************************
@@ -104,6 +168,31 @@ std::unique_ptr<TransactionalDirectory> BoardClipboardData::getDirectory(
  ******************************************************************************/
 
 std::unique_ptr<QMimeData> BoardClipboardData::toMimeData() const {
+  return std::unique_ptr<QMimeData>(new MimeData(
+      std::unique_ptr<BoardClipboardData>(new BoardClipboardData(*this))));
+}
+
+std::unique_ptr<BoardClipboardData> BoardClipboardData::fromMimeData(
+    const QMimeData* mime) {
+  if (const MimeData* data = dynamic_cast<const MimeData*>(mime)) {
+    // Copied within this application, no need to deserialize anything.
+    return std::unique_ptr<BoardClipboardData>(
+        new BoardClipboardData(data->getData()));
+  }
+  QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
+  if (!content.isNull()) {
+    return std::unique_ptr<BoardClipboardData>(
+        new BoardClipboardData(content));  // can throw
+  } else {
+    return nullptr;
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+SExpression BoardClipboardData::serialize() const {
   SExpression root = SExpression::createList("librepcb_clipboard_board");
   root.ensureLineBreak();
   mCursorPos.serialize(root.appendList("cursor_position"));
@@ -130,32 +219,9 @@ std::unique_ptr<QMimeData> BoardClipboardData::toMimeData() const {
     root.appendChild(child);
   }
   root.ensureLineBreak();
-  mFileSystem->write("board.lp", root.toByteArray());
-
-  QByteArray zip = mFileSystem->exportToZip();
-
-  std::unique_ptr<QMimeData> data(new QMimeData());
-  data->setData(getMimeType(), zip);
-  data->setData("application/zip", zip);
-  data->setText(root.toByteArray());  // TODO: Remove this
-  return data;
-}
-
-std::unique_ptr<BoardClipboardData> BoardClipboardData::fromMimeData(
-    const QMimeData* mime) {
-  QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
-  if (!content.isNull()) {
-    return std::unique_ptr<BoardClipboardData>(
-        new BoardClipboardData(content));  // can throw
-  } else {
-    return nullptr;
-  }
+  return root;
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 QString BoardClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.board; version=%1")
       .arg(qApp->applicationVersion());
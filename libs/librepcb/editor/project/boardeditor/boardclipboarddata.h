@@ -59,6 +59,10 @@ namespace editor {
 
 /**
  * @brief The BoardClipboardData class
+ *
+ * When copying and pasting within the same application, the MIME data
+ * directly holds a copy of this object. The zip file for the system clipboard
+ * is only created when another application requests it.
  */
 class BoardClipboardData final {
 public:
@@ -90,6 +94,17 @@ public:
         strokeTexts(strokeTexts),
         onEdited(*this) {}
 
+    Device(const Device& other) noexcept
+      : componentUuid(other.componentUuid),
+        libDeviceUuid(other.libDeviceUuid),
+        libFootprintUuid(other.libFootprintUuid),
+        position(other.position),
+        rotation(other.rotation),
+        mirrored(other.mirrored),
+        attributes(other.attributes),
+        strokeTexts(other.strokeTexts),
+        onEdited(*this) {}
+
     explicit Device(const SExpression& node)
       : componentUuid(deserialize<Uuid>(node.getChild("@0"))),
         libDeviceUuid(deserialize<Uuid>(node.getChild("lib_device/@0"))),
@@ -140,6 +155,13 @@ public:
     explicit NetSegment(const tl::optional<CircuitIdentifier>& netName)
       : netName(netName), vias(), junctions(), traces(), onEdited(*this) {}
 
+    NetSegment(const NetSegment& other) noexcept
+      : netName(other.netName),
+        vias(other.vias),
+        junctions(other.junctions),
+        traces(other.traces),
+        onEdited(*this) {}
+
     explicit NetSegment(const SExpression& node)
       : netName(deserialize<tl::optional<CircuitIdentifier>>(
             node.getChild("net/@0"))),
@@ -195,6 +217,18 @@ public:
         connectStyle(connectStyle),
         onEdited(*this) {}
 
+    Plane(const Plane& other) noexcept
+      : uuid(other.uuid),
+        layer(other.layer),
+        netSignalName(other.netSignalName),
+        outline(other.outline),
+        minWidth(other.minWidth),
+        minClearance(other.minClearance),
+        keepOrphans(other.keepOrphans),
+        priority(other.priority),
+        connectStyle(other.connectStyle),
+        onEdited(*this) {}
+
     explicit Plane(const SExpression& node)
       : uuid(deserialize<Uuid>(node.getChild("@0"))),
         layer(deserialize<GraphicsLayerName>(node.getChild("layer/@0"))),
@@ -237,7 +271,16 @@ public:
 
   // Constructors / Destructor
   BoardClipboardData() = delete;
-  BoardClipboardData(const BoardClipboardData& other) = delete;
+
+  /**
+   * @brief Copy constructor
+   *
+   * All items are copied, but the library elements are shared with the
+   * other object since they are never modified.
+   *
+   * @param other   The object to copy.
+   */
+  BoardClipboardData(const BoardClipboardData& other) noexcept;
   BoardClipboardData(const Uuid& boardUuid, const Point& cursorPos) noexcept;
   explicit BoardClipboardData(const QByteArray& mimeData);
   ~BoardClipboardData() noexcept;
@@ -270,7 +313,11 @@ public:
   // Operator Overloadings
   BoardClipboardData& operator=(const BoardClipboardData& rhs) = delete;
 
+private:  // Types
+  class MimeData;
+
 private:  // Methods
+  SExpression serialize() const;
   static QString getMimeType() noexcept;
 
 private:  // Data
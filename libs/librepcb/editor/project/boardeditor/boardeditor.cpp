@@ -112,6 +112,8 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   mUi->graphicsView->setGridStyle(theme.getBoardGridStyle());
   mUi->graphicsView->setUseOpenGl(
       mProjectEditor.getWorkspace().getSettings().useOpenGl.get());
+  mUi->graphicsView->setTileCacheEnabled(
+      mProjectEditor.getWorkspace().getSettings().useTileCache.get());
   mUi->graphicsView->setEventHandlerObject(this);
   connect(mUi->graphicsView, &GraphicsView::cursorScenePositionChanged,
           mUi->statusbar, &StatusBar::setAbsoluteCursorPosition);
@@ -379,6 +381,8 @@ void BoardEditor::createActions() noexcept {
         emit mProjectEditor.openProjectLibraryUpdaterClicked(
             mProject.getFilepath());
       }));
+  mActionMemoryUsage.reset(cmd.memoryUsage.createAction(
+      this, this, [this]() { mProjectEditor.execMemoryUsageDialog(this); }));
   mActionLayerStack.reset(cmd.layerStack.createAction(this, this, [this]() {
     try {
       if (Board* board = getActiveBoard()) {
@@ -417,13 +421,25 @@ void BoardEditor::createActions() noexcept {
   mActionGenerateFabricationData.reset(
       cmd.generateFabricationData.createAction(this, this, [this]() {
         if (Board* board = getActiveBoard()) {
-          FabricationOutputDialog dialog(
-              mProjectEditor.getWorkspace().getSettings(), *board, this);
-          connect(&dialog, &FabricationOutputDialog::orderPcbDialogTriggered,
-                  this, [this, &dialog]() {
-                    mProjectEditor.execOrderPcbDialog(&dialog);
-                  });
-          dialog.exec();
+          // Non-modal since the export runs in the background, thus the board
+          // can still be edited while the dialog is open.
+          if (mFabricationOutputDialog &&
+              (&mFabricationOutputDialog->getBoard() != board)) {
+            delete mFabricationOutputDialog;
+          }
+          if (!mFabricationOutputDialog) {
+            FabricationOutputDialog* dialog = new FabricationOutputDialog(
+                mProjectEditor.getWorkspace().getSettings(), *board, this);
+            dialog->setAttribute(Qt::WA_DeleteOnClose);
+            connect(dialog, &FabricationOutputDialog::orderPcbDialogTriggered,
+                    this, [this, dialog]() {
+                      mProjectEditor.execOrderPcbDialog(dialog);
+                    });
+            mFabricationOutputDialog = dialog;
+          }
+          mFabricationOutputDialog->show();
+          mFabricationOutputDialog->raise();
+          mFabricationOutputDialog->activateWindow();
         }
       }));
   mActionGeneratePickPlace.reset(
@@ -864,6 +880,7 @@ void BoardEditor::createMenus() noexcept {
   mb.addAction(mActionProjectSettings);
   mb.addSeparator();
   mb.addAction(mActionUpdateLibrary);
+  mb.addAction(mActionMemoryUsage);
 
   // Tools.
   mb.newMenu(&MenuBuilder::createToolsMenu);
@@ -1268,7 +1285,7 @@ void BoardEditor::execDesignRulesDialog() noexcept {
     connect(&dialog, &BoardDesignRulesDialog::rulesChanged,
             [&](const BoardDesignRules& rules) {
               board->getDesignRules() = rules;
-              emit board->attributesChanged();
+              emit board->attributesChanged(QSet<QString>());
             });
     int result = dialog.exec();
     board->getDesignRules() = originalRules;  // important hack ;)
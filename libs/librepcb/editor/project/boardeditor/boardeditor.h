@@ -49,6 +49,7 @@ class BoardEditorFsm;
 class BoardLayersDock;
 class ErcMsgDock;
 class ExclusiveActionGroup;
+class FabricationOutputDialog;
 class GraphicsView;
 class ProjectEditor;
 class SearchToolBar;
@@ -155,6 +156,7 @@ private:
   // Misc
   QPointer<Board> mActiveBoard;
   QScopedPointer<BoardEditorFsm> mFsm;
+  QPointer<FabricationOutputDialog> mFabricationOutputDialog;
 
   // Actions
   QScopedPointer<QAction> mActionAboutLibrePcb;
@@ -173,6 +175,7 @@ private:
   QScopedPointer<QAction> mActionProjectSettings;
   QScopedPointer<QAction> mActionNetClasses;
   QScopedPointer<QAction> mActionUpdateLibrary;
+  QScopedPointer<QAction> mActionMemoryUsage;
   QScopedPointer<QAction> mActionLayerStack;
   QScopedPointer<QAction> mActionDesignRules;
   QScopedPointer<QAction> mActionDesignRuleCheck;
@@ -52,6 +52,7 @@ FabricationOutputDialog::FabricationOutputDialog(
     mBoard(board),
     mUi(new Ui::FabricationOutputDialog) {
   mUi->setupUi(this);
+  mUi->prgProgress->hide();
   mBtnGenerate =
       mUi->buttonBox->addButton(tr("&Generate"), QDialogButtonBox::AcceptRole);
   mBtnGenerate->setDefault(true);
@@ -143,18 +144,36 @@ FabricationOutputDialog::FabricationOutputDialog(
   mUi->cbxSilkBotValues->setChecked(
       botSilkscreen.contains(GraphicsLayer::sBotValues));
 
+  // Close the dialog if the board gets deleted.
+  connect(&mBoard, &Board::destroyed, this, &FabricationOutputDialog::close);
+
   // Load window geometry.
   QSettings clientSettings;
   restoreGeometry(
       clientSettings.value("fabrication_export_dialog/window_geometry")
           .toByteArray());
+  mUi->cbxZip->setChecked(
+      clientSettings.value("fabrication_export_dialog/zip", false).toBool());
 }
 
 FabricationOutputDialog::~FabricationOutputDialog() {
+  cancelExport();
+
   // Save window geometry.
   QSettings clientSettings;
   clientSettings.setValue("fabrication_export_dialog/window_geometry",
                           saveGeometry());
+  clientSettings.setValue("fabrication_export_dialog/zip",
+                          mUi->cbxZip->isChecked());
+}
+
+/*******************************************************************************
+ *  Inherited from QDialog
+ ******************************************************************************/
+
+void FabricationOutputDialog::reject() noexcept {
+  cancelExport();
+  QDialog::reject();
 }
 
 /*******************************************************************************
@@ -196,13 +215,19 @@ void FabricationOutputDialog::btnProtelSuffixesClicked() {
 }
 
 void FabricationOutputDialog::btnGenerateClicked() {
-  try {
-    // Visual feedback with cursor.
-    setCursor(Qt::WaitCursor);
-    auto cursorScopeGuard = scopeGuard([this]() { unsetCursor(); });
+  // While the export is running, the button cancels it.
+  if (mGerberExport) {
+    cancelExport();
+    return;
+  }
 
+  try {
     // rebuild planes because they may be outdated!
-    mBoard.rebuildAllPlanes();
+    {
+      setCursor(Qt::WaitCursor);
+      auto cursorScopeGuard = scopeGuard([this]() { unsetCursor(); });
+      mBoard.rebuildAllPlanes();
+    }
 
     // update fabrication output settings if modified
     BoardFabricationOutputSettings s = mBoard.getFabricationOutputSettings();
@@ -230,21 +255,31 @@ void FabricationOutputDialog::btnGenerateClicked() {
       mBoard.getFabricationOutputSettings() = s;  // TODO: use undo command
     }
 
-    // generate files
-    BoardGerberExport grbExport(mBoard);
-    grbExport.exportPcbLayers(mBoard.getFabricationOutputSettings());
-
-    // Show success message.
-    QString btnSuccessText = tr("Success!");
-    QString btnGenerateText = mBtnGenerate->text();
-    if (btnGenerateText != btnSuccessText) {
-      mBtnGenerate->setText(btnSuccessText);
-      QTimer::singleShot(500, this, [this, btnGenerateText]() {
-        if (mBtnGenerate) {
-          mBtnGenerate->setText(btnGenerateText);
-        }
-      });
-    }
+    // Generate files in a worker thread from a snapshot of the board, so the
+    // board can be edited in the meantime. The export object is used as
+    // context, thus pending signals are discarded when it gets deleted.
+    mGerberExport.reset(new BoardGerberExport(mBoard));  // can throw
+    connect(mGerberExport.data(), &BoardGerberExport::progress,
+            mGerberExport.data(),
+            [this](int percent, int completed, int total) {
+              mUi->prgProgress->setValue(percent);
+              mUi->prgProgress->setFormat(
+                  tr("%1 of %2 files").arg(completed).arg(total));
+            },
+            Qt::QueuedConnection);
+    connect(mGerberExport.data(), &BoardGerberExport::succeeded,
+            mGerberExport.data(), [this]() { exportFinished(QString()); },
+            Qt::QueuedConnection);
+    connect(mGerberExport.data(), &BoardGerberExport::failed,
+            mGerberExport.data(),
+            [this](const QString& msg) { exportFinished(msg); },
+            Qt::QueuedConnection);
+    mUi->prgProgress->setValue(0);
+    mUi->prgProgress->setFormat(QString());
+    mUi->prgProgress->show();
+    mBtnGenerate->setText(tr("&Cancel"));
+    mGerberExport->startPcbLayersExport(mBoard.getFabricationOutputSettings(),
+                                        mUi->cbxZip->isChecked());
   } catch (const Exception& e) {
     QMessageBox::warning(this, tr("Error"), e.getMsg());
   }
@@ -266,6 +301,36 @@ void FabricationOutputDialog::btnBrowseOutputDirClicked() {
  *  Private Methods
  ******************************************************************************/
 
+void FabricationOutputDialog::exportFinished(const QString& errorMsg) noexcept {
+  // Note: This is called from a slot of the export object, thus it must not
+  //       be deleted immediately.
+  mGerberExport.take()->deleteLater();
+  mUi->prgProgress->hide();
+
+  if (!errorMsg.isNull()) {
+    mBtnGenerate->setText(tr("&Generate"));
+    QMessageBox::warning(this, tr("Error"), errorMsg);
+    return;
+  }
+
+  // Show success message.
+  mBtnGenerate->setText(tr("Success!"));
+  QTimer::singleShot(500, this, [this]() {
+    if (mBtnGenerate && (!mGerberExport)) {
+      mBtnGenerate->setText(tr("&Generate"));
+    }
+  });
+}
+
+void FabricationOutputDialog::cancelExport() noexcept {
+  if (mGerberExport) {
+    mGerberExport->cancel();
+    mGerberExport.reset();
+    mUi->prgProgress->hide();
+    mBtnGenerate->setText(tr("&Generate"));
+  }
+}
+
 QStringList FabricationOutputDialog::getTopSilkscreenLayers() const noexcept {
   QStringList layers;
   if (mUi->cbxSilkTopPlacement->isChecked()) {
@@ -32,6 +32,7 @@
 namespace librepcb {
 
 class Board;
+class BoardGerberExport;
 class Project;
 class WorkspaceSettings;
 
@@ -59,6 +60,12 @@ public:
                                    Board& board, QWidget* parent = 0);
   ~FabricationOutputDialog();
 
+  // Getters
+  const Board& getBoard() const noexcept { return mBoard; }
+
+  // Inherited from QDialog
+  void reject() noexcept override;
+
 signals:
   void orderPcbDialogTriggered();
 
@@ -67,6 +74,8 @@ private:
   void btnProtelSuffixesClicked();
   void btnGenerateClicked();
   void btnBrowseOutputDirClicked();
+  void exportFinished(const QString& errorMsg) noexcept;
+  void cancelExport() noexcept;
   QStringList getTopSilkscreenLayers() const noexcept;
   QStringList getBotSilkscreenLayers() const noexcept;
 
@@ -75,6 +84,7 @@ private:
   Board& mBoard;
   QScopedPointer<Ui::FabricationOutputDialog> mUi;
   QPointer<QPushButton> mBtnGenerate;
+  QScopedPointer<BoardGerberExport> mGerberExport;  ///< Only while running
 };
 
 /*******************************************************************************
@@ -69,6 +69,7 @@
 #include <librepcb/core/project/circuit/componentinstance.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectsettings.h>
+#include <librepcb/core/utils/pathsimplifier.h>
 #include <librepcb/core/utils/scopeguard.h>
 #include <librepcb/core/utils/tangentpathjoiner.h>
 #include <librepcb/core/workspace/workspace.h>
@@ -154,15 +155,28 @@ bool BoardEditorState_Select::processImportDxf() noexcept {
       auto cursorScopeGuard =
           scopeGuard([this]() { parentWidget()->unsetCursor(); });
 
-      // Read DXF file.
+      // Read DXF file. Points are not imported at all, so skip them early.
       DxfReader import;
       import.setScaleFactor(dialog.getScaleFactor());
+      import.setLayerFilter(dialog.getDxfLayers());
+      import.setEntityFilter(DxfReader::Circles | DxfReader::Lines |
+                             DxfReader::Arcs | DxfReader::Polylines);
+      import.setSimplifyTolerance(dialog.getSimplifyTolerance());
+      QVector<Path> paths;
+      import.setHandlers(nullptr, nullptr,
+                         [&paths](const Path& path) { paths.append(path); });
       import.parse(fp);  // can throw
 
-      // If enabled, join tangent paths.
-      QVector<Path> paths = import.getPolygons().toVector();
+      // If enabled, join tangent paths. Simplify them (again) afterwards since
+      // joining makes vertices of adjacent paths (e.g. DXF lines) simplifiable.
       if (dialog.getJoinTangentPolylines()) {
-        paths = TangentPathJoiner::join(paths, 2000);
+        paths = TangentPathJoiner::join(paths);
+        const UnsignedLength tolerance = dialog.getSimplifyTolerance();
+        if (tolerance > 0) {
+          for (Path& path : paths) {
+            path = PathSimplifier::simplify(path, tolerance);
+          }
+        }
       }
 
       // Build board elements to import. ALthough this has nothing to do with
@@ -71,6 +71,7 @@ UnplacedComponentsDock::UnplacedComponentsDock(ProjectEditor& editor,
     mBoard(nullptr),
     mUi(new Ui::UnplacedComponentsDock),
     mDisableListUpdate(false),
+    mListUpdateScheduled(false),
     mNextPosition(),
     mLastDeviceOfComponent(),
     mLastFootprintOfPackage(),
@@ -103,9 +104,9 @@ UnplacedComponentsDock::UnplacedComponentsDock(ProjectEditor& editor,
 
   // Update components list each time a component gets added or removed.
   connect(&mProject.getCircuit(), &Circuit::componentAdded, this,
-          &UnplacedComponentsDock::updateComponentsList);
+          &UnplacedComponentsDock::scheduleComponentsListUpdate);
   connect(&mProject.getCircuit(), &Circuit::componentRemoved, this,
-          &UnplacedComponentsDock::updateComponentsList);
+          &UnplacedComponentsDock::scheduleComponentsListUpdate);
   updateComponentsList();
 
   // Connect UI events to methods.
@@ -157,9 +158,9 @@ int UnplacedComponentsDock::getUnplacedComponentsCount() const noexcept {
 void UnplacedComponentsDock::setBoard(Board* board) {
   if (mBoard) {
     disconnect(mBoard, &Board::deviceAdded, this,
-               &UnplacedComponentsDock::updateComponentsList);
+               &UnplacedComponentsDock::scheduleComponentsListUpdate);
     disconnect(mBoard, &Board::deviceRemoved, this,
-               &UnplacedComponentsDock::updateComponentsList);
+               &UnplacedComponentsDock::scheduleComponentsListUpdate);
     mBoard = nullptr;
     updateComponentsList();
   }
@@ -167,9 +168,9 @@ void UnplacedComponentsDock::setBoard(Board* board) {
   if (board) {
     mBoard = board;
     connect(mBoard, &Board::deviceAdded, this,
-            &UnplacedComponentsDock::updateComponentsList);
+            &UnplacedComponentsDock::scheduleComponentsListUpdate);
     connect(mBoard, &Board::deviceRemoved, this,
-            &UnplacedComponentsDock::updateComponentsList);
+            &UnplacedComponentsDock::scheduleComponentsListUpdate);
     mNextPosition =
         Point::fromMm(0, -20).mappedToGrid(mBoard->getGridInterval());
     updateComponentsList();
@@ -180,7 +181,17 @@ void UnplacedComponentsDock::setBoard(Board* board) {
  *  Private Methods
  ******************************************************************************/
 
+void UnplacedComponentsDock::scheduleComponentsListUpdate() noexcept {
+  // Pasting or removing many elements at once emits many signals, but the
+  // list shall be updated only once afterwards.
+  if (!mListUpdateScheduled) {
+    mListUpdateScheduled = true;
+    QTimer::singleShot(0, this, &UnplacedComponentsDock::updateComponentsList);
+  }
+}
+
 void UnplacedComponentsDock::updateComponentsList() noexcept {
+  mListUpdateScheduled = false;
   if (mDisableListUpdate) return;
 
   bool hasPreselectedDevices = false;
@@ -102,6 +102,7 @@ signals:
                           Uuid footprintUuid);
 
 private:  // Methods
+  void scheduleComponentsListUpdate() noexcept;
   void updateComponentsList() noexcept;
   void currentComponentListItemChanged(QListWidgetItem* current,
                                        QListWidgetItem* previous) noexcept;
@@ -142,6 +143,7 @@ private:  // Data
 
   // State
   bool mDisableListUpdate;
+  bool mListUpdateScheduled;
   Point mNextPosition;
   QHash<Uuid, Uuid> mLastDeviceOfComponent;
   QHash<Uuid, Uuid> mLastFootprintOfPackage;
@@ -61,12 +61,12 @@ bool CmdBoardDesignRulesModify::performExecute() {
 
 void CmdBoardDesignRulesModify::performUndo() {
   mBoard.getDesignRules() = mOldRules;
-  emit mBoard.attributesChanged();
+  emit mBoard.attributesChanged(QSet<QString>());
 }
 
 void CmdBoardDesignRulesModify::performRedo() {
   mBoard.getDesignRules() = mNewRules;
-  emit mBoard.attributesChanged();
+  emit mBoard.attributesChanged(QSet<QString>());
 }
 
 /*******************************************************************************
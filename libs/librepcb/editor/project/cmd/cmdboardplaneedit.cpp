@@ -42,8 +42,10 @@ CmdBoardPlaneEdit::CmdBoardPlaneEdit(BI_Plane& plane,
   : UndoCommand(tr("Edit plane")),
     mPlane(plane),
     mDoRebuildOnChanges(rebuildOnChanges),
-    mOldOutline(plane.getOutline()),
+    // Don't retain the cached painter path of the plane.
+    mOldOutline(plane.getOutline().getVertices()),
     mNewOutline(mOldOutline),
+    mNewOutlineDelta(),
     mOldLayerName(plane.getLayerName()),
     mNewLayerName(mOldLayerName),
     mOldNetSignal(&plane.getNetSignal()),
@@ -67,6 +69,17 @@ CmdBoardPlaneEdit::~CmdBoardPlaneEdit() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdBoardPlaneEdit::getRetainedSize() const noexcept {
+  return UndoCommand::getRetainedSize() +
+      (mOldOutline.getVertices().capacity() +
+       mNewOutline.getVertices().capacity()) *
+      qint64(sizeof(Vertex)) + mNewOutlineDelta.getRetainedSize();
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -148,9 +161,14 @@ void CmdBoardPlaneEdit::setKeepOrphans(bool keepOrphans) noexcept {
  ******************************************************************************/
 
 bool CmdBoardPlaneEdit::performExecute() {
+  // From now on, the new outline is only kept as difference to the old
+  // outline to reduce the memory retained in the undo stack.
+  mNewOutlineDelta = PathDelta(mOldOutline, mNewOutline);
+  mNewOutline = Path();
+
   performRedo();  // can throw
 
-  if (mNewOutline != mOldOutline) return true;
+  if (!mNewOutlineDelta.isEmpty()) return true;
   if (mNewLayerName != mOldLayerName) return true;
   if (mNewNetSignal != mOldNetSignal) return true;
   if (mNewMinWidth != mOldMinWidth) return true;
@@ -177,7 +195,7 @@ void CmdBoardPlaneEdit::performUndo() {
 
 void CmdBoardPlaneEdit::performRedo() {
   mPlane.setNetSignal(*mNewNetSignal);  // can throw
-  mPlane.setOutline(mNewOutline);
+  mPlane.setOutline(mNewOutlineDelta.apply(mOldOutline));
   mPlane.setLayerName(mNewLayerName);
   mPlane.setMinWidth(mNewMinWidth);
   mPlane.setMinClearance(mNewMinClearance);
@@ -26,6 +26,7 @@
 #include "../../undocommand.h"
 
 #include <librepcb/core/geometry/path.h>
+#include <librepcb/core/geometry/pathdelta.h>
 #include <librepcb/core/project/board/items/bi_plane.h>
 
 #include <QtCore>
@@ -52,6 +53,11 @@ public:
   CmdBoardPlaneEdit(BI_Plane& plane, bool rebuildOnChanges) noexcept;
   ~CmdBoardPlaneEdit() noexcept;
 
+  // Getters
+
+  /// @copydoc ::librepcb::editor::UndoCommand::getRetainedSize()
+  qint64 getRetainedSize() const noexcept override;
+
   // Setters
   void translate(const Point& deltaPos, bool immediate) noexcept;
   void snapToGrid(const PositiveLength& gridInterval, bool immediate) noexcept;
@@ -88,7 +94,8 @@ private:
 
   // General Attributes
   Path mOldOutline;
-  Path mNewOutline;
+  Path mNewOutline;  ///< Only used until the command is executed
+  PathDelta mNewOutlineDelta;  ///< Used instead of #mNewOutline once executed
   GraphicsLayerName mOldLayerName;
   GraphicsLayerName mNewLayerName;
   NetSignal* mOldNetSignal;
@@ -60,6 +60,7 @@ CmdDragSelectedBoardItems::CmdDragSelectedBoardItems(
     mItemCount(0),
     mStartPos(startPos),
     mDeltaPos(0, 0),
+    mTargetDeltaPos(0, 0),
     mCenterPos(0, 0),
     mDeltaAngle(0),
     mSnappedToGrid(false),
@@ -142,6 +143,18 @@ CmdDragSelectedBoardItems::CmdDragSelectedBoardItems(
     mCenterPos /= mItemCount;
     mCenterPos.mapToGrid(mBoard.getGridInterval());
   }
+
+  // Timers for deferred updates of large selections.
+  mUpdateTimer.setSingleShot(true);
+  mUpdateTimer.setInterval(sUpdateIntervalMs);
+  QObject::connect(&mUpdateTimer, &QTimer::timeout,
+                   [this]() { applyPendingTranslation(); });
+  mAirWiresTimer.setSingleShot(true);
+  mAirWiresTimer.setInterval(sAirWiresDelayMs);
+  QObject::connect(&mAirWiresTimer, &QTimer::timeout, [this]() {
+    applyPendingTranslation();
+    mBoard.triggerAirWiresRebuild();
+  });
 }
 
 CmdDragSelectedBoardItems::~CmdDragSelectedBoardItems() noexcept {
@@ -152,6 +165,7 @@ CmdDragSelectedBoardItems::~CmdDragSelectedBoardItems() noexcept {
  ******************************************************************************/
 
 void CmdDragSelectedBoardItems::snapToGrid() noexcept {
+  flushDeferredUpdates();
   PositiveLength grid = mBoard.getGridInterval();
   foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
     cmd->snapToGrid(grid, true);
@@ -188,39 +202,28 @@ void CmdDragSelectedBoardItems::setCurrentPosition(
     delta.mapToGrid(mBoard.getGridInterval());
   }
 
-  if (delta != mDeltaPos) {
-    // move selected elements
-    foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdBoardViaEdit* cmd, mViaEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdBoardNetPointEdit* cmd, mNetPointEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdBoardPlaneEdit* cmd, mPlaneEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdPolygonEdit* cmd, mPolygonEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdStrokeTextEdit* cmd, mStrokeTextEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
-      cmd->translate(delta - mDeltaPos, true);
-    }
-    mDeltaPos = delta;
+  if (delta != mTargetDeltaPos) {
+    mTargetDeltaPos = delta;
+    if (mItemCount < sDeferredUpdateThreshold) {
+      applyPendingTranslation();
 
-    // Force updating airwires immediately as they are important while moving
-    // items.
-    mBoard.triggerAirWiresRebuild();
+      // Force updating airwires immediately as they are important while
+      // moving items.
+      mBoard.triggerAirWiresRebuild();
+    } else {
+      // Coalesce mouse move events and rebuild the airwires only when the
+      // cursor rests for a moment, to keep dragging many items responsive.
+      if (!mUpdateTimer.isActive()) {
+        mUpdateTimer.start();
+      }
+      mAirWiresTimer.start();
+    }
   }
 }
 
 void CmdDragSelectedBoardItems::rotate(const Angle& angle,
                                        bool aroundCurrentPosition) noexcept {
+  flushDeferredUpdates();
   const Point center = (aroundCurrentPosition && (mItemCount > 1))
       ? (mStartPos + mDeltaPos).mappedToGrid(mBoard.getGridInterval())
       : (mCenterPos + mDeltaPos);
@@ -254,11 +257,53 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
   mBoard.triggerAirWiresRebuild();
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void CmdDragSelectedBoardItems::applyPendingTranslation() noexcept {
+  mUpdateTimer.stop();
+  if (mTargetDeltaPos == mDeltaPos) {
+    return;
+  }
+
+  // move selected elements
+  const Point delta = mTargetDeltaPos - mDeltaPos;
+  foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
+    cmd->translate(delta, true);
+  }
+  foreach (CmdBoardViaEdit* cmd, mViaEditCmds) { cmd->translate(delta, true); }
+  foreach (CmdBoardNetPointEdit* cmd, mNetPointEditCmds) {
+    cmd->translate(delta, true);
+  }
+  foreach (CmdBoardPlaneEdit* cmd, mPlaneEditCmds) {
+    cmd->translate(delta, true);
+  }
+  foreach (CmdPolygonEdit* cmd, mPolygonEditCmds) {
+    cmd->translate(delta, true);
+  }
+  foreach (CmdStrokeTextEdit* cmd, mStrokeTextEditCmds) {
+    cmd->translate(delta, true);
+  }
+  foreach (CmdHoleEdit* cmd, mHoleEditCmds) { cmd->translate(delta, true); }
+  mDeltaPos = mTargetDeltaPos;
+}
+
+void CmdDragSelectedBoardItems::flushDeferredUpdates() noexcept {
+  applyPendingTranslation();
+  if (mAirWiresTimer.isActive()) {
+    mAirWiresTimer.stop();
+    mBoard.triggerAirWiresRebuild();
+  }
+}
+
 /*******************************************************************************
  *  Inherited from UndoCommand
  ******************************************************************************/
 
 bool CmdDragSelectedBoardItems::performExecute() {
+  flushDeferredUpdates();
+
   if (mDeltaPos.isOrigin() && (mDeltaAngle == Angle::deg0()) &&
       (!mSnappedToGrid) && (!mTextsReset)) {
     // no movement required --> discard all commands
@@ -312,7 +357,19 @@ bool CmdDragSelectedBoardItems::performExecute() {
   }
 
   // execute all child commands
-  return UndoCommandGroup::performExecute();  // can throw
+  const bool modified = UndoCommandGroup::performExecute();  // can throw
+
+  // The child commands are owned by the group now, so release the lists to
+  // not retain them in the undo stack for nothing.
+  mDeviceEditCmds.clear();
+  mDeviceStrokeTextsResetCmds.clear();
+  mViaEditCmds.clear();
+  mNetPointEditCmds.clear();
+  mPlaneEditCmds.clear();
+  mPolygonEditCmds.clear();
+  mStrokeTextEditCmds.clear();
+  mHoleEditCmds.clear();
+  return modified;
 }
 
 /*******************************************************************************
@@ -54,6 +54,15 @@ class CmdStrokeTextEdit;
 
 /**
  * @brief The CmdDragSelectedBoardItems class
+ *
+ * For large selections (see #sDeferredUpdateThreshold), moving the items on
+ * every mouse move event would be too slow since each item updates its
+ * graphics items and geometry, and the air wires of all affected nets are
+ * rebuilt. Therefore in this case #setCurrentPosition() only records the new
+ * position, the items are moved at most once per #sUpdateIntervalMs and the
+ * air wires are rebuilt only once the cursor rests for #sAirWiresDelayMs, or
+ * when the command gets executed. The final item positions are not affected
+ * by this.
  */
 class CmdDragSelectedBoardItems final : public UndoCommandGroup {
 public:
@@ -71,6 +80,8 @@ public:
 
 private:
   // Private Methods
+  void applyPendingTranslation() noexcept;
+  void flushDeferredUpdates() noexcept;
 
   /// @copydoc ::librepcb::editor::UndoCommand::performExecute()
   bool performExecute() override;
@@ -79,7 +90,8 @@ private:
   Board& mBoard;
   int mItemCount;
   Point mStartPos;
-  Point mDeltaPos;
+  Point mDeltaPos;  ///< Translation applied to the items
+  Point mTargetDeltaPos;  ///< Translation requested by setCurrentPosition()
   Point mCenterPos;
   Angle mDeltaAngle;
   bool mSnappedToGrid;
@@ -94,6 +106,15 @@ private:
   QList<CmdPolygonEdit*> mPolygonEditCmds;
   QList<CmdStrokeTextEdit*> mStrokeTextEditCmds;
   QList<CmdHoleEdit*> mHoleEditCmds;
+
+  // Deferred updates
+  QTimer mUpdateTimer;
+  QTimer mAirWiresTimer;
+
+  // Static Variables
+  static constexpr int sDeferredUpdateThreshold = 50;  ///< Min. item count
+  static constexpr int sUpdateIntervalMs = 15;  ///< Max. ~60 updates per sec
+  static constexpr int sAirWiresDelayMs = 150;  ///< Idle time for air wires
 };
 
 /*******************************************************************************
@@ -0,0 +1,99 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "memoryusagedialog.h"
+
+#include "projecteditor.h"
+#include "ui_memoryusagedialog.h"
+
+#include <librepcb/core/project/projectmemoryreport.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+MemoryUsageDialog::MemoryUsageDialog(ProjectEditor& editor,
+                                     QWidget* parent) noexcept
+  : QDialog(parent), mEditor(editor), mUi(new Ui::MemoryUsageDialog) {
+  mUi->setupUi(this);
+  mUi->tblEntries->horizontalHeader()->setSectionResizeMode(
+      0, QHeaderView::Stretch);
+  mUi->tblEntries->horizontalHeader()->setSectionResizeMode(
+      1, QHeaderView::ResizeToContents);
+  mUi->tblEntries->horizontalHeader()->setSectionResizeMode(
+      2, QHeaderView::ResizeToContents);
+  connect(mUi->btnCompact, &QPushButton::clicked, this,
+          &MemoryUsageDialog::compactButtonClicked);
+  updateReport();
+}
+
+MemoryUsageDialog::~MemoryUsageDialog() noexcept {
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void MemoryUsageDialog::compactButtonClicked() noexcept {
+  QApplication::setOverrideCursor(Qt::WaitCursor);
+  mEditor.compactHiddenBoardsAndSchematics();
+  updateReport();
+  QApplication::restoreOverrideCursor();
+}
+
+void MemoryUsageDialog::updateReport() noexcept {
+  const ProjectMemoryReport report = mEditor.createMemoryReport();
+  const QVector<ProjectMemoryReport::Entry>& entries = report.getEntries();
+  mUi->tblEntries->setRowCount(entries.count());
+  for (int i = 0; i < entries.count(); ++i) {
+    const ProjectMemoryReport::Entry& entry = entries.at(i);
+    QTableWidgetItem* nameItem = new QTableWidgetItem(entry.name);
+    QTableWidgetItem* countItem =
+        new QTableWidgetItem(QString::number(entry.count));
+    countItem->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    QTableWidgetItem* sizeItem =
+        new QTableWidgetItem(ProjectMemoryReport::formatBytes(entry.bytes));
+    sizeItem->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+    mUi->tblEntries->setItem(i, 0, nameItem);
+    mUi->tblEntries->setItem(i, 1, countItem);
+    mUi->tblEntries->setItem(i, 2, sizeItem);
+  }
+  mUi->lblTotal->setText(
+      tr("Total: %1")
+          .arg(ProjectMemoryReport::formatBytes(report.getTotalBytes())));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
@@ -0,0 +1,81 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_EDITOR_MEMORYUSAGEDIALOG_H
+#define LIBREPCB_EDITOR_MEMORYUSAGEDIALOG_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+
+class ProjectEditor;
+
+namespace Ui {
+class MemoryUsageDialog;
+}
+
+/*******************************************************************************
+ *  Class MemoryUsageDialog
+ ******************************************************************************/
+
+/**
+ * @brief Shows the approximate memory usage of an opened project
+ *
+ * Also allows to release caches of boards and schematics which are not active
+ * in an editor, see #ProjectEditor::compactHiddenBoardsAndSchematics().
+ */
+class MemoryUsageDialog final : public QDialog {
+  Q_OBJECT
+
+public:
+  // Constructors / Destructor
+  MemoryUsageDialog() = delete;
+  MemoryUsageDialog(const MemoryUsageDialog& other) = delete;
+  explicit MemoryUsageDialog(ProjectEditor& editor,
+                             QWidget* parent = nullptr) noexcept;
+  ~MemoryUsageDialog() noexcept;
+
+  // Operator Overloads
+  MemoryUsageDialog& operator=(const MemoryUsageDialog& rhs) = delete;
+
+private:  // Methods
+  void compactButtonClicked() noexcept;
+  void updateReport() noexcept;
+
+private:  // Data
+  ProjectEditor& mEditor;
+  QScopedPointer<Ui::MemoryUsageDialog> mUi;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace editor
+}  // namespace librepcb
+
+#endif
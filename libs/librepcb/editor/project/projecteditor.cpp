@@ -26,13 +26,17 @@
 #include "../undostack.h"
 #include "boardeditor/boardeditor.h"
 #include "circuit/editnetclassesdialog.h"
+#include "memoryusagedialog.h"
 #include "orderpcbdialog.h"
 #include "projectsettingsdialog.h"
 #include "schematiceditor/schematiceditor.h"
 
 #include <librepcb/core/application.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectmemoryreport.h>
+#include <librepcb/core/project/schematic/schematic.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacesettings.h>
 
@@ -76,6 +80,16 @@ ProjectEditor::ProjectEditor(
     throw;  // ...and rethrow the exception
   }
 
+  // limit the memory used by the undo stack, as configured in the settings
+  auto updateUndoMemoryBudget = [this]() {
+    mUndoStack->setMemoryBudget(
+        qint64(mWorkspace.getSettings().projectUndoMemoryBudgetMb.get()) *
+        1024 * 1024);
+  };
+  updateUndoMemoryBudget();
+  connect(&mWorkspace.getSettings().projectUndoMemoryBudgetMb,
+          &WorkspaceSettingsItem::edited, this, updateUndoMemoryBudget);
+
   // setup the timer for automatic backups, if enabled in the settings
   int intervalSecs =
       mWorkspace.getSettings().projectAutosaveIntervalSeconds.get();
@@ -149,6 +163,31 @@ bool ProjectEditor::windowIsAboutToClose(QMainWindow& window) noexcept {
   }
 }
 
+ProjectMemoryReport ProjectEditor::createMemoryReport() const noexcept {
+  ProjectMemoryReport report(mProject);
+  report.addEntry("undo_stack", tr("Undo stack"), mUndoStack->getCommandCount(),
+                  mUndoStack->getRetainedSize());
+  return report;
+}
+
+void ProjectEditor::compactHiddenBoardsAndSchematics() noexcept {
+  // The active board and schematic are never compacted, even if their editor
+  // is hidden. The released caches are only restored when switching to
+  // another board or schematic, but not when showing the editor again.
+  const Board* activeBoard = mBoardEditor->getActiveBoard();
+  foreach (Board* board, mProject.getBoards()) {
+    if (board != activeBoard) {
+      board->compact();
+    }
+  }
+  const Schematic* activeSchematic = mSchematicEditor->getActiveSchematic();
+  foreach (Schematic* schematic, mProject.getSchematics()) {
+    if (schematic != activeSchematic) {
+      schematic->compact();
+    }
+  }
+}
+
 /*******************************************************************************
  *  Public Slots
  ******************************************************************************/
@@ -250,6 +289,11 @@ void ProjectEditor::execOrderPcbDialog(QWidget* parent) noexcept {
   dialog.exec();
 }
 
+void ProjectEditor::execMemoryUsageDialog(QWidget* parent) noexcept {
+  MemoryUsageDialog dialog(*this, parent);
+  dialog.exec();
+}
+
 bool ProjectEditor::saveProject() noexcept {
   try {
     qDebug() << "Save project...";
@@ -43,6 +43,7 @@ class Board;
 class FilePath;
 class LengthUnit;
 class Project;
+class ProjectMemoryReport;
 class Workspace;
 
 namespace editor {
@@ -126,6 +127,23 @@ public:
    */
   bool windowIsAboutToClose(QMainWindow& window) noexcept;
 
+  /**
+   * @brief Estimate the memory used by the project and its undo stack
+   *
+   * @return The report of all subsystems.
+   */
+  ProjectMemoryReport createMemoryReport() const noexcept;
+
+  /**
+   * @brief Release regenerable caches of all boards and schematics which are
+   *        currently not displayed
+   *
+   * The active board and schematic of the editors are kept as they are, even
+   * if the corresponding editor window is hidden. See Board::compact() and
+   * Schematic::compact() for details.
+   */
+  void compactHiddenBoardsAndSchematics() noexcept;
+
   // Operator Overloadings
   ProjectEditor& operator=(const Project& rhs) = delete;
 
@@ -179,6 +197,13 @@ public slots:
    */
   void execOrderPcbDialog(QWidget* parent = nullptr) noexcept;
 
+  /**
+   * @brief Execute the memory usage dialog (blocking!)
+   *
+   * @param parent    Parent widget of the dialog (optional)
+   */
+  void execMemoryUsageDialog(QWidget* parent = nullptr) noexcept;
+
   /**
    * @brief Save the whole project to the harddisc
    *
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "schematicclipboarddata.h"
 
+#include <librepcb/core/exceptions.h>
 #include <librepcb/core/fileio/transactionaldirectory.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
 #include <librepcb/core/library/librarybaseelement.h>
@@ -35,13 +36,61 @@
 namespace librepcb {
 namespace editor {
 
+/*******************************************************************************
+ *  Class SchematicClipboardData::MimeData
+ ******************************************************************************/
+
+/**
+ * @brief MIME data holding a copy of the clipboard data
+ *
+ * The zip file is created on the first request only, so it is not needed at
+ * all when pasting within the same application.
+ */
+class SchematicClipboardData::MimeData final : public QMimeData {
+public:
+  explicit MimeData(std::unique_ptr<SchematicClipboardData> data) noexcept
+    : QMimeData(), mData(std::move(data)), mSerialized(false) {}
+  const SchematicClipboardData& getData() const noexcept { return *mData; }
+  QStringList formats() const override {
+    return {getMimeType(), "application/zip"};
+  }
+  bool hasFormat(const QString& mimeType) const override {
+    return formats().contains(mimeType);
+  }
+
+protected:
+  QVariant retrieveData(const QString& mimeType,
+                        QVariant::Type type) const override {
+    if (!formats().contains(mimeType)) {
+      return QMimeData::retrieveData(mimeType, type);
+    }
+    if (!mSerialized) {
+      mSerialized = true;
+      try {
+        mData->mFileSystem->write("schematic.lp",
+                                  mData->serialize().toByteArray());
+        mZip = mData->mFileSystem->exportToZip();
+      } catch (const Exception& e) {
+        qCritical() << "Failed to serialize schematic clipboard data:"
+                    << e.getMsg();
+      }
+    }
+    return mZip;
+  }
+
+private:
+  std::unique_ptr<SchematicClipboardData> mData;
+  mutable bool mSerialized;
+  mutable QByteArray mZip;
+};
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
 SchematicClipboardData::SchematicClipboardData(const Uuid& schematicUuid,
                                                const Point& cursorPos) noexcept
-  : mFileSystem(TransactionalFileSystem::openRW(FilePath::getRandomTempPath())),
+  : mFileSystem(TransactionalFileSystem::openTemporary()),
     mSchematicUuid(schematicUuid),
     mCursorPos(cursorPos),
     mComponentInstances(),
@@ -66,12 +115,21 @@ SchematicClipboardData::SchematicClipboardData(const QByteArray& mimeData)
   mTexts.loadFromSExpression(root);
 }
 
+SchematicClipboardData::SchematicClipboardData(
+    const SchematicClipboardData& other) noexcept
+  : mFileSystem(other.mFileSystem),
+    mSchematicUuid(other.mSchematicUuid),
+    mCursorPos(other.mCursorPos),
+    mComponentInstances(other.mComponentInstances),
+    mSymbolInstances(other.mSymbolInstances),
+    mNetSegments(other.mNetSegments),
+    mPolygons(other.mPolygons),
+    mTexts(other.mTexts) {
+}
+
 SchematicClipboardData::~SchematicClipboardData() noexcept {
-  // Clean up the temporary directory, but destroy the TransactionalFileSystem
-  // object first since it has a lock on the directory.
-  FilePath fp = mFileSystem->getAbsPath();
-  mFileSystem.reset();
-  QDir(fp.toStr()).removeRecursively();
+  // Note: The temporary directory is removed by the file system itself as
+  // soon as it is not used anymore.
 }
 
 /*******************************************************************************
@@ -89,6 +147,32 @@ std::unique_ptr<TransactionalDirectory> SchematicClipboardData::getDirectory(
  ******************************************************************************/
 
 std::unique_ptr<QMimeData> SchematicClipboardData::toMimeData() const {
+  return std::unique_ptr<QMimeData>(
+      new MimeData(std::unique_ptr<SchematicClipboardData>(
+          new SchematicClipboardData(*this))));
+}
+
+std::unique_ptr<SchematicClipboardData> SchematicClipboardData::fromMimeData(
+    const QMimeData* mime) {
+  if (const MimeData* data = dynamic_cast<const MimeData*>(mime)) {
+    // Copied within this application, no need to deserialize anything.
+    return std::unique_ptr<SchematicClipboardData>(
+        new SchematicClipboardData(data->getData()));
+  }
+  QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
+  if (!content.isNull()) {
+    return std::unique_ptr<SchematicClipboardData>(
+        new SchematicClipboardData(content));  // can throw
+  } else {
+    return nullptr;
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+SExpression SchematicClipboardData::serialize() const {
   SExpression root = SExpression::createList("librepcb_clipboard_schematic");
   root.ensureLineBreak();
   mCursorPos.serialize(root.appendList("cursor_position"));
@@ -105,31 +189,9 @@ std::unique_ptr<QMimeData> SchematicClipboardData::toMimeData() const {
   root.ensureLineBreak();
   mTexts.serialize(root);
   root.ensureLineBreak();
-  mFileSystem->write("schematic.lp", root.toByteArray());
-
-  QByteArray zip = mFileSystem->exportToZip();
-
-  std::unique_ptr<QMimeData> data(new QMimeData());
-  data->setData(getMimeType(), zip);
-  data->setData("application/zip", zip);
-  return data;
-}
-
-std::unique_ptr<SchematicClipboardData> SchematicClipboardData::fromMimeData(
-    const QMimeData* mime) {
-  QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
-  if (!content.isNull()) {
-    return std::unique_ptr<SchematicClipboardData>(
-        new SchematicClipboardData(content));  // can throw
-  } else {
-    return nullptr;
-  }
+  return root;
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
-
 QString SchematicClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.schematic; version=%1")
       .arg(qApp->applicationVersion());
@@ -51,6 +51,9 @@ namespace editor {
 
 /**
  * @brief The SchematicClipboardData class
+ *
+ * See ::librepcb::editor::BoardClipboardData for how copy and paste within
+ * the same application avoids the serialization.
  */
 class SchematicClipboardData final {
 public:
@@ -82,6 +85,16 @@ public:
         attributes(attributes),
         onEdited(*this) {}
 
+    ComponentInstance(const ComponentInstance& other) noexcept
+      : uuid(other.uuid),
+        libComponentUuid(other.libComponentUuid),
+        libVariantUuid(other.libVariantUuid),
+        libDeviceUuid(other.libDeviceUuid),
+        name(other.name),
+        value(other.value),
+        attributes(other.attributes),
+        onEdited(*this) {}
+
     explicit ComponentInstance(const SExpression& node)
       : uuid(deserialize<Uuid>(node.getChild("@0"))),
         libComponentUuid(deserialize<Uuid>(node.getChild("lib_component/@0"))),
@@ -145,6 +158,16 @@ public:
         texts(texts),
         onEdited(*this) {}
 
+    SymbolInstance(const SymbolInstance& other) noexcept
+      : uuid(other.uuid),
+        componentInstanceUuid(other.componentInstanceUuid),
+        symbolVariantItemUuid(other.symbolVariantItemUuid),
+        position(other.position),
+        rotation(other.rotation),
+        mirrored(other.mirrored),
+        texts(other.texts),
+        onEdited(*this) {}
+
     explicit SymbolInstance(const SExpression& node)
       : uuid(deserialize<Uuid>(node.getChild("@0"))),
         componentInstanceUuid(deserialize<Uuid>(node.getChild("component/@0"))),
@@ -191,6 +214,13 @@ public:
     explicit NetSegment(const CircuitIdentifier& netName)
       : netName(netName), junctions(), lines(), labels(), onEdited(*this) {}
 
+    NetSegment(const NetSegment& other) noexcept
+      : netName(other.netName),
+        junctions(other.junctions),
+        lines(other.lines),
+        labels(other.labels),
+        onEdited(*this) {}
+
     explicit NetSegment(const SExpression& node)
       : netName(deserialize<CircuitIdentifier>(node.getChild("net/@0"))),
         junctions(node),
@@ -218,7 +248,16 @@ public:
 
   // Constructors / Destructor
   SchematicClipboardData() = delete;
-  SchematicClipboardData(const SchematicClipboardData& other) = delete;
+
+  /**
+   * @brief Copy constructor
+   *
+   * All items are copied, but the library elements are shared with the
+   * other object since they are never modified.
+   *
+   * @param other   The object to copy.
+   */
+  SchematicClipboardData(const SchematicClipboardData& other) noexcept;
   SchematicClipboardData(const Uuid& schematicUuid,
                          const Point& cursorPos) noexcept;
   explicit SchematicClipboardData(const QByteArray& mimeData);
@@ -251,7 +290,11 @@ public:
   // Operator Overloadings
   SchematicClipboardData& operator=(const SchematicClipboardData& rhs) = delete;
 
+private:  // Types
+  class MimeData;
+
 private:  // Methods
+  SExpression serialize() const;
   static QString getMimeType() noexcept;
 
 private:  // Data
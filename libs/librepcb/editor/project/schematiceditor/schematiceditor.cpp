@@ -367,6 +367,8 @@ void SchematicEditor::createActions() noexcept {
         emit mProjectEditor.openProjectLibraryUpdaterClicked(
             mProject.getFilepath());
       }));
+  mActionMemoryUsage.reset(cmd.memoryUsage.createAction(
+      this, this, [this]() { mProjectEditor.execMemoryUsageDialog(this); }));
   mActionExportLppz.reset(cmd.exportLppz.createAction(
       this, this, [this]() { mProjectEditor.execLppzExportDialog(this); }));
   mActionExportImage.reset(cmd.exportImage.createAction(this, this, [this]() {
@@ -819,6 +821,7 @@ void SchematicEditor::createMenus() noexcept {
   mb.addAction(mActionProjectSettings);
   mb.addSeparator();
   mb.addAction(mActionUpdateLibrary);
+  mb.addAction(mActionMemoryUsage);
 
   // Tools.
   mb.newMenu(&MenuBuilder::createToolsMenu);
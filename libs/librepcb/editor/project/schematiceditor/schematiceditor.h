@@ -152,6 +152,7 @@ private:
   QScopedPointer<QAction> mActionProjectSettings;
   QScopedPointer<QAction> mActionNetClasses;
   QScopedPointer<QAction> mActionUpdateLibrary;
+  QScopedPointer<QAction> mActionMemoryUsage;
   QScopedPointer<QAction> mActionExportLppz;
   QScopedPointer<QAction> mActionExportImage;
   QScopedPointer<QAction> mActionExportPdf;
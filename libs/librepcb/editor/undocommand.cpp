@@ -44,6 +44,14 @@ UndoCommand::~UndoCommand() noexcept {
   Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommand::getRetainedSize() const noexcept {
+  return sizeof(UndoCommand) + mText.capacity() * qint64(sizeof(QChar));
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -74,6 +74,17 @@ public:
    */
   bool isCurrentlyExecuted() const noexcept { return mRedoCount > mUndoCount; }
 
+  /**
+   * @brief Estimate the memory retained by this command
+   *
+   * Used by ::librepcb::editor::UndoStack to limit the memory used by the
+   * undo history. Derived classes which hold a considerable amount of data
+   * (e.g. paths) should add it to the size returned by this implementation.
+   *
+   * @return Approximate size in bytes.
+   */
+  virtual qint64 getRetainedSize() const noexcept;
+
   // General Methods
 
   /**
@@ -48,6 +48,19 @@ UndoCommandGroup::~UndoCommandGroup() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommandGroup::getRetainedSize() const noexcept {
+  qint64 size = UndoCommand::getRetainedSize() +
+      mChilds.count() * qint64(sizeof(UndoCommand*));
+  foreach (const UndoCommand* cmd, mChilds) {
+    size += cmd->getRetainedSize();
+  }
+  return size;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
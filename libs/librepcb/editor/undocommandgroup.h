@@ -54,6 +54,9 @@ public:
   // Getters
   int getChildCount() const noexcept { return mChilds.count(); }
 
+  /// @copydoc ::librepcb::editor::UndoCommand::getRetainedSize()
+  virtual qint64 getRetainedSize() const noexcept override;
+
   // General Methods
 
   /**
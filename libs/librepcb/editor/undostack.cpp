@@ -80,7 +80,9 @@ UndoStack::UndoStack() noexcept
   : QObject(nullptr),
     mCurrentIndex(0),
     mCleanIndex(0),
-    mActiveCommandGroup(nullptr) {
+    mActiveCommandGroup(nullptr),
+    mMemoryBudget(0),
+    mRetainedSize(0) {
 }
 
 UndoStack::~UndoStack() noexcept {
@@ -129,6 +131,26 @@ uint UndoStack::getUniqueStateId() const noexcept {
   return id;
 }
 
+QString UndoStack::getCommandText(int index) const noexcept {
+  if ((index >= 0) && (index < mCommands.count())) {
+    return mCommands.at(index)->getText();
+  } else {
+    return QString();
+  }
+}
+
+qint64 UndoStack::getCommandRetainedSize(int index) const noexcept {
+  if ((index >= 0) && (index < mCommands.count())) {
+    return mCommandSizes.at(index);
+  } else {
+    return 0;
+  }
+}
+
+qint64 UndoStack::getRetainedSize() const noexcept {
+  return mRetainedSize;
+}
+
 bool UndoStack::isClean() const noexcept {
   return (mCurrentIndex == mCleanIndex);
 }
@@ -149,6 +171,11 @@ void UndoStack::setClean() noexcept {
   emit cleanChanged(true);
 }
 
+void UndoStack::setMemoryBudget(qint64 bytes) noexcept {
+  mMemoryBudget = qMax(bytes, qint64(0));
+  enforceMemoryBudget();
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -177,6 +204,7 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // impossible)
     // --> in reverse order (from top to bottom)!
     while (mCurrentIndex < mCommands.count()) {
+      mRetainedSize -= mCommandSizes.takeLast();
       delete mCommands.takeLast();
     }
     Q_ASSERT(mCurrentIndex == mCommands.count());
@@ -184,6 +212,8 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // add command to the command stack
     mCommands.append(
         cmdScopeGuard.take());  // move ownership of "cmd" to "mCommands"
+    mCommandSizes.append(cmd->getRetainedSize());
+    mRetainedSize += mCommandSizes.last();
     mCurrentIndex++;
 
     // emit signals
@@ -193,6 +223,10 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     emit canRedoChanged(false);
     emit cleanChanged(false);
     emit stateModified();
+
+    // Note: If a command group is being started, it is not yet active here
+    // and it is the most recent command so it will not be discarded.
+    enforceMemoryBudget();
   } else {
     // the command has done nothing, so we will just discard it
     cmd->undo();  // only to be sure the command has executed nothing...
@@ -251,9 +285,15 @@ bool UndoStack::commitCmdGroup() {
     return false;
   }
 
+  // The command group might have grown considerably, so update its size.
+  const qint64 size = mActiveCommandGroup->getRetainedSize();
+  mRetainedSize += size - mCommandSizes.last();
+  mCommandSizes.last() = size;
+
   // To finish the active command group, we only need to reset the pointer to
   // the currently active command group
   mActiveCommandGroup = nullptr;
+  enforceMemoryBudget();
 
   // emit signals
   emit canUndoChanged(canUndo());
@@ -273,6 +313,7 @@ void UndoStack::abortCmdGroup() {
     mActiveCommandGroup->undo();  // can throw (but should usually not)
     mActiveCommandGroup = nullptr;
     mCurrentIndex--;
+    mRetainedSize -= mCommandSizes.takeLast();
     delete mCommands.takeLast();  // delete and remove the aborted command group
                                   // from the stack
   } catch (Exception& e) {
@@ -352,6 +393,8 @@ void UndoStack::clear() noexcept {
   while (!mCommands.isEmpty()) {
     delete mCommands.takeLast();
   }
+  mCommandSizes.clear();
+  mRetainedSize = 0;
 
   mCurrentIndex = 0;
   mCleanIndex = 0;
@@ -365,6 +408,33 @@ void UndoStack::clear() noexcept {
   emit cleanChanged(true);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void UndoStack::enforceMemoryBudget() noexcept {
+  if (mMemoryBudget <= 0) {
+    return;
+  }
+
+  // Only commands below the most recently executed command are discarded.
+  // An active command group is always the most recent command, so it is
+  // never affected.
+  int discarded = 0;
+  while ((mRetainedSize > mMemoryBudget) && (mCurrentIndex > 1)) {
+    mRetainedSize -= mCommandSizes.takeFirst();
+    delete mCommands.takeFirst();
+    --mCurrentIndex;
+    // If the clean state was discarded, it will no longer exist.
+    mCleanIndex = (mCleanIndex > 0) ? (mCleanIndex - 1) : -1;
+    ++discarded;
+  }
+  if (discarded > 0) {
+    qDebug() << "Discarded" << discarded
+             << "undo commands to stay within the memory budget.";
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
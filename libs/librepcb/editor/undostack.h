@@ -177,6 +177,51 @@ public:
    */
   bool isCommandGroupActive() const noexcept;
 
+  /**
+   * @brief Get the number of commands on the stack (including redo commands)
+   *
+   * @return Number of top-level commands
+   */
+  int getCommandCount() const noexcept { return mCommands.count(); }
+
+  /**
+   * @brief Get the text of a command on the stack
+   *
+   * @param index     Index of the command (0 = oldest command).
+   *
+   * @return The text of the command, or an empty string if the index is out
+   *         of range
+   */
+  QString getCommandText(int index) const noexcept;
+
+  /**
+   * @brief Get the approximate memory retained by a command on the stack
+   *
+   * @param index     Index of the command (0 = oldest command).
+   *
+   * @return Size in bytes (see ::librepcb::editor::UndoCommand::
+   *         getRetainedSize()), or 0 if the index is out of range
+   *
+   * @note  The size is determined when the command is pushed to the stack,
+   *        or when the command group is committed. The children appended to
+   *        a currently active command group are not taken into account yet.
+   */
+  qint64 getCommandRetainedSize(int index) const noexcept;
+
+  /**
+   * @brief Get the approximate memory retained by all commands on the stack
+   *
+   * @return Sum of all #getCommandRetainedSize() in bytes
+   */
+  qint64 getRetainedSize() const noexcept;
+
+  /**
+   * @brief Get the memory budget set by #setMemoryBudget()
+   *
+   * @return Budget in bytes (0 = unlimited)
+   */
+  qint64 getMemoryBudget() const noexcept { return mMemoryBudget; }
+
   // Setters
 
   /**
@@ -184,6 +229,18 @@ public:
    */
   void setClean() noexcept;
 
+  /**
+   * @brief Limit the memory retained by the commands on the stack
+   *
+   * If the commands on the stack exceed the budget, the oldest commands are
+   * discarded (so they can no longer be undone) until the stack fits into
+   * the budget again. The most recently executed command is always kept.
+   * The budget is checked whenever a command is pushed to the stack.
+   *
+   * @param bytes     Budget in bytes (0 = unlimited, which is the default)
+   */
+  void setMemoryBudget(qint64 bytes) noexcept;
+
   // General Methods
 
   /**
@@ -301,6 +358,11 @@ signals:
   void stateModified();
 
 private:
+  /**
+   * @brief Discard the oldest commands until #mMemoryBudget is satisfied
+   */
+  void enforceMemoryBudget() noexcept;
+
   /**
    * @brief This list holds all commands of the undo stack
    *
@@ -309,6 +371,14 @@ private:
    */
   QList<UndoCommand*> mCommands;
 
+  /**
+   * @brief The retained size of each command in #mCommands (same order)
+   *
+   * Determining the size requires walking through the whole command, so it
+   * is done only once when the command is pushed to the stack.
+   */
+  QList<qint64> mCommandSizes;
+
   /**
    * @brief This attribute holds the current position in the undo stack
    * #mCommands
@@ -334,6 +404,16 @@ private:
    * nullptr.
    */
   UndoCommandGroup* mActiveCommandGroup;
+
+  /**
+   * @brief Maximum memory to be retained by #mCommands (0 = unlimited)
+   */
+  qint64 mMemoryBudget;
+
+  /**
+   * @brief The sum of all #mCommandSizes
+   */
+  qint64 mRetainedSize;
 };
 
 /*******************************************************************************
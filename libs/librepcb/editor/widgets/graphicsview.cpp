@@ -62,13 +62,21 @@ GraphicsView::GraphicsView(QWidget* parent,
     mOriginCrossVisible(true),
     mUseOpenGl(false),
     mGrayOut(false),
+    mFrameTimeOverlayVisible(qgetenv("LIBREPCB_SHOW_FRAME_TIME") == "1"),
     mSceneCursor(),
     mRulerGauges({
         {1, LengthUnit::millimeters(), " ", Length(100), Length(0)},
         {-1, LengthUnit::inches(), "", Length(254), Length(0)},
     }),
     mRulerPositions(),
-    mPanningActive(false) {
+    mPanningActive(false),
+    mInteractionActive(false),
+    mFrameTimer(),
+    mFrameTimeMs(0),
+    mTileCacheEnabled(false),
+    mTileCache(sTileCacheSizeKb),
+    mTileCacheTransform(),
+    mSceneChangedConnection() {
   setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
   setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
   setOptimizationFlags(QGraphicsView::DontSavePainterState);
@@ -175,8 +183,14 @@ void GraphicsView::setScene(GraphicsScene* scene) noexcept {
   mSceneRectMarker = QRectF();  // clear marker
   if (mScene) mScene->removeEventFilter(this);
   mScene = scene;
-  if (mScene) mScene->installEventFilter(this);
+  if (mScene) {
+    // The index might have been released by Board::compact() or
+    // Schematic::compact(), restore it as it's needed for fast rendering.
+    mScene->setItemIndexMethod(QGraphicsScene::BspTreeIndex);
+    mScene->installEventFilter(this);
+  }
   QGraphicsView::setScene(mScene);
+  updateTileCacheConnection();
 }
 
 void GraphicsView::setVisibleSceneRect(const QRectF& rect) noexcept {
@@ -211,6 +225,21 @@ void GraphicsView::setOriginCrossVisible(bool visible) noexcept {
   setForegroundBrush(foregroundBrush());  // this will repaint the foreground
 }
 
+void GraphicsView::setFrameTimeOverlayVisible(bool visible) noexcept {
+  mFrameTimeOverlayVisible = visible;
+  mFrameTimeMs = 0;
+  if (!visible) {
+    mFrameTimer.invalidate();
+  }
+  viewport()->update();
+}
+
+void GraphicsView::setTileCacheEnabled(bool enabled) noexcept {
+  mTileCacheEnabled = enabled;
+  updateTileCacheConnection();
+  viewport()->update();
+}
+
 void GraphicsView::setEventHandlerObject(
     IF_GraphicsViewEventHandler* eventHandler) noexcept {
   mEventHandlerObject = eventHandler;
@@ -346,6 +375,8 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
       if (e->button() == Qt::MiddleButton) {
         mCursorBeforePanning = cursor();
         setCursor(Qt::ClosedHandCursor);
+      } else if (e->button() == Qt::LeftButton) {
+        mInteractionActive = true;
       }
       if (mEventHandlerObject) {
         mEventHandlerObject->graphicsViewEventHandler(event);
@@ -358,6 +389,8 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
       Q_ASSERT(e);
       if (e->button() == Qt::MiddleButton) {
         setCursor(mCursorBeforePanning);
+      } else if (e->button() == Qt::LeftButton) {
+        mInteractionActive = false;
       }
       if (mEventHandlerObject) {
         mEventHandlerObject->graphicsViewEventHandler(event);
@@ -407,7 +440,57 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
   return QWidget::eventFilter(obj, event);
 }
 
+void GraphicsView::paintEvent(QPaintEvent* event) {
+  // While interacting with the scene (e.g. dragging items), the changed
+  // areas would need to be re-rendered on every frame, so it's faster to
+  // paint the items directly. The tiles are still invalidated meanwhile.
+  if ((!mTileCacheEnabled) || mUseOpenGl || (!mScene) || mInteractionActive) {
+    QGraphicsView::paintEvent(event);
+    return;
+  }
+
+  // All tiles become invalid when zooming.
+  if (transform() != mTileCacheTransform) {
+    mTileCache.clear();
+    mTileCacheTransform = transform();
+  }
+
+  const QRect exposedRect = event->rect();
+  const QRectF exposedSceneRect = mapToScene(exposedRect).boundingRect();
+  QPainter painter(viewport());
+  painter.setRenderHints(renderHints());
+
+  // Background and foreground are not cached since they are cheap to draw
+  // and contain view-dependent overlays.
+  painter.setTransform(viewportTransform());
+  drawBackground(&painter, exposedSceneRect);
+
+  // Tiles are aligned to the scene origin (without scroll offset), so they
+  // stay valid while panning. The offset is rounded to avoid blurry tiles.
+  painter.resetTransform();
+  const QPoint offset = viewportTransform().map(QPointF(0, 0)).toPoint() -
+      transform().map(QPointF(0, 0)).toPoint();
+  const QRect tileArea = exposedRect.translated(-offset);
+  const int xMin = qFloor(tileArea.left() / qreal(sTileSize));
+  const int xMax = qFloor(tileArea.right() / qreal(sTileSize));
+  const int yMin = qFloor(tileArea.top() / qreal(sTileSize));
+  const int yMax = qFloor(tileArea.bottom() / qreal(sTileSize));
+  for (int y = yMin; y <= yMax; ++y) {
+    for (int x = xMin; x <= xMax; ++x) {
+      painter.drawPixmap(offset + QPoint(x * sTileSize, y * sTileSize),
+                         getTile(x, y));
+    }
+  }
+
+  painter.setTransform(viewportTransform());
+  drawForeground(&painter, exposedSceneRect);
+}
+
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect) {
+  if (mFrameTimeOverlayVisible) {
+    mFrameTimer.start();
+  }
+
   QPen gridPen(mGridColor);
   gridPen.setCosmetic(true);
 
@@ -606,6 +689,109 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect) {
       painter->drawEllipse(pos, r / 2, r / 2);
     }
   }
+
+  // If enabled, draw the frame time overlay. Must be the last step to
+  // measure the whole frame.
+  if (mFrameTimeOverlayVisible) {
+    drawFrameTimeOverlay(painter);
+  }
+}
+
+void GraphicsView::drawFrameTimeOverlay(QPainter* painter) noexcept {
+  if (!mFrameTimer.isValid()) {
+    return;
+  }
+
+  // Low-pass filter the measured time to get a readable value.
+  const qreal elapsedMs = mFrameTimer.nsecsElapsed() / qreal(1000000);
+  if (mFrameTimeMs > 0) {
+    mFrameTimeMs = (mFrameTimeMs * 0.8) + (elapsedMs * 0.2);
+  } else {
+    mFrameTimeMs = elapsedMs;
+  }
+  const QString text = QString("%1 ms (LOD %2)")
+                           .arg(mFrameTimeMs, 0, 'f', 1)
+                           .arg(QStyleOptionGraphicsItem::
+                                    levelOfDetailFromTransform(transform()),
+                                0, 'f', 2);
+
+  // Draw in viewport coordinates.
+  painter->save();
+  painter->resetTransform();
+  painter->setFont(qApp->getDefaultMonospaceFont());
+  const QFontMetricsF metrics(painter->font());
+  const QRectF textRect(QPointF(5, 5),
+                        metrics.size(Qt::TextSingleLine, text) + QSizeF(10, 6));
+  painter->setPen(Qt::NoPen);
+  painter->setBrush(mOverlayFillColor);
+  painter->drawRect(textRect);
+  painter->setPen(mOverlayContentColor);
+  painter->drawText(textRect, Qt::AlignCenter, text);
+  painter->restore();
+}
+
+void GraphicsView::updateTileCacheConnection() noexcept {
+  // Only connect to the changed() signal if required since it makes the
+  // scene tracking the changed areas, which has some overhead.
+  disconnect(mSceneChangedConnection);
+  mTileCache.clear();
+  if (mTileCacheEnabled && mScene) {
+    mSceneChangedConnection = connect(mScene, &QGraphicsScene::changed, this,
+                                      &GraphicsView::invalidateTiles);
+  }
+}
+
+void GraphicsView::invalidateTiles(const QList<QRectF>& sceneRects) noexcept {
+  foreach (const QRectF& sceneRect, sceneRects) {
+    // Add some margin for antialiasing.
+    const QRectF rect =
+        mTileCacheTransform.mapRect(sceneRect).adjusted(-2, -2, 2, 2);
+    const int xMin = qFloor(rect.left() / sTileSize);
+    const int xMax = qFloor(rect.right() / sTileSize);
+    const int yMin = qFloor(rect.top() / sTileSize);
+    const int yMax = qFloor(rect.bottom() / sTileSize);
+    if ((qint64(xMax - xMin + 1) * (yMax - yMin + 1)) > mTileCache.count()) {
+      // Faster to check each cached tile than each affected tile.
+      foreach (quint64 key, mTileCache.keys()) {
+        const int x = static_cast<qint32>(key >> 32);
+        const int y = static_cast<qint32>(key & 0xFFFFFFFF);
+        if ((x >= xMin) && (x <= xMax) && (y >= yMin) && (y <= yMax)) {
+          mTileCache.remove(key);
+        }
+      }
+    } else {
+      for (int y = yMin; y <= yMax; ++y) {
+        for (int x = xMin; x <= xMax; ++x) {
+          mTileCache.remove((quint64(quint32(x)) << 32) | quint32(y));
+        }
+      }
+    }
+  }
+}
+
+const QPixmap& GraphicsView::getTile(int x, int y) noexcept {
+  const quint64 key = (quint64(quint32(x)) << 32) | quint32(y);
+  if (QPixmap* tile = mTileCache.object(key)) {
+    return *tile;
+  }
+
+  // Render all scene items within the tile area. Note that the scene does
+  // not draw any background since that is done by the view.
+  const qreal dpr = viewport()->devicePixelRatioF();
+  QPixmap* tile = new QPixmap(QSize(sTileSize, sTileSize) * dpr);
+  tile->setDevicePixelRatio(dpr);
+  tile->fill(Qt::transparent);
+  {
+    const QRect target(0, 0, sTileSize, sTileSize);
+    const QRectF source = mTileCacheTransform.inverted().mapRect(
+        QRectF(target.translated(x * sTileSize, y * sTileSize)));
+    QPainter painter(tile);
+    painter.setRenderHints(renderHints());
+    mScene->render(&painter, target, source, Qt::IgnoreAspectRatio);
+  }
+  const int costKb = qMax((tile->width() * tile->height() * 4) / 1024, 1);
+  mTileCache.insert(key, tile, costKb);  // Takes ownership.
+  return *mTileCache.object(key);
 }
 
 /*******************************************************************************
@@ -103,6 +103,36 @@ public:
       const tl::optional<std::pair<Point, Point>>& pos) noexcept;
   void setInfoBoxText(const QString& text) noexcept;
   void setOriginCrossVisible(bool visible) noexcept;
+
+  /**
+   * @brief Show or hide the frame time overlay
+   *
+   * If enabled, the time spent for rendering the last frames is displayed
+   * in the top left corner of the view. This is intended to verify the
+   * rendering performance (e.g. of level-of-detail optimizations). It can
+   * also be enabled with the environment variable
+   * `LIBREPCB_SHOW_FRAME_TIME=1`.
+   *
+   * @param visible   Whether the overlay shall be visible or not.
+   */
+  void setFrameTimeOverlayVisible(bool visible) noexcept;
+
+  /**
+   * @brief Enable or disable the tile cache
+   *
+   * If enabled, the scene items are rasterized into tiles at the current
+   * zoom level, which are then just recomposited when repainting the view
+   * (e.g. while panning). Tiles are invalidated only for the areas of the
+   * scene which have changed, and all tiles are invalidated when zooming.
+   *
+   * This speeds up panning of large scenes, especially on machines without
+   * GPU. While the left mouse button is pressed (e.g. when dragging items),
+   * the cache is bypassed since the scene changes on every frame anyway. It
+   * has no effect if OpenGL is used.
+   *
+   * @param enabled   Whether the tile cache shall be used or not.
+   */
+  void setTileCacheEnabled(bool enabled) noexcept;
   void setEventHandlerObject(
       IF_GraphicsViewEventHandler* eventHandler) noexcept;
 
@@ -143,6 +173,11 @@ private:
   bool eventFilter(QObject* obj, QEvent* event);
   void drawBackground(QPainter* painter, const QRectF& rect);
   void drawForeground(QPainter* painter, const QRectF& rect);
+  void paintEvent(QPaintEvent* event);
+  void drawFrameTimeOverlay(QPainter* painter) noexcept;
+  void updateTileCacheConnection() noexcept;
+  void invalidateTiles(const QList<QRectF>& sceneRects) noexcept;
+  const QPixmap& getTile(int x, int y) noexcept;
 
   // General Attributes
   QScopedPointer<QLabel> mInfoBoxLabel;
@@ -159,6 +194,7 @@ private:
   bool mOriginCrossVisible;
   bool mUseOpenGl;
   bool mGrayOut;
+  bool mFrameTimeOverlayVisible;
 
   /// If not nullopt, a cursor will be shown at the given position
   tl::optional<std::pair<Point, CursorOptions>> mSceneCursor;
@@ -176,10 +212,21 @@ private:
 
   // State
   volatile bool mPanningActive;
+  bool mInteractionActive;  ///< Left mouse button pressed, e.g. dragging
   QCursor mCursorBeforePanning;
+  QElapsedTimer mFrameTimer;  ///< Started in #drawBackground()
+  qreal mFrameTimeMs;  ///< Smoothed render time of the last frames [ms]
+
+  // Tile cache
+  bool mTileCacheEnabled;
+  QCache<quint64, QPixmap> mTileCache;  ///< Key: x/y index, cost: kB
+  QTransform mTileCacheTransform;  ///< Transform the tiles were rendered with
+  QMetaObject::Connection mSceneChangedConnection;
 
   // Static Variables
   static constexpr qreal sZoomStepFactor = 1.3;
+  static constexpr int sTileSize = 256;  ///< Tile width/height [px]
+  static constexpr int sTileCacheSizeKb = 128 * 1024;  ///< Max. cache size
 };
 
 /*******************************************************************************
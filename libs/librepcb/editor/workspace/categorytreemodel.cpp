@@ -136,12 +136,30 @@ void CategoryTreeModel::update() noexcept {
   QElapsedTimer t;
   t.start();
 
-  // Determine new items.
-  QVector<std::shared_ptr<Item>> items = getChilds(nullptr);
-
-  // Add virtual category for library elements with no category assigned.
+  // Determine new items. All categories and element counts are fetched at
+  // once since querying them category by category is very slow for large
+  // libraries.
+  QVector<std::shared_ptr<Item>> items;
   try {
-    if (containsItems(tl::nullopt)) {
+    const QList<WorkspaceLibraryDb::Category> categories =
+        listPackageCategories()
+        ? mLibrary.getCategories<PackageCategory>(mLocaleOrder)
+        : mLibrary.getCategories<ComponentCategory>(mLocaleOrder);
+    QMultiHash<tl::optional<Uuid>, std::shared_ptr<Item>> categoryItems;
+    foreach (const WorkspaceLibraryDb::Category& category, categories) {
+      categoryItems.insert(
+          category.parent,
+          std::shared_ptr<Item>(new Item{std::weak_ptr<Item>(),
+                                         category.uuid,
+                                         category.name,
+                                         category.description,
+                                         {}}));
+    }
+    const QSet<tl::optional<Uuid>> nonEmpty = getNonEmptyCategories();
+    items = getChilds(nullptr, categoryItems, nonEmpty);
+
+    // Add virtual category for library elements with no category assigned.
+    if (nonEmpty.contains(tl::nullopt)) {
       items.append(std::shared_ptr<Item>(
           new Item{std::weak_ptr<Item>(),
                    tl::nullopt,
@@ -160,35 +178,18 @@ void CategoryTreeModel::update() noexcept {
 }
 
 QVector<std::shared_ptr<CategoryTreeModel::Item>> CategoryTreeModel::getChilds(
-    std::shared_ptr<Item> parent) const noexcept {
+    std::shared_ptr<Item> parent,
+    const QMultiHash<tl::optional<Uuid>, std::shared_ptr<Item>>& items,
+    const QSet<tl::optional<Uuid>>& nonEmpty) const noexcept {
   QVector<std::shared_ptr<Item>> childs;
   tl::optional<Uuid> parentUuid = parent ? parent->uuid : tl::nullopt;
-  try {
-    QSet<Uuid> uuids = listPackageCategories()
-        ? mLibrary.getChilds<PackageCategory>(parentUuid)
-        : mLibrary.getChilds<ComponentCategory>(parentUuid);
-    foreach (const Uuid& uuid, uuids) {
-      std::shared_ptr<Item> child(
-          new Item{parent, uuid, QString(), QString(), {}});
-      child->childs = getChilds(child);
-      if (!child->childs.isEmpty() || listAll() || containsItems(uuid)) {
-        FilePath fp = listPackageCategories()
-            ? mLibrary.getLatest<PackageCategory>(uuid)
-            : mLibrary.getLatest<ComponentCategory>(uuid);
-        if (fp.isValid()) {
-          if (listPackageCategories()) {
-            mLibrary.getTranslations<PackageCategory>(
-                fp, mLocaleOrder, &child->text, &child->tooltip);
-          } else {
-            mLibrary.getTranslations<ComponentCategory>(
-                fp, mLocaleOrder, &child->text, &child->tooltip);
-          }
-        }
-        childs.append(child);
-      }
+  foreach (const std::shared_ptr<Item>& child, items.values(parentUuid)) {
+    child->parent = parent;
+    child->childs = getChilds(child, items, nonEmpty);
+    if (!child->childs.isEmpty() || listAll() ||
+        nonEmpty.contains(child->uuid)) {
+      childs.append(child);
     }
-  } catch (const Exception& e) {
-    qCritical() << "Failed to update category tree model items:" << e.getMsg();
   }
 
   // Sort items by text.
@@ -205,27 +206,31 @@ QVector<std::shared_ptr<CategoryTreeModel::Item>> CategoryTreeModel::getChilds(
   return childs;
 }
 
-bool CategoryTreeModel::containsItems(const tl::optional<Uuid>& uuid) const {
+QSet<tl::optional<Uuid>> CategoryTreeModel::getNonEmptyCategories() const {
+  QSet<tl::optional<Uuid>> uuids;
+  auto add = [&uuids](const QHash<tl::optional<Uuid>, int>& counts) {
+    for (auto it = counts.begin(); it != counts.end(); ++it) {
+      if (it.value() > 0) {
+        uuids.insert(it.key());
+      }
+    }
+  };
   if (listPackageCategories()) {
-    if (mFilters.testFlag(Filter::PkgCatWithPackages) &&
-        (mLibrary.getByCategory<Package>(uuid, 1).count() > 0)) {
-      return true;
+    if (mFilters.testFlag(Filter::PkgCatWithPackages)) {
+      add(mLibrary.getElementCountPerCategory<Package>());
     }
   } else {
-    if (mFilters.testFlag(Filter::CmpCatWithSymbols) &&
-        (mLibrary.getByCategory<Symbol>(uuid, 1).count() > 0)) {
-      return true;
+    if (mFilters.testFlag(Filter::CmpCatWithSymbols)) {
+      add(mLibrary.getElementCountPerCategory<Symbol>());
     }
-    if (mFilters.testFlag(Filter::CmpCatWithComponents) &&
-        (mLibrary.getByCategory<Component>(uuid, 1).count() > 0)) {
-      return true;
+    if (mFilters.testFlag(Filter::CmpCatWithComponents)) {
+      add(mLibrary.getElementCountPerCategory<Component>());
     }
-    if (mFilters.testFlag(Filter::CmpCatWithDevices) &&
-        (mLibrary.getByCategory<Device>(uuid, 1).count() > 0)) {
-      return true;
+    if (mFilters.testFlag(Filter::CmpCatWithDevices)) {
+      add(mLibrary.getElementCountPerCategory<Device>());
     }
   }
-  return false;
+  return uuids;
 }
 
 bool CategoryTreeModel::listAll() const noexcept {
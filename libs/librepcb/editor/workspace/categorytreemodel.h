@@ -102,9 +102,11 @@ public:
 
 private:  // Methods
   void update() noexcept;
-  QVector<std::shared_ptr<Item>> getChilds(std::shared_ptr<Item> parent) const
-      noexcept;
-  bool containsItems(const tl::optional<Uuid>& uuid) const;
+  QVector<std::shared_ptr<Item>> getChilds(
+      std::shared_ptr<Item> parent,
+      const QMultiHash<tl::optional<Uuid>, std::shared_ptr<Item>>& items,
+      const QSet<tl::optional<Uuid>>& nonEmpty) const noexcept;
+  QSet<tl::optional<Uuid>> getNonEmptyCategories() const;
   bool listAll() const noexcept;
   bool listPackageCategories() const noexcept;
   void updateModelItem(
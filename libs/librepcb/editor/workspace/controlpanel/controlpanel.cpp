@@ -51,6 +51,7 @@
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacelibrarydb.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -173,6 +174,17 @@ ControlPanel::ControlPanel(Workspace& workspace, bool fileFormatIsOutdated)
 }
 
 ControlPanel::~ControlPanel() {
+  // Abort opening projects and wait until the worker threads don't access
+  // them anymore.
+  foreach (const std::shared_ptr<LoadingProject>& lp, mLoadingProjects) {
+    lp->loader->cancel();
+    try {
+      lp->future.waitForFinished();
+    } catch (...) {
+    }
+  }
+  mLoadingProjects.clear();
+
   mProjectLibraryUpdater.reset();
   closeAllProjects(false);
   closeAllLibraryEditors(false);
@@ -181,6 +193,16 @@ ControlPanel::~ControlPanel() {
 }
 
 void ControlPanel::closeEvent(QCloseEvent* event) {
+  // projects which are currently being opened can't be closed yet, so abort
+  // opening them and let the user close the application afterwards
+  if (!mLoadingProjects.isEmpty()) {
+    foreach (const std::shared_ptr<LoadingProject>& lp, mLoadingProjects) {
+      lp->loader->cancel();
+    }
+    event->ignore();
+    return;
+  }
+
   // close all projects, unsaved projects will ask for saving
   if (!closeAllProjects(true)) {
     event->ignore();
@@ -385,7 +407,7 @@ void ControlPanel::showProjectReadmeInBrowser(
  *  Project Management
  ******************************************************************************/
 
-ProjectEditor* ControlPanel::newProject(FilePath parentDir) noexcept {
+void ControlPanel::newProject(FilePath parentDir) noexcept {
   if (!parentDir.isValid()) {
     parentDir = mWorkspace.getProjectsPath();
   }
@@ -397,15 +419,14 @@ ProjectEditor* ControlPanel::newProject(FilePath parentDir) noexcept {
       std::unique_ptr<Project> project = wizard.createProject();  // can throw
       const FilePath fp = project->getFilepath();
       project.reset();  // Release lock.
-      return openProject(fp);
+      openProject(fp);
     } catch (const Exception& e) {
       QMessageBox::critical(this, tr("Could not create project"), e.getMsg());
     }
   }
-  return nullptr;
 }
 
-ProjectEditor* ControlPanel::openProject(FilePath filepath) noexcept {
+void ControlPanel::openProject(FilePath filepath) noexcept {
   if (!filepath.isValid()) {
     QSettings settings;  // client settings
     QString lastOpenedFile = settings
@@ -416,52 +437,111 @@ ProjectEditor* ControlPanel::openProject(FilePath filepath) noexcept {
     filepath = FilePath(FileDialog::getOpenFileName(
         this, tr("Open Project"), lastOpenedFile,
         tr("LibrePCB project files (%1)").arg("*.lpp")));
-    if (!filepath.isValid()) return nullptr;
+    if (!filepath.isValid()) return;
 
     settings.setValue("controlpanel/last_open_project", filepath.toNative());
   }
 
+  const QString key = filepath.toUnique().toStr();
+  if (ProjectEditor* editor = getOpenProject(filepath)) {
+    editor->showAllRequiredEditors();
+    return;
+  } else if (mLoadingProjects.contains(key)) {
+    return;  // The project is already being opened.
+  }
+
+  // Register the project before opening the file system since that might
+  // show dialogs which allow to request opening the project once more.
+  std::shared_ptr<LoadingProject> lp = std::make_shared<LoadingProject>();
+  lp->filepath = filepath;
+  lp->loader.reset(new ProjectLoader());
+  mLoadingProjects.insert(key, lp);
+
   try {
-    ProjectEditor* editor = getOpenProject(filepath);
-    if (!editor) {
-      // Opening the project can take some time, use wait cursor to provide
-      // immediate UI feedback.
-      setCursor(Qt::WaitCursor);
-      auto cursorScopeGuard = scopeGuard([this]() { unsetCursor(); });
-
-      std::shared_ptr<TransactionalFileSystem> fs =
-          TransactionalFileSystem::openRW(
-              filepath.getParentDir(), &askForRestoringBackup,
-              DirectoryLockHandlerDialog::createDirectoryLockCallback());
-      ProjectLoader loader;
-      std::unique_ptr<Project> project =
-          loader.open(std::unique_ptr<TransactionalDirectory>(
-                          new TransactionalDirectory(fs)),
-                      filepath.getFilename());  // can throw
-      editor = new ProjectEditor(mWorkspace, *project.release(),
-                                 loader.getUpgradeMessages());
-      connect(editor, &ProjectEditor::projectEditorClosed, this,
-              &ControlPanel::projectEditorClosed);
-      connect(editor, &ProjectEditor::showControlPanelClicked, this,
-              &ControlPanel::showControlPanel);
-      connect(editor, &ProjectEditor::openProjectLibraryUpdaterClicked, this,
-              &ControlPanel::openProjectLibraryUpdater);
-      mOpenProjectEditors.insert(filepath.toUnique().toStr(), editor);
-
-      // Delay updating the last opened project to avoid an issue when
-      // double-clicking: https://github.com/LibrePCB/LibrePCB/issues/293
-      QTimer::singleShot(500, this, [this, filepath]() {
-        mRecentProjectsModel->setLastRecentProject(filepath);
-      });
-    }
+    // Opening the file system can take some time, use wait cursor to provide
+    // immediate UI feedback.
+    setCursor(Qt::WaitCursor);
+    auto cursorScopeGuard = scopeGuard([this]() { unsetCursor(); });
+    lp->fs = TransactionalFileSystem::openRW(
+        filepath.getParentDir(), &askForRestoringBackup,
+        DirectoryLockHandlerDialog::createDirectoryLockCallback());
+  } catch (UserCanceled& e) {
+    mLoadingProjects.remove(key);
+    return;
+  } catch (Exception& e) {
+    mLoadingProjects.remove(key);
+    QMessageBox::critical(this, tr("Could not open project"), e.getMsg());
+    return;
+  }
+
+  // Show a progress dialog if opening takes more than a moment. It is not
+  // modal, so all windows stay usable in the meantime.
+  QProgressDialog* progress = new QProgressDialog(
+      tr("Opening project..."), tr("Cancel"), 0, 100, this);
+  lp->progressDialog.reset(progress);
+  progress->setWindowTitle(filepath.getFilename());
+  progress->setMinimumDuration(500);
+  connect(progress, &QProgressDialog::canceled, lp->loader.get(),
+          &ProjectLoader::cancel);
+  connect(lp->loader.get(), &ProjectLoader::progress, progress,
+          [progress](int percent, const QString& status) {
+            progress->setLabelText(status);
+            progress->setValue(percent);
+          });
+
+  // Read all files in a worker thread. The file system is not accessed by the
+  // GUI thread meanwhile since the project is not known to any other object
+  // yet. The remaining work is done in projectLoadingFinished().
+  std::shared_ptr<TransactionalFileSystem> fs = lp->fs;
+  ProjectLoader* loader = lp->loader.get();
+  const QString filename = filepath.getFilename();
+  lp->future = QtConcurrent::run([fs, filename, loader]() {
+    loader->read(std::unique_ptr<TransactionalDirectory>(
+                     new TransactionalDirectory(fs)),
+                 filename);  // can throw
+  });
+  lp->watcher.reset(new QFutureWatcher<void>());
+  connect(lp->watcher.get(), &QFutureWatcher<void>::finished, this,
+          [this, key]() { projectLoadingFinished(key); });
+  lp->watcher->setFuture(lp->future);
+}
+
+void ControlPanel::projectLoadingFinished(const QString& key) noexcept {
+  std::shared_ptr<LoadingProject> lp = mLoadingProjects.take(key);
+  if (!lp) return;
+
+  // The watcher emitted the signal which invoked this slot, thus it must not
+  // be deleted immediately.
+  lp->watcher.release()->deleteLater();
+
+  try {
+    lp->future.waitForFinished();  // Rethrows exceptions from the worker.
+
+    // Create the project with all its graphics items in the GUI thread.
+    std::unique_ptr<Project> project = lp->loader->build();  // can throw
+    lp->progressDialog->hide();
+    ProjectEditor* editor = new ProjectEditor(
+        mWorkspace, *project.release(), lp->loader->getUpgradeMessages());
+    connect(editor, &ProjectEditor::projectEditorClosed, this,
+            &ControlPanel::projectEditorClosed);
+    connect(editor, &ProjectEditor::showControlPanelClicked, this,
+            &ControlPanel::showControlPanel);
+    connect(editor, &ProjectEditor::openProjectLibraryUpdaterClicked, this,
+            &ControlPanel::openProjectLibraryUpdater);
+    mOpenProjectEditors.insert(key, editor);
+
+    // Delay updating the last opened project to avoid an issue when
+    // double-clicking: https://github.com/LibrePCB/LibrePCB/issues/293
+    const FilePath filepath = lp->filepath;
+    QTimer::singleShot(500, this, [this, filepath]() {
+      mRecentProjectsModel->setLastRecentProject(filepath);
+    });
     editor->showAllRequiredEditors();
-    return editor;
   } catch (UserCanceled& e) {
     // do nothing
-    return nullptr;
   } catch (Exception& e) {
+    lp->progressDialog->hide();
     QMessageBox::critical(this, tr("Could not open project"), e.getMsg());
-    return nullptr;
   }
 }
 
@@ -28,6 +28,8 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -36,6 +38,8 @@ namespace librepcb {
 class FilePath;
 class Library;
 class Project;
+class ProjectLoader;
+class TransactionalFileSystem;
 class Workspace;
 
 namespace editor {
@@ -119,18 +123,21 @@ private:
 
   // Project Management
 
-  ProjectEditor* newProject(FilePath parentDir = FilePath()) noexcept;
+  void newProject(FilePath parentDir = FilePath()) noexcept;
 
   /**
    * @brief Open a project with the editor (or bring an already opened editor to
    * front)
    *
+   * The project files are read in a worker thread, so this method returns
+   * before the project is actually opened. The editor is created and shown
+   * by #projectLoadingFinished() once reading has completed. Requests to
+   * open a project which is already being opened are ignored.
+   *
    * @param filepath  The filepath to the *.lpp project file to open. If invalid
    *                  (the default), a file dialog will be shown to select it.
-   *
-   * @return The pointer to the opened project editor (nullptr on error)
    */
-  ProjectEditor* openProject(FilePath filepath = FilePath()) noexcept;
+  void openProject(FilePath filepath = FilePath()) noexcept;
 
   /**
    * @brief Close an opened project editor
@@ -176,6 +183,16 @@ private:
    */
   ProjectEditor* getOpenProject(const FilePath& filepath) const noexcept;
 
+  /**
+   * @brief Finish opening a project after its files have been read
+   *
+   * Builds the project in the GUI thread and opens its editor, or reports
+   * the error if reading or building the project failed.
+   *
+   * @param key   The unique filepath of the project being opened.
+   */
+  void projectLoadingFinished(const QString& key) noexcept;
+
   /**
    * @brief Ask the user whether to restore a backup of a project
    *
@@ -202,6 +219,18 @@ private:
    */
   bool closeAllLibraryEditors(bool askForSave) noexcept;
 
+  /**
+   * @brief State of a project which is currently being opened
+   */
+  struct LoadingProject {
+    FilePath filepath;
+    std::shared_ptr<TransactionalFileSystem> fs;
+    std::unique_ptr<ProjectLoader> loader;
+    std::unique_ptr<QProgressDialog> progressDialog;
+    QFuture<void> future;
+    std::unique_ptr<QFutureWatcher<void>> watcher;
+  };
+
   // Attributes
   Workspace& mWorkspace;
   QScopedPointer<Ui::ControlPanel> mUi;
@@ -211,6 +240,7 @@ private:
   QScopedPointer<FavoriteProjectsModel> mFavoriteProjectsModel;
   QScopedPointer<LibraryManager> mLibraryManager;
   QHash<QString, ProjectEditor*> mOpenProjectEditors;
+  QHash<QString, std::shared_ptr<LoadingProject>> mLoadingProjects;
   QHash<FilePath, LibraryEditor*> mOpenLibraryEditors;
   QScopedPointer<ProjectLibraryUpdater> mProjectLibraryUpdater;
 
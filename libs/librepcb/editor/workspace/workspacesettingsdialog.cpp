@@ -617,9 +617,15 @@ void WorkspaceSettingsDialog::loadSettings() noexcept {
   mUi->spbAutosaveInterval->setValue(
       mSettings.projectAutosaveIntervalSeconds.get());
 
+  // Undo Memory Budget
+  mUi->spbUndoMemoryBudget->setValue(mSettings.projectUndoMemoryBudgetMb.get());
+
   // Use OpenGL
   mUi->cbxUseOpenGl->setChecked(mSettings.useOpenGl.get());
 
+  // Use Tile Cache
+  mUi->cbxUseTileCache->setChecked(mSettings.useTileCache.get());
+
   // Library Locale Order
   mLibLocaleOrderModel->setValues(mSettings.libraryLocaleOrder.get());
 
@@ -666,9 +672,15 @@ void WorkspaceSettingsDialog::saveSettings() noexcept {
     mSettings.projectAutosaveIntervalSeconds.set(
         mUi->spbAutosaveInterval->value());
 
+    // Undo Memory Budget
+    mSettings.projectUndoMemoryBudgetMb.set(mUi->spbUndoMemoryBudget->value());
+
     // Use OpenGL
     mSettings.useOpenGl.set(mUi->cbxUseOpenGl->isChecked());
 
+    // Use Tile Cache
+    mSettings.useTileCache.set(mUi->cbxUseTileCache->isChecked());
+
     // Library Locale Order
     mSettings.libraryLocaleOrder.set(mLibLocaleOrderModel->getValues());
 
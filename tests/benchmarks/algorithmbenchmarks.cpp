@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+#include "syntheticdata.h"
+
+#include <librepcb/core/algorithm/airwiresbuilder.h>
+#include <librepcb/core/algorithm/clearancekernel.h>
+#include <librepcb/core/utils/tangentpathjoiner.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void benchmarkAirWiresBuilder(BenchmarkContext& context) {
+  // Random points of one net where about a third of them are already
+  // connected to their predecessor, like partially routed pads.
+  const int pointCount = context.scaled(2000);
+  SyntheticData data(context.getSeed());
+  QVector<Point> points;
+  QVector<QPair<int, int>> edges;
+  for (int i = 0; i < pointCount; ++i) {
+    points.append(data.randomPoint(Point(100000000, 100000000)));
+    if ((i > 0) && (data.randomInt(0, 2) == 0)) {
+      edges.append(qMakePair(i - 1, i));
+    }
+  }
+  context.setParameter("points", pointCount);
+  context.setParameter("edges", edges.count());
+  context.setItemsPerIteration(pointCount);
+
+  int airWireCount = 0;
+  context.measure([&]() {
+    AirWiresBuilder builder;
+    foreach (const Point& point, points) { builder.addPoint(point); }
+    foreach (const auto& edge, edges) {
+      builder.addEdge(edge.first, edge.second);
+    }
+    airWireCount = builder.buildAirWires().count();
+  });
+  context.setCounter("air_wires", airWireCount);
+}
+
+static void benchmarkClearanceKernel(BenchmarkContext& context) {
+  // Pads, vias and traces randomly distributed over a 100x100mm area, each
+  // assigned to a random net.
+  const int objectCount = context.scaled(20000);
+  const int netCount = 100;
+  const Point area(100000000, 100000000);
+  SyntheticData data(context.getSeed());
+  struct Object {
+    int type;
+    int group;
+    Point p1;
+    Point p2;
+    qint64 size;
+  };
+  QVector<Object> objects;
+  for (int i = 0; i < objectCount; ++i) {
+    Object obj;
+    obj.type = data.randomInt(0, 2);
+    obj.group = data.randomInt(0, netCount - 1);
+    obj.p1 = data.randomPoint(area);
+    obj.p2 = obj.p1 +
+        Point(data.randomInt(-2000000, 2000000),
+              data.randomInt(-2000000, 2000000));
+    obj.size = data.randomInt(200000, 800000);
+    objects.append(obj);
+  }
+  context.setParameter("objects", objectCount);
+  context.setParameter("nets", netCount);
+  context.setItemsPerIteration(objectCount);
+
+  int violationCount = 0;
+  context.measure([&]() {
+    ClearanceKernel kernel;
+    foreach (const Object& obj, objects) {
+      if (obj.type == 0) {
+        kernel.addCircle(obj.group, obj.p1, UnsignedLength(obj.size));
+      } else if (obj.type == 1) {
+        kernel.addCapsule(obj.group, obj.p1, obj.p2, UnsignedLength(obj.size));
+      } else {
+        const Length half(obj.size / 2);
+        kernel.addConvexPolygon(obj.group,
+                                {obj.p1 + Point(-half, -half),
+                                 obj.p1 + Point(half, -half),
+                                 obj.p1 + Point(half, half),
+                                 obj.p1 + Point(-half, half)});
+      }
+    }
+    violationCount = kernel.findViolations(UnsignedLength(200000)).count();
+  });
+  context.setCounter("violations", violationCount);
+}
+
+static void benchmarkTangentPathJoiner(BenchmarkContext& context) {
+  // Shuffled line segments like from a DXF import: Chains of segments, some
+  // of them closed to rectangles, and a grid of crossing segments.
+  const int chainCount = context.scaled(5000);
+  const int gridSize = 50;
+  SyntheticData data(context.getSeed());
+  QVector<Path> paths;
+  for (int i = 0; i < chainCount; ++i) {
+    const Point start(Length(i * qint64(10000000)), Length(0));
+    const bool closed = (i % 4 == 0);
+    const QVector<Point> points = {start, start + Point(0, 5000000),
+                                   start + Point(5000000, 5000000),
+                                   start + Point(5000000, 0),
+                                   closed ? start : start + Point(0, -5000000)};
+    for (int k = 1; k < points.count(); ++k) {
+      paths.append(Path::line(points.at(k - 1), points.at(k)));
+    }
+  }
+  const Point gridOrigin(0, -100000000);
+  for (int i = 0; i <= gridSize; ++i) {
+    for (int k = 0; k < gridSize; ++k) {
+      const Length a(i * 1000000), b(k * 1000000), c((k + 1) * 1000000);
+      paths.append(
+          Path::line(gridOrigin + Point(a, b), gridOrigin + Point(a, c)));
+      paths.append(
+          Path::line(gridOrigin + Point(b, a), gridOrigin + Point(c, a)));
+    }
+  }
+  for (int i = paths.count() - 1; i > 0; --i) {
+    std::swap(paths[i], paths[data.randomInt(0, i)]);
+  }
+  context.setParameter("chains", chainCount);
+  context.setParameter("grid_size", gridSize);
+  context.setItemsPerIteration(paths.count());
+
+  int resultCount = 0;
+  context.measure(
+      [&]() { resultCount = TangentPathJoiner::join(paths).count(); });
+  context.setCounter("paths", resultCount);
+}
+
+/*******************************************************************************
+ *  Registration
+ ******************************************************************************/
+
+void registerAlgorithmBenchmarks(BenchmarkRunner& runner) {
+  runner.add("algorithm/air_wires_builder", &benchmarkAirWiresBuilder);
+  runner.add("algorithm/clearance_kernel", &benchmarkClearanceKernel);
+  runner.add("algorithm/tangent_path_joiner", &benchmarkTangentPathJoiner);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,339 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/utils/timingrecorder.h>
+
+#include <QtCore>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+// Version of the JSON output, to be incremented on incompatible changes.
+static const int sJsonFormatVersion = 1;
+
+/*******************************************************************************
+ *  Class BenchmarkResult
+ ******************************************************************************/
+
+QJsonObject BenchmarkResult::toJson() const noexcept {
+  QJsonObject obj;
+  obj.insert("name", name);
+  obj.insert("parameters", parameters);
+  obj.insert("counters", counters);
+  obj.insert("items_per_iteration", static_cast<double>(itemsPerIteration));
+  obj.insert("iterations", iterations);
+  obj.insert("min_ns", static_cast<double>(minNs));
+  obj.insert("median_ns", static_cast<double>(medianNs));
+  obj.insert("mean_ns", static_cast<double>(meanNs));
+  obj.insert("max_ns", static_cast<double>(maxNs));
+  if (!error.isEmpty()) {
+    obj.insert("error", error);
+  }
+  return obj;
+}
+
+BenchmarkResult BenchmarkResult::fromJson(const QJsonObject& obj) noexcept {
+  BenchmarkResult result;
+  result.name = obj.value("name").toString();
+  result.parameters = obj.value("parameters").toObject();
+  result.counters = obj.value("counters").toObject();
+  result.itemsPerIteration =
+      static_cast<qint64>(obj.value("items_per_iteration").toDouble());
+  result.iterations = obj.value("iterations").toInt();
+  result.minNs = static_cast<qint64>(obj.value("min_ns").toDouble());
+  result.medianNs = static_cast<qint64>(obj.value("median_ns").toDouble());
+  result.meanNs = static_cast<qint64>(obj.value("mean_ns").toDouble());
+  result.maxNs = static_cast<qint64>(obj.value("max_ns").toDouble());
+  result.error = obj.value("error").toString();
+  return result;
+}
+
+/*******************************************************************************
+ *  Class BenchmarkContext
+ ******************************************************************************/
+
+BenchmarkContext::BenchmarkContext(const BenchmarkOptions& options,
+                                   BenchmarkResult& result) noexcept
+  : mOptions(options),
+    mResult(result),
+    mStartMemoryKb(TimingRecorder::getResidentMemoryKb()) {
+}
+
+BenchmarkContext::~BenchmarkContext() noexcept {
+}
+
+int BenchmarkContext::scaled(int count) const noexcept {
+  return qMax(qRound(count * mOptions.scale), 1);
+}
+
+void BenchmarkContext::setParameter(const QString& key,
+                                    const QJsonValue& value) noexcept {
+  mResult.parameters.insert(key, value);
+}
+
+void BenchmarkContext::setCounter(const QString& key,
+                                  const QJsonValue& value) noexcept {
+  mResult.counters.insert(key, value);
+}
+
+void BenchmarkContext::setItemsPerIteration(qint64 items) noexcept {
+  mResult.itemsPerIteration = items;
+}
+
+void BenchmarkContext::measure(const std::function<void()>& function,
+                               const std::function<void()>& setup) {
+  if (mResult.iterations > 0) {
+    throw LogicError(__FILE__, __LINE__,
+                     "A benchmark must be measured only once.");
+  }
+
+  // Memory used by the generated data (only a rough estimate since freed
+  // memory is not necessarily returned to the operating system).
+  const qint64 memoryKb = TimingRecorder::getResidentMemoryKb();
+  if ((mStartMemoryKb >= 0) && (memoryKb >= 0)) {
+    setCounter("data_memory_kb",
+               static_cast<double>(memoryKb - mStartMemoryKb));
+  }
+
+  // Warm-up to fill caches and to trigger lazy initializations.
+  if (setup) {
+    setup();
+  }
+  function();
+
+  QVector<qint64> samples;
+  QElapsedTimer totalTimer;
+  totalTimer.start();
+  while ((samples.count() < mOptions.minIterations) ||
+         ((samples.count() < mOptions.maxIterations) &&
+          (totalTimer.elapsed() < mOptions.minTimeMs))) {
+    if (setup) {
+      setup();
+    }
+    QElapsedTimer timer;
+    timer.start();
+    function();
+    samples.append(timer.nsecsElapsed());
+  }
+
+  std::sort(samples.begin(), samples.end());
+  qint64 sum = 0;
+  foreach (qint64 sample, samples) { sum += sample; }
+  mResult.iterations = samples.count();
+  mResult.minNs = samples.first();
+  mResult.medianNs = samples.at(samples.count() / 2);
+  mResult.meanNs = sum / samples.count();
+  mResult.maxNs = samples.last();
+}
+
+/*******************************************************************************
+ *  Class BenchmarkRunner
+ ******************************************************************************/
+
+BenchmarkRunner::BenchmarkRunner() noexcept {
+}
+
+BenchmarkRunner::~BenchmarkRunner() noexcept {
+}
+
+QStringList BenchmarkRunner::getNames() const noexcept {
+  QStringList names;
+  foreach (const auto& benchmark, mBenchmarks) {
+    names.append(benchmark.first);
+  }
+  return names;
+}
+
+void BenchmarkRunner::add(const QString& name, Function function) noexcept {
+  mBenchmarks.append(qMakePair(name, function));
+}
+
+QVector<BenchmarkResult> BenchmarkRunner::run(const BenchmarkOptions& options,
+                                              QTextStream& log) const {
+  const QRegularExpression filter(options.filter);
+  if (!filter.isValid()) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        QString("Invalid filter expression: %1").arg(filter.errorString()));
+  }
+
+  QVector<BenchmarkResult> results;
+  foreach (const auto& benchmark, mBenchmarks) {
+    if (!filter.match(benchmark.first).hasMatch()) {
+      continue;
+    }
+    log << benchmark.first << "..." << flush;
+    BenchmarkResult result;
+    result.name = benchmark.first;
+    try {
+      BenchmarkContext context(options, result);
+      benchmark.second(context);
+      if (result.iterations == 0) {
+        throw LogicError(__FILE__, __LINE__, "Nothing was measured.");
+      }
+    } catch (const Exception& e) {
+      result.error = e.getMsg();
+    }
+    if (result.error.isEmpty()) {
+      log << " " << formatDuration(result.medianNs) << " (median of "
+          << result.iterations << ")";
+      if (result.itemsPerIteration > 0) {
+        const qreal itemsPerSecond = (result.itemsPerIteration * qreal(1e9)) /
+            qMax(result.medianNs, qint64(1));
+        log << ", " << QString::number(itemsPerSecond, 'f', 0) << " items/s";
+      }
+      log << endl;
+    } else {
+      log << " FAILED: " << result.error << endl;
+    }
+    results.append(result);
+  }
+  return results;
+}
+
+QByteArray BenchmarkRunner::toJson(
+    const BenchmarkOptions& options,
+    const QVector<BenchmarkResult>& results) noexcept {
+  QJsonObject environment;
+  environment.insert("app_version", qApp->getAppVersion().toStr());
+  environment.insert("git_revision", qApp->getGitRevision());
+  environment.insert("qt_version", QString(qVersion()));
+  environment.insert("os", QSysInfo::prettyProductName());
+  environment.insert("cpu_architecture", QSysInfo::currentCpuArchitecture());
+  environment.insert("threads", QThread::idealThreadCount());
+
+  QJsonObject opts;
+  opts.insert("filter", options.filter);
+  opts.insert("scale", options.scale);
+  opts.insert("seed", static_cast<double>(options.seed));
+  opts.insert("min_iterations", options.minIterations);
+  opts.insert("max_iterations", options.maxIterations);
+  opts.insert("min_time_ms", options.minTimeMs);
+
+  QJsonArray array;
+  foreach (const BenchmarkResult& result, results) {
+    array.append(result.toJson());
+  }
+
+  QJsonObject root;
+  root.insert("format", sJsonFormatVersion);
+  root.insert("environment", environment);
+  root.insert("options", opts);
+  root.insert("results", array);
+  return QJsonDocument(root).toJson(QJsonDocument::Indented);
+}
+
+QVector<BenchmarkResult> BenchmarkRunner::fromJson(const QByteArray& content,
+                                                   BenchmarkOptions& options) {
+  QJsonParseError error;
+  const QJsonDocument doc = QJsonDocument::fromJson(content, &error);
+  if (doc.isNull()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString("Invalid benchmark result file: %1")
+                           .arg(error.errorString()));
+  }
+  const QJsonObject root = doc.object();
+  if (root.value("format").toInt() != sJsonFormatVersion) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       "Unsupported benchmark result file format.");
+  }
+
+  const QJsonObject opts = root.value("options").toObject();
+  options.filter = opts.value("filter").toString();
+  options.scale = opts.value("scale").toDouble();
+  options.seed = static_cast<quint32>(opts.value("seed").toDouble());
+  options.minIterations = opts.value("min_iterations").toInt();
+  options.maxIterations = opts.value("max_iterations").toInt();
+  options.minTimeMs = opts.value("min_time_ms").toInt();
+
+  QVector<BenchmarkResult> results;
+  foreach (const QJsonValue& value, root.value("results").toArray()) {
+    results.append(BenchmarkResult::fromJson(value.toObject()));
+  }
+  return results;
+}
+
+int BenchmarkRunner::compare(const QVector<BenchmarkResult>& results,
+                             const QVector<BenchmarkResult>& baseline,
+                             qreal tolerancePercent,
+                             QTextStream& log) noexcept {
+  QHash<QString, BenchmarkResult> baselineResults;
+  foreach (const BenchmarkResult& result, baseline) {
+    baselineResults.insert(result.name, result);
+  }
+
+  int regressions = 0;
+  log << "Comparison against baseline (tolerance " << tolerancePercent
+      << "%):" << endl;
+  foreach (const BenchmarkResult& result, results) {
+    log << "  " << result.name << ": ";
+    auto it = baselineResults.constFind(result.name);
+    if (it == baselineResults.constEnd()) {
+      log << "not in baseline" << endl;
+    } else if (it->parameters != result.parameters) {
+      log << "not comparable (different parameters)" << endl;
+    } else if ((!it->error.isEmpty()) || (!result.error.isEmpty())) {
+      log << "not comparable (failed)" << endl;
+    } else {
+      const qreal change = (result.medianNs - it->medianNs) * qreal(100) /
+          qMax(it->medianNs, qint64(1));
+      log << formatDuration(it->medianNs) << " -> "
+          << formatDuration(result.medianNs) << " ("
+          << (change >= 0 ? "+" : "") << QString::number(change, 'f', 1)
+          << "%)";
+      if (change > tolerancePercent) {
+        log << " REGRESSION";
+        ++regressions;
+      }
+      log << endl;
+    }
+  }
+  return regressions;
+}
+
+QString BenchmarkRunner::formatDuration(qint64 ns) noexcept {
+  if (ns >= 1000000000) {
+    return QString::number(ns / qreal(1000000000), 'f', 3) % " s";
+  } else if (ns >= 1000000) {
+    return QString::number(ns / qreal(1000000), 'f', 3) % " ms";
+  } else if (ns >= 1000) {
+    return QString::number(ns / qreal(1000), 'f', 3) % " us";
+  } else {
+    return QString::number(ns) % " ns";
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
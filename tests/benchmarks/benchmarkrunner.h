@@ -0,0 +1,233 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_BENCHMARKRUNNER_H
+#define LIBREPCB_BENCHMARKS_BENCHMARKRUNNER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class BenchmarkOptions
+ ******************************************************************************/
+
+/**
+ * @brief Options which affect all benchmarks of a run
+ *
+ * All options are written to the JSON output, so a run can be reproduced
+ * exactly and results are only compared against runs with the same options.
+ */
+struct BenchmarkOptions {
+  QString filter;  ///< Regular expression for the benchmark names to run
+  qreal scale = 1;  ///< Factor for the size of the generated data
+  quint32 seed = 42;  ///< Seed of the random data generator
+  int minIterations = 5;  ///< Minimum number of measured iterations
+  int maxIterations = 1000;  ///< Maximum number of measured iterations
+  int minTimeMs = 500;  ///< Minimum measurement time per benchmark
+};
+
+/*******************************************************************************
+ *  Class BenchmarkResult
+ ******************************************************************************/
+
+/**
+ * @brief The result of a single benchmark
+ */
+struct BenchmarkResult {
+  QString name;
+  QJsonObject parameters;  ///< Parameters of the generated data
+  QJsonObject counters;  ///< Additional values (e.g. memory usage)
+  qint64 itemsPerIteration = 0;  ///< Processed items, 0 if not applicable
+  int iterations = 0;
+  qint64 minNs = 0;
+  qint64 medianNs = 0;
+  qint64 meanNs = 0;
+  qint64 maxNs = 0;
+  QString error;  ///< Error message, empty on success
+
+  QJsonObject toJson() const noexcept;
+  static BenchmarkResult fromJson(const QJsonObject& obj) noexcept;
+};
+
+/*******************************************************************************
+ *  Class BenchmarkContext
+ ******************************************************************************/
+
+/**
+ * @brief Passed to each benchmark to generate data and measure the time
+ *
+ * A benchmark first generates its data (which is not measured), then
+ * describes it with #setParameter() and finally calls #measure() exactly
+ * once with the operation to measure.
+ */
+class BenchmarkContext final {
+public:
+  // Constructors / Destructor
+  BenchmarkContext() = delete;
+  BenchmarkContext(const BenchmarkContext& other) = delete;
+  BenchmarkContext(const BenchmarkOptions& options,
+                   BenchmarkResult& result) noexcept;
+  ~BenchmarkContext() noexcept;
+
+  // Getters
+  quint32 getSeed() const noexcept { return mOptions.seed; }
+
+  /**
+   * @brief Scale a default item count with the configured scale factor
+   *
+   * @param count   Item count for a scale factor of 1.
+   *
+   * @return The scaled count, at least 1.
+   */
+  int scaled(int count) const noexcept;
+
+  // Setters
+  void setParameter(const QString& key, const QJsonValue& value) noexcept;
+  void setCounter(const QString& key, const QJsonValue& value) noexcept;
+  void setItemsPerIteration(qint64 items) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Measure an operation
+   *
+   * The operation is executed once for warm-up and then repeatedly until both
+   * the minimum number of iterations and the minimum time are reached.
+   *
+   * @param function  The operation to measure.
+   * @param setup     Optional preparation executed before each iteration,
+   *                  which is not measured.
+   */
+  void measure(const std::function<void()>& function,
+               const std::function<void()>& setup = nullptr);
+
+  // Operator Overloadings
+  BenchmarkContext& operator=(const BenchmarkContext& rhs) = delete;
+
+private:  // Data
+  const BenchmarkOptions& mOptions;
+  BenchmarkResult& mResult;
+  qint64 mStartMemoryKb;
+};
+
+/*******************************************************************************
+ *  Class BenchmarkRunner
+ ******************************************************************************/
+
+/**
+ * @brief Runs registered benchmarks and compares results against a baseline
+ */
+class BenchmarkRunner final {
+public:
+  // Types
+  typedef std::function<void(BenchmarkContext&)> Function;
+
+  // Constructors / Destructor
+  BenchmarkRunner(const BenchmarkRunner& other) = delete;
+  BenchmarkRunner() noexcept;
+  ~BenchmarkRunner() noexcept;
+
+  // Getters
+  QStringList getNames() const noexcept;
+
+  // General Methods
+  void add(const QString& name, Function function) noexcept;
+
+  /**
+   * @brief Run all benchmarks matching the filter of the options
+   *
+   * @param options   Options for this run.
+   * @param log       Stream to print the progress and results to.
+   *
+   * @return The results of all executed benchmarks, in registration order.
+   */
+  QVector<BenchmarkResult> run(const BenchmarkOptions& options,
+                               QTextStream& log) const;
+
+  // Operator Overloadings
+  BenchmarkRunner& operator=(const BenchmarkRunner& rhs) = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Serialize the results of a run to JSON
+   *
+   * @param options   The options of the run.
+   * @param results   The results of the run.
+   *
+   * @return JSON document with environment, options and results.
+   */
+  static QByteArray toJson(const BenchmarkOptions& options,
+                           const QVector<BenchmarkResult>& results) noexcept;
+
+  /**
+   * @brief Read the results from a JSON file written by #toJson()
+   *
+   * @param content   The file content.
+   * @param options   The options of the run are written into this object.
+   *
+   * @return The results.
+   *
+   * @throw Exception if the content is not a valid result file.
+   */
+  static QVector<BenchmarkResult> fromJson(const QByteArray& content,
+                                           BenchmarkOptions& options);
+
+  /**
+   * @brief Compare results against a baseline
+   *
+   * Results are compared by their median time. Benchmarks which are missing
+   * in the baseline or were run with other parameters are reported but not
+   * considered as regression.
+   *
+   * @param results           Results of the current run.
+   * @param baseline          Results of the baseline run.
+   * @param tolerancePercent  Allowed slowdown in percent.
+   * @param log               Stream to print the comparison to.
+   *
+   * @return Number of benchmarks which are slower than allowed.
+   */
+  static int compare(const QVector<BenchmarkResult>& results,
+                     const QVector<BenchmarkResult>& baseline,
+                     qreal tolerancePercent, QTextStream& log) noexcept;
+
+  static QString formatDuration(qint64 ns) noexcept;
+
+private:  // Data
+  QVector<QPair<QString, Function>> mBenchmarks;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif
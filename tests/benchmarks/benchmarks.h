@@ -0,0 +1,51 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_BENCHMARKS_H
+#define LIBREPCB_BENCHMARKS_BENCHMARKS_H
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+class BenchmarkRunner;
+
+/*******************************************************************************
+ *  Functions
+ ******************************************************************************/
+
+// Each function registers the benchmarks of one area. Benchmark names are
+// prefixed with the area, e.g. "board/drc", to allow filtering.
+void registerAlgorithmBenchmarks(BenchmarkRunner& runner);
+void registerBoardBenchmarks(BenchmarkRunner& runner);
+void registerExportBenchmarks(BenchmarkRunner& runner);
+void registerProjectBenchmarks(BenchmarkRunner& runner);
+void registerSerializationBenchmarks(BenchmarkRunner& runner);
+void registerWorkspaceBenchmarks(BenchmarkRunner& runner);
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif
@@ -0,0 +1,307 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+#include "syntheticdata.h"
+
+#include <librepcb/core/attribute/attributesubstitutor.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardgerberexport.h>
+#include <librepcb/core/project/board/drc/boarddesignrulecheck.h>
+#include <librepcb/core/project/board/items/bi_device.h>
+#include <librepcb/core/project/board/items/bi_footprintpad.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/utils/timingrecorder.h>
+#include <librepcb/editor/widgets/graphicsview.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class BoardFixture
+ ******************************************************************************/
+
+/**
+ * @brief A project with one generated board in a temporary directory
+ */
+class BoardFixture final {
+public:
+  BoardFixture(BenchmarkContext& context,
+               const SyntheticData::BoardParameters& params)
+    : mData(context.getSeed()), mProject(), mBoard(nullptr) {
+    mProject = mData.createProject(FilePath(mDir.path()));  // can throw
+    mBoard = &mData.addBoard(*mProject, params);  // can throw
+    context.setParameter("board", params.toJson());
+  }
+
+  Project& getProject() noexcept { return *mProject; }
+  Board& getBoard() noexcept { return *mBoard; }
+
+private:
+  QTemporaryDir mDir;
+  SyntheticData mData;
+  std::unique_ptr<Project> mProject;
+  Board* mBoard;
+};
+
+static SyntheticData::BoardParameters defaultBoard(
+    const BenchmarkContext& context) noexcept {
+  SyntheticData::BoardParameters params;
+  params.chipCount = context.scaled(params.chipCount);
+  return params;
+}
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void benchmarkAirWires(BenchmarkContext& context) {
+  BoardFixture fixture(context, defaultBoard(context));
+  context.measure([&]() { fixture.getBoard().forceAirWiresRebuild(); });
+}
+
+static void benchmarkPlanes(BenchmarkContext& context) {
+  BoardFixture fixture(context, defaultBoard(context));
+  context.measure([&]() { fixture.getBoard().rebuildAllPlanes(); });
+
+  int fragments = 0;
+  foreach (const BI_Plane* plane, fixture.getBoard().getPlanes()) {
+    fragments += plane->getFragments().count();
+  }
+  context.setCounter("plane_fragments", fragments);
+}
+
+static void benchmarkDesignRuleCheck(BenchmarkContext& context) {
+  BoardFixture fixture(context, defaultBoard(context));
+  fixture.getBoard().rebuildAllPlanes();
+  BoardDesignRuleCheck::Options options;
+  options.rebuildPlanes = false;  // Measured separately.
+
+  int messages = 0;
+  context.measure([&]() {
+    BoardDesignRuleCheck drc(fixture.getBoard(), options);
+    drc.execute();  // can throw
+    messages = drc.getMessages().count();
+  });
+  context.setCounter("messages", messages);
+}
+
+static void benchmarkGerberExport(BenchmarkContext& context) {
+  BoardFixture fixture(context, defaultBoard(context));
+  fixture.getBoard().rebuildAllPlanes();
+  context.measure([&]() {
+    BoardGerberExport grbExport(fixture.getBoard());
+    grbExport.exportPcbLayers(
+        fixture.getBoard().getFabricationOutputSettings());  // can throw
+  });
+}
+
+static void benchmarkPadOutlines(BenchmarkContext& context) {
+  // Many identical footprints, the data memory counter shows the memory
+  // needed per pad.
+  SyntheticData::BoardParameters params = defaultBoard(context);
+  params.bgaSize = 0;
+  params.addPlane = false;
+  BoardFixture fixture(context, params);
+  QVector<const BI_FootprintPad*> pads;
+  foreach (const BI_Device* device, fixture.getBoard().getDeviceInstances()) {
+    foreach (const BI_FootprintPad* pad, device->getPads()) {
+      pads.append(pad);
+    }
+  }
+  context.setCounter("pads", pads.count());
+  context.setItemsPerIteration(pads.count());
+
+  const Length clearance(200000);
+  context.measure([&]() {
+    foreach (const BI_FootprintPad* pad, pads) {
+      pad->getSceneOutline(clearance);
+    }
+  });
+}
+
+static void benchmarkPadOutlinesExpansions(BenchmarkContext& context) {
+  // Queries the pad outlines with many different expansions (like different
+  // clearances of the DRC). The cache memory counter shows whether the
+  // memory of the pad geometry caches is bounded.
+  SyntheticData::BoardParameters params = defaultBoard(context);
+  params.bgaSize = 0;
+  params.addPlane = false;
+  BoardFixture fixture(context, params);
+  QVector<const BI_FootprintPad*> pads;
+  foreach (const BI_Device* device, fixture.getBoard().getDeviceInstances()) {
+    foreach (const BI_FootprintPad* pad, device->getPads()) {
+      pads.append(pad);
+    }
+  }
+  const int expansions = 20;
+  context.setCounter("pads", pads.count());
+  context.setItemsPerIteration(pads.count() * expansions);
+
+  const qint64 startMemoryKb = TimingRecorder::getResidentMemoryKb();
+  int iteration = 0;
+  context.measure([&]() {
+    for (int i = 0; i < expansions; ++i) {
+      // New expansions in every iteration, so they are never cached yet.
+      const Length expansion((iteration * expansions + i) * 1000);
+      foreach (const BI_FootprintPad* pad, pads) {
+        pad->getOutline(expansion);
+      }
+    }
+    ++iteration;
+  });
+  const qint64 endMemoryKb = TimingRecorder::getResidentMemoryKb();
+  if ((startMemoryKb >= 0) && (endMemoryKb >= 0)) {
+    context.setCounter("cache_memory_kb",
+                       static_cast<double>(endMemoryKb - startMemoryKb));
+  }
+}
+
+static void benchmarkAttributeSubstitution(BenchmarkContext& context) {
+  SyntheticData::BoardParameters params;
+  params.chipCount = context.scaled(5000);
+  params.bgaSize = 0;
+  params.addPlane = false;
+  BoardFixture fixture(context, params);
+  const QList<BI_Device*> devices =
+      fixture.getBoard().getDeviceInstances().values();
+  context.setItemsPerIteration(devices.count());
+
+  context.measure([&]() {
+    foreach (const BI_Device* device, devices) {
+      AttributeSubstitutor::substitute("{{NAME}} {{VALUE}}", device);
+    }
+  });
+}
+
+static void benchmarkAttributesChanged(BenchmarkContext& context) {
+  // Updates all texts of a board after a project attribute was modified.
+  SyntheticData::BoardParameters params;
+  params.chipCount = context.scaled(5000);
+  params.bgaSize = 0;
+  params.addPlane = false;
+  BoardFixture fixture(context, params);
+  context.setItemsPerIteration(fixture.getBoard().getDeviceInstances().count());
+
+  context.measure([&]() {
+    emit fixture.getProject().attributesChanged(QSet<QString>());
+  });
+}
+
+/**
+ * @brief Renders the board in a GraphicsView while panning or editing
+ *
+ * Allows to compare the rendering performance with and without the tile
+ * cache of the view. Each iteration renders the given number of frames.
+ */
+static void benchmarkBoardView(BenchmarkContext& context, bool tileCache,
+                               bool editing) {
+  BoardFixture fixture(context, defaultBoard(context));
+  fixture.getBoard().rebuildAllPlanes();
+  const QList<BI_Device*> devices =
+      fixture.getBoard().getDeviceInstances().values();
+  const int frames = 20;
+  context.setParameter("tile_cache", tileCache);
+  context.setItemsPerIteration(frames);
+
+  editor::GraphicsView view;
+  view.setAttribute(Qt::WA_DontShowOnScreen);
+  view.setScene(&fixture.getBoard().getGraphicsScene());
+  view.setTileCacheEnabled(tileCache);
+  view.resize(1280, 800);
+  view.show();
+  const QRectF boardRect =
+      fixture.getBoard().getGraphicsScene().itemsBoundingRect();
+  view.setVisibleSceneRect(QRectF(boardRect.topLeft(), boardRect.size() / 3));
+  QImage image(view.viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+
+  int frame = 0;
+  context.measure([&]() {
+    for (int i = 0; i < frames; ++i, ++frame) {
+      if (editing) {
+        // Move one device back and forth, like dragging it around.
+        BI_Device* device = devices.at(frame % devices.count());
+        const Length offset((frame % 2) ? -500000 : 500000);
+        device->setPosition(device->getPosition() + Point(offset, offset));
+      } else {
+        // Pan right and back again.
+        const int step = ((frame / 10) % 2) ? -100 : 100;
+        view.horizontalScrollBar()->setValue(
+            view.horizontalScrollBar()->value() + step);
+      }
+      // Deliver QGraphicsScene::changed() to invalidate the tiles.
+      qApp->processEvents();
+      view.viewport()->render(&image);
+    }
+  });
+}
+
+static void benchmarkBoardViewPan(BenchmarkContext& context) {
+  benchmarkBoardView(context, false, false);
+}
+
+static void benchmarkBoardViewPanTileCache(BenchmarkContext& context) {
+  benchmarkBoardView(context, true, false);
+}
+
+static void benchmarkBoardViewEdit(BenchmarkContext& context) {
+  benchmarkBoardView(context, false, true);
+}
+
+static void benchmarkBoardViewEditTileCache(BenchmarkContext& context) {
+  benchmarkBoardView(context, true, true);
+}
+
+/*******************************************************************************
+ *  Registration
+ ******************************************************************************/
+
+void registerBoardBenchmarks(BenchmarkRunner& runner) {
+  runner.add("board/air_wires", &benchmarkAirWires);
+  runner.add("board/planes", &benchmarkPlanes);
+  runner.add("board/drc", &benchmarkDesignRuleCheck);
+  runner.add("board/gerber_export", &benchmarkGerberExport);
+  runner.add("board/pad_outlines", &benchmarkPadOutlines);
+  runner.add("board/pad_outlines_expansions", &benchmarkPadOutlinesExpansions);
+  runner.add("board/attribute_substitution", &benchmarkAttributeSubstitution);
+  runner.add("board/attributes_changed", &benchmarkAttributesChanged);
+  runner.add("board/view_pan", &benchmarkBoardViewPan);
+  runner.add("board/view_pan_tile_cache", &benchmarkBoardViewPanTileCache);
+  runner.add("board/view_edit", &benchmarkBoardViewEdit);
+  runner.add("board/view_edit_tile_cache", &benchmarkBoardViewEditTileCache);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,100 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+#include "syntheticdata.h"
+
+#include <librepcb/core/export/gerbergenerator.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void benchmarkGerberGenerator(BenchmarkContext& context) {
+  // A copper layer with random traces and via pads of a few different sizes,
+  // which share a small number of apertures.
+  const int count = context.scaled(50000);
+  const Point area(100000000, 100000000);
+  SyntheticData data(context.getSeed());
+  const Uuid projectUuid = data.createUuid();
+  struct Item {
+    Point p1;
+    Point p2;
+    qint64 size;
+    QString net;
+  };
+  QVector<Item> items;
+  for (int i = 0; i < count; ++i) {
+    Item item;
+    item.p1 = data.randomPoint(area);
+    item.p2 = data.randomPoint(area);
+    item.size = data.randomInt(1, 8) * 100000;
+    item.net = QString("N%1").arg(data.randomInt(1, 100));
+    items.append(item);
+  }
+  context.setParameter("objects", count * 2);
+  context.setItemsPerIteration(count * 2);
+
+  int outputSize = 0;
+  context.measure([&]() {
+    GerberGenerator gen(QDateTime(QDate(2000, 1, 1), QTime(0, 0)),
+                        "Benchmark", projectUuid, "1");
+    gen.setFileFunctionCopper(1, GerberGenerator::CopperSide::Top,
+                              GerberGenerator::Polarity::Positive);
+    foreach (const Item& item, items) {
+      gen.drawLine(item.p1, item.p2, UnsignedLength(item.size),
+                   GerberAttribute::ApertureFunction::Conductor, item.net,
+                   QString());
+      gen.flashCircle(item.p2, PositiveLength(item.size * 2),
+                      GerberAttribute::ApertureFunction::ViaPad, item.net,
+                      QString(), QString(), QString());
+    }
+    gen.generate();
+    outputSize = gen.toStr().size();
+  });
+  context.setCounter("output_size_kb", outputSize / 1024);
+}
+
+/*******************************************************************************
+ *  Registration
+ ******************************************************************************/
+
+void registerExportBenchmarks(BenchmarkRunner& runner) {
+  runner.add("export/gerber_generator", &benchmarkGerberGenerator);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,179 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/debug.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/fileio/filepath.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::benchmarks;
+
+/*******************************************************************************
+ *  The Benchmark Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // Initialize a common locale for reproducible output.
+  QLocale::setDefault(QLocale(QLocale::English, QLocale::UnitedStates));
+
+  // Many classes rely on a QApplication instance, so we create it here.
+  Application app(argc, argv);
+  Application::setOrganizationName("LibrePCB");
+  Application::setOrganizationDomain("librepcb.org");
+  Application::setApplicationName("LibrePCB-Benchmarks");
+
+  // Only print warnings to not disturb the benchmark output.
+  Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Warning);
+
+  BenchmarkRunner runner;
+  registerAlgorithmBenchmarks(runner);
+  registerBoardBenchmarks(runner);
+  registerExportBenchmarks(runner);
+  registerProjectBenchmarks(runner);
+  registerSerializationBenchmarks(runner);
+  registerWorkspaceBenchmarks(runner);
+
+  const BenchmarkOptions defaults;
+  QCommandLineParser parser;
+  parser.setApplicationDescription("LibrePCB Benchmarks");
+  parser.addHelpOption();
+  const QCommandLineOption listOption("list", "List all benchmarks and exit.");
+  parser.addOption(listOption);
+  const QCommandLineOption filterOption(
+      "filter", "Only run benchmarks matching the regular expression.",
+      "regex");
+  parser.addOption(filterOption);
+  const QCommandLineOption scaleOption(
+      "scale", "Factor for the size of the generated data.", "factor",
+      QString::number(defaults.scale));
+  parser.addOption(scaleOption);
+  const QCommandLineOption seedOption(
+      "seed", "Seed of the random data generator.", "number",
+      QString::number(defaults.seed));
+  parser.addOption(seedOption);
+  const QCommandLineOption minIterationsOption(
+      "min-iterations", "Minimum number of iterations per benchmark.",
+      "count", QString::number(defaults.minIterations));
+  parser.addOption(minIterationsOption);
+  const QCommandLineOption maxIterationsOption(
+      "max-iterations", "Maximum number of iterations per benchmark.",
+      "count", QString::number(defaults.maxIterations));
+  parser.addOption(maxIterationsOption);
+  const QCommandLineOption minTimeOption(
+      "min-time", "Minimum measurement time per benchmark.", "ms",
+      QString::number(defaults.minTimeMs));
+  parser.addOption(minTimeOption);
+  const QCommandLineOption outputOption(
+      "output", "Write the results as JSON to the given file.", "file");
+  parser.addOption(outputOption);
+  const QCommandLineOption baselineOption(
+      "baseline",
+      "Compare the results against a JSON file written by --output and "
+      "report failure (exit code = 1) on regressions. Unless specified "
+      "otherwise, the options of the baseline run are used.",
+      "file");
+  parser.addOption(baselineOption);
+  const QCommandLineOption toleranceOption(
+      "tolerance", "Allowed slowdown compared to the baseline.", "percent",
+      "10");
+  parser.addOption(toleranceOption);
+  parser.process(app);
+
+  QTextStream log(stdout);
+  if (parser.isSet(listOption)) {
+    foreach (const QString& name, runner.getNames()) { log << name << endl; }
+    return 0;
+  }
+
+  try {
+    // Load the baseline first to take over its options.
+    BenchmarkOptions options;
+    QVector<BenchmarkResult> baseline;
+    if (parser.isSet(baselineOption)) {
+      const FilePath fp(QFileInfo(parser.value(baselineOption))
+                            .absoluteFilePath());
+      baseline = BenchmarkRunner::fromJson(FileUtils::readFile(fp),
+                                           options);  // can throw
+    }
+    if (parser.isSet(filterOption) || (!parser.isSet(baselineOption))) {
+      options.filter = parser.value(filterOption);
+    }
+    if (parser.isSet(scaleOption) || (!parser.isSet(baselineOption))) {
+      options.scale = parser.value(scaleOption).toDouble();
+    }
+    if (parser.isSet(seedOption) || (!parser.isSet(baselineOption))) {
+      options.seed = parser.value(seedOption).toUInt();
+    }
+    if (parser.isSet(minIterationsOption) || (!parser.isSet(baselineOption))) {
+      options.minIterations = parser.value(minIterationsOption).toInt();
+    }
+    if (parser.isSet(maxIterationsOption) || (!parser.isSet(baselineOption))) {
+      options.maxIterations = parser.value(maxIterationsOption).toInt();
+    }
+    if (parser.isSet(minTimeOption) || (!parser.isSet(baselineOption))) {
+      options.minTimeMs = parser.value(minTimeOption).toInt();
+    }
+    if ((options.scale <= 0) || (options.minIterations < 1) ||
+        (options.maxIterations < options.minIterations)) {
+      throw RuntimeError(__FILE__, __LINE__, "Invalid benchmark options.");
+    }
+
+    const QVector<BenchmarkResult> results =
+        runner.run(options, log);  // can throw
+    if (parser.isSet(outputOption)) {
+      const FilePath fp(
+          QFileInfo(parser.value(outputOption)).absoluteFilePath());
+      FileUtils::writeFile(
+          fp, BenchmarkRunner::toJson(options, results));  // can throw
+      log << "Results written to " << fp.toNative() << endl;
+    }
+
+    bool success = true;
+    foreach (const BenchmarkResult& result, results) {
+      if (!result.error.isEmpty()) {
+        success = false;
+      }
+    }
+    if (parser.isSet(baselineOption)) {
+      const qreal tolerance = parser.value(toleranceOption).toDouble();
+      if (BenchmarkRunner::compare(results, baseline, tolerance, log) > 0) {
+        success = false;
+      }
+    }
+    return success ? 0 : 1;
+  } catch (const Exception& e) {
+    log << "ERROR: " << e.getMsg() << endl;
+    return 1;
+  }
+}
@@ -0,0 +1,89 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+#include "syntheticdata.h"
+
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectloader.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void benchmarkOpenProject(BenchmarkContext& context) {
+  const int pages = 4;
+  const int segments = context.scaled(500);
+  SyntheticData::BoardParameters params;
+  params.chipCount = context.scaled(params.chipCount);
+  QTemporaryDir dir;
+  const FilePath projectDir(dir.path());
+  {
+    SyntheticData data(context.getSeed());
+    std::unique_ptr<Project> project =
+        data.createProject(projectDir);  // can throw
+    for (int i = 0; i < pages; ++i) {
+      data.addSchematic(*project, segments);  // can throw
+      data.addBoard(*project, params);  // can throw
+    }
+    project->save();  // can throw
+    project->getDirectory().getFileSystem()->save();  // can throw
+  }
+  context.setParameter("schematics", pages);
+  context.setParameter("segments_per_schematic", segments);
+  context.setParameter("boards", pages);
+  context.setParameter("board", params.toJson());
+
+  context.measure([&]() {
+    ProjectLoader loader;
+    loader.open(std::unique_ptr<TransactionalDirectory>(
+                    new TransactionalDirectory(
+                        TransactionalFileSystem::openRO(projectDir))),
+                "benchmark.lpp");  // can throw
+  });
+}
+
+/*******************************************************************************
+ *  Registration
+ ******************************************************************************/
+
+void registerProjectBenchmarks(BenchmarkRunner& runner) {
+  runner.add("project/open", &benchmarkOpenProject);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,175 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+#include "syntheticdata.h"
+
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/serialization/sexpression.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void benchmarkSExpressionParse(BenchmarkContext& context) {
+  SyntheticData::BoardParameters params;
+  params.chipCount = context.scaled(params.chipCount);
+  QTemporaryDir dir;
+  SyntheticData data(context.getSeed());
+  std::unique_ptr<Project> project =
+      data.createProject(FilePath(dir.path()));  // can throw
+  Board& board = data.addBoard(*project, params);  // can throw
+  project->save();  // can throw
+  const QByteArray content = project->getDirectory().read(
+      "boards/" % board.getDirectoryName() % "/board.lp");  // can throw
+  context.setParameter("board", params.toJson());
+  context.setCounter("file_size_kb", content.size() / 1024);
+  context.setItemsPerIteration(content.size());
+
+  const FilePath fp(dir.path() % "/board.lp");
+  context.measure([&]() { SExpression::parse(content, fp); });
+}
+
+static void benchmarkUuidLookup(BenchmarkContext& context) {
+  // Lookups of existing and non-existing UUIDs, as done when resolving
+  // references while loading a project.
+  const int count = context.scaled(100000);
+  SyntheticData data(context.getSeed());
+  QHash<Uuid, int> hash;
+  QVector<Uuid> keys;
+  for (int i = 0; i < count; ++i) {
+    const Uuid uuid = data.createUuid();
+    hash.insert(uuid, i);
+    keys.append(uuid);
+    keys.append(data.createUuid());
+  }
+  context.setParameter("count", count);
+  context.setCounter("uuid_size_bytes", static_cast<int>(sizeof(Uuid)));
+  context.setItemsPerIteration(keys.count());
+
+  int found = 0;
+  context.measure([&]() {
+    found = 0;
+    foreach (const Uuid& key, keys) {
+      if (hash.contains(key)) {
+        ++found;
+      }
+    }
+  });
+  context.setCounter("found", found);
+}
+
+static void benchmarkUuidConversion(BenchmarkContext& context) {
+  const int count = context.scaled(100000);
+  SyntheticData data(context.getSeed());
+  QStringList strings;
+  for (int i = 0; i < count; ++i) {
+    strings.append(data.createUuid().toStr());
+  }
+  context.setParameter("count", count);
+  context.setItemsPerIteration(count);
+
+  context.measure([&]() {
+    foreach (const QString& str, strings) {
+      if (Uuid::fromString(str).toStr() != str) {
+        throw LogicError(__FILE__, __LINE__, "UUID conversion failed.");
+      }
+    }
+  });
+}
+
+static void benchmarkFootprintPadsLoad(BenchmarkContext& context) {
+  const int size = qMax(qRound(qSqrt(context.scaled(1024))), 1);
+  SyntheticData data(context.getSeed());
+  SExpression node = SExpression::createList("footprint");
+  data.createBgaPads(size).serialize(node);
+  context.setParameter("pads", size * size);
+  context.setItemsPerIteration(size * size);
+
+  context.measure([&]() {
+    FootprintPadList pads(node);  // can throw
+    if (pads.count() != size * size) {
+      throw LogicError(__FILE__, __LINE__, "Wrong number of pads loaded.");
+    }
+  });
+}
+
+static void benchmarkFootprintPadsPaste(BenchmarkContext& context) {
+  // Paste a copy of all pads into the same footprint, like the footprint
+  // editor does on copy & paste. All UUIDs exist already, so each pad is
+  // looked up and gets a new UUID.
+  const int size = qMax(qRound(qSqrt(context.scaled(1024))), 1);
+  SyntheticData data(context.getSeed());
+  const FootprintPadList original = data.createBgaPads(size);
+  const FootprintPadList clipboard = original.sortedByUuid();
+  const Point offset(100000, 100000);
+  context.setParameter("pads", size * size);
+  context.setItemsPerIteration(size * size);
+
+  FootprintPadList target;
+  context.measure(
+      [&]() {
+        for (const FootprintPad& pad : clipboard) {
+          Uuid uuid = pad.getUuid();
+          if (target.contains(uuid)) {
+            uuid = Uuid::createRandom();
+          }
+          target.append(std::make_shared<FootprintPad>(
+              uuid, pad.getPackagePadUuid(), pad.getPosition() + offset,
+              pad.getRotation(), pad.getShape(), pad.getWidth(),
+              pad.getHeight(), pad.getComponentSide(), pad.getHoles()));
+        }
+      },
+      [&]() { target = original; });
+}
+
+/*******************************************************************************
+ *  Registration
+ ******************************************************************************/
+
+void registerSerializationBenchmarks(BenchmarkRunner& runner) {
+  runner.add("serialization/sexpression_parse", &benchmarkSExpressionParse);
+  runner.add("serialization/uuid_lookup", &benchmarkUuidLookup);
+  runner.add("serialization/uuid_conversion", &benchmarkUuidConversion);
+  runner.add("serialization/footprint_pads_load", &benchmarkFootprintPadsLoad);
+  runner.add("serialization/footprint_pads_paste",
+             &benchmarkFootprintPadsPaste);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,491 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "syntheticdata.h"
+
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/graphics/graphicslayer.h>
+#include <librepcb/core/library/cmp/component.h>
+#include <librepcb/core/library/dev/device.h>
+#include <librepcb/core/library/library.h>
+#include <librepcb/core/library/pkg/package.h>
+#include <librepcb/core/library/sym/symbol.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardlayerstack.h>
+#include <librepcb/core/project/board/items/bi_device.h>
+#include <librepcb/core/project/board/items/bi_footprintpad.h>
+#include <librepcb/core/project/board/items/bi_netline.h>
+#include <librepcb/core/project/board/items/bi_netsegment.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/board/items/bi_polygon.h>
+#include <librepcb/core/project/board/items/bi_via.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/circuit/componentinstance.h>
+#include <librepcb/core/project/circuit/componentsignalinstance.h>
+#include <librepcb/core/project/circuit/netclass.h>
+#include <librepcb/core/project/circuit/netsignal.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectlibrary.h>
+#include <librepcb/core/project/schematic/items/si_netlabel.h>
+#include <librepcb/core/project/schematic/items/si_netline.h>
+#include <librepcb/core/project/schematic/items/si_netpoint.h>
+#include <librepcb/core/project/schematic/items/si_netsegment.h>
+#include <librepcb/core/project/schematic/schematic.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+// Layout of the generated boards, in nanometers.
+static const qint64 sBoardMargin = 3000000;
+static const qint64 sChipPitchX = 3000000;
+static const qint64 sChipPitchY = 2000000;
+static const qint64 sBgaPitch = 800000;
+
+// Layout of the generated schematics, in nanometers.
+static const qint64 sSegmentPitchX = 12700000;
+static const qint64 sSegmentPitchY = 5080000;
+
+/*******************************************************************************
+ *  Class SyntheticData::BoardParameters
+ ******************************************************************************/
+
+QJsonObject SyntheticData::BoardParameters::toJson() const noexcept {
+  QJsonObject obj;
+  obj.insert("chips", chipCount);
+  obj.insert("bga_size", bgaSize);
+  obj.insert("nets", netCount);
+  obj.insert("plane", addPlane);
+  return obj;
+}
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+SyntheticData::SyntheticData(quint32 seed) noexcept : mRandom(seed) {
+}
+
+SyntheticData::~SyntheticData() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+Uuid SyntheticData::createUuid() noexcept {
+  // Version 4 UUID, built from the reproducible random generator.
+  const quint32 a = static_cast<quint32>(mRandom());
+  const quint32 b = static_cast<quint32>(mRandom());
+  const quint32 c = static_cast<quint32>(mRandom());
+  const quint32 d = static_cast<quint32>(mRandom());
+  const QString str = QString("%1-%2-4%3-%4-%5%6")
+                          .arg(a, 8, 16, QChar('0'))
+                          .arg(b >> 16, 4, 16, QChar('0'))
+                          .arg(b & 0xFFFu, 3, 16, QChar('0'))
+                          .arg(0x8000u | ((c >> 16) & 0x3FFFu), 4, 16,
+                               QChar('0'))
+                          .arg(c & 0xFFFFu, 4, 16, QChar('0'))
+                          .arg(d, 8, 16, QChar('0'));
+  return Uuid::fromString(str);  // Format is always valid.
+}
+
+int SyntheticData::randomInt(int min, int max) noexcept {
+  // Not using std::uniform_int_distribution since its implementation (and
+  // thus the generated data) differs between standard libraries.
+  const quint32 range = static_cast<quint32>(max - min) + 1;
+  return min + static_cast<int>(static_cast<quint32>(mRandom()) % range);
+}
+
+Point SyntheticData::randomPoint(const Point& max) noexcept {
+  auto random = [this](const Length& limit) {
+    return Length(static_cast<qint64>(static_cast<quint32>(mRandom())) %
+                  (limit.toNm() + 1));
+  };
+  const Length x = random(max.getX());
+  const Length y = random(max.getY());
+  return Point(x, y);
+}
+
+FootprintPadList SyntheticData::createBgaPads(int size) noexcept {
+  FootprintPadList pads;
+  const qint64 offset = (sBgaPitch * (size - 1)) / 2;
+  for (int row = 0; row < size; ++row) {
+    for (int column = 0; column < size; ++column) {
+      const Uuid uuid = createUuid();
+      const Uuid pkgPadUuid = createUuid();
+      pads.append(std::make_shared<FootprintPad>(
+          uuid, pkgPadUuid,
+          Point(sBgaPitch * column - offset, offset - sBgaPitch * row),
+          Angle::deg0(), FootprintPad::Shape::ROUND,
+          PositiveLength(400000), PositiveLength(400000),
+          FootprintPad::ComponentSide::Top, HoleList()));
+    }
+  }
+  return pads;
+}
+
+std::unique_ptr<Project> SyntheticData::createProject(const FilePath& dir) {
+  std::unique_ptr<Project> project = Project::create(
+      std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(TransactionalFileSystem::openRW(dir))),
+      "benchmark.lpp");  // can throw
+  project->setName(ElementName("Benchmark"));
+  return project;
+}
+
+Board& SyntheticData::addBoard(Project& project,
+                               const BoardParameters& params) {
+  const QVector<NetSignal*> nets = getNetSignals(project, params.netCount);
+  const int number = project.getBoards().count() + 1;
+  Board* board = new Board(
+      project,
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+      QString("board_%1").arg(number), createUuid(),
+      ElementName(QString("Board %1").arg(number)));
+  project.addBoard(*board);
+  GraphicsLayer* topCopper =
+      board->getLayerStack().getLayer(GraphicsLayer::sTopCopper);
+  Q_ASSERT(topCopper);
+
+  // Components are shared by all boards, as if the boards were variants of
+  // the same circuit.
+  auto getComponent = [this, &project](const LibraryDevice& libDev,
+                                       const QString& name, bool& created) {
+    Circuit& circuit = project.getCircuit();
+    ComponentInstance* cmp = circuit.getComponentInstanceByName(name);
+    created = (!cmp);
+    if (!cmp) {
+      cmp = new ComponentInstance(
+          circuit, createUuid(),
+          *project.getLibrary().getComponent(libDev.component),
+          libDev.symbolVariant, CircuitIdentifier(name), libDev.device);
+      circuit.addComponentInstance(*cmp);
+    }
+    return cmp;
+  };
+
+  // Chips in a grid, each with a trace from its second pad to a via.
+  const LibraryDevice& chip = getChipDevice(project);
+  const int columns = qMax(qCeil(qSqrt(params.chipCount)), 1);
+  const int rows = (params.chipCount + columns - 1) / columns;
+  for (int i = 0; i < params.chipCount; ++i) {
+    NetSignal* net1 = nets.at(i % nets.count());
+    NetSignal* net2 = nets.at((i + 1) % nets.count());
+    bool created = false;
+    ComponentInstance* cmp =
+        getComponent(chip, QString("R%1").arg(i + 1), created);
+    if (created) {
+      cmp->getSignalInstance(chip.signalUuids.at(0))->setNetSignal(net1);
+      cmp->getSignalInstance(chip.signalUuids.at(1))->setNetSignal(net2);
+    }
+    const Point pos(sBoardMargin + sChipPitchX * (i % columns),
+                    sBoardMargin + sChipPitchY * (i / columns));
+    BI_Device* device =
+        new BI_Device(*board, *cmp, chip.device, chip.footprint, pos,
+                      Angle::deg0(), false, true);
+    board->addDeviceInstance(*device);
+
+    BI_NetSegment* segment = new BI_NetSegment(*board, createUuid(), net2);
+    board->addNetSegment(*segment);
+    BI_Via* via = new BI_Via(
+        *segment,
+        Via(createUuid(), pos + Point(1300000, 0), PositiveLength(600000),
+            PositiveLength(300000)));
+    BI_NetLine* line =
+        new BI_NetLine(*segment, createUuid(),
+                       *device->getPad(chip.padUuids.at(1)), *via,
+                       *topCopper, PositiveLength(200000));
+    segment->addElements(QList<BI_Via*>{via}, QList<BI_NetPoint*>(),
+                         QList<BI_NetLine*>{line});
+  }
+  qint64 width = sBoardMargin * 2 + sChipPitchX * columns;
+  qint64 height = sBoardMargin * 2 + sChipPitchY * rows;
+
+  // A BGA to the right of the chips, with the balls connected to all nets.
+  if (params.bgaSize > 0) {
+    const LibraryDevice& bga = getBgaDevice(project, params.bgaSize);
+    bool created = false;
+    ComponentInstance* cmp = getComponent(bga, "U1", created);
+    if (created) {
+      for (int i = 0; i < bga.signalUuids.count(); ++i) {
+        cmp->getSignalInstance(bga.signalUuids.at(i))
+            ->setNetSignal(nets.at(i % nets.count()));
+      }
+    }
+    const qint64 size = sBgaPitch * (params.bgaSize + 2);
+    const Point pos(width + size / 2, sBoardMargin + size / 2);
+    BI_Device* device = new BI_Device(*board, *cmp, bga.device, bga.footprint,
+                                      pos, Angle::deg0(), false, true);
+    board->addDeviceInstance(*device);
+    width += size + sBoardMargin;
+    height = qMax(height, size + sBoardMargin * 2);
+  }
+
+  // Board outline and plane.
+  board->addPolygon(*new BI_Polygon(
+      *board,
+      Polygon(createUuid(), GraphicsLayerName(GraphicsLayer::sBoardOutlines),
+              UnsignedLength(0), false, false,
+              Path::rect(Point(0, 0), Point(width, height)))));
+  if (params.addPlane) {
+    BI_Plane* plane = new BI_Plane(
+        *board, createUuid(), GraphicsLayerName(GraphicsLayer::sBotCopper),
+        *nets.first(),
+        Path::rect(Point(1000000, 1000000),
+                   Point(width - 1000000, height - 1000000)));
+    board->addPlane(*plane);
+  }
+  return *board;
+}
+
+Schematic& SyntheticData::addSchematic(Project& project, int segments) {
+  const QVector<NetSignal*> nets = getNetSignals(project, 100);
+  const int number = project.getSchematics().count() + 1;
+  Schematic* schematic = new Schematic(
+      project,
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+      QString("schematic_%1").arg(number), createUuid(),
+      ElementName(QString("Page %1").arg(number)));
+  project.addSchematic(*schematic);
+
+  const int columns = qMax(qCeil(qSqrt(segments)), 1);
+  const QVector<Point> offsets = {
+      Point(0, 0),
+      Point(5080000, 0),
+      Point(5080000, -2540000),
+      Point(10160000, -2540000),
+  };
+  for (int i = 0; i < segments; ++i) {
+    const Point origin(sSegmentPitchX * (i % columns),
+                       -sSegmentPitchY * (i / columns));
+    SI_NetSegment* segment = new SI_NetSegment(*schematic, createUuid(),
+                                               *nets.at(i % nets.count()));
+    schematic->addNetSegment(*segment);
+    QList<SI_NetPoint*> points;
+    foreach (const Point& offset, offsets) {
+      points.append(new SI_NetPoint(*segment, createUuid(), origin + offset));
+    }
+    QList<SI_NetLine*> lines;
+    for (int k = 1; k < points.count(); ++k) {
+      lines.append(new SI_NetLine(*segment, createUuid(), *points.at(k - 1),
+                                  *points.at(k), UnsignedLength(158750)));
+    }
+    segment->addNetPointsAndNetLines(points, lines);
+    segment->addNetLabel(*new SI_NetLabel(
+        *segment,
+        NetLabel(createUuid(), origin + Point(1270000, 0), Angle::deg0(),
+                 false)));
+  }
+  return *schematic;
+}
+
+void SyntheticData::createLibrary(const FilePath& librariesDir, int elements) {
+  const Version version = Version::fromString("0.1");
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRW(
+          librariesDir.getPathTo("local/Synthetic.lplib"));  // can throw
+  TransactionalDirectory dir(fs);
+  Library library(createUuid(), version, "LibrePCB", ElementName("Synthetic"),
+                  "Generated library", "");
+  library.moveTo(dir);  // can throw
+
+  TransactionalDirectory symDir(dir, Symbol::getShortElementName());
+  TransactionalDirectory pkgDir(dir, Package::getShortElementName());
+  TransactionalDirectory cmpDir(dir, Component::getShortElementName());
+  TransactionalDirectory devDir(dir, Device::getShortElementName());
+  for (int i = 0; i < elements; ++i) {
+    const ElementName name(QString("Element %1").arg(i + 1));
+    const QString description = "Generated element";
+    const QString keywords = "synthetic,benchmark";
+
+    Symbol symbol(createUuid(), version, "LibrePCB", name, description,
+                  keywords);
+    symbol.saveIntoParentDirectory(symDir);  // can throw
+
+    Package package(createUuid(), version, "LibrePCB", name, description,
+                    keywords);
+    std::shared_ptr<Footprint> footprint = std::make_shared<Footprint>(
+        createUuid(), ElementName("default"), "");
+    for (int k = 0; k < 2; ++k) {
+      const Uuid pkgPadUuid = createUuid();
+      package.getPads().append(std::make_shared<PackagePad>(
+          pkgPadUuid, CircuitIdentifier(QString::number(k + 1))));
+      footprint->getPads().append(std::make_shared<FootprintPad>(
+          createUuid(), pkgPadUuid, Point(k * 1000000 - 500000, 0),
+          Angle::deg0(), FootprintPad::Shape::RECT, PositiveLength(500000),
+          PositiveLength(600000), FootprintPad::ComponentSide::Top,
+          HoleList()));
+    }
+    package.getFootprints().append(footprint);
+    package.saveIntoParentDirectory(pkgDir);  // can throw
+
+    Component component(createUuid(), version, "LibrePCB", name, description,
+                        keywords);
+    component.getSymbolVariants().append(
+        std::make_shared<ComponentSymbolVariant>(
+            createUuid(), "", ElementName("default"), ""));
+    component.saveIntoParentDirectory(cmpDir);  // can throw
+
+    Device device(createUuid(), version, "LibrePCB", name, description,
+                  keywords, component.getUuid(), package.getUuid());
+    device.saveIntoParentDirectory(devDir);  // can throw
+  }
+  fs->save();  // can throw
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+const SyntheticData::LibraryDevice& SyntheticData::getChipDevice(
+    Project& project) {
+  QHash<int, LibraryDevice>& devices = mLibraryDevices[&project];
+  auto it = devices.find(0);
+  if (it == devices.end()) {
+    FootprintPadList pads;
+    for (int i = 0; i < 2; ++i) {
+      const Uuid uuid = createUuid();
+      const Uuid pkgPadUuid = createUuid();
+      pads.append(std::make_shared<FootprintPad>(
+          uuid, pkgPadUuid, Point(i * 1000000 - 500000, 0), Angle::deg0(),
+          FootprintPad::Shape::RECT, PositiveLength(500000),
+          PositiveLength(600000), FootprintPad::ComponentSide::Top,
+          HoleList()));
+    }
+    it = devices.insert(0, addLibraryDevice(project, "R-0402", pads));
+  }
+  return *it;
+}
+
+const SyntheticData::LibraryDevice& SyntheticData::getBgaDevice(
+    Project& project, int size) {
+  QHash<int, LibraryDevice>& devices = mLibraryDevices[&project];
+  auto it = devices.find(size);
+  if (it == devices.end()) {
+    it = devices.insert(size,
+                        addLibraryDevice(project, QString("BGA-%1").arg(size),
+                                         createBgaPads(size)));
+  }
+  return *it;
+}
+
+SyntheticData::LibraryDevice SyntheticData::addLibraryDevice(
+    Project& project, const QString& name, const FootprintPadList& pads) {
+  const Version version = Version::fromString("0.1");
+  const ElementName elementName(name);
+
+  // Package with one package pad per footprint pad, the name as stroke text
+  // and a courtyard around all pads.
+  std::unique_ptr<Package> pkg(
+      new Package(createUuid(), version, "LibrePCB", elementName, "", ""));
+  std::shared_ptr<Footprint> footprint = std::make_shared<Footprint>(
+      createUuid(), ElementName("default"), "");
+  qint64 courtyardWidth = 0;
+  qint64 courtyardHeight = 0;
+  for (const FootprintPad& pad : pads) {
+    pkg->getPads().append(std::make_shared<PackagePad>(
+        *pad.getPackagePadUuid(),
+        CircuitIdentifier(QString::number(pkg->getPads().count() + 1))));
+    footprint->getPads().append(std::make_shared<FootprintPad>(pad));
+    courtyardWidth = qMax(courtyardWidth,
+                          qAbs(pad.getPosition().getX().toNm()) * 2 +
+                              pad.getWidth()->toNm() + 500000);
+    courtyardHeight = qMax(courtyardHeight,
+                           qAbs(pad.getPosition().getY().toNm()) * 2 +
+                               pad.getHeight()->toNm() + 500000);
+  }
+  footprint->getPolygons().append(std::make_shared<Polygon>(
+      createUuid(), GraphicsLayerName(GraphicsLayer::sTopCourtyard),
+      UnsignedLength(0), false, false,
+      Path::centeredRect(PositiveLength(courtyardWidth),
+                         PositiveLength(courtyardHeight))));
+  footprint->getStrokeTexts().append(std::make_shared<StrokeText>(
+      createUuid(), GraphicsLayerName(GraphicsLayer::sTopNames), "{{NAME}}",
+      Point(0, courtyardHeight / 2 + 500000), Angle::deg0(),
+      PositiveLength(500000), UnsignedLength(100000), StrokeTextSpacing(),
+      StrokeTextSpacing(),
+      Alignment(HAlign::center(), VAlign::bottom()), false, true));
+  pkg->getFootprints().append(footprint);
+
+  // Component with one signal per pad.
+  std::unique_ptr<Component> cmp(
+      new Component(createUuid(), version, "LibrePCB", elementName, "", ""));
+  std::shared_ptr<ComponentSymbolVariant> symbolVariant =
+      std::make_shared<ComponentSymbolVariant>(createUuid(), "",
+                                               ElementName("default"), "");
+  cmp->getSymbolVariants().append(symbolVariant);
+  std::unique_ptr<Device> dev(new Device(createUuid(), version, "LibrePCB",
+                                         elementName, "", "", cmp->getUuid(),
+                                         pkg->getUuid()));
+  LibraryDevice libDev{cmp->getUuid(),        symbolVariant->getUuid(),
+                       dev->getUuid(),        footprint->getUuid(),
+                       QVector<Uuid>(),       QVector<Uuid>()};
+  for (const FootprintPad& pad : pads) {
+    const Uuid signalUuid = createUuid();
+    cmp->getSignals().append(std::make_shared<ComponentSignal>(
+        signalUuid,
+        CircuitIdentifier(QString("S%1").arg(cmp->getSignals().count() + 1)),
+        SignalRole::passive(), QString(), false, false, false));
+    dev->getPadSignalMap().append(std::make_shared<DevicePadSignalMapItem>(
+        *pad.getPackagePadUuid(), signalUuid));
+    libDev.signalUuids.append(signalUuid);
+    libDev.padUuids.append(pad.getUuid());
+  }
+
+  // The project library takes ownership.
+  project.getLibrary().addPackage(*pkg);  // can throw
+  pkg.release();
+  project.getLibrary().addComponent(*cmp);  // can throw
+  cmp.release();
+  project.getLibrary().addDevice(*dev);  // can throw
+  dev.release();
+  return libDev;
+}
+
+QVector<NetSignal*> SyntheticData::getNetSignals(Project& project, int count) {
+  Circuit& circuit = project.getCircuit();
+  QVector<NetSignal*> nets;
+  for (int i = 0; i < qMax(count, 1); ++i) {
+    const QString name = (i == 0) ? QString("GND") : QString("N%1").arg(i);
+    NetSignal* net = circuit.getNetSignalByName(name);
+    if (!net) {
+      net = new NetSignal(circuit, createUuid(),
+                          *circuit.getNetClasses().first(),
+                          CircuitIdentifier(name), false);
+      circuit.addNetSignal(*net);
+    }
+    nets.append(net);
+  }
+  return nets;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,183 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_SYNTHETICDATA_H
+#define LIBREPCB_BENCHMARKS_SYNTHETICDATA_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/fileio/filepath.h>
+#include <librepcb/core/library/pkg/footprintpad.h>
+#include <librepcb/core/types/point.h>
+#include <librepcb/core/types/uuid.h>
+
+#include <QtCore>
+
+#include <memory>
+#include <random>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class Board;
+class NetSignal;
+class Project;
+class Schematic;
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class SyntheticData
+ ******************************************************************************/
+
+/**
+ * @brief Generates reproducible projects, boards and libraries for benchmarks
+ *
+ * All generated data (including UUIDs) only depends on the seed and the
+ * given parameters, so the same seed always leads to the same data.
+ */
+class SyntheticData final {
+public:
+  // Types
+  struct BoardParameters {
+    int chipCount = 400;  ///< Number of two-pad 0402 devices
+    int bgaSize = 24;  ///< Balls per row of a BGA device (0 = no BGA)
+    int netCount = 100;  ///< Number of net signals
+    bool addPlane = true;  ///< Add a GND plane on the bottom layer
+
+    QJsonObject toJson() const noexcept;
+  };
+
+  // Constructors / Destructor
+  SyntheticData() = delete;
+  SyntheticData(const SyntheticData& other) = delete;
+  explicit SyntheticData(quint32 seed) noexcept;
+  ~SyntheticData() noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Create a random but reproducible UUID
+   */
+  Uuid createUuid() noexcept;
+
+  /**
+   * @brief Create a random but reproducible integer
+   *
+   * @param min   Minimum value (inclusive).
+   * @param max   Maximum value (inclusive).
+   */
+  int randomInt(int min, int max) noexcept;
+
+  /**
+   * @brief Create a random but reproducible point
+   *
+   * @param max   Maximum coordinates, the minimum is (0, 0).
+   */
+  Point randomPoint(const Point& max) noexcept;
+
+  /**
+   * @brief Create a package pad list like the one of a large BGA
+   *
+   * @param size  Number of balls per row.
+   *
+   * @return Round pads with 0.8mm pitch.
+   */
+  FootprintPadList createBgaPads(int size) noexcept;
+
+  /**
+   * @brief Create a new project in an empty directory
+   *
+   * @param dir   Directory of the project (will be created).
+   *
+   * @return The project, not yet saved to disk.
+   */
+  std::unique_ptr<Project> createProject(const FilePath& dir);
+
+  /**
+   * @brief Add a board with devices, traces, vias and a plane
+   *
+   * The chips are placed in a grid and connected in a chain through the
+   * net signals, each with a trace and a via. The BGA is placed next to the
+   * chips with its balls connected to the net signals in turn. Net signals
+   * and library elements are created as needed.
+   *
+   * @param project   The project to add the board to.
+   * @param params    Size of the board.
+   *
+   * @return The added board.
+   */
+  Board& addBoard(Project& project, const BoardParameters& params);
+
+  /**
+   * @brief Add a schematic with net segments and net labels
+   *
+   * @param project     The project to add the schematic to.
+   * @param segments    Number of net segments, each with four junctions,
+   *                    three lines and one label.
+   *
+   * @return The added schematic.
+   */
+  Schematic& addSchematic(Project& project, int segments);
+
+  /**
+   * @brief Create a workspace library with symbols, packages, components
+   *        and devices
+   *
+   * @param librariesDir  The libraries directory of a workspace.
+   * @param elements      Number of elements per element type.
+   */
+  void createLibrary(const FilePath& librariesDir, int elements);
+
+  // Operator Overloadings
+  SyntheticData& operator=(const SyntheticData& rhs) = delete;
+
+private:  // Types
+  struct LibraryDevice {
+    Uuid component;
+    Uuid symbolVariant;
+    Uuid device;
+    Uuid footprint;
+    QVector<Uuid> signalUuids;  ///< Component signal of each pad
+    QVector<Uuid> padUuids;  ///< Footprint pads
+  };
+
+private:  // Methods
+  const LibraryDevice& getChipDevice(Project& project);
+  const LibraryDevice& getBgaDevice(Project& project, int size);
+  LibraryDevice addLibraryDevice(Project& project, const QString& name,
+                                 const FootprintPadList& pads);
+  QVector<NetSignal*> getNetSignals(Project& project, int count);
+
+private:  // Data
+  std::mt19937 mRandom;
+  QHash<Project*, QHash<int, LibraryDevice>> mLibraryDevices;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif
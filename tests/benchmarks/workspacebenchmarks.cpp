@@ -0,0 +1,81 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkrunner.h"
+#include "benchmarks.h"
+#include "syntheticdata.h"
+
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/workspace/workspacelibrarydb.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+static void benchmarkLibraryRescan(BenchmarkContext& context) {
+  const int elements = context.scaled(250);
+  QTemporaryDir dir;
+  const FilePath librariesPath(dir.path());
+  SyntheticData data(context.getSeed());
+  data.createLibrary(librariesPath, elements);  // can throw
+  WorkspaceLibraryDb db(librariesPath);  // can throw
+  context.setParameter("elements_per_type", elements);
+  context.setItemsPerIteration(elements * 4);
+
+  QString error;
+  QObject::connect(&db, &WorkspaceLibraryDb::scanFailed,
+                   [&error](QString msg) { error = msg; });
+  context.measure([&]() {
+    QEventLoop loop;
+    QObject::connect(&db, &WorkspaceLibraryDb::scanFinished, &loop,
+                     &QEventLoop::quit);
+    db.startLibraryRescan();
+    loop.exec();
+    if (!error.isEmpty()) {
+      throw RuntimeError(__FILE__, __LINE__, error);
+    }
+  });
+}
+
+/*******************************************************************************
+ *  Registration
+ ******************************************************************************/
+
+void registerWorkspaceBenchmarks(BenchmarkRunner& runner) {
+  runner.add("workspace/library_rescan", &benchmarkLibraryRescan);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
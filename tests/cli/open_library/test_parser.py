@@ -10,19 +10,21 @@ Usage: {executable} [options] open-library [command_options] library
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -V, --version  Displays version information.
-  -v, --verbose  Verbose output.
-  --all          Perform the selected action(s) on all elements contained in
-                 the opened library.
-  --save         Save library (and contained elements if '--all' is given)
-                 before closing them (useful to upgrade file format).
-  --strict       Fail if the opened files are not strictly canonical, i.e.
-                 there would be changes when saving the library elements.
+  -h, --help      Print this message.
+  -V, --version   Displays version information.
+  -v, --verbose   Verbose output.
+  --trace <file>  Record the duration of all performed operations and write
+                  them as Chrome trace JSON to the given file.
+  --all           Perform the selected action(s) on all elements contained in
+                  the opened library.
+  --save          Save library (and contained elements if '--all' is given)
+                  before closing them (useful to upgrade file format).
+  --strict        Fail if the opened files are not strictly canonical, i.e.
+                  there would be changes when saving the library elements.
 
 Arguments:
-  open-library   Open a library to execute library-related tasks.
-  library        Path to library directory (*.lplib).
+  open-library    Open a library to execute library-related tasks.
+  library         Path to library directory (*.lplib).
 """
 
 ERROR_TEXT = """\
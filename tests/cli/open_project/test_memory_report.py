@@ -0,0 +1,40 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import params
+import pytest
+import re
+
+"""
+Test command "open-project --memory-report"
+"""
+
+
+@pytest.mark.parametrize("project", [
+    params.EMPTY_PROJECT_LPP_PARAM,
+    params.PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM,
+])
+def test_memory_report(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--memory-report',
+                                   project.path)
+    assert stderr == ''
+    lines = stdout.splitlines()
+    assert lines[0] == "Open project '{project.path}'...".format(
+        project=project)
+    assert lines[1] == "Memory usage (approximate):"
+    names = [
+        'Library elements',
+        'Board items',
+        'Board graphics items',
+        'Plane fragments',
+        'Schematic items',
+        'Schematic graphics items',
+    ]
+    for i, name in enumerate(names):
+        assert re.match(r'^  ' + name + r' +\d+ +\d+(\.\d)? (B|KiB|MiB)$',
+                        lines[2 + i]) is not None
+    assert re.match(r'^  Total +\d+(\.\d)? (B|KiB|MiB)$',
+                    lines[2 + len(names)]) is not None
+    assert lines[3 + len(names):] == ['SUCCESS']
+    assert code == 0
@@ -15,6 +15,9 @@ Options:
   -h, --help                         Print this message.
   -V, --version                      Displays version information.
   -v, --verbose                      Verbose output.
+  --trace <file>                     Record the duration of all performed
+                                     operations and write them as Chrome trace
+                                     JSON to the given file.
   --erc                              Run the electrical rule check, print all
                                      non-approved warnings/errors and report
                                      failure (exit code = 1) if there are
@@ -64,6 +67,8 @@ Options:
                                      canonical, i.e. there would be changes when
                                      saving the project. Note that this option
                                      is not available for *.lppz files.
+  --memory-report                    Print the approximate memory usage of the
+                                     opened project, split into its subsystems.
 
 Arguments:
   open-project                       Open a project to execute project-related
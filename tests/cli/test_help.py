@@ -14,12 +14,14 @@ Usage: {executable} [options] command
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -V, --version  Displays version information.
-  -v, --verbose  Verbose output.
+  -h, --help      Print this message.
+  -V, --version   Displays version information.
+  -v, --verbose   Verbose output.
+  --trace <file>  Record the duration of all performed operations and write
+                  them as Chrome trace JSON to the given file.
 
 Arguments:
-  command        The command to execute (see list below).
+  command         The command to execute (see list below).
 
 Commands:
   open-library   Open a library to execute library-related tasks.
@@ -0,0 +1,208 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/algorithm/clearancekernel.h>
+#include <librepcb/core/geometry/path.h>
+#include <librepcb/core/utils/clipperhelpers.h>
+
+#include <QtCore>
+
+#include <random>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ClearanceKernelTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ClearanceKernelTest, testCircleToCircle) {
+  ClearanceKernel kernel;
+  int c1 = kernel.addCircle(0, Point(0, 0), UnsignedLength(1000));
+  int c2 = kernel.addCircle(1, Point(3000, 4000), UnsignedLength(2000));
+  EXPECT_EQ(Length(3500), kernel.calcDistance(c1, c2));
+  EXPECT_EQ(Length(3500), kernel.calcDistance(c2, c1));
+}
+
+TEST_F(ClearanceKernelTest, testCapsuleToCapsuleParallel) {
+  ClearanceKernel kernel;
+  int t1 = kernel.addCapsule(0, Point(0, 0), Point(10000, 0),
+                             UnsignedLength(1000));
+  int t2 = kernel.addCapsule(1, Point(5000, 3000), Point(20000, 3000),
+                             UnsignedLength(2000));
+  EXPECT_EQ(Length(1500), kernel.calcDistance(t1, t2));
+}
+
+TEST_F(ClearanceKernelTest, testCapsuleToCapsuleEnds) {
+  ClearanceKernel kernel;
+  int t1 = kernel.addCapsule(0, Point(0, 0), Point(10000, 0),
+                             UnsignedLength(1000));
+  int t2 = kernel.addCapsule(1, Point(13000, 4000), Point(20000, 4000),
+                             UnsignedLength(1000));
+  EXPECT_EQ(Length(4000), kernel.calcDistance(t1, t2));
+}
+
+TEST_F(ClearanceKernelTest, testCrossingCapsules) {
+  ClearanceKernel kernel;
+  int t1 = kernel.addCapsule(0, Point(-10000, 0), Point(10000, 0),
+                             UnsignedLength(0));
+  int t2 = kernel.addCapsule(1, Point(0, -10000), Point(0, 10000),
+                             UnsignedLength(0));
+  EXPECT_EQ(Length(0), kernel.calcDistance(t1, t2));
+}
+
+TEST_F(ClearanceKernelTest, testPolygonToCircle) {
+  ClearanceKernel kernel;
+  int p = kernel.addConvexPolygon(
+      0, {Point(0, 0), Point(10000, 0), Point(10000, 10000), Point(0, 10000)});
+  int c1 = kernel.addCircle(1, Point(15000, 5000), UnsignedLength(2000));
+  int c2 = kernel.addCircle(1, Point(5000, 5000), UnsignedLength(2000));
+  int c3 = kernel.addCircle(1, Point(13000, 14000), UnsignedLength(0));
+  EXPECT_EQ(Length(4000), kernel.calcDistance(p, c1));
+  EXPECT_EQ(Length(0), kernel.calcDistance(p, c2));  // Inside polygon.
+  EXPECT_EQ(Length(5000), kernel.calcDistance(p, c3));
+}
+
+TEST_F(ClearanceKernelTest, testPolygonInsidePolygon) {
+  ClearanceKernel kernel;
+  int p1 = kernel.addConvexPolygon(
+      0, {Point(0, 0), Point(0, 10000), Point(10000, 10000), Point(10000, 0)});
+  int p2 = kernel.addConvexPolygon(
+      1, {Point(1000, 1000), Point(2000, 1000), Point(2000, 2000)});
+  EXPECT_EQ(Length(0), kernel.calcDistance(p1, p2));
+  EXPECT_EQ(Length(0), kernel.calcDistance(p2, p1));
+}
+
+TEST_F(ClearanceKernelTest, testFindViolations) {
+  ClearanceKernel kernel;
+  kernel.addCircle(0, Point(0, 0), UnsignedLength(1000));  // 0
+  kernel.addCircle(0, Point(1000, 0), UnsignedLength(1000));  // 1
+  kernel.addCircle(1, Point(2000, 0), UnsignedLength(1000));  // 2
+  kernel.addCircle(2, Point(4000, 0), UnsignedLength(1000));  // 3
+  kernel.addCircle(3, Point(100000, 0), UnsignedLength(1000));  // 4
+
+  // Same group is never reported, and exact clearance is not a violation.
+  QVector<ClearanceKernel::Violation> violations =
+      kernel.findViolations(UnsignedLength(1000));
+  ASSERT_EQ(1, violations.count());
+  EXPECT_EQ(1, violations[0].object1);
+  EXPECT_EQ(2, violations[0].object2);
+
+  violations = kernel.findViolations(UnsignedLength(1001));
+  ASSERT_EQ(3, violations.count());
+  EXPECT_EQ(0, violations[0].object1);
+  EXPECT_EQ(2, violations[0].object2);
+  EXPECT_EQ(1, violations[1].object1);
+  EXPECT_EQ(2, violations[1].object2);
+  EXPECT_EQ(2, violations[2].object1);
+  EXPECT_EQ(3, violations[2].object2);
+}
+
+TEST_F(ClearanceKernelTest, testCrossCheckWithClipper) {
+  const PositiveLength tolerance(5000);
+  const UnsignedLength clearance(200000);
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> pos(0, 5000000);
+  std::uniform_int_distribution<int> size(100000, 1000000);
+  std::uniform_int_distribution<int> type(0, 2);
+
+  // Create random objects and their outlines.
+  ClearanceKernel kernel;
+  QVector<Path> outlines;
+  for (int i = 0; i < 100; ++i) {
+    const Point p(pos(rng), pos(rng));
+    const PositiveLength w(size(rng));
+    switch (type(rng)) {
+      case 0: {
+        kernel.addCircle(i, p, positiveToUnsigned(w));
+        outlines.append(Path::circle(w).translated(p));
+        break;
+      }
+      case 1: {
+        const Point p2 = p + Point(size(rng), size(rng));
+        kernel.addCapsule(i, p, p2, positiveToUnsigned(w));
+        outlines.append(Path::obround(p, p2, w));
+        break;
+      }
+      default: {
+        const Path rect =
+            Path::centeredRect(w, PositiveLength(size(rng))).translated(p);
+        QVector<Point> vertices;
+        for (int k = 0; k < rect.getVertices().count() - 1; ++k) {
+          vertices.append(rect.getVertices().at(k).getPos());
+        }
+        kernel.addConvexPolygon(i, vertices);
+        outlines.append(rect);
+        break;
+      }
+    }
+  }
+
+  // Compare with the result of offsetting and intersecting with Clipper,
+  // except for pairs whose distance is too close to the clearance to get
+  // a reliable result with flattened arcs.
+  QSet<QPair<int, int>> violations;
+  for (const ClearanceKernel::Violation& v : kernel.findViolations(clearance)) {
+    violations.insert(qMakePair(v.object1, v.object2));
+  }
+  int checkedPairs = 0;
+  for (int i = 0; i < outlines.count(); ++i) {
+    for (int k = i + 1; k < outlines.count(); ++k) {
+      const Length distance = kernel.calcDistance(i, k);
+      if ((distance - *clearance).abs() < (*tolerance * 4)) {
+        continue;
+      }
+      ClipperLib::Paths paths1{ClipperHelpers::convert(outlines[i], tolerance)};
+      ClipperLib::Paths paths2{ClipperHelpers::convert(outlines[k], tolerance)};
+      ClipperHelpers::offset(paths1, *clearance / 2, tolerance);
+      ClipperHelpers::offset(paths2, *clearance / 2, tolerance);
+      std::unique_ptr<ClipperLib::PolyTree> intersections =
+          ClipperHelpers::intersect(paths1, paths2);
+      const bool clipperViolation =
+          !ClipperHelpers::flattenTree(*intersections).empty();
+      EXPECT_EQ(clipperViolation, violations.contains(qMakePair(i, k)))
+          << "Objects " << i << " and " << k << ", distance "
+          << distance.toNm() << "nm";
+      ++checkedPairs;
+    }
+  }
+  EXPECT_GT(checkedPairs, 4000);
+  EXPECT_GT(violations.count(), 0);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
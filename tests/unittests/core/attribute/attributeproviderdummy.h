@@ -59,7 +59,9 @@ public:
   }
 
 signals:
-  void attributesChanged() override {}
+  void attributesChanged(const QSet<QString>& keys) override {
+    Q_UNUSED(keys);
+  }
 };
 
 /*******************************************************************************
@@ -0,0 +1,80 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/attribute/attributeprovider.h>
+#include <librepcb/core/attribute/attrtypestring.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class AttributeProviderTest : public ::testing::Test {
+protected:
+  static std::shared_ptr<Attribute> createAttribute(const QString& key,
+                                                    const QString& value) {
+    return std::make_shared<Attribute>(
+        AttributeKey(key), AttrTypeString::instance(), value, nullptr);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(AttributeProviderTest, testIsAffectedByChange) {
+  EXPECT_FALSE(AttributeProvider::isAffectedByChange({}, {}));
+  EXPECT_FALSE(AttributeProvider::isAffectedByChange({}, {"A"}));
+  EXPECT_TRUE(AttributeProvider::isAffectedByChange({"A"}, {}));
+  EXPECT_TRUE(AttributeProvider::isAffectedByChange({"A", "B"}, {"B"}));
+  EXPECT_FALSE(AttributeProvider::isAffectedByChange({"A", "B"}, {"C"}));
+}
+
+TEST_F(AttributeProviderTest, testGetChangedKeys) {
+  AttributeList a;
+  a.append(createAttribute("KEPT", "1"));
+  a.append(createAttribute("MODIFIED", "1"));
+  a.append(createAttribute("REMOVED", "1"));
+  AttributeList b;
+  b.append(createAttribute("KEPT", "1"));
+  b.append(createAttribute("MODIFIED", "2"));
+  b.append(createAttribute("ADDED", "1"));
+  QSet<QString> expected = {"MODIFIED", "REMOVED", "ADDED"};
+  EXPECT_EQ(expected, AttributeProvider::getChangedKeys(a, b));
+  EXPECT_EQ(expected, AttributeProvider::getChangedKeys(b, a));
+  EXPECT_EQ(QSet<QString>(), AttributeProvider::getChangedKeys(a, a));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
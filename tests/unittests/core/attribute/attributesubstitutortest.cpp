@@ -50,6 +50,8 @@ typedef struct {
 class AttributeSubstitutorTest
   : public ::testing::TestWithParam<AttributeSubstitutorTestData> {};
 
+class AttributeSubstitutorKeysTest : public ::testing::Test {};
+
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
@@ -63,6 +65,41 @@ TEST_P(AttributeSubstitutorTest, testData) {
       << "Actual value: '" << qPrintable(output) << "'";
 }
 
+TEST_F(AttributeSubstitutorKeysTest, testUsedKeys) {
+  AttributeProviderDummy ap;
+  QSet<QString> keys;
+  QString output = AttributeSubstitutor::substitute(
+      "{{KEY_4}} {{FOO or 'bar'}} {{KEY or KEY_1}}", &ap, nullptr, &keys);
+  EXPECT_EQ("Recursive Normal value value bar ", output);  // KEY_1 used twice
+  EXPECT_EQ(QSet<QString>({"KEY_4", "KEY_1", "FOO", "KEY"}), keys);
+}
+
+TEST_F(AttributeSubstitutorKeysTest, testNoUsedKeys) {
+  AttributeProviderDummy ap;
+  QSet<QString> keys;
+  QString output = AttributeSubstitutor::substitute(
+      "Hello {{ '{{' }} World!", &ap, nullptr, &keys);
+  EXPECT_EQ("Hello {{ World!", output);
+  EXPECT_TRUE(keys.isEmpty());
+}
+
+TEST_F(AttributeSubstitutorKeysTest, testFilter) {
+  AttributeProviderDummy ap;
+  QString output = AttributeSubstitutor::substitute(
+      "a {{KEY_4}} {{'b'}} c", &ap,
+      [](const QString& str) { return str.toUpper(); });
+  EXPECT_EQ("a RECURSIVE NORMAL VALUE VALUE B c", output);
+}
+
+TEST_F(AttributeSubstitutorKeysTest, testRepeatedSubstitution) {
+  // The second call uses the cached tokens and must give the same result.
+  AttributeProviderDummy ap;
+  const QString input = "{{KEY_1}} {{KEY_5}}!";
+  const QString output = AttributeSubstitutor::substitute(input, &ap);
+  EXPECT_EQ("Normal value Recursive Recursive  value value!", output);
+  EXPECT_EQ(output, AttributeSubstitutor::substitute(input, &ap));
+}
+
 /*******************************************************************************
  *  Test Data
  ******************************************************************************/
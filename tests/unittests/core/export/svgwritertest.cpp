@@ -0,0 +1,126 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/export/svgwriter.h>
+#include <librepcb/core/geometry/path.h>
+
+#include <QtCore>
+#include <QtSvg>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SvgWriterTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SvgWriterTest, testToNumber) {
+  EXPECT_EQ("0", SvgWriter::toNumber(0).toStdString());
+  EXPECT_EQ("0", SvgWriter::toNumber(-0.000001).toStdString());
+  EXPECT_EQ("72", SvgWriter::toNumber(72).toStdString());
+  EXPECT_EQ("-1.5", SvgWriter::toNumber(-1.5).toStdString());
+  EXPECT_EQ("0.12346", SvgWriter::toNumber(0.123456).toStdString());
+}
+
+TEST_F(SvgWriterTest, testToPathDataLines) {
+  // 25.4mm = 72px
+  const Path path({
+      Vertex(Point(0, 0)),
+      Vertex(Point(25400000, 0)),
+      Vertex(Point(25400000, 25400000)),
+      Vertex(Point(0, 0)),
+  });
+  EXPECT_EQ("M0 0L72 0L72 -72L0 0Z", SvgWriter::toPathData(path).toStdString());
+}
+
+TEST_F(SvgWriterTest, testToPathDataArcs) {
+  const Path ccw({
+      Vertex(Point(0, 0), Angle::deg90()),
+      Vertex(Point(25400000, 0)),
+  });
+  EXPECT_EQ("M0 0A50.91169 50.91169 0 0 0 72 0",
+            SvgWriter::toPathData(ccw).toStdString());
+
+  const Path cw({
+      Vertex(Point(0, 0), -Angle::deg270()),
+      Vertex(Point(25400000, 0)),
+  });
+  EXPECT_EQ("M0 0A50.91169 50.91169 0 1 1 72 0",
+            SvgWriter::toPathData(cw).toStdString());
+}
+
+TEST_F(SvgWriterTest, testToTransform) {
+  QTransform t;
+  EXPECT_EQ("translate(0 0)", SvgWriter::toTransform(t).toStdString());
+  t.translate(10, -5);
+  EXPECT_EQ("translate(10 -5)", SvgWriter::toTransform(t).toStdString());
+  t.scale(-1, 1);
+  EXPECT_EQ("matrix(-1 0 0 1 10 -5)", SvgWriter::toTransform(t).toStdString());
+}
+
+TEST_F(SvgWriterTest, testDocument) {
+  QBuffer buffer;
+  buffer.open(QIODevice::WriteOnly);
+  SvgWriter writer(buffer);
+  writer.beginDocument("Test", QSizeF(100, 50), QRectF(0, 0, 200, 100));
+  writer.fillRect(QRectF(0, 0, 200, 100), Qt::white);
+  writer.beginDefinition("footprint0");
+  writer.drawCircle(Point(0, 0), Length(1000000), Length(0), QColor(), Qt::red);
+  writer.endDefinition();
+  writer.beginGroup(QTransform::fromTranslate(100, 50));
+  writer.drawDefinition("footprint0", QTransform::fromTranslate(10, 10));
+  writer.drawDefinition("footprint0", QTransform::fromTranslate(-10, 10));
+  writer.drawLine(Point(0, 0), Point(1000000, 0), Length(100000), Qt::blue);
+  writer.drawSlot(Path({Vertex(Point(0, 0)), Vertex(Point(0, 1000000))}),
+                  PositiveLength(500000), Length(0), Qt::black, QColor());
+  writer.drawInvisibleText(Point(0, 0), Angle::deg0(), Length(1000000),
+                           Alignment(), "Text & <more>", false);
+  writer.endGroup();
+  writer.endDocument();
+  EXPECT_FALSE(writer.hasError());
+
+  const QByteArray content = buffer.data();
+  EXPECT_EQ(1, content.count("<circle"));
+  EXPECT_EQ(2, content.count("<use"));
+  EXPECT_TRUE(content.contains("Text &amp; &lt;more&gt;"));
+  QSvgRenderer renderer;
+  ASSERT_TRUE(renderer.load(content));
+  EXPECT_EQ(QRectF(0, 0, 200, 100), renderer.viewBoxF());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,194 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/fileio/zipwriter.h>
+
+#include <quazip/quazip.h>
+#include <quazip/quazipfile.h>
+
+#include <random>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ZipWriterTest : public ::testing::Test {
+protected:
+  typedef QPair<QString, QByteArray> ZipContent;
+
+  FilePath mTmpDir;
+
+  ZipWriterTest() {
+    // temporary dir (with spaces in path to make tests harder)
+    mTmpDir = FilePath::getRandomTempPath().getPathTo("spaces in path");
+    FileUtils::makePath(mTmpDir);
+  }
+
+  virtual ~ZipWriterTest() { QDir(mTmpDir.toStr()).removeRecursively(); }
+
+  static QByteArray createRandomData(int size) {
+    std::mt19937 gen(42);
+    QByteArray data(size, Qt::Uninitialized);
+    for (int i = 0; i < size; ++i) {
+      data[i] = static_cast<char>(gen() & 0xFF);
+    }
+    return data;
+  }
+
+  static QList<ZipContent> readZip(QuaZip& zip) {
+    QList<ZipContent> content;
+    EXPECT_TRUE(zip.open(QuaZip::mdUnzip));
+    QuaZipFile file(&zip);
+    for (bool f = zip.goToFirstFile(); f; f = zip.goToNextFile()) {
+      EXPECT_TRUE(file.open(QIODevice::ReadOnly));
+      content.append(qMakePair(file.getActualFileName(), file.readAll()));
+      file.close();
+      EXPECT_EQ(0, file.getZipError());  // UNZ_OK, i.e. CRC is valid.
+    }
+    zip.close();
+    return content;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ZipWriterTest, testEmptyArchive) {
+  FilePath fp = mTmpDir.getPathTo("empty.zip");
+  {
+    ZipWriter writer(fp);
+    writer.finish();
+  }
+  QuaZip zip(fp.toStr());
+  EXPECT_EQ(QList<ZipContent>{}, readZip(zip));
+}
+
+TEST_F(ZipWriterTest, testAddFiles) {
+  const QByteArray text = QByteArray("Hello World!\n").repeated(1000);
+  const QByteArray random = createRandomData(100000);
+  FilePath sourceFp = mTmpDir.getPathTo("source file.bin");
+  FileUtils::writeFile(sourceFp, random);
+
+  FilePath fp = mTmpDir.getPathTo("sub dir/files.zip");
+  {
+    ZipWriter writer(fp);  // Creates the parent directory.
+    writer.addFile("text.txt", text);
+    writer.addFile("dir/random.bin", sourceFp);
+    writer.addFile("dir/empty", QByteArray());
+    writer.addFile(QString::fromUtf8("\xc3\xa4\xc3\xb6\xc3\xbc.txt"), "UTF-8");
+    writer.finish();
+  }
+
+  QList<ZipContent> expected = {
+      qMakePair(QString("text.txt"), text),
+      qMakePair(QString("dir/random.bin"), random),
+      qMakePair(QString("dir/empty"), QByteArray()),
+      qMakePair(QString::fromUtf8("\xc3\xa4\xc3\xb6\xc3\xbc.txt"),
+                QByteArray("UTF-8")),
+  };
+  QuaZip zip(fp.toStr());
+  EXPECT_EQ(expected, readZip(zip));
+}
+
+TEST_F(ZipWriterTest, testManyFilesKeepOrder) {
+  QList<ZipContent> expected;
+  QBuffer buffer;
+  buffer.open(QIODevice::WriteOnly);
+  {
+    ZipWriter writer(buffer);
+    for (int i = 0; i < 200; ++i) {
+      const QString name = QString("file %1.txt").arg(i);
+      const QByteArray content = QByteArray::number(i).repeated(i * 100);
+      writer.addFile(name, content);
+      expected.append(qMakePair(name, content));
+    }
+    writer.finish();
+  }
+  buffer.close();
+
+  QuaZip zip(&buffer);
+  EXPECT_EQ(expected, readZip(zip));
+}
+
+TEST_F(ZipWriterTest, testLargeFileIsStreamed) {
+  // Larger than the streaming threshold, and not a multiple of the chunk
+  // size.
+  const QByteArray large = createRandomData(1000).repeated(20000);
+  FilePath sourceFp = mTmpDir.getPathTo("large.bin");
+  FileUtils::writeFile(sourceFp, large);
+
+  FilePath fp = mTmpDir.getPathTo("large.zip");
+  {
+    ZipWriter writer(fp);
+    writer.addFile("before.txt", "before");
+    writer.addFile("large.bin", sourceFp);
+    writer.addFile("after.txt", "after");
+    writer.finish();
+  }
+  EXPECT_LT(QFileInfo(fp.toStr()).size(), large.size());
+
+  QList<ZipContent> expected = {
+      qMakePair(QString("before.txt"), QByteArray("before")),
+      qMakePair(QString("large.bin"), large),
+      qMakePair(QString("after.txt"), QByteArray("after")),
+  };
+  QuaZip zip(fp.toStr());
+  EXPECT_EQ(expected, readZip(zip));
+}
+
+TEST_F(ZipWriterTest, testNonExistingSourceFileThrows) {
+  FilePath fp = mTmpDir.getPathTo("failed.zip");
+  {
+    ZipWriter writer(fp);
+    writer.addFile("foo.txt", mTmpDir.getPathTo("nonexisting.txt"));
+    EXPECT_THROW(writer.finish(), Exception);
+  }
+  EXPECT_FALSE(fp.isExistingFile());
+}
+
+TEST_F(ZipWriterTest, testUnfinishedFileIsRemoved) {
+  FilePath fp = mTmpDir.getPathTo("unfinished.zip");
+  {
+    ZipWriter writer(fp);
+    writer.addFile("foo.txt", "foo");
+    EXPECT_TRUE(fp.isExistingFile());
+  }
+  EXPECT_FALSE(fp.isExistingFile());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
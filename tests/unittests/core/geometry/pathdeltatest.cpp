@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/geometry/pathdelta.h>
+#include <librepcb/core/serialization/sexpression.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PathDeltaTest : public ::testing::Test {
+protected:
+  static Path createPath(int count) noexcept {
+    Path path;
+    for (int i = 0; i < count; ++i) {
+      path.addVertex(Point(i * 1000, (i % 3) * 500), Angle(i * 100));
+    }
+    return path;
+  }
+
+  static std::string str(const Path& path) {
+    SExpression sexpr = SExpression::createList("path");
+    path.serialize(sexpr);
+    return sexpr.toByteArray().toStdString();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PathDeltaTest, testDefaultConstructedIsEmpty) {
+  const Path path = createPath(5);
+  const PathDelta delta;
+  EXPECT_TRUE(delta.isEmpty());
+  EXPECT_EQ(str(path), str(delta.apply(path)));
+}
+
+TEST_F(PathDeltaTest, testEqualPaths) {
+  const Path path = createPath(5);
+  const PathDelta delta(path, path);
+  EXPECT_TRUE(delta.isEmpty());
+  EXPECT_EQ(str(path), str(delta.apply(path)));
+}
+
+TEST_F(PathDeltaTest, testTranslation) {
+  const Path from = createPath(100);
+  const Path to = from.translated(Point(123, -456));
+  const PathDelta delta(from, to);
+  EXPECT_FALSE(delta.isEmpty());
+  EXPECT_EQ(str(to), str(delta.apply(from)));
+  EXPECT_EQ(qint64(sizeof(PathDelta)), delta.getRetainedSize());
+}
+
+TEST_F(PathDeltaTest, testModifiedVertex) {
+  const Path from = createPath(100);
+  Path to = from;
+  to.getVertices()[42] = Vertex(Point(1, 2), Angle::deg90());
+  const PathDelta delta(from, to);
+  EXPECT_FALSE(delta.isEmpty());
+  EXPECT_EQ(str(to), str(delta.apply(from)));
+  EXPECT_LT(delta.getRetainedSize(),
+            qint64(sizeof(PathDelta) + 10 * sizeof(Vertex)));
+}
+
+TEST_F(PathDeltaTest, testInsertedVertex) {
+  const Path from = createPath(10);
+  Path to = from;
+  to.insertVertex(5, Point(1, 2));
+  const PathDelta delta(from, to);
+  EXPECT_EQ(str(to), str(delta.apply(from)));
+}
+
+TEST_F(PathDeltaTest, testRemovedVertices) {
+  const Path from = createPath(10);
+  Path to = from;
+  to.getVertices().remove(3, 4);
+  const PathDelta delta(from, to);
+  EXPECT_EQ(str(to), str(delta.apply(from)));
+  EXPECT_EQ(qint64(sizeof(PathDelta)), delta.getRetainedSize());
+}
+
+TEST_F(PathDeltaTest, testRotation) {
+  const Path from = createPath(10);
+  const Path to = from.rotated(Angle::deg90(), Point(100, 200));
+  const PathDelta delta(from, to);
+  EXPECT_EQ(str(to), str(delta.apply(from)));
+}
+
+TEST_F(PathDeltaTest, testFromAndToEmpty) {
+  const Path path = createPath(3);
+  EXPECT_EQ(str(path), str(PathDelta(Path(), path).apply(Path())));
+  EXPECT_EQ(str(Path()), str(PathDelta(path, Path()).apply(path)));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -151,6 +151,28 @@ TEST_F(PathTest, testReversed) {
   EXPECT_EQ(str(expected), str(actual));
 }
 
+TEST_F(PathTest, testToSimplifiedPath) {
+  const Path input = Path({
+      Vertex(Point(0, 0)),
+      Vertex(Point(10, 0)),
+      Vertex(Point(20, 0)),
+      Vertex(Point(100, 0), Angle::deg90()),
+      Vertex(Point(105, 0)),
+      Vertex(Point(105, 100)),
+      Vertex(Point(105, 105)),
+  });
+  const Path expected = Path({
+      Vertex(Point(0, 0)),
+      Vertex(Point(20, 0)),
+      Vertex(Point(100, 0), Angle::deg90()),
+      Vertex(Point(105, 0)),
+      Vertex(Point(105, 100)),
+      Vertex(Point(105, 105)),
+  });
+  EXPECT_EQ(str(expected), str(input.toSimplifiedPath(UnsignedLength(15))));
+  EXPECT_EQ(str(input), str(input.toSimplifiedPath(UnsignedLength(0))));
+}
+
 TEST_F(PathTest, testOperatorCompareLess) {
   EXPECT_FALSE(Path() < Path());
   EXPECT_FALSE(Path({Vertex(Point(1, 2))}) < Path());
@@ -0,0 +1,123 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/graphics/graphicslayer.h>
+#include <librepcb/core/graphics/graphicslayerid.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GraphicsLayerIdTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GraphicsLayerIdTest, testSameNameGivesSameId) {
+  GraphicsLayerId id1(QString(GraphicsLayer::sTopCopper));
+  GraphicsLayerId id2(QString(GraphicsLayer::sTopCopper));
+  EXPECT_TRUE(id1 == id2);
+  EXPECT_EQ(id1.toInt(), id2.toInt());
+  EXPECT_EQ(QString(GraphicsLayer::sTopCopper), id1.getName());
+}
+
+TEST_F(GraphicsLayerIdTest, testDifferentNamesGiveDifferentIds) {
+  GraphicsLayerId id1(QString(GraphicsLayer::sTopCopper));
+  GraphicsLayerId id2(QString(GraphicsLayer::sBotCopper));
+  EXPECT_TRUE(id1 != id2);
+  EXPECT_LT(id1.toInt(), GraphicsLayerId::getCount());
+  EXPECT_LT(id2.toInt(), GraphicsLayerId::getCount());
+}
+
+TEST_F(GraphicsLayerIdTest, testMirrored) {
+  GraphicsLayerId top(QString(GraphicsLayer::sTopPlacement));
+  GraphicsLayerId bot(QString(GraphicsLayer::sBotPlacement));
+  GraphicsLayerId outlines(QString(GraphicsLayer::sBoardOutlines));
+  EXPECT_EQ(bot, top.getMirrored());
+  EXPECT_EQ(top, bot.getMirrored());
+  EXPECT_EQ(outlines, outlines.getMirrored());
+}
+
+TEST_F(GraphicsLayerIdTest, testIsCopperLayer) {
+  EXPECT_TRUE(GraphicsLayerId(QString(GraphicsLayer::sTopCopper))
+                  .isCopperLayer());
+  EXPECT_TRUE(GraphicsLayerId(GraphicsLayer::getInnerLayerName(3))
+                  .isCopperLayer());
+  EXPECT_FALSE(GraphicsLayerId(QString(GraphicsLayer::sTopStopMask))
+                   .isCopperLayer());
+}
+
+TEST_F(GraphicsLayerIdTest, testTryGet) {
+  GraphicsLayerId id(QString(GraphicsLayer::sBoardOutlines));
+  EXPECT_EQ(id, GraphicsLayerId::tryGet(GraphicsLayer::sBoardOutlines));
+  EXPECT_EQ(tl::nullopt, GraphicsLayerId::tryGet("not_interned_layer_xyz"));
+}
+
+TEST_F(GraphicsLayerIdTest, testUnknownNamesAreNotAdded) {
+  const int count = GraphicsLayerId::getCount();
+  GraphicsLayerId foo(QString("unknown_layer_foo"));
+  GraphicsLayerId bar(QString("unknown_layer_bar"));
+  EXPECT_EQ(count, GraphicsLayerId::getCount());
+  EXPECT_EQ(foo, bar);
+  EXPECT_EQ(QString(), foo.getName());
+  EXPECT_EQ(foo, foo.getMirrored());
+  EXPECT_FALSE(foo.isCopperLayer());
+  EXPECT_NE(foo, GraphicsLayerId(QString(GraphicsLayer::sTopCopper)));
+  EXPECT_EQ(tl::nullopt, GraphicsLayerId::tryGet("unknown_layer_foo"));
+}
+
+TEST_F(GraphicsLayerIdTest, testAllInnerCopperLayersAreKnown) {
+  for (int i = 1; i <= GraphicsLayer::getInnerLayerCount(); ++i) {
+    const QString name = GraphicsLayer::getInnerLayerName(i);
+    EXPECT_NE(tl::nullopt, GraphicsLayerId::tryGet(name)) << qPrintable(name);
+  }
+}
+
+TEST_F(GraphicsLayerIdTest, testSerialize) {
+  GraphicsLayerId id(QString(GraphicsLayer::sTopSolderPaste));
+  EXPECT_EQ(QString(GraphicsLayer::sTopSolderPaste), serialize(id).getValue());
+}
+
+TEST_F(GraphicsLayerIdTest, testDeserialize) {
+  SExpression sexpr = SExpression::createToken(GraphicsLayer::sBotNames);
+  GraphicsLayerId id = deserialize<GraphicsLayerId>(sexpr);
+  EXPECT_EQ(QString(GraphicsLayer::sBotNames), id.getName());
+  EXPECT_THROW(deserialize<GraphicsLayerId>(SExpression::createToken("Foo")),
+               RuntimeError);
+  EXPECT_THROW(
+      deserialize<GraphicsLayerId>(SExpression::createToken("unknown_layer")),
+      RuntimeError);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
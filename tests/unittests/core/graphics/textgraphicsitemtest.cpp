@@ -0,0 +1,111 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/attribute/attributeprovider.h>
+#include <librepcb/core/geometry/text.h>
+#include <librepcb/core/graphics/defaultgraphicslayerprovider.h>
+#include <librepcb/core/graphics/graphicslayer.h>
+#include <librepcb/core/graphics/textgraphicsitem.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class TextGraphicsItemTest : public ::testing::Test {
+protected:
+  /**
+   * @brief Attribute provider which counts how often attributes are looked up
+   */
+  class CountingAttributeProvider final : public AttributeProvider {
+  public:
+    QString getBuiltInAttributeValue(const QString& key) const
+        noexcept override {
+      ++mLookups;
+      return (key == "NAME") ? QString("R1") : QString();
+    }
+    int getLookups() const noexcept { return mLookups; }
+
+  signals:
+    void attributesChanged(const QSet<QString>& keys) override {
+      Q_UNUSED(keys);
+    }
+
+  private:
+    mutable int mLookups = 0;
+  };
+
+  static Text createText(const QString& text) {
+    return Text(Uuid::createRandom(),
+                GraphicsLayerName(GraphicsLayer::sSymbolNames), text,
+                Point(0, 0), Angle::deg0(), PositiveLength(1000000),
+                Alignment());
+  }
+
+  DefaultGraphicsLayerProvider mLayers;
+  CountingAttributeProvider mProvider;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(TextGraphicsItemTest, testUpdateOnlyIfUsedKeyChanged) {
+  Text text = createText("{{NAME}}");
+  TextGraphicsItem item(text, mLayers);
+  item.setAttributeProvider(&mProvider);
+  const int lookups = mProvider.getLookups();
+  EXPECT_GT(lookups, 0);
+
+  item.updateText({"VALUE"});  // Not used by the text.
+  EXPECT_EQ(lookups, mProvider.getLookups());
+
+  item.updateText({"NAME"});  // Used by the text.
+  EXPECT_EQ(lookups * 2, mProvider.getLookups());
+
+  item.updateText(QSet<QString>());  // Any attribute might have changed.
+  EXPECT_EQ(lookups * 3, mProvider.getLookups());
+}
+
+TEST_F(TextGraphicsItemTest, testNoUpdateIfNoAttributesUsed) {
+  Text text = createText("Static Text");
+  TextGraphicsItem item(text, mLayers);
+  item.setAttributeProvider(&mProvider);
+  item.updateText(QSet<QString>());
+  item.updateText({"NAME"});
+  EXPECT_EQ(0, mProvider.getLookups());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -524,6 +524,130 @@ TEST_F(DxfReaderTest, testLwPolylineClosed) {
   EXPECT_EQ(str(expected), str(reader.getPolygons().first()));
 }
 
+TEST_F(DxfReaderTest, testLayerFilter) {
+  reader.setLayerFilter({"Outline"});
+  parse(
+      "0\nSECTION\n"
+      "2\nENTITIES\n"
+      "0\nLINE\n"
+      "8\nOutline\n"  // LAYER
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "11\n1.0\n"  // X2
+      "21\n0.0\n"  // Y2
+      "0\nLINE\n"
+      "8\nDimensions\n"  // LAYER
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "11\n0.0\n"  // X2
+      "21\n1.0\n"  // Y2
+      "0\nCIRCLE\n"
+      "8\nDimensions\n"  // LAYER
+      "10\n4.0\n"  // CX
+      "20\n5.0\n"  // CY
+      "40\n8.0\n"  // RADIUS
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  // Assert(!) for number of elements to avoid illegal list item access below.
+  ASSERT_EQ(0, reader.getPoints().count());
+  ASSERT_EQ(1, reader.getPolygons().count());
+  ASSERT_EQ(0, reader.getCircles().count());
+
+  Path expected({
+      Vertex(Point(Length(0), Length(0)), Angle(0)),
+      Vertex(Point(Length(1000000), Length(0)), Angle(0)),
+  });
+  EXPECT_EQ(str(expected), str(reader.getPolygons().first()));
+  EXPECT_EQ(QSet<QString>({"Outline", "Dimensions"}), reader.getLayerNames());
+}
+
+TEST_F(DxfReaderTest, testEntityFilter) {
+  reader.setEntityFilter(DxfReader::Circles | DxfReader::Polylines);
+  parse(
+      "0\nSECTION\n"
+      "2\nENTITIES\n"
+      "0\nPOINT\n"
+      "10\n4.0\n"  // X
+      "20\n5.0\n"  // Y
+      "0\nLINE\n"
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "11\n1.0\n"  // X2
+      "21\n0.0\n"  // Y2
+      "0\nCIRCLE\n"
+      "10\n4.0\n"  // CX
+      "20\n5.0\n"  // CY
+      "40\n8.0\n"  // RADIUS
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  EXPECT_EQ(0, reader.getPoints().count());
+  EXPECT_EQ(0, reader.getPolygons().count());
+  EXPECT_EQ(1, reader.getCircles().count());
+}
+
+TEST_F(DxfReaderTest, testLwPolylineSimplified) {
+  reader.setSimplifyTolerance(UnsignedLength(100000));  // 0.1mm
+  parse(
+      "0\nSECTION\n"
+      "2\nENTITIES\n"
+      "0\nLWPOLYLINE\n"
+      "90\n4\n"  // NUMBER OF VERTICES
+      "70\n0\n"  // FLAGS (0=open, 1=closed)
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "10\n1.0\n"  // X2
+      "20\n0.01\n"  // Y2
+      "10\n2.0\n"  // X3
+      "20\n0.0\n"  // Y3
+      "10\n2.0\n"  // X4
+      "20\n2.0\n"  // Y4
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  // Assert(!) for number of elements to avoid illegal list item access below.
+  ASSERT_EQ(1, reader.getPolygons().count());
+
+  Path expected({
+      Vertex(Point(Length(0), Length(0)), Angle(0)),
+      Vertex(Point(Length(2000000), Length(0)), Angle(0)),
+      Vertex(Point(Length(2000000), Length(2000000)), Angle(0)),
+  });
+  EXPECT_EQ(str(expected), str(reader.getPolygons().first()));
+}
+
+TEST_F(DxfReaderTest, testHandlers) {
+  QList<Point> points;
+  QList<Path> polygons;
+  reader.setHandlers([&points](const Point& p) { points.append(p); }, nullptr,
+                     [&polygons](const Path& p) { polygons.append(p); });
+  parse(
+      "0\nSECTION\n"
+      "2\nENTITIES\n"
+      "0\nPOINT\n"
+      "10\n4.0\n"  // X
+      "20\n5.0\n"  // Y
+      "0\nLINE\n"
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "11\n1.0\n"  // X2
+      "21\n0.0\n"  // Y2
+      "0\nCIRCLE\n"
+      "10\n4.0\n"  // CX
+      "20\n5.0\n"  // CY
+      "40\n8.0\n"  // RADIUS
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  // Objects passed to handlers are not stored in the reader.
+  EXPECT_EQ(0, reader.getPoints().count());
+  EXPECT_EQ(0, reader.getPolygons().count());
+  EXPECT_EQ(1, reader.getCircles().count());
+  EXPECT_EQ(1, points.count());
+  EXPECT_EQ(1, polygons.count());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
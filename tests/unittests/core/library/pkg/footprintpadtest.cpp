@@ -110,6 +110,53 @@ TEST_F(FootprintPadTest, testSerializeAndDeserialize) {
   EXPECT_EQ(sexpr1.toByteArray(), sexpr2.toByteArray());
 }
 
+TEST_F(FootprintPadTest, testGeometryIsSharedBetweenCopies) {
+  FootprintPad obj1(Uuid::createRandom(), tl::nullopt, Point(0, 0),
+                    Angle::deg0(), FootprintPad::Shape::RECT,
+                    PositiveLength(1000000), PositiveLength(2000000),
+                    FootprintPad::ComponentSide::Top, HoleList{});
+  const Path outline1 = obj1.getOutline(Length(100000));
+  FootprintPad obj2(obj1);
+  EXPECT_EQ(outline1, obj2.getOutline(Length(100000)));
+  EXPECT_EQ(obj1.toQPainterPathPx(), obj2.toQPainterPathPx());
+}
+
+TEST_F(FootprintPadTest, testGeometryCacheInvalidatedOnModification) {
+  FootprintPad obj(Uuid::createRandom(), tl::nullopt, Point(0, 0),
+                   Angle::deg0(), FootprintPad::Shape::RECT,
+                   PositiveLength(1000000), PositiveLength(2000000),
+                   FootprintPad::ComponentSide::Top, HoleList{});
+  const Path outline1 = obj.getOutline();
+  const QPainterPath painterPath1 = obj.toQPainterPathPx();
+  obj.setWidth(PositiveLength(3000000));
+  EXPECT_NE(outline1, obj.getOutline());
+  EXPECT_EQ(Path::centeredRect(PositiveLength(3000000),
+                               PositiveLength(2000000)),
+            obj.getOutline());
+  EXPECT_NE(painterPath1, obj.toQPainterPathPx());
+  obj.getHoles().append(std::make_shared<Hole>(
+      Uuid::createRandom(), PositiveLength(100000), makeNonEmptyPath(Point())));
+  const QPainterPath painterPath2 = obj.toQPainterPathPx();
+  EXPECT_NE(obj.toOutlineQPainterPathPx(), painterPath2);
+}
+
+TEST_F(FootprintPadTest, testGeometryCacheWithManyExpansions) {
+  FootprintPad obj(Uuid::createRandom(), tl::nullopt, Point(0, 0),
+                   Angle::deg0(), FootprintPad::Shape::RECT,
+                   PositiveLength(1000000), PositiveLength(2000000),
+                   FootprintPad::ComponentSide::Top, HoleList{});
+  const Path outline0 = obj.getOutline(Length(0));
+  for (int i = 1; i <= 10; ++i) {
+    obj.getOutline(Length(i * 10000));
+  }
+  // The first outline was removed from the cache meanwhile, so this
+  // generates it again.
+  EXPECT_EQ(outline0, obj.getOutline(Length(0)));
+  EXPECT_EQ(Path::centeredRect(PositiveLength(1000000),
+                               PositiveLength(2000000)),
+            obj.getOutline(Length(0)));
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
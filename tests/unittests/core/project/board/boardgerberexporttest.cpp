@@ -26,6 +26,7 @@
 #include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/boardfabricationoutputsettings.h>
 #include <librepcb/core/project/board/boardgerberexport.h>
+#include <librepcb/core/project/board/items/bi_netsegment.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectloader.h>
 
@@ -120,6 +121,50 @@ TEST(BoardGerberExportTest, test) {
   }
 }
 
+TEST(BoardGerberExportTest, testBackgroundExportUsesSnapshot) {
+  // open project from test data directory
+  FilePath projectFp(TEST_DATA_DIR "/projects/Gerber Test/project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  ProjectLoader loader;
+  std::unique_ptr<Project> project =
+      loader.open(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename());
+  Board* board = project->getBoards().first();
+  board->rebuildAllPlanes();
+
+  // export synchronously
+  const FilePath outDir = FilePath::getRandomTempPath();
+  BoardFabricationOutputSettings config = board->getFabricationOutputSettings();
+  config.setOutputBasePath(outDir.getPathTo("sync").toStr() % "/{{PROJECT}}");
+  BoardGerberExport grbExport(*board);
+  grbExport.exportPcbLayers(config);
+  const QVector<FilePath> syncFiles = grbExport.getWrittenFiles();
+
+  // export in background while removing all traces from the board
+  config.setOutputBasePath(outDir.getPathTo("async").toStr() % "/{{PROJECT}}");
+  grbExport.startPcbLayersExport(config);
+  QList<BI_NetSegment*> removedSegments = board->getNetSegments().values();
+  foreach (BI_NetSegment* segment, removedSegments) {
+    board->removeNetSegment(*segment);
+  }
+  EXPECT_EQ(QString(), grbExport.waitForFinished());
+  const QVector<FilePath> asyncFiles = grbExport.getWrittenFiles();
+
+  // the board modification must not affect the generated files
+  ASSERT_EQ(syncFiles.count(), asyncFiles.count());
+  for (int i = 0; i < syncFiles.count(); ++i) {
+    EXPECT_EQ(syncFiles.at(i).getFilename().toStdString(),
+              asyncFiles.at(i).getFilename().toStdString());
+    EXPECT_EQ(FileUtils::readFile(syncFiles.at(i)).toStdString(),
+              FileUtils::readFile(asyncFiles.at(i)).toStdString());
+  }
+
+  qDeleteAll(removedSegments);
+  FileUtils::removeDirRecursively(outDir);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
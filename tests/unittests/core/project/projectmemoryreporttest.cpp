@@ -0,0 +1,153 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/graphics/graphicsscene.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/graphicsitems/bgi_plane.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectlibrary.h>
+#include <librepcb/core/project/projectloader.h>
+#include <librepcb/core/project/projectmemoryreport.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ProjectMemoryReportTest : public ::testing::Test {
+protected:
+  std::unique_ptr<Project> openProject() {
+    FilePath projectFp(TEST_DATA_DIR "/projects/Gerber Test/project.lpp");
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    ProjectLoader loader;
+    return loader.open(std::unique_ptr<TransactionalDirectory>(
+                           new TransactionalDirectory(projectFs)),
+                       projectFp.getFilename());
+  }
+
+  static qint64 getCachedPlaneAreasSize(Board& board) noexcept {
+    qint64 size = 0;
+    foreach (BI_Plane* plane, board.getPlanes()) {
+      size += plane->getGraphicsItem().getCachedAreasMemoryUsage();
+    }
+    return size;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ProjectMemoryReportTest, testEntries) {
+  std::unique_ptr<Project> project = openProject();
+  ProjectMemoryReport report(*project);
+
+  const ProjectMemoryReport::Entry* library =
+      report.getEntry("library_elements");
+  ASSERT_TRUE(library);
+  const ProjectLibrary& lib = project->getLibrary();
+  EXPECT_EQ(lib.getSymbols().count() + lib.getPackages().count() +
+                lib.getComponents().count() + lib.getDevices().count(),
+            library->count);
+  EXPECT_GT(library->bytes, 0);
+
+  int fragments = 0;
+  foreach (const Board* board, project->getBoards()) {
+    foreach (const BI_Plane* plane, board->getPlanes()) {
+      fragments += plane->getFragments().count();
+    }
+  }
+  const ProjectMemoryReport::Entry* planes = report.getEntry("plane_fragments");
+  ASSERT_TRUE(planes);
+  EXPECT_EQ(fragments, planes->count);
+
+  const QStringList boardIds = {"board_items", "board_graphics"};
+  foreach (const QString& id, boardIds) {
+    const ProjectMemoryReport::Entry* entry = report.getEntry(id);
+    ASSERT_TRUE(entry) << qPrintable(id);
+    EXPECT_GT(entry->count, 0) << qPrintable(id);
+    EXPECT_GT(entry->bytes, 0) << qPrintable(id);
+  }
+  EXPECT_TRUE(report.getEntry("schematic_items"));
+  EXPECT_TRUE(report.getEntry("schematic_graphics"));
+
+  qint64 total = 0;
+  foreach (const ProjectMemoryReport::Entry& entry, report.getEntries()) {
+    total += entry.bytes;
+  }
+  EXPECT_EQ(total, report.getTotalBytes());
+}
+
+TEST_F(ProjectMemoryReportTest, testAddEntryWithUnknownSize) {
+  std::unique_ptr<Project> project = openProject();
+  ProjectMemoryReport report(*project);
+  const qint64 total = report.getTotalBytes();
+  report.addEntry("undo_stack", "Undo stack", 42, -1);
+  EXPECT_EQ(total, report.getTotalBytes());
+  ASSERT_TRUE(report.getEntry("undo_stack"));
+  EXPECT_EQ(42, report.getEntry("undo_stack")->count);
+  EXPECT_EQ(report.getEntries().count() + 1,
+            report.toString().split("\n").count());
+}
+
+TEST_F(ProjectMemoryReportTest, testBoardCompact) {
+  std::unique_ptr<Project> project = openProject();
+  Board* board = project->getBoards().first();
+  board->forceAirWiresRebuild();
+  const int airWires = board->getAirWires().count();
+
+  board->compact();
+  EXPECT_EQ(0, board->getAirWires().count());
+  EXPECT_EQ(0, getCachedPlaneAreasSize(*board));
+  EXPECT_EQ(QGraphicsScene::NoIndex,
+            board->getGraphicsScene().itemIndexMethod());
+
+  // Airwires are rebuilt as soon as the board gets displayed again.
+  board->triggerAirWiresRebuild();
+  EXPECT_EQ(airWires, board->getAirWires().count());
+}
+
+TEST_F(ProjectMemoryReportTest, testFormatBytes) {
+  EXPECT_EQ("512 B", ProjectMemoryReport::formatBytes(512).toStdString());
+  EXPECT_EQ("1.5 KiB", ProjectMemoryReport::formatBytes(1536).toStdString());
+  EXPECT_EQ("2.0 MiB",
+            ProjectMemoryReport::formatBytes(2 * 1024 * 1024).toStdString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -22,9 +22,15 @@
  ******************************************************************************/
 #include <gtest/gtest.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/circuit/netclass.h>
+#include <librepcb/core/project/erc/ercmsglist.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectloader.h>
+#include <librepcb/core/project/schematic/schematic.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -193,6 +199,137 @@ TEST_F(ProjectTest, testSettersGetters) {
   EXPECT_EQ(version, project->getVersion());
 }
 
+TEST_F(ProjectTest, testErcMessagesAreUpdatedInBatch) {
+  std::unique_ptr<Project> project =
+      Project::create(createDir(), mProjectFile.getFilename());
+  ErcMsgList& ercMsgList = project->getErcMsgList();
+  ercMsgList.processScheduledUpdates();
+  const int msgCount = ercMsgList.getItems().count();
+  const int requestedUpdates = ercMsgList.getRequestedUpdatesCount();
+  const int performedUpdates = ercMsgList.getPerformedUpdatesCount();
+
+  // Multiple modifications must not update the ERC messages immediately.
+  NetClass* netclass = new NetClass(project->getCircuit(), Uuid::createRandom(),
+                                    ElementName("foo"));
+  project->getCircuit().addNetClass(*netclass);
+  netclass->setName(ElementName("bar"));
+  netclass->setName(ElementName("baz"));
+  EXPECT_EQ(msgCount, ercMsgList.getItems().count());
+  EXPECT_EQ(requestedUpdates + 3, ercMsgList.getRequestedUpdatesCount());
+  EXPECT_EQ(performedUpdates, ercMsgList.getPerformedUpdatesCount());
+
+  // All modifications are processed with a single update.
+  ercMsgList.processScheduledUpdates();
+  EXPECT_EQ(msgCount + 1, ercMsgList.getItems().count());  // Unused net class
+  EXPECT_EQ(performedUpdates + 1, ercMsgList.getPerformedUpdatesCount());
+
+  // Destroying an object discards its scheduled update.
+  project->getCircuit().removeNetClass(*netclass);
+  delete netclass;
+  ercMsgList.processScheduledUpdates();
+  EXPECT_EQ(msgCount, ercMsgList.getItems().count());
+  EXPECT_EQ(performedUpdates + 1, ercMsgList.getPerformedUpdatesCount());
+}
+
+TEST_F(ProjectTest, testLoadMultipleSchematicsAndBoardsInOrder) {
+  // Schematics and boards are parsed concurrently, but the order must be
+  // kept since it is visible to the user (e.g. page numbers, tabs).
+  std::unique_ptr<Project> project =
+      Project::create(createDir(), mProjectFile.getFilename());
+  QStringList names;
+  for (int i = 0; i < 8; ++i) {
+    const QString name = QString("Item %1").arg(i);
+    names.append(name);
+    Schematic* schematic = new Schematic(
+        *project,
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+        QString("schematic_%1").arg(i), Uuid::createRandom(),
+        ElementName(name));
+    project->addSchematic(*schematic);
+    Board* board = new Board(
+        *project,
+        std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+        QString("board_%1").arg(i), Uuid::createRandom(), ElementName(name));
+    board->addDefaultContent();
+    project->addBoard(*board);
+  }
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+  project.reset();
+
+  ProjectLoader loader;
+  project = loader.open(createDir(false), mProjectFile.getFilename());
+  QStringList schematicNames, boardNames;
+  foreach (const Schematic* schematic, project->getSchematics()) {
+    schematicNames.append(*schematic->getName());
+  }
+  foreach (const Board* board, project->getBoards()) {
+    boardNames.append(*board->getName());
+  }
+  EXPECT_EQ(names.join(",").toStdString(),
+            schematicNames.join(",").toStdString());
+  EXPECT_EQ(names.join(",").toStdString(), boardNames.join(",").toStdString());
+}
+
+TEST_F(ProjectTest, testReadInWorkerThreadAndBuildInGuiThread) {
+  std::unique_ptr<Project> project =
+      Project::create(createDir(), mProjectFile.getFilename());
+  project->setName(ElementName("Threaded"));
+  Board* board = new Board(
+      *project,
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+      "board", Uuid::createRandom(), ElementName("Board"));
+  board->addDefaultContent();
+  project->addBoard(*board);
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+  project.reset();
+
+  // Connect the signal by hand because QSignalSpy is not threadsafe!
+  ProjectLoader loader;
+  QList<int> percents;
+  QMutex mutex;
+  QObject::connect(&loader, &ProjectLoader::progress,
+                   [&](int percent, const QString& status) {
+                     Q_UNUSED(status);
+                     QMutexLocker lock(&mutex);
+                     percents.append(percent);
+                   });
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(mProjectDir);
+  const QString filename = mProjectFile.getFilename();
+  QtConcurrent::run([&loader, fs, filename]() {
+    loader.read(std::unique_ptr<TransactionalDirectory>(
+                    new TransactionalDirectory(fs)),
+                filename);
+  }).waitForFinished();
+  project = loader.build();
+  EXPECT_EQ("Threaded", project->getName());
+  ASSERT_EQ(1, project->getBoards().count());
+  EXPECT_EQ(QThread::currentThread(), project->getBoards().first()->thread());
+
+  // Progress must be reported monotonically increasing.
+  QMutexLocker lock(&mutex);
+  ASSERT_FALSE(percents.isEmpty());
+  for (int i = 1; i < percents.count(); ++i) {
+    EXPECT_GE(percents.at(i), percents.at(i - 1));
+  }
+}
+
+TEST_F(ProjectTest, testCancelRead) {
+  std::unique_ptr<Project> project =
+      Project::create(createDir(), mProjectFile.getFilename());
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+  project.reset();
+
+  ProjectLoader loader;
+  loader.cancel();
+  EXPECT_THROW(loader.read(createDir(false), mProjectFile.getFilename()),
+               UserCanceled);
+  EXPECT_THROW(loader.build(), LogicError);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -161,6 +161,67 @@ TEST_F(SerializableObjectListTest, testIndexOfName) {
   EXPECT_EQ(2, l.indexOf(mMocks[2]->mName));
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfLargeList) {
+  // Large enough to use the hash indices.
+  List l;
+  QVector<std::shared_ptr<Mock>> mocks;
+  for (int i = 0; i < 100; ++i) {
+    mocks.append(std::make_shared<Mock>(Uuid::createRandom(),
+                                        QString("Pad %1").arg(i)));
+    l.append(mocks.last());
+    EXPECT_EQ(i, l.indexOf(mocks.last().get()));
+    EXPECT_EQ(i, l.indexOf(mocks.last()->mUuid));
+    EXPECT_EQ(i, l.indexOf(mocks.last()->mName));
+  }
+  EXPECT_EQ(-1, l.indexOf(Uuid::createRandom()));
+  EXPECT_EQ(-1, l.indexOf(QString("foo")));
+
+  // Duplicate names return the first element.
+  l.append(std::make_shared<Mock>(Uuid::createRandom(), "Pad 10"));
+  EXPECT_EQ(10, l.indexOf(QString("Pad 10")));
+  l.remove(l.count() - 1);
+  EXPECT_EQ(10, l.indexOf(QString("Pad 10")));
+
+  // Insert & remove in the middle.
+  auto inserted = std::make_shared<Mock>(Uuid::createRandom(), "Inserted");
+  l.insert(50, inserted);
+  EXPECT_EQ(50, l.indexOf(inserted.get()));
+  EXPECT_EQ(50, l.indexOf(inserted->mUuid));
+  EXPECT_EQ(51, l.indexOf(mocks[50]->mUuid));
+  EXPECT_EQ(100, l.indexOf(mocks[99]->mName));
+  l.remove(inserted.get());
+  EXPECT_EQ(-1, l.indexOf(inserted.get()));
+  EXPECT_EQ(-1, l.indexOf(inserted->mUuid));
+  EXPECT_EQ(50, l.indexOf(mocks[50]->mUuid));
+
+  // Swap.
+  l.swap(1, 98);
+  EXPECT_EQ(98, l.indexOf(mocks[1].get()));
+  EXPECT_EQ(1, l.indexOf(mocks[98]->mUuid));
+  EXPECT_EQ(98, l.indexOf(mocks[1]->mName));
+
+  // Rename.
+  mocks[20]->mName = "Renamed";
+  mocks[20]->onEdited.notify();
+  EXPECT_EQ(20, l.indexOf(QString("Renamed")));
+  EXPECT_EQ(-1, l.indexOf(QString("Pad 20")));
+  EXPECT_EQ(20, l.indexOf(mocks[20]->mUuid));
+
+  // Rename to an existing name, and back again.
+  mocks[30]->mName = "Pad 40";
+  mocks[30]->onEdited.notify();
+  EXPECT_EQ(30, l.indexOf(QString("Pad 40")));
+  mocks[30]->mName = "Pad 30";
+  mocks[30]->onEdited.notify();
+  EXPECT_EQ(30, l.indexOf(QString("Pad 30")));
+  EXPECT_EQ(40, l.indexOf(QString("Pad 40")));
+
+  // Edits without changing the UUID or name.
+  mocks[60]->onEdited.notify();
+  EXPECT_EQ(60, l.indexOf(QString("Pad 60")));
+  EXPECT_EQ(60, l.indexOf(mocks[60]->mUuid));
+}
+
 TEST_F(SerializableObjectListTest, testContainsPointer) {
   List l{mMocks[0], mMocks[1], mMocks[2]};
   EXPECT_TRUE(l.contains(mMocks[0].get()));
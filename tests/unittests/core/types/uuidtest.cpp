@@ -145,6 +145,30 @@ TEST_P(UuidTest, testOperatorComparisons) {
   }
 }
 
+TEST_P(UuidTest, testGetBytes) {
+  const UuidTestData& data = GetParam();
+
+  if (data.valid) {
+    Uuid uuid = Uuid::fromString(data.uuid);
+    QByteArray expected = QUuid(data.uuid).toRfc4122();
+    QByteArray actual(reinterpret_cast<const char*>(uuid.getBytes().data()),
+                      uuid.getBytes().size());
+    EXPECT_EQ(expected.toHex().toStdString(), actual.toHex().toStdString());
+  }
+}
+
+TEST_P(UuidTest, testQHash) {
+  const UuidTestData& data = GetParam();
+
+  if (data.valid) {
+    Uuid uuid1 = Uuid::fromString(data.uuid);
+    Uuid uuid2 = Uuid::fromString(data.uuid);
+    EXPECT_EQ(qHash(uuid1, 42), qHash(uuid2, 42));
+    EXPECT_EQ(qHash(tl::make_optional(uuid1), 42),
+              qHash(tl::make_optional(uuid2), 42));
+  }
+}
+
 TEST(UuidTest, testCreateRandom) {
   for (int i = 0; i < 1000; i++) {
     Uuid uuid = Uuid::createRandom();
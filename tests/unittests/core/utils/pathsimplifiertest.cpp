@@ -0,0 +1,189 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/geometry/path.h>
+#include <librepcb/core/serialization/sexpression.h>
+#include <librepcb/core/utils/pathsimplifier.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PathSimplifierTest : public ::testing::Test {
+protected:
+  static std::string str(const Path& path) {
+    SExpression root = SExpression::createList("path");
+    path.serialize(root);
+    return root.toByteArray().toStdString();
+  }
+
+  static Point arcPoint(const Point& center, const Length& radius,
+                        qreal angleDeg) {
+    const qreal angle = angleDeg * M_PI / 180;
+    return center +
+        Point(Length(qRound64(radius.toNm() * std::cos(angle))),
+              Length(qRound64(radius.toNm() * std::sin(angle))));
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PathSimplifierTest, testZeroToleranceReturnsInput) {
+  Path input({
+      Vertex(Point(0, 0)),
+      Vertex(Point(1000, 0)),
+      Vertex(Point(2000, 0)),
+  });
+  EXPECT_EQ(str(input),
+            str(PathSimplifier::simplify(input, UnsignedLength(0))));
+}
+
+TEST_F(PathSimplifierTest, testCollinearVerticesRemoved) {
+  Path input({
+      Vertex(Point(0, 0)),
+      Vertex(Point(1000, 10)),
+      Vertex(Point(2000, -10)),
+      Vertex(Point(3000, 0)),
+      Vertex(Point(3000, 5000)),
+  });
+  Path expected({
+      Vertex(Point(0, 0)),
+      Vertex(Point(3000, 0)),
+      Vertex(Point(3000, 5000)),
+  });
+  EXPECT_EQ(str(expected),
+            str(PathSimplifier::simplify(input, UnsignedLength(100))));
+}
+
+TEST_F(PathSimplifierTest, testVerticesOutOfToleranceKept) {
+  Path input({
+      Vertex(Point(0, 0)),
+      Vertex(Point(1000, 1000)),
+      Vertex(Point(2000, 0)),
+      Vertex(Point(3000, 1000)),
+  });
+  EXPECT_EQ(str(input),
+            str(PathSimplifier::simplify(input, UnsignedLength(100))));
+}
+
+TEST_F(PathSimplifierTest, testArcSegmentsKept) {
+  Path input({
+      Vertex(Point(0, 0), Angle::deg90()),
+      Vertex(Point(1000, 0)),
+      Vertex(Point(2000, 0)),
+      Vertex(Point(3000, 0), -Angle::deg45()),
+      Vertex(Point(4000, 0)),
+  });
+  Path expected({
+      Vertex(Point(0, 0), Angle::deg90()),
+      Vertex(Point(1000, 0)),
+      Vertex(Point(3000, 0), -Angle::deg45()),
+      Vertex(Point(4000, 0)),
+  });
+  EXPECT_EQ(str(expected),
+            str(PathSimplifier::simplify(input, UnsignedLength(100))));
+}
+
+TEST_F(PathSimplifierTest, testArcFitted) {
+  const Point center(Length(5000000), Length(5000000));
+  const Length radius(1000000);
+  Path input;
+  for (int i = 0; i <= 90; ++i) {
+    input.addVertex(arcPoint(center, radius, i));
+  }
+  const Path output = PathSimplifier::simplify(input, UnsignedLength(1000));
+  ASSERT_EQ(2, output.getVertices().count());
+  EXPECT_EQ(input.getVertices().first().getPos(),
+            output.getVertices().first().getPos());
+  EXPECT_EQ(input.getVertices().last().getPos(),
+            output.getVertices().last().getPos());
+  EXPECT_NEAR(90, output.getVertices().first().getAngle().toDeg(), 0.01);
+}
+
+TEST_F(PathSimplifierTest, testClockwiseArcFitted) {
+  const Point center(Length(0), Length(0));
+  const Length radius(2000000);
+  Path input;
+  for (int i = 0; i <= 60; ++i) {
+    input.addVertex(arcPoint(center, radius, 150 - i * 2));
+  }
+  const Path output = PathSimplifier::simplify(input, UnsignedLength(1000));
+  ASSERT_EQ(2, output.getVertices().count());
+  EXPECT_NEAR(-120, output.getVertices().first().getAngle().toDeg(), 0.01);
+}
+
+TEST_F(PathSimplifierTest, testClosedRoundedRectangle) {
+  const Length radius(1000000);
+  const QVector<Point> centers = {
+      Point(Length(10000000), Length(10000000)),
+      Point(Length(0), Length(10000000)),
+      Point(Length(0), Length(0)),
+      Point(Length(10000000), Length(0)),
+  };
+  Path input;
+  for (int corner = 0; corner < centers.count(); ++corner) {
+    for (int i = 0; i <= 30; ++i) {
+      input.addVertex(
+          arcPoint(centers.at(corner), radius, corner * 90 + i * 3));
+    }
+  }
+  input.close();
+  const Path output = PathSimplifier::simplify(input, UnsignedLength(5000));
+  EXPECT_TRUE(output.isClosed());
+  ASSERT_EQ(9, output.getVertices().count());
+  for (int i = 0; i < 8; ++i) {
+    const qreal expected = (i % 2 == 0) ? 90 : 0;
+    EXPECT_NEAR(expected, output.getVertices().at(i).getAngle().toDeg(), 0.01)
+        << i;
+  }
+}
+
+TEST_F(PathSimplifierTest, testManyTinySegments) {
+  // Noisy straight line as often found in exported mechanical outlines.
+  Path input;
+  for (int i = 0; i < 100000; ++i) {
+    input.addVertex(Point(Length(i * 1000), Length((i * 37) % 100)));
+  }
+  const Path output = PathSimplifier::simplify(input, UnsignedLength(1000));
+  ASSERT_EQ(2, output.getVertices().count());
+  EXPECT_EQ(input.getVertices().first().getPos(),
+            output.getVertices().first().getPos());
+  EXPECT_EQ(input.getVertices().last().getPos(),
+            output.getVertices().last().getPos());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
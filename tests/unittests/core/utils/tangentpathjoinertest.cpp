@@ -351,6 +351,24 @@ TEST_F(TangentPathJoinerTest, testManyTangentPaths) {
   EXPECT_EQ(str(expected), str(output)) << debug(expected, output);
 }
 
+// For testing performance and determinism with highly ambiguous input.
+TEST_F(TangentPathJoinerTest, testGrid) {
+  QVector<Path> input;
+  for (int i = 0; i <= 100; ++i) {
+    for (int k = 0; k < 100; ++k) {
+      input.append(Path::line(Point(i, k), Point(i, k + 1)));
+      input.append(Path::line(Point(k, i), Point(k + 1, i)));
+    }
+  }
+  QVector<Path> output = TangentPathJoiner::join(input);
+  int segments = 0;
+  foreach (const Path& path, output) {
+    segments += path.getVertices().count() - 1;
+  }
+  EXPECT_EQ(input.count(), segments);
+  EXPECT_EQ(str(output), str(TangentPathJoiner::join(input)));
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
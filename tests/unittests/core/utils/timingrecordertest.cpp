@@ -0,0 +1,133 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/core/utils/timingrecorder.h>
+
+#include <QtConcurrent>
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class TimingRecorderTest : public ::testing::Test {
+protected:
+  virtual void TearDown() override { TimingRecorder::instance().stop(); }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(TimingRecorderTest, testNotRecording) {
+  TimingRecorder& recorder = TimingRecorder::instance();
+  recorder.start();
+  recorder.stop();
+  { TimingScope scope("ignored"); }
+  EXPECT_FALSE(recorder.isRecording());
+  EXPECT_EQ(0, recorder.getEvents().count());
+}
+
+TEST_F(TimingRecorderTest, testNestedScopes) {
+  TimingRecorder& recorder = TimingRecorder::instance();
+  recorder.start();
+  {
+    TimingScope outer("outer", "detail");
+    { TimingScope inner1("inner1"); }
+    { TimingScope inner2("inner2"); }
+  }
+  recorder.stop();
+
+  // Events are added when the scopes are left.
+  const QVector<TimingRecorder::Event> events = recorder.getEvents();
+  ASSERT_EQ(3, events.count());
+  EXPECT_EQ("inner1", events[0].name.toStdString());
+  EXPECT_EQ(1, events[0].depth);
+  EXPECT_EQ("inner2", events[1].name.toStdString());
+  EXPECT_EQ(1, events[1].depth);
+  EXPECT_EQ("outer", events[2].name.toStdString());
+  EXPECT_EQ("detail", events[2].detail.toStdString());
+  EXPECT_EQ(0, events[2].depth);
+  EXPECT_LE(events[2].startUs, events[0].startUs);
+  EXPECT_LE(events[1].startUs + events[1].durationUs,
+            events[2].startUs + events[2].durationUs);
+
+  // Summary is ordered by start time and indented by depth.
+  const QStringList lines = recorder.toSummary().split("\n");
+  ASSERT_EQ(3, lines.count());
+  EXPECT_TRUE(lines[0].startsWith("outer (detail): "));
+  EXPECT_TRUE(lines[1].startsWith("  inner1: "));
+  EXPECT_TRUE(lines[2].startsWith("  inner2: "));
+}
+
+TEST_F(TimingRecorderTest, testChromeTrace) {
+  TimingRecorder& recorder = TimingRecorder::instance();
+  recorder.start();
+  { TimingScope scope("scope"); }
+  recorder.stop();
+
+  QJsonParseError error;
+  const QJsonDocument doc =
+      QJsonDocument::fromJson(recorder.toChromeTrace(), &error);
+  ASSERT_EQ(QJsonParseError::NoError, error.error);
+  const QJsonArray events = doc.object().value("traceEvents").toArray();
+  ASSERT_EQ(1, events.count());
+  const QJsonObject event = events.first().toObject();
+  EXPECT_EQ("scope", event.value("name").toString().toStdString());
+  EXPECT_EQ("X", event.value("ph").toString().toStdString());
+  EXPECT_TRUE(event.contains("ts"));
+  EXPECT_TRUE(event.contains("dur"));
+}
+
+TEST_F(TimingRecorderTest, testMultipleThreads) {
+  TimingRecorder& recorder = TimingRecorder::instance();
+  recorder.start();
+  {
+    TimingScope scope("main");
+    QFuture<void> future =
+        QtConcurrent::run([]() { TimingScope scope("worker"); });
+    future.waitForFinished();
+  }
+  recorder.stop();
+
+  const QVector<TimingRecorder::Event> events = recorder.getEvents();
+  ASSERT_EQ(2, events.count());
+  EXPECT_EQ("worker", events[0].name.toStdString());
+  EXPECT_EQ(0, events[0].depth);  // Depth is per thread.
+  EXPECT_EQ("main", events[1].name.toStdString());
+  EXPECT_NE(events[0].thread, events[1].thread);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
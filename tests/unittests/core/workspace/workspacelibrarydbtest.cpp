@@ -90,6 +90,36 @@ protected:
     return s.join(", ").toStdString();
   }
 
+  std::string str(const QHash<FilePath, QString>& hash) {
+    QStringList s;
+    for (auto it = hash.constBegin(); it != hash.constEnd(); it++) {
+      s.append(it.key().toRelative(mWsDir) % " -> " % it.value());
+    }
+    s.sort();
+    return s.join(", ").toStdString();
+  }
+
+  std::string str(const QList<WorkspaceLibraryDb::Category>& categories) {
+    QStringList s;
+    foreach (const WorkspaceLibraryDb::Category& cat, categories) {
+      s.append(cat.filePath.toRelative(mWsDir) % " (" %
+               (cat.parent ? cat.parent->toStr() : QString("root")) %
+               "): " % cat.name % ", " % cat.description);
+    }
+    s.sort();
+    return s.join(", ").toStdString();
+  }
+
+  std::string str(const QHash<tl::optional<Uuid>, int>& counts) {
+    QStringList s;
+    for (auto it = counts.constBegin(); it != counts.constEnd(); it++) {
+      s.append((it.key() ? it.key()->toStr() : QString("none")) % ": " %
+               QString::number(it.value()));
+    }
+    s.sort();
+    return s.join(", ").toStdString();
+  }
+
   FilePath toAbs(const QString& fp) { return mWsDir.getPathTo(fp); }
 
   Uuid uuid(int index = -1) {
@@ -560,6 +590,81 @@ TEST_F(WorkspaceLibraryDbTest, testGetTranslationsNullptr) {
   EXPECT_EQ("_k", keywords.toStdString());
 }
 
+/*******************************************************************************
+ *  Tests for getAllNames()
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllNamesEmptyDb) {
+  EXPECT_EQ("", str(mWsDb->getAllNames<Library>({})));
+  EXPECT_EQ("", str(mWsDb->getAllNames<ComponentCategory>({})));
+  EXPECT_EQ("", str(mWsDb->getAllNames<PackageCategory>({})));
+  EXPECT_EQ("", str(mWsDb->getAllNames<Symbol>({})));
+  EXPECT_EQ("", str(mWsDb->getAllNames<Package>({})));
+  EXPECT_EQ("", str(mWsDb->getAllNames<Component>({})));
+  EXPECT_EQ("", str(mWsDb->getAllNames<Device>({})));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllNames) {
+  int id = mWriter->addElement<Symbol>(0, toAbs("sym1"), uuid(),
+                                       version("0.1"), false);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("_n"), "_d", "_k");
+  mWriter->addTranslation<Symbol>(id, "de_DE", ElementName("de_n"), "de_d",
+                                  "de_k");
+  id = mWriter->addElement<Symbol>(0, toAbs("sym2"), uuid(), version("0.1"),
+                                   false);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("_n2"), "_d", "_k");
+  id = mWriter->addElement<Symbol>(0, toAbs("sym3"), uuid(), version("0.1"),
+                                   false);
+  mWriter->addTranslation<Symbol>(id, "de_DE", tl::nullopt, "de_d",
+                                  tl::nullopt);
+  mWriter->addElement<Symbol>(0, toAbs("sym4"), uuid(), version("0.1"), false);
+  mWriter->addElement<Package>(0, toAbs("pkg"), uuid(), version("0.1"), false);
+
+  EXPECT_EQ("sym1 -> _n, sym2 -> _n2, sym3 -> , sym4 -> ",
+            str(mWsDb->getAllNames<Symbol>({})));
+  EXPECT_EQ("sym1 -> de_n, sym2 -> _n2, sym3 -> , sym4 -> ",
+            str(mWsDb->getAllNames<Symbol>({"de_DE"})));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllNamesWithLibrary) {
+  int lib1 = mWriter->addLibrary(toAbs("lib1"), uuid(), version("0.1"), false,
+                                 QByteArray());
+  int lib2 = mWriter->addLibrary(toAbs("lib2"), uuid(), version("0.1"), false,
+                                 QByteArray());
+  int id = mWriter->addElement<Symbol>(lib1, toAbs("lib1/sym"), uuid(),
+                                       version("0.1"), false);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("n1"), "", "");
+  id = mWriter->addElement<Symbol>(lib2, toAbs("lib2/sym"), uuid(),
+                                   version("0.1"), false);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("n2"), "", "");
+
+  EXPECT_EQ("lib2/sym -> n2",
+            str(mWsDb->getAllNames<Symbol>({}, toAbs("lib2"))));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllNamesMatchesGetTranslations) {
+  for (int i = 0; i < 10; ++i) {
+    int id = mWriter->addElement<Symbol>(0, toAbs(QString("sym%1").arg(i)),
+                                         uuid(), version("0.1"), false);
+    if (i % 2) {
+      mWriter->addTranslation<Symbol>(id, "", ElementName("n"), "", "");
+    }
+    if (i % 3) {
+      mWriter->addTranslation<Symbol>(
+          id, "de_DE", ElementName(QString("de_n%1").arg(i)), "", "");
+    }
+  }
+
+  const QStringList localeOrder = {"de_DE"};
+  QHash<FilePath, QString> expected;
+  foreach (const FilePath& fp, mWsDb->getAll<Symbol>()) {
+    QString name;
+    mWsDb->getTranslations<Symbol>(fp, localeOrder, &name);
+    expected.insert(fp, name);
+  }
+  EXPECT_EQ(str(expected), str(mWsDb->getAllNames<Symbol>(localeOrder)));
+}
+
 /*******************************************************************************
  *  Tests for getMetadata()
  ******************************************************************************/
@@ -861,6 +966,64 @@ TEST_F(WorkspaceLibraryDbTest, testGetChildsDuplicatesWithoutUuid) {
             str(mWsDb->getChilds<ComponentCategory>(tl::nullopt)));
 }
 
+/*******************************************************************************
+ *  Tests for getCategories()
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testGetCategoriesEmptyDb) {
+  EXPECT_EQ("", str(mWsDb->getCategories<ComponentCategory>({})));
+  EXPECT_EQ("", str(mWsDb->getCategories<PackageCategory>({})));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetCategories) {
+  int id = mWriter->addCategory<ComponentCategory>(
+      0, toAbs("cmpcat1"), uuid(1), version("0.1"), false, tl::nullopt);
+  mWriter->addTranslation<ComponentCategory>(id, "", ElementName("n1"), "d1",
+                                             "");
+  mWriter->addTranslation<ComponentCategory>(id, "de_DE", ElementName("de1"),
+                                             tl::nullopt, tl::nullopt);
+  id = mWriter->addCategory<ComponentCategory>(0, toAbs("cmpcat2"), uuid(2),
+                                               version("0.1"), false, uuid(1));
+  mWriter->addTranslation<ComponentCategory>(id, "", ElementName("n2"), "d2",
+                                             "");
+  mWriter->addCategory<ComponentCategory>(0, toAbs("cmpcat3"), uuid(3),
+                                          version("0.1"), false, uuid(4));
+  mWriter->addCategory<PackageCategory>(0, toAbs("pkgcat"), uuid(5),
+                                        version("0.1"), false, tl::nullopt);
+
+  EXPECT_EQ(str(QList<WorkspaceLibraryDb::Category>{
+                WorkspaceLibraryDb::Category{uuid(1), tl::nullopt,
+                                             toAbs("cmpcat1"), "de1", "d1"},
+                WorkspaceLibraryDb::Category{uuid(2), uuid(1),
+                                             toAbs("cmpcat2"), "n2", "d2"},
+                WorkspaceLibraryDb::Category{uuid(3), tl::nullopt,
+                                             toAbs("cmpcat3"), "", ""},
+            }),
+            str(mWsDb->getCategories<ComponentCategory>({"de_DE"})));
+  EXPECT_EQ(str(QList<WorkspaceLibraryDb::Category>{
+                WorkspaceLibraryDb::Category{uuid(5), tl::nullopt,
+                                             toAbs("pkgcat"), "", ""},
+            }),
+            str(mWsDb->getCategories<PackageCategory>({})));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetCategoriesReturnsLatestVersion) {
+  int id = mWriter->addCategory<ComponentCategory>(
+      0, toAbs("cmpcat1"), uuid(1), version("0.2"), false, tl::nullopt);
+  mWriter->addTranslation<ComponentCategory>(id, "", ElementName("new"), "",
+                                             "");
+  id = mWriter->addCategory<ComponentCategory>(1, toAbs("cmpcat2"), uuid(1),
+                                               version("0.1"), false, uuid(2));
+  mWriter->addTranslation<ComponentCategory>(id, "", ElementName("old"), "",
+                                             "");
+
+  EXPECT_EQ(str(QList<WorkspaceLibraryDb::Category>{
+                WorkspaceLibraryDb::Category{uuid(1), tl::nullopt,
+                                             toAbs("cmpcat1"), "new", ""},
+            }),
+            str(mWsDb->getCategories<ComponentCategory>({})));
+}
+
 /*******************************************************************************
  *  Tests for getByCategory()
  ******************************************************************************/
@@ -969,6 +1132,46 @@ TEST_F(WorkspaceLibraryDbTest, testGetByCategoryDuplicates) {
             str(mWsDb->getByCategory<Component>(tl::nullopt)));
 }
 
+/*******************************************************************************
+ *  Tests for getElementCountPerCategory()
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testGetElementCountPerCategoryEmptyDb) {
+  EXPECT_EQ("", str(mWsDb->getElementCountPerCategory<Symbol>()));
+  EXPECT_EQ("", str(mWsDb->getElementCountPerCategory<Package>()));
+  EXPECT_EQ("", str(mWsDb->getElementCountPerCategory<Component>()));
+  EXPECT_EQ("", str(mWsDb->getElementCountPerCategory<Device>()));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetElementCountPerCategory) {
+  mWriter->addCategory<ComponentCategory>(0, toAbs("cmpcat1"), uuid(1),
+                                          version("0.1"), false, tl::nullopt);
+  mWriter->addCategory<ComponentCategory>(0, toAbs("cmpcat2"), uuid(2),
+                                          version("0.1"), false, tl::nullopt);
+  int sym = mWriter->addElement<Symbol>(0, toAbs("sym1"), uuid(3),
+                                        version("0.1"), false);
+  mWriter->addToCategory<Symbol>(sym, uuid(1));
+  mWriter->addToCategory<Symbol>(sym, uuid(2));
+  sym = mWriter->addElement<Symbol>(1, toAbs("sym2"), uuid(3), version("0.2"),
+                                    false);
+  mWriter->addToCategory<Symbol>(sym, uuid(1));
+  sym = mWriter->addElement<Symbol>(0, toAbs("sym3"), uuid(4), version("0.1"),
+                                    false);
+  mWriter->addToCategory<Symbol>(sym, uuid(1));
+  sym = mWriter->addElement<Symbol>(0, toAbs("sym4"), uuid(5), version("0.1"),
+                                    false);
+  mWriter->addToCategory<Symbol>(sym, uuid(6));
+  mWriter->addElement<Symbol>(0, toAbs("sym5"), uuid(7), version("0.1"), false);
+
+  QHash<tl::optional<Uuid>, int> expected;
+  expected.insert(uuid(1), 2);
+  expected.insert(uuid(2), 1);
+  expected.insert(uuid(6), 1);
+  expected.insert(tl::nullopt, 2);
+  EXPECT_EQ(str(expected), str(mWsDb->getElementCountPerCategory<Symbol>()));
+  EXPECT_EQ("", str(mWsDb->getElementCountPerCategory<Component>()));
+}
+
 /*******************************************************************************
  *  Tests for getComponentDevices()
  ******************************************************************************/
@@ -86,7 +86,9 @@ TEST_F(WorkspaceSettingsTest, testLoadFromSExpressionCurrentVersion) {
       " (application_locale \"de_CH\")\n"
       " (default_length_unit micrometers)\n"
       " (project_autosave_interval 120)\n"
+      " (project_undo_memory_budget 64)\n"
       " (use_opengl true)\n"
+      " (use_tile_cache true)\n"
       " (library_locale_order\n"
       "  (locale \"de_DE\")\n"
       " )\n"
@@ -118,7 +120,9 @@ TEST_F(WorkspaceSettingsTest, testLoadFromSExpressionCurrentVersion) {
   EXPECT_EQ("de_CH", obj.applicationLocale.get());
   EXPECT_EQ(LengthUnit::micrometers(), obj.defaultLengthUnit.get());
   EXPECT_EQ(120U, obj.projectAutosaveIntervalSeconds.get());
+  EXPECT_EQ(64U, obj.projectUndoMemoryBudgetMb.get());
   EXPECT_EQ(true, obj.useOpenGl.get());
+  EXPECT_EQ(true, obj.useTileCache.get());
   EXPECT_EQ(QStringList{"de_DE"}, obj.libraryLocaleOrder.get());
   EXPECT_EQ(QStringList{"IEC 60617"}, obj.libraryNormOrder.get());
   EXPECT_EQ(QList<QUrl>{QUrl("https://api.librepcb.org")},
@@ -140,7 +144,9 @@ TEST_F(WorkspaceSettingsTest, testStoreAndLoad) {
   obj1.applicationLocale.set("de_CH");
   obj1.defaultLengthUnit.set(LengthUnit::nanometers());
   obj1.projectAutosaveIntervalSeconds.set(1234);
+  obj1.projectUndoMemoryBudgetMb.set(42);
   obj1.useOpenGl.set(!obj1.useOpenGl.get());
+  obj1.useTileCache.set(!obj1.useTileCache.get());
   obj1.libraryLocaleOrder.set({"de_CH", "en_US"});
   obj1.libraryNormOrder.set({"foo", "bar"});
   obj1.repositoryUrls.set({QUrl("https://foo"), QUrl("https://bar")});
@@ -160,7 +166,10 @@ TEST_F(WorkspaceSettingsTest, testStoreAndLoad) {
   EXPECT_EQ(obj1.defaultLengthUnit.get(), obj2.defaultLengthUnit.get());
   EXPECT_EQ(obj1.projectAutosaveIntervalSeconds.get(),
             obj2.projectAutosaveIntervalSeconds.get());
+  EXPECT_EQ(obj1.projectUndoMemoryBudgetMb.get(),
+            obj2.projectUndoMemoryBudgetMb.get());
   EXPECT_EQ(obj1.useOpenGl.get(), obj2.useOpenGl.get());
+  EXPECT_EQ(obj1.useTileCache.get(), obj2.useTileCache.get());
   EXPECT_EQ(obj1.libraryLocaleOrder.get(), obj2.libraryLocaleOrder.get());
   EXPECT_EQ(obj1.libraryNormOrder.get(), obj2.libraryNormOrder.get());
   EXPECT_EQ(obj1.repositoryUrls.get(), obj2.repositoryUrls.get());
@@ -21,9 +21,11 @@
  *  Includes
  ******************************************************************************/
 #include <gtest/gtest.h>
+#include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/eagleimport/eaglelibraryimport.h>
 
 #include <QtCore>
+#include <QtXml>
 
 /*******************************************************************************
  *  Namespace
@@ -36,7 +38,102 @@ namespace tests {
  *  Test Class
  ******************************************************************************/
 
-class EagleLibraryImportTest : public ::testing::Test {};
+class EagleLibraryImportTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+
+  EagleLibraryImportTest() : mTmpDir(FilePath::getRandomTempPath()) {}
+
+  virtual ~EagleLibraryImportTest() {
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  /**
+   * @brief Write a copy of a library with each element duplicated
+   *
+   * Used to get enough elements of each type to be imported by several
+   * threads in parallel.
+   */
+  static void writeDuplicatedLibrary(const FilePath& src, const FilePath& dst,
+                                     int copies) {
+    QDomDocument doc;
+    ASSERT_TRUE(doc.setContent(FileUtils::readFile(src)));
+    const QDomElement library = doc.documentElement()
+                                    .firstChildElement("drawing")
+                                    .firstChildElement("library");
+    foreach (const QString& list,
+             QStringList({"packages", "symbols", "devicesets"})) {
+      QDomElement parent = library.firstChildElement(list);
+      QList<QDomElement> originals;
+      for (QDomElement e = parent.firstChildElement(); !e.isNull();
+           e = e.nextSiblingElement()) {
+        originals.append(e);
+      }
+      for (int i = 1; i < copies; ++i) {
+        const QString suffix = QString("_%1").arg(i);
+        foreach (const QDomElement& original, originals) {
+          QDomElement copy = original.cloneNode(true).toElement();
+          appendToAttribute(copy, "name", suffix);
+          // Let devices refer to the duplicated symbols and packages.
+          appendToChildAttributes(copy, "gate", "symbol", suffix);
+          appendToChildAttributes(copy, "device", "package", suffix);
+          parent.appendChild(copy);
+        }
+      }
+    }
+    FileUtils::writeFile(dst, doc.toByteArray());
+  }
+
+  static void appendToAttribute(QDomElement& element, const QString& name,
+                                const QString& suffix) {
+    if (element.hasAttribute(name)) {
+      element.setAttribute(name, element.attribute(name) + suffix);
+    }
+  }
+
+  static void appendToChildAttributes(const QDomElement& parent,
+                                      const QString& tag, const QString& name,
+                                      const QString& suffix) {
+    const QDomNodeList children = parent.elementsByTagName(tag);
+    for (int i = 0; i < children.count(); ++i) {
+      QDomElement child = children.at(i).toElement();
+      appendToAttribute(child, name, suffix);
+    }
+  }
+
+  static void checkAll(EagleLibraryImport& import) {
+    foreach (const auto& element, import.getSymbols()) {
+      import.setSymbolChecked(element.displayName, true);
+    }
+    foreach (const auto& element, import.getPackages()) {
+      import.setPackageChecked(element.displayName, true);
+    }
+    foreach (const auto& element, import.getComponents()) {
+      import.setComponentChecked(element.displayName, true);
+    }
+    foreach (const auto& element, import.getDevices()) {
+      import.setDeviceChecked(element.displayName, true);
+    }
+  }
+
+  /**
+   * @brief Read all files of a directory, except the creation timestamps
+   */
+  static QMap<QString, QByteArray> readFiles(const FilePath& dir) {
+    QMap<QString, QByteArray> files;
+    foreach (const FilePath& fp,
+             FileUtils::getFilesInDirectory(dir, QStringList(), true)) {
+      QList<QByteArray> lines = FileUtils::readFile(fp).split('\n');
+      for (int i = lines.count() - 1; i >= 0; --i) {
+        if (lines.at(i).trimmed().startsWith("(created ")) {
+          lines.removeAt(i);
+        }
+      }
+      files.insert(fp.toRelative(dir), lines.join('\n'));
+    }
+    return files;
+  }
+};
 
 /*******************************************************************************
  *  Test Methods
@@ -44,7 +141,7 @@ class EagleLibraryImportTest : public ::testing::Test {};
 
 TEST_F(EagleLibraryImportTest, testImport) {
   FilePath src(TEST_DATA_DIR "/unittests/eagleimport/resistor.lbr");
-  FilePath dst = FilePath::getRandomTempPath();
+  FilePath dst = mTmpDir.getPathTo("dst");
 
   EagleLibraryImport import(dst);
 
@@ -70,6 +167,66 @@ TEST_F(EagleLibraryImportTest, testImport) {
   EXPECT_EQ(0, importErrors.count());
 }
 
+TEST_F(EagleLibraryImportTest, testParallelImportEqualsSerialImport) {
+  FilePath src = mTmpDir.getPathTo("duplicated.lbr");
+  writeDuplicatedLibrary(
+      FilePath(TEST_DATA_DIR "/unittests/eagleimport/resistor.lbr"), src, 20);
+  FilePath serialDst = mTmpDir.getPathTo("serial");
+  FilePath parallelDst = mTmpDir.getPathTo("parallel");
+
+  EagleLibraryImport serial(serialDst);
+  serial.setUuidSeed("seed");
+  serial.setMaxThreadCount(1);
+  serial.open(src);
+  checkAll(serial);
+  serial.start();
+  EXPECT_TRUE(serial.wait(10000));
+
+  EagleLibraryImport parallel(parallelDst);
+  parallel.setUuidSeed("seed");
+  parallel.setMaxThreadCount(4);
+  parallel.open(src);
+  EXPECT_EQ(20, parallel.getSymbols().count());
+  EXPECT_EQ(20, parallel.getPackages().count());
+  EXPECT_EQ(20, parallel.getComponents().count());
+  EXPECT_EQ(20, parallel.getDevices().count());
+  checkAll(parallel);
+  parallel.start();
+  EXPECT_TRUE(parallel.wait(10000));
+
+  QMap<QString, QByteArray> serialFiles = readFiles(serialDst);
+  QMap<QString, QByteArray> parallelFiles = readFiles(parallelDst);
+  EXPECT_FALSE(serialFiles.isEmpty());
+  EXPECT_EQ(serialFiles.keys().join("\n").toStdString(),
+            parallelFiles.keys().join("\n").toStdString());
+  EXPECT_TRUE(serialFiles == parallelFiles);
+}
+
+TEST_F(EagleLibraryImportTest, testRandomUuidsWithoutSeed) {
+  FilePath src(TEST_DATA_DIR "/unittests/eagleimport/resistor.lbr");
+  FilePath dst1 = mTmpDir.getPathTo("dst1");
+  FilePath dst2 = mTmpDir.getPathTo("dst2");
+
+  EagleLibraryImport import1(dst1);
+  import1.open(src);
+  checkAll(import1);
+  import1.start();
+  EXPECT_TRUE(import1.wait(10000));
+
+  EagleLibraryImport import2(dst2);
+  import2.open(src);
+  checkAll(import2);
+  import2.start();
+  EXPECT_TRUE(import2.wait(10000));
+
+  QMap<QString, QByteArray> files1 = readFiles(dst1);
+  QMap<QString, QByteArray> files2 = readFiles(dst2);
+  EXPECT_EQ(files1.count(), files2.count());
+  foreach (const QString& file, files1.keys()) {
+    EXPECT_FALSE(files2.contains(file)) << file.toStdString();
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
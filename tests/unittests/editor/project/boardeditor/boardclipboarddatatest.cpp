@@ -220,6 +220,44 @@ TEST(BoardClipboardDataTest, testToFromMimeDataPopulated) {
   EXPECT_EQ(obj1.getStrokeTexts(), obj2->getStrokeTexts());
   EXPECT_EQ(obj1.getHoles(), obj2->getHoles());
   EXPECT_EQ(obj1.getPadPositions(), obj2->getPadPositions());
+
+  // Load from MIME data of another application and validate
+  QMimeData mime2;
+  foreach (const QString& format, mime1->formats()) {
+    mime2.setData(format, mime1->data(format));
+  }
+  std::unique_ptr<BoardClipboardData> obj3 =
+      BoardClipboardData::fromMimeData(&mime2);
+  EXPECT_EQ(uuid, obj3->getBoardUuid());
+  EXPECT_EQ(pos, obj3->getCursorPos());
+  EXPECT_EQ(obj1.getDevices(), obj3->getDevices());
+  EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+  EXPECT_EQ(obj1.getPlanes(), obj3->getPlanes());
+  EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+  EXPECT_EQ(obj1.getStrokeTexts(), obj3->getStrokeTexts());
+  EXPECT_EQ(obj1.getHoles(), obj3->getHoles());
+  EXPECT_EQ(obj1.getPadPositions(), obj3->getPadPositions());
+}
+
+TEST(BoardClipboardDataTest, testFromMimeDataReturnsIndependentCopy) {
+  BoardClipboardData obj1(Uuid::createRandom(), Point(1, 2));
+  obj1.getPolygons().append(std::make_shared<Polygon>(
+      Uuid::createRandom(), GraphicsLayerName("foo"), UnsignedLength(1), false,
+      true,
+      Path({Vertex(Point(1, 2), Angle(3)), Vertex(Point(4, 5), Angle(6))})));
+  std::unique_ptr<QMimeData> mime = obj1.toMimeData();
+
+  // Modifying the original object must not modify the MIME data.
+  obj1.getPolygons().clear();
+  std::unique_ptr<BoardClipboardData> obj2 =
+      BoardClipboardData::fromMimeData(mime.get());
+  EXPECT_EQ(1, obj2->getPolygons().count());
+
+  // Modifying a pasted object must not modify the MIME data.
+  obj2->getPolygons().clear();
+  std::unique_ptr<BoardClipboardData> obj3 =
+      BoardClipboardData::fromMimeData(mime.get());
+  EXPECT_EQ(1, obj3->getPolygons().count());
 }
 
 /*******************************************************************************
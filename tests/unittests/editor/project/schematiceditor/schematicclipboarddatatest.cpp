@@ -187,6 +187,42 @@ TEST(SchematicClipboardDataTest, testToFromMimeDataPopulated) {
   EXPECT_EQ(obj1.getSymbolInstances(), obj2->getSymbolInstances());
   EXPECT_EQ(obj1.getPolygons(), obj2->getPolygons());
   EXPECT_EQ(obj1.getTexts(), obj2->getTexts());
+
+  // Load from MIME data of another application and validate
+  QMimeData mime2;
+  foreach (const QString& format, mime1->formats()) {
+    mime2.setData(format, mime1->data(format));
+  }
+  std::unique_ptr<SchematicClipboardData> obj3 =
+      SchematicClipboardData::fromMimeData(&mime2);
+  EXPECT_EQ(uuid, obj3->getSchematicUuid());
+  EXPECT_EQ(pos, obj3->getCursorPos());
+  EXPECT_EQ(obj1.getComponentInstances(), obj3->getComponentInstances());
+  EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+  EXPECT_EQ(obj1.getSymbolInstances(), obj3->getSymbolInstances());
+  EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+  EXPECT_EQ(obj1.getTexts(), obj3->getTexts());
+}
+
+TEST(SchematicClipboardDataTest, testFromMimeDataReturnsIndependentCopy) {
+  SchematicClipboardData obj1(Uuid::createRandom(), Point(1, 2));
+  obj1.getPolygons().append(std::make_shared<Polygon>(
+      Uuid::createRandom(), GraphicsLayerName("foo"), UnsignedLength(1), false,
+      true,
+      Path({Vertex(Point(1, 2), Angle(3)), Vertex(Point(4, 5), Angle(6))})));
+  std::unique_ptr<QMimeData> mime = obj1.toMimeData();
+
+  // Modifying the original object must not modify the MIME data.
+  obj1.getPolygons().clear();
+  std::unique_ptr<SchematicClipboardData> obj2 =
+      SchematicClipboardData::fromMimeData(mime.get());
+  EXPECT_EQ(1, obj2->getPolygons().count());
+
+  // Modifying a pasted object must not modify the MIME data.
+  obj2->getPolygons().clear();
+  std::unique_ptr<SchematicClipboardData> obj3 =
+      SchematicClipboardData::fromMimeData(mime.get());
+  EXPECT_EQ(1, obj3->getPolygons().count());
 }
 
 /*******************************************************************************
@@ -0,0 +1,180 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/editor/undocommand.h>
+#include <librepcb/editor/undostack.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class UndoStackTest : public ::testing::Test {
+protected:
+  class TestCommand final : public UndoCommand {
+  public:
+    TestCommand(const QString& text, qint64 size) noexcept
+      : UndoCommand(text), mSize(size) {}
+    qint64 getRetainedSize() const noexcept override { return mSize; }
+
+  private:
+    bool performExecute() override { return true; }
+    void performUndo() override {}
+    void performRedo() override {}
+
+    qint64 mSize;
+  };
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(UndoStackTest, testRetainedSize) {
+  UndoStack stack;
+  stack.execCmd(new TestCommand("a", 100));
+  stack.execCmd(new TestCommand("b", 200));
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ("a", stack.getCommandText(0).toStdString());
+  EXPECT_EQ("b", stack.getCommandText(1).toStdString());
+  EXPECT_EQ("", stack.getCommandText(2).toStdString());
+  EXPECT_EQ(100, stack.getCommandRetainedSize(0));
+  EXPECT_EQ(200, stack.getCommandRetainedSize(1));
+  EXPECT_EQ(0, stack.getCommandRetainedSize(-1));
+  EXPECT_EQ(300, stack.getRetainedSize());
+}
+
+TEST_F(UndoStackTest, testRetainedSizeOfCommandGroup) {
+  UndoStack stack;
+  stack.beginCmdGroup("group");
+  stack.appendToCmdGroup(new TestCommand("a", 1000));
+  stack.appendToCmdGroup(new TestCommand("b", 2000));
+  stack.commitCmdGroup();
+  EXPECT_EQ(1, stack.getCommandCount());
+  EXPECT_GT(stack.getRetainedSize(), 3000);
+}
+
+TEST_F(UndoStackTest, testRetainedSizeAfterRemovingCommands) {
+  UndoStack stack;
+  stack.execCmd(new TestCommand("a", 100));
+  stack.execCmd(new TestCommand("b", 200));
+  stack.undo();
+  stack.execCmd(new TestCommand("c", 400));  // Discards "b".
+  EXPECT_EQ(500, stack.getRetainedSize());
+  stack.beginCmdGroup("group");
+  stack.appendToCmdGroup(new TestCommand("d", 1000));
+  stack.abortCmdGroup();
+  EXPECT_EQ(500, stack.getRetainedSize());
+  stack.clear();
+  EXPECT_EQ(0, stack.getRetainedSize());
+}
+
+TEST_F(UndoStackTest, testUnlimitedByDefault) {
+  UndoStack stack;
+  EXPECT_EQ(0, stack.getMemoryBudget());
+  for (int i = 0; i < 100; ++i) {
+    stack.execCmd(new TestCommand(QString::number(i), 1000000));
+  }
+  EXPECT_EQ(100, stack.getCommandCount());
+}
+
+TEST_F(UndoStackTest, testMemoryBudgetDiscardsOldestCommands) {
+  UndoStack stack;
+  stack.setMemoryBudget(250);
+  for (int i = 0; i < 5; ++i) {
+    stack.execCmd(new TestCommand(QString::number(i), 100));
+  }
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ("3", stack.getCommandText(0).toStdString());
+  EXPECT_EQ("4", stack.getCommandText(1).toStdString());
+  EXPECT_EQ(200, stack.getRetainedSize());
+  stack.undo();
+  stack.undo();
+  EXPECT_FALSE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testMemoryBudgetKeepsMostRecentCommand) {
+  UndoStack stack;
+  stack.setMemoryBudget(10);
+  stack.execCmd(new TestCommand("a", 100));
+  stack.execCmd(new TestCommand("b", 100));
+  EXPECT_EQ(1, stack.getCommandCount());
+  EXPECT_EQ("b", stack.getCommandText(0).toStdString());
+  EXPECT_TRUE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testMemoryBudgetKeepsRedoCommands) {
+  UndoStack stack;
+  for (int i = 0; i < 5; ++i) {
+    stack.execCmd(new TestCommand(QString::number(i), 100));
+  }
+  stack.undo();
+  stack.undo();
+  stack.setMemoryBudget(100);
+  EXPECT_EQ(3, stack.getCommandCount());
+  EXPECT_EQ("2", stack.getCommandText(0).toStdString());
+  EXPECT_TRUE(stack.canUndo());
+  EXPECT_TRUE(stack.canRedo());
+  stack.redo();
+  stack.redo();
+  EXPECT_FALSE(stack.canRedo());
+}
+
+TEST_F(UndoStackTest, testMemoryBudgetDiscardsCleanState) {
+  UndoStack stack;
+  stack.setMemoryBudget(150);
+  EXPECT_TRUE(stack.isClean());
+  stack.execCmd(new TestCommand("a", 100));
+  stack.execCmd(new TestCommand("b", 100));
+  EXPECT_FALSE(stack.isClean());
+  stack.undo();
+  EXPECT_FALSE(stack.canUndo());
+  EXPECT_FALSE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testMemoryBudgetKeepsCleanStateIndex) {
+  UndoStack stack;
+  stack.setMemoryBudget(250);
+  stack.execCmd(new TestCommand("a", 100));
+  stack.execCmd(new TestCommand("b", 100));
+  stack.setClean();
+  stack.execCmd(new TestCommand("c", 100));
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_FALSE(stack.isClean());
+  stack.undo();
+  EXPECT_TRUE(stack.isClean());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb